@@ -0,0 +1,31 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+ELF_SRCS := 
+LD_SRCS := 
+TODISASSEMBLE_SRCS := 
+OBJ_SRCS := 
+S_SRCS := 
+ASM_UPPER_SRCS := 
+TOPREPROCESS_SRCS := 
+ASM_SRCS := 
+C_SRCS := 
+O_SRCS := 
+S_UPPER_SRCS := 
+EXECUTABLES := 
+OBJS := 
+SECONDARY_SIZE := 
+C_DEPS := 
+
+# Every subdirectory with source files must be described here
+SUBDIRS := \
+Project_Settings/Startup_Code \
+SDK/platform/devices/S32K144/startup \
+SDK/platform/devices \
+SDK/platform/drivers/src/clock/S32K1xx \
+SDK/platform/drivers/src/interrupt \
+SDK/platform/drivers/src/pins \
+board \
+src \
+
@@ -0,0 +1,129 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+# Add inputs and outputs from these tool invocations to the build variables 
+C_SRCS += \
+../src/adc_sampler.c \
+../src/adc_scan.c \
+../src/adc_stream.c \
+../src/agg.c \
+../src/anomaly.c \
+../src/bench.c \
+../src/boot_cfg.c \
+../src/clock_gate.c \
+../src/deadline.c \
+../src/dma_alloc.c \
+../src/dsp_stats.c \
+../src/filter.c \
+../src/fmt.c \
+../src/i2c_meter.c \
+../src/i2c_queue.c \
+../src/i2c_speed.c \
+../src/irq_prio.c \
+../src/lcd.c \
+../src/lcd_comp.c \
+../src/lcd_fb.c \
+../src/lcd_glyph.c \
+../src/lcd_gpio.c \
+../src/lcd_multi.c \
+../src/mem_prof.c \
+../src/perf_cfg.c \
+../src/pool.c \
+../src/prof.c \
+../src/sched.c \
+../src/sensor.c \
+../src/sensor_i2c.c \
+../src/sensor_lm35.c \
+../src/spsc.c \
+../src/temp_cal.c \
+../src/temp_conv.c \
+../src/temp_monitor.c \
+../src/wake_mon.c 
+
+OBJS += \
+./src/adc_sampler.o \
+./src/adc_scan.o \
+./src/adc_stream.o \
+./src/agg.o \
+./src/anomaly.o \
+./src/bench.o \
+./src/boot_cfg.o \
+./src/clock_gate.o \
+./src/deadline.o \
+./src/dma_alloc.o \
+./src/dsp_stats.o \
+./src/filter.o \
+./src/fmt.o \
+./src/i2c_meter.o \
+./src/i2c_queue.o \
+./src/i2c_speed.o \
+./src/irq_prio.o \
+./src/lcd.o \
+./src/lcd_comp.o \
+./src/lcd_fb.o \
+./src/lcd_glyph.o \
+./src/lcd_gpio.o \
+./src/lcd_multi.o \
+./src/mem_prof.o \
+./src/perf_cfg.o \
+./src/pool.o \
+./src/prof.o \
+./src/sched.o \
+./src/sensor.o \
+./src/sensor_i2c.o \
+./src/sensor_lm35.o \
+./src/spsc.o \
+./src/temp_cal.o \
+./src/temp_conv.o \
+./src/temp_monitor.o \
+./src/wake_mon.o 
+
+C_DEPS += \
+./src/adc_sampler.d \
+./src/adc_scan.d \
+./src/adc_stream.d \
+./src/agg.d \
+./src/anomaly.d \
+./src/bench.d \
+./src/boot_cfg.d \
+./src/clock_gate.d \
+./src/deadline.d \
+./src/dma_alloc.d \
+./src/dsp_stats.d \
+./src/filter.d \
+./src/fmt.d \
+./src/i2c_meter.d \
+./src/i2c_queue.d \
+./src/i2c_speed.d \
+./src/irq_prio.d \
+./src/lcd.d \
+./src/lcd_comp.d \
+./src/lcd_fb.d \
+./src/lcd_glyph.d \
+./src/lcd_gpio.d \
+./src/lcd_multi.d \
+./src/mem_prof.d \
+./src/perf_cfg.d \
+./src/pool.d \
+./src/prof.d \
+./src/sched.d \
+./src/sensor.d \
+./src/sensor_i2c.d \
+./src/sensor_lm35.d \
+./src/spsc.d \
+./src/temp_cal.d \
+./src/temp_conv.d \
+./src/temp_monitor.d \
+./src/wake_mon.d 
+
+
+# Each subdirectory must supply rules for building sources it contributes
+src/%.o: ../src/%.c
+	@echo 'Building file: $<'
+	@echo 'Invoking: Standard S32DS C Compiler'
+	arm-none-eabi-gcc "@src/main.args" -MMD -MP -MF"$(@:%.o=%.d)" -MT"$@" -o "$@" "$<"
+	@echo 'Finished building: $<'
+	@echo ' '
+
+
@@ -5,6 +5,7 @@
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
 ../board/adc_driver.c \
+../board/adc_irq.c \
 ../board/clock_config.c \
 ../board/edma_driver.c \
 ../board/edma_hw_access.c \
@@ -21,6 +22,7 @@ C_SRCS += \
 
 OBJS += \
 ./board/adc_driver.o \
+./board/adc_irq.o \
 ./board/clock_config.o \
 ./board/edma_driver.o \
 ./board/edma_hw_access.o \
@@ -37,6 +39,7 @@ OBJS += \
 
 C_DEPS += \
 ./board/adc_driver.d \
+./board/adc_irq.d \
 ./board/clock_config.d \
 ./board/edma_driver.d \
 ./board/edma_hw_access.d \
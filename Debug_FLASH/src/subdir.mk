@@ -4,13 +4,145 @@
 
 # Add inputs and outputs from these tool invocations to the build variables 
 C_SRCS += \
-../src/main.c 
+../src/adc_sampler.c \
+../src/adc_scan.c \
+../src/adc_stream.c \
+../src/agg.c \
+../src/anomaly.c \
+../src/bandgap.c \
+../src/boot_cfg.c \
+../src/can_node.c \
+../src/clock_gate.c \
+../src/datalog.c \
+../src/deadline.c \
+../src/dma_alloc.c \
+../src/dsp_stats.c \
+../src/filter.c \
+../src/fmt.c \
+../src/i2c_async.c \
+../src/i2c_meter.c \
+../src/i2c_queue.c \
+../src/i2c_recover.c \
+../src/i2c_slave.c \
+../src/i2c_speed.c \
+../src/irq_prio.c \
+../src/lcd.c \
+../src/lcd_comp.c \
+../src/lcd_fb.c \
+../src/lcd_glyph.c \
+../src/lcd_gpio.c \
+../src/lcd_multi.c \
+../src/main.c \
+../src/mem_prof.c \
+../src/perf_cfg.c \
+../src/pool.c \
+../src/power.c \
+../src/prof.c \
+../src/refresh.c \
+../src/sched.c \
+../src/sensor.c \
+../src/sensor_i2c.c \
+../src/sensor_lm35.c \
+../src/spsc.c \
+../src/telemetry.c \
+../src/temp_cal.c \
+../src/temp_conv.c \
+../src/temp_monitor.c \
+../src/wake_mon.c 
 
 OBJS += \
-./src/main.o 
+./src/adc_sampler.o \
+./src/adc_scan.o \
+./src/adc_stream.o \
+./src/agg.o \
+./src/anomaly.o \
+./src/bandgap.o \
+./src/boot_cfg.o \
+./src/can_node.o \
+./src/clock_gate.o \
+./src/datalog.o \
+./src/deadline.o \
+./src/dma_alloc.o \
+./src/dsp_stats.o \
+./src/filter.o \
+./src/fmt.o \
+./src/i2c_async.o \
+./src/i2c_meter.o \
+./src/i2c_queue.o \
+./src/i2c_recover.o \
+./src/i2c_slave.o \
+./src/i2c_speed.o \
+./src/irq_prio.o \
+./src/lcd.o \
+./src/lcd_comp.o \
+./src/lcd_fb.o \
+./src/lcd_glyph.o \
+./src/lcd_gpio.o \
+./src/lcd_multi.o \
+./src/main.o \
+./src/mem_prof.o \
+./src/perf_cfg.o \
+./src/pool.o \
+./src/power.o \
+./src/prof.o \
+./src/refresh.o \
+./src/sched.o \
+./src/sensor.o \
+./src/sensor_i2c.o \
+./src/sensor_lm35.o \
+./src/spsc.o \
+./src/telemetry.o \
+./src/temp_cal.o \
+./src/temp_conv.o \
+./src/temp_monitor.o \
+./src/wake_mon.o 
 
 C_DEPS += \
-./src/main.d 
+./src/adc_sampler.d \
+./src/adc_scan.d \
+./src/adc_stream.d \
+./src/agg.d \
+./src/anomaly.d \
+./src/bandgap.d \
+./src/boot_cfg.d \
+./src/can_node.d \
+./src/clock_gate.d \
+./src/datalog.d \
+./src/deadline.d \
+./src/dma_alloc.d \
+./src/dsp_stats.d \
+./src/filter.d \
+./src/fmt.d \
+./src/i2c_async.d \
+./src/i2c_meter.d \
+./src/i2c_queue.d \
+./src/i2c_recover.d \
+./src/i2c_slave.d \
+./src/i2c_speed.d \
+./src/irq_prio.d \
+./src/lcd.d \
+./src/lcd_comp.d \
+./src/lcd_fb.d \
+./src/lcd_glyph.d \
+./src/lcd_gpio.d \
+./src/lcd_multi.d \
+./src/main.d \
+./src/mem_prof.d \
+./src/perf_cfg.d \
+./src/pool.d \
+./src/power.d \
+./src/prof.d \
+./src/refresh.d \
+./src/sched.d \
+./src/sensor.d \
+./src/sensor_i2c.d \
+./src/sensor_lm35.d \
+./src/spsc.d \
+./src/telemetry.d \
+./src/temp_cal.d \
+./src/temp_conv.d \
+./src/temp_monitor.d \
+./src/wake_mon.d 
 
 
 # Each subdirectory must supply rules for building sources it contributes
@@ -0,0 +1,34 @@
+################################################################################
+# Automatically-generated file. Do not edit!
+################################################################################
+
+ELF_SRCS := 
+LD_SRCS := 
+TODISASSEMBLE_SRCS := 
+OBJ_SRCS := 
+S_SRCS := 
+ASM_UPPER_SRCS := 
+TOPREPROCESS_SRCS := 
+ASM_SRCS := 
+C_SRCS := 
+O_SRCS := 
+S_UPPER_SRCS := 
+EXECUTABLES := 
+OBJS := 
+SECONDARY_SIZE := 
+C_DEPS := 
+
+# Every subdirectory with source files must be described here
+SUBDIRS := \
+Project_Settings/Startup_Code \
+SDK/platform/devices/S32K144/startup \
+SDK/platform/devices \
+SDK/platform/drivers/src/clock/S32K1xx \
+SDK/platform/drivers/src/interrupt \
+SDK/platform/drivers/src/pins \
+SDK/rtos/FreeRTOS_S32K/Source \
+SDK/rtos/FreeRTOS_S32K/Source/portable/GCC/ARM_CM4F \
+SDK/rtos/FreeRTOS_S32K/Source/portable/MemMang \
+board \
+src \
+
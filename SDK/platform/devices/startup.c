@@ -68,6 +68,94 @@ static volatile uint32_t * const s_vectors[NUMBER_OF_CORES] = FEATURE_INTERRUPT_
  * Code
  ******************************************************************************/
 
+#if !defined(__ARMCC_VERSION)
+/*FUNCTION**********************************************************************
+ * Function Name : init_copy
+ * Description   : Copy a section image from ROM to RAM.
+ * Whole words are copied while both addresses are word-aligned, which the
+ * linker file guarantees for every section copied at startup, so only a
+ * section placed by a different linker file falls back to byte copies.
+ *END**************************************************************************/
+static void init_copy(uint8_t * dst, const uint8_t * src, const uint8_t * src_end)
+{
+    uint32_t * dst_word;
+    const uint32_t * src_word;
+    uint32_t words;
+
+    if (((((uint32_t)dst) | ((uint32_t)src)) & 3U) == 0U)
+    {
+        words = ((uint32_t)(src_end - src)) >> 2U;
+        dst_word = (uint32_t *)dst;
+        src_word = (const uint32_t *)src;
+        /* Four words per pass, so the loop overhead is paid once per 16 bytes */
+        while (words >= 4U)
+        {
+            dst_word[0] = src_word[0];
+            dst_word[1] = src_word[1];
+            dst_word[2] = src_word[2];
+            dst_word[3] = src_word[3];
+            dst_word += 4U;
+            src_word += 4U;
+            words -= 4U;
+        }
+        while (words != 0U)
+        {
+            *dst_word = *src_word;
+            dst_word++;
+            src_word++;
+            words--;
+        }
+        dst = (uint8_t *)dst_word;
+        src = (const uint8_t *)src_word;
+    }
+
+    while (src_end != src)
+    {
+        *dst = *src;
+        dst++;
+        src++;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ * Function Name : init_zero
+ * Description   : Clear a RAM section, by whole words when it is aligned.
+ *END**************************************************************************/
+static void init_zero(uint8_t * dst, const uint8_t * dst_end)
+{
+    uint32_t * dst_word;
+    uint32_t words;
+
+    if ((((uint32_t)dst) & 3U) == 0U)
+    {
+        words = ((uint32_t)(dst_end - dst)) >> 2U;
+        dst_word = (uint32_t *)dst;
+        while (words >= 4U)
+        {
+            dst_word[0] = 0U;
+            dst_word[1] = 0U;
+            dst_word[2] = 0U;
+            dst_word[3] = 0U;
+            dst_word += 4U;
+            words -= 4U;
+        }
+        while (words != 0U)
+        {
+            *dst_word = 0U;
+            dst_word++;
+            words--;
+        }
+        dst = (uint8_t *)dst_word;
+    }
+
+    while (dst_end != dst)
+    {
+        *dst = 0U;
+        dst++;
+    }
+}
+#endif
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : init_data_bss
@@ -76,6 +164,9 @@ static volatile uint32_t * const s_vectors[NUMBER_OF_CORES] = FEATURE_INTERRUPT_
  * - Copy initialized data from ROM to RAM.
  * - Copy code that should reside in RAM from ROM
  * - Clear the zero-initialized data section.
+ * Sections are copied and cleared by whole words. Objects placed in the
+ * .noinit section are neither copied nor cleared, so large buffers that are
+ * written before they are read cost no startup time.
  *
  * Tool Chains:
  *   __GNUC__           : GNU Compiler Collection
@@ -178,35 +269,16 @@ void init_data_bss(void)
 
 #if !defined(__ARMCC_VERSION)
     /* Copy initialized data from ROM to RAM */
-    while (data_rom_end != data_rom)
-    {
-        *data_ram = *data_rom;
-        data_ram++;
-        data_rom++;
-    }
+    init_copy(data_ram, data_rom, data_rom_end);
 
     /* Copy functions from ROM to RAM */
-    while (code_rom_end != code_rom)
-    {
-        *code_ram = *code_rom;
-        code_ram++;
-        code_rom++;
-    }
+    init_copy(code_ram, code_rom, code_rom_end);
 
     /* Clear the zero-initialized data section */
-    while(bss_end != bss_start)
-    {
-        *bss_start = 0;
-        bss_start++;
-    }
+    init_zero(bss_start, bss_end);
 
     /* Copy customsection rom to ram */
-    while(custom_rom_end != custom_rom)
-    {
-        *custom_ram = *custom_rom;
-        custom_rom++;
-        custom_ram++;
-    }
+    init_copy(custom_ram, custom_rom, custom_rom_end);
 #endif
     coreId = (uint8_t)GET_CORE_ID();
 #if defined (__ARMCC_VERSION)
@@ -40,6 +40,7 @@
 #include "adc_driver.h"
 #include "adc_hw_access.h"
 #include "clock_manager.h"
+#include "interrupt_manager.h"
 
 
 /*******************************************************************************
@@ -55,6 +56,22 @@
 /* Table of base addresses for ADC instances. */
 static ADC_Type * const s_adcBase[ADC_INSTANCE_COUNT] = ADC_BASE_PTRS;
 
+/* Table of interrupt numbers for ADC instances. */
+static const IRQn_Type s_adcIrqId[ADC_INSTANCE_COUNT] = ADC_IRQS;
+
+/* Conversion complete callbacks and their parameters. */
+static adc_drv_callback_t s_adcCallback[ADC_INSTANCE_COUNT];
+static void * s_adcCallbackParam[ADC_INSTANCE_COUNT];
+
+/*******************************************************************************
+ * Prototypes
+ ******************************************************************************/
+
+/* Conversion complete interrupt path, executed from SRAM to avoid flash wait states */
+START_FUNCTION_DECLARATION_RAMSECTION
+void ADC_DRV_IRQHandler(const uint32_t instance)
+END_FUNCTION_DECLARATION_RAMSECTION
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : ADC_DRV_InitConverterStruct
@@ -761,6 +778,78 @@ uint32_t ADC_DRV_GetTriggerErrorFlags(const uint32_t instance)
     return trig_errors;
 }
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DRV_InstallCallback
+ * Description   : Register conversion complete callback function and parameter,
+ * and enable or disable the ADC interrupt accordingly.
+ *
+ * Implements : ADC_DRV_InstallCallback_Activity
+ *END**************************************************************************/
+void ADC_DRV_InstallCallback(const uint32_t instance,
+                             const adc_drv_callback_t callback,
+                             void * const parameter)
+{
+    DEV_ASSERT(instance < ADC_INSTANCE_COUNT);
+
+    INT_SYS_DisableIRQ(s_adcIrqId[instance]);
+
+    s_adcCallback[instance] = callback;
+    s_adcCallbackParam[instance] = parameter;
+
+    if (callback != NULL)
+    {
+        INT_SYS_EnableIRQ(s_adcIrqId[instance]);
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : ADC_DRV_IRQHandler
+ * Description   : ADC interrupt handler. Reads every completed control channel
+ * with interrupts enabled (clearing its COCO flag) and invokes the callback.
+ * The SC1 and R registers are accessed directly rather than through
+ * ADC_DRV_GetConvCompleteFlag and ADC_DRV_GetChanResult, which stay in flash,
+ * so the path up to the callback runs entirely from SRAM.
+ *
+ * Implements : ADC_DRV_IRQHandler_Activity
+ *END**************************************************************************/
+void ADC_DRV_IRQHandler(const uint32_t instance)
+{
+    DEV_ASSERT(instance < ADC_INSTANCE_COUNT);
+
+    const ADC_Type * const base = s_adcBase[instance];
+    const adc_drv_callback_t callback = s_adcCallback[instance];
+    uint32_t sc1;
+    bool ready;
+    uint16_t result;
+    uint8_t chanIndex;
+
+    for (chanIndex = 0u; chanIndex < ADC_CTRL_CHANS_COUNT; chanIndex++)
+    {
+#if FEATURE_ADC_HAS_EXTRA_NUM_REGS
+        sc1 = base->aSC1[chanIndex];
+        ready = ((sc1 & ADC_aSC1_AIEN_MASK) != 0u) && ((sc1 & ADC_aSC1_COCO_MASK) != 0u);
+#else
+        sc1 = base->SC1[chanIndex];
+        ready = ((sc1 & ADC_SC1_AIEN_MASK) != 0u) && ((sc1 & ADC_SC1_COCO_MASK) != 0u);
+#endif /* FEATURE_ADC_HAS_EXTRA_NUM_REGS */
+        if (ready)
+        {
+            /* Reading the result clears COCO */
+#if FEATURE_ADC_HAS_EXTRA_NUM_REGS
+            result = (uint16_t)((base->aR[chanIndex] & ADC_aR_D_MASK) >> ADC_aR_D_SHIFT);
+#else
+            result = (uint16_t)((base->R[chanIndex] & ADC_R_D_MASK) >> ADC_R_D_SHIFT);
+#endif /* FEATURE_ADC_HAS_EXTRA_NUM_REGS */
+            if (callback != NULL)
+            {
+                callback(instance, chanIndex, result, s_adcCallbackParam[instance]);
+            }
+        }
+    }
+}
+
 /******************************************************************************
  * EOF
  *****************************************************************************/
@@ -330,6 +330,20 @@ typedef enum
     ADC_LATCH_CLEAR_FORCE /*!< Process current trigger and clear all latched */
 } adc_latch_clear_t;
 
+/*!
+ * @brief Conversion complete callback
+ *
+ * Called from the ADC interrupt for each control channel that has its
+ * interrupt enabled and a conversion complete. The result has already been
+ * read, which clears the Conversion Complete flag.
+ *
+ * Implements : adc_drv_callback_t_Class
+ */
+typedef void (*adc_drv_callback_t)(const uint32_t instance,
+                                   const uint8_t chanIndex,
+                                   const uint16_t result,
+                                   void * parameter);
+
 /*******************************************************************************
  * API
  ******************************************************************************/
@@ -769,6 +783,41 @@ uint32_t ADC_DRV_GetTriggerErrorFlags(const uint32_t instance);
 
 /*! @}*/
 
+/*!
+ * @name Interrupt handling
+ * These functions turn conversion complete events into callbacks.
+ */
+/*! @{*/
+
+/*!
+ * @brief Register a conversion complete callback
+ *
+ * This function registers the callback invoked from the ADC interrupt and
+ * enables the interrupt in the interrupt controller; passing NULL disables it.
+ * The interrupt source of each control channel is still selected with
+ * adc_chan_config_t::interruptEnable.
+ *
+ * @param[in] instance instance number of the ADC
+ * @param[in] callback the callback function, or NULL
+ * @param[in] parameter parameter passed to the callback
+ */
+void ADC_DRV_InstallCallback(const uint32_t instance,
+                             const adc_drv_callback_t callback,
+                             void * const parameter);
+
+/*!
+ * @brief ADC interrupt handler
+ *
+ * This function reads the result of every control channel that has its
+ * interrupt enabled and a conversion complete, and passes it to the
+ * installed callback. It is called from the ADC IRQ handlers in adc_irq.c.
+ *
+ * @param[in] instance instance number of the ADC
+ */
+void ADC_DRV_IRQHandler(const uint32_t instance);
+
+/*! @}*/
+
 #if defined (__cplusplus)
 }
 #endif
@@ -0,0 +1,60 @@
+/*
+ * Copyright 2018-2020 NXP
+ * All rights reserved.
+ *
+ * NXP Confidential. This software is owned or controlled by NXP and may only be
+ * used strictly in accordance with the applicable license terms. By expressly
+ * accepting such terms or by downloading, installing, activating and/or otherwise
+ * using the software, you are agreeing that you have read, and that you agree to
+ * comply with and are bound by, such license terms. If you do not agree to be
+ * bound by the applicable license terms, then you may not retain, install,
+ * activate or otherwise use the software. The production use license in
+ * Section 2.3 is expressly granted for this software.
+ */
+
+/*!
+ * @adc_irq.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 8.4, A compatible declaration shall be
+ * visible when an object or function with external linkage is defined.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ */
+
+#include "device_registers.h"
+#include "adc_driver.h"
+#include "adc_irq.h"
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+#if (ADC_INSTANCE_COUNT > 0u)
+/* Executed from SRAM to avoid flash wait states */
+START_FUNCTION_DECLARATION_RAMSECTION
+void ADC0_IRQHandler(void)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+/* Implementation of ADC0 handler named in startup code. */
+void ADC0_IRQHandler(void)
+{
+	ADC_DRV_IRQHandler(0);
+}
+#endif
+
+#if (ADC_INSTANCE_COUNT > 1u)
+/* Implementation of ADC1 handler named in startup code. */
+void ADC1_IRQHandler(void)
+{
+	ADC_DRV_IRQHandler(1);
+}
+#endif
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
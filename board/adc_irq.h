@@ -0,0 +1,37 @@
+/*
+ * Copyright 2018-2020 NXP
+ * All rights reserved.
+ *
+ * NXP Confidential. This software is owned or controlled by NXP and may only be
+ * used strictly in accordance with the applicable license terms. By expressly
+ * accepting such terms or by downloading, installing, activating and/or otherwise
+ * using the software, you are agreeing that you have read, and that you agree to
+ * comply with and are bound by, such license terms. If you do not agree to be
+ * bound by the applicable license terms, then you may not retain, install,
+ * activate or otherwise use the software. The production use license in
+ * Section 2.3 is expressly granted for this software.
+ */
+
+#ifndef ADC_IRQ_H__
+#define ADC_IRQ_H__
+
+#include "device_registers.h"
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+#if (ADC_INSTANCE_COUNT > 0u)
+/* ADC0 handler named in startup code. */
+void ADC0_IRQHandler(void);
+#endif
+
+#if (ADC_INSTANCE_COUNT > 1u)
+/* ADC1 handler named in startup code. */
+void ADC1_IRQHandler(void);
+#endif
+
+#endif /* ADC_IRQ_H__ */
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
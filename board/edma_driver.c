@@ -103,7 +103,13 @@ static edma_state_t * s_virtEdmaState;
 /*******************************************************************************
  * Prototypes
  ******************************************************************************/                                    
-static void EDMA_DRV_ClearIntStatus(uint8_t virtualChannel);
+/* Channel interrupt path, executed from SRAM to avoid flash wait states */
+START_FUNCTION_DECLARATION_RAMSECTION
+static void EDMA_DRV_ClearIntStatus(uint8_t virtualChannel)
+END_FUNCTION_DECLARATION_RAMSECTION
+START_FUNCTION_DECLARATION_RAMSECTION
+void EDMA_DRV_IRQHandler(uint8_t virtualChannel)
+END_FUNCTION_DECLARATION_RAMSECTION
 static void EDMA_DRV_ClearSoftwareTCD(edma_software_tcd_t *stcd);
 static void EDMA_DRV_ClearStructure(uint8_t *sructPtr, size_t size);
 #if defined (CUSTOM_DEVASSERT) || defined (DEV_ERROR_DETECT)
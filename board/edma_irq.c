@@ -69,8 +69,13 @@ void DMA16_31_IRQHandler(void);
 #endif
  
 #ifdef FEATURE_DMA_SEPARATE_IRQ_LINES_PER_CHN
-void DMA0_IRQHandler(void);
-void DMA1_IRQHandler(void);
+/* Channels used by LPI2C0 and the ADC stream run from SRAM */
+START_FUNCTION_DECLARATION_RAMSECTION
+void DMA0_IRQHandler(void)
+END_FUNCTION_DECLARATION_RAMSECTION
+START_FUNCTION_DECLARATION_RAMSECTION
+void DMA1_IRQHandler(void)
+END_FUNCTION_DECLARATION_RAMSECTION
 void DMA2_IRQHandler(void);
 void DMA3_IRQHandler(void);
 #if (FEATURE_DMA_VIRTUAL_CHANNELS > 4U)
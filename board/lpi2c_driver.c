@@ -103,6 +103,13 @@
 #define SETHOLD_MIN_VALUE 2U
 #define BUSIDLE_MAX_VALUE 0xFFFU
 
+#if (LPI2C_MASTER_STATS != 0U)
+/* SCL cycles still on the wire at the end-of-transfer interrupt: the last byte
+   with its acknowledge and the STOP after a send, only the STOP after a receive */
+#define STATS_TX_TAIL_BITS 10U
+#define STATS_RX_TAIL_BITS 1U
+#endif
+
 /* Table of base addresses for LPI2C instances. */
 static LPI2C_Type * const g_lpi2cBase[LPI2C_INSTANCE_COUNT] = LPI2C_BASE_PTRS;
 
@@ -121,7 +128,46 @@ static const IRQn_Type g_lpi2cSlaveIrqId[LPI2C_INSTANCE_COUNT] = LPI2C_SLAVE_IRQ
 static const clock_names_t g_lpi2cClock[LPI2C_INSTANCE_COUNT] = LPI2C_PCC_CLOCKS;
 
 /* Callback for master DMA transfer done.*/
-static void LPI2C_DRV_MasterCompleteDMATransfer(void* parameter, edma_chn_status_t status);
+START_FUNCTION_DECLARATION_RAMSECTION
+static void LPI2C_DRV_MasterCompleteDMATransfer(void* parameter, edma_chn_status_t status)
+END_FUNCTION_DECLARATION_RAMSECTION
+
+/* Master interrupt paths, executed from SRAM to avoid flash wait states */
+START_FUNCTION_DECLARATION_RAMSECTION
+static inline bool LPI2C_DRV_MasterCmdQueueEmpty(const lpi2c_master_state_t * master)
+END_FUNCTION_DECLARATION_RAMSECTION
+START_FUNCTION_DECLARATION_RAMSECTION
+static inline void LPI2C_DRV_MasterSendQueuedCmd(LPI2C_Type *baseAddr, lpi2c_master_state_t * master)
+END_FUNCTION_DECLARATION_RAMSECTION
+START_FUNCTION_DECLARATION_RAMSECTION
+static void LPI2C_DRV_MasterQueueData(LPI2C_Type *baseAddr, lpi2c_master_state_t * master)
+END_FUNCTION_DECLARATION_RAMSECTION
+#if (LPI2C_MASTER_STATS != 0U)
+START_FUNCTION_DECLARATION_RAMSECTION
+static inline void LPI2C_DRV_MasterStatsEnd(lpi2c_master_state_t * master, bool sendStop, bool resetFIFO)
+END_FUNCTION_DECLARATION_RAMSECTION
+#endif
+START_FUNCTION_DECLARATION_RAMSECTION
+static void LPI2C_DRV_MasterEndTransfer(LPI2C_Type *baseAddr, lpi2c_master_state_t *master,
+                                        bool sendStop, bool resetFIFO)
+END_FUNCTION_DECLARATION_RAMSECTION
+START_FUNCTION_DECLARATION_RAMSECTION
+static void LPI2C_DRV_MasterHandleTransmitDataRequest(LPI2C_Type *baseAddr, lpi2c_master_state_t *master)
+END_FUNCTION_DECLARATION_RAMSECTION
+START_FUNCTION_DECLARATION_RAMSECTION
+static void LPI2C_DRV_MasterHandleReceiveDataReadyEvent(LPI2C_Type *baseAddr, lpi2c_master_state_t *master)
+END_FUNCTION_DECLARATION_RAMSECTION
+START_FUNCTION_DECLARATION_RAMSECTION
+static inline void LPI2C_DRV_MasterHandleEvents(uint32_t instance, LPI2C_Type *baseAddr, lpi2c_master_state_t *master)
+END_FUNCTION_DECLARATION_RAMSECTION
+START_FUNCTION_DECLARATION_RAMSECTION
+void LPI2C_DRV_MasterIRQHandler(uint32_t instance)
+END_FUNCTION_DECLARATION_RAMSECTION
+#if (LPI2C_DIRECT_IRQ != 0U)
+START_FUNCTION_DECLARATION_RAMSECTION
+static void LPI2C_DRV_Master0IRQHandler(void)
+END_FUNCTION_DECLARATION_RAMSECTION
+#endif
 
 /*! @brief Direction of a LPI2C transfer - transmit or receive. */
 typedef enum
@@ -343,6 +389,85 @@ static void LPI2C_DRV_MasterQueueData(LPI2C_Type *baseAddr,
 }
 
 
+#if (LPI2C_MASTER_STATS != 0U)
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LPI2C_DRV_MasterStatsStart
+ * Description   : counts a transfer that is about to start and notes when
+ *                 its START claims the bus; after a repeated START the bus
+ *                 is already held
+ *
+ *END**************************************************************************/
+static inline void LPI2C_DRV_MasterStatsStart(lpi2c_master_state_t * master)
+{
+    master->stats.transfers++;
+    master->stats.txBytes += master->txSize;
+    master->stats.rxBytes += master->rxSize;
+
+    if ((master->busHeld == false) && (master->timestamp != NULL))
+    {
+        master->busyStart = master->timestamp();
+        master->busHeld = true;
+    }
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LPI2C_DRV_MasterStatsEnd
+ * Description   : adds the bus-busy period that ends with this transfer,
+ *                 unless the bus stays held for a repeated START; a transfer
+ *                 ended by an error or an abort adds no tail
+ *
+ *END**************************************************************************/
+static inline void LPI2C_DRV_MasterStatsEnd(lpi2c_master_state_t * master,
+                                            bool sendStop,
+                                            bool resetFIFO)
+{
+    uint32_t tail = 0U;
+
+    if ((master->busHeld == false) || ((sendStop == false) && (resetFIFO == false)))
+    {
+        return;
+    }
+
+    if (resetFIFO == false)
+    {
+        tail = (master->rxBuff != NULL) ? master->rxTailTicks : master->txTailTicks;
+    }
+    master->stats.busyTicks += (uint64_t)(master->timestamp() - master->busyStart) + tail;
+    master->busHeld = false;
+}
+
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LPI2C_DRV_MasterStatsRate
+ * Description   : converts the tail bit times to ticks of the stats clock
+ *                 at the current baud rate
+ *
+ *END**************************************************************************/
+static void LPI2C_DRV_MasterStatsRate(uint32_t instance, lpi2c_master_state_t * master)
+{
+    lpi2c_baud_rate_params_t baudRate;
+
+    master->txTailTicks = 0U;
+    master->rxTailTicks = 0U;
+    if (master->timestamp == NULL)
+    {
+        return;
+    }
+
+    LPI2C_DRV_MasterGetBaudRate(instance, &baudRate);
+    if (baudRate.baudRate != 0U)
+    {
+        master->txTailTicks = (uint32_t)(((uint64_t)STATS_TX_TAIL_BITS * master->timestampHz) / baudRate.baudRate);
+        master->rxTailTicks = (uint32_t)(((uint64_t)STATS_RX_TAIL_BITS * master->timestampHz) / baudRate.baudRate);
+    }
+}
+#endif
+
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : LPI2C_DRV_MasterEndTransfer
@@ -357,6 +482,11 @@ static void LPI2C_DRV_MasterEndTransfer(LPI2C_Type *baseAddr,
     DEV_ASSERT(master != NULL);
     DEV_ASSERT(baseAddr != NULL);
 
+#if (LPI2C_MASTER_STATS != 0U)
+    /* Before the buffers are released, which tells a send from a receive */
+    LPI2C_DRV_MasterStatsEnd(master, sendStop, resetFIFO);
+#endif
+
     /* Disable all events */
     LPI2C_Set_MasterInt(baseAddr, LPI2C_MASTER_FIFO_ERROR_INT |
                                      LPI2C_MASTER_ARBITRATION_LOST_INT |
@@ -731,6 +861,9 @@ static void LPI2C_DRV_MasterCompleteDMATransfer(void* parameter, edma_chn_status
         if(status == EDMA_CHN_ERROR)
         {
             master->status = STATUS_ERROR;
+#if (LPI2C_MASTER_STATS != 0U)
+            master->stats.errors++;
+#endif
         }
         else
         {
@@ -764,6 +897,10 @@ static status_t LPI2C_DRV_MasterReinit(uint32_t instance, lpi2c_master_state_t *
     master->rxBuff = NULL;
     master->rxSize = 0;
     master->i2cIdle = true;
+#if (LPI2C_MASTER_STATS != 0U)
+    /* The aborted reception's bus-busy period cannot be timed any more */
+    master->busHeld = false;
+#endif
 
     LPI2C_DRV_MasterResetQueue(master);
 
@@ -1185,6 +1322,14 @@ status_t LPI2C_DRV_MasterInit(uint32_t instance,
 
     LPI2C_DRV_MasterResetQueue(master);
 
+#if (LPI2C_DIRECT_IRQ != 0U)
+    /* Vector instance 0 straight to its own handler */
+    if (instance == 0U)
+    {
+        INT_SYS_InstallHandler(g_lpi2cMasterIrqId[0U], LPI2C_DRV_Master0IRQHandler, NULL);
+    }
+#endif
+
     /* Enable lpi2c interrupt */
     INT_SYS_EnableIRQ(g_lpi2cMasterIrqId[instance]);
 
@@ -1492,6 +1637,11 @@ status_t LPI2C_DRV_MasterSetBaudRate(uint32_t instance,
 
     /* Re-enable master */
     LPI2C_Set_MasterEnable(baseAddr, true);
+
+#if (LPI2C_MASTER_STATS != 0U)
+    /* The bit time has changed */
+    LPI2C_DRV_MasterStatsRate(instance, g_lpi2cMasterStatePtr[instance]);
+#endif
     
     (void) minPrescaler;
     (void)master;
@@ -1557,6 +1707,9 @@ status_t LPI2C_DRV_MasterSendData(uint32_t instance,
     master->sendStop = sendStop;
     master->i2cIdle = false;
     master->status = STATUS_BUSY;
+#if (LPI2C_MASTER_STATS != 0U)
+    LPI2C_DRV_MasterStatsStart(master);
+#endif
 
     if (master->transferType == LPI2C_USING_DMA)
     {
@@ -1722,6 +1875,9 @@ status_t LPI2C_DRV_MasterReceiveData(uint32_t  instance,
     master->sendStop = sendStop;
     master->rxBuff = rxBuff;
     master->status = STATUS_BUSY;
+#if (LPI2C_MASTER_STATS != 0U)
+    LPI2C_DRV_MasterStatsStart(master);
+#endif
 
     if (master->transferType == LPI2C_USING_DMA)
     {
@@ -1888,23 +2044,77 @@ void LPI2C_DRV_MasterGetDefaultConfig(lpi2c_master_user_config_t * config)
       config->callbackParam = NULL;
 }
 
+#if (LPI2C_MASTER_STATS != 0U)
 /*FUNCTION**********************************************************************
  *
- * Function Name : LPI2C_DRV_MasterIRQHandler
- * Description   : handle non-blocking master operation when I2C interrupt occurs
+ * Function Name : LPI2C_DRV_MasterSetStatsClock
+ * Description   : sets the clock of the bus-busy time and clears the master
+ *                 traffic statistics
  *
+ * Implements : LPI2C_DRV_MasterSetStatsClock_Activity
  *END**************************************************************************/
-void LPI2C_DRV_MasterIRQHandler(uint32_t instance)
+void LPI2C_DRV_MasterSetStatsClock(uint32_t instance, lpi2c_timestamp_t timestamp, uint32_t timestampHz)
 {
-    LPI2C_Type *baseAddr;
     lpi2c_master_state_t * master;
 
     DEV_ASSERT(instance < LPI2C_INSTANCE_COUNT);
 
-    baseAddr = g_lpi2cBase[instance];
     master = g_lpi2cMasterStatePtr[instance];
     DEV_ASSERT(master != NULL);
 
+    INT_SYS_DisableIRQGlobal();
+    master->timestamp = timestamp;
+    master->timestampHz = timestampHz;
+    master->busHeld = false;
+    master->stats.transfers = 0U;
+    master->stats.txBytes = 0U;
+    master->stats.rxBytes = 0U;
+    master->stats.nacks = 0U;
+    master->stats.errors = 0U;
+    master->stats.busyTicks = 0U;
+    LPI2C_DRV_MasterStatsRate(instance, master);
+    INT_SYS_EnableIRQGlobal();
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LPI2C_DRV_MasterGetStats
+ * Description   : copies the master traffic statistics
+ *
+ * The interrupts update several fields at the end of a transfer, so the copy
+ * is taken with them masked.
+ *
+ * Implements : LPI2C_DRV_MasterGetStats_Activity
+ *END**************************************************************************/
+void LPI2C_DRV_MasterGetStats(uint32_t instance, lpi2c_master_stats_t * stats)
+{
+    const lpi2c_master_state_t * master;
+
+    DEV_ASSERT(instance < LPI2C_INSTANCE_COUNT);
+    DEV_ASSERT(stats != NULL);
+
+    master = g_lpi2cMasterStatePtr[instance];
+    DEV_ASSERT(master != NULL);
+
+    INT_SYS_DisableIRQGlobal();
+    *stats = master->stats;
+    if (master->busHeld == true)
+    {
+        /* Held right now: busy up to this call */
+        stats->busyTicks += (uint64_t)(master->timestamp() - master->busyStart);
+    }
+    INT_SYS_EnableIRQGlobal();
+}
+#endif
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LPI2C_DRV_MasterHandleEvents
+ * Description   : services every pending master event of one instance
+ *
+ *END**************************************************************************/
+static inline void LPI2C_DRV_MasterHandleEvents(uint32_t instance, LPI2C_Type *baseAddr, lpi2c_master_state_t *master)
+{
     /* Check which event caused the interrupt */
     if (LPI2C_Get_MasterTransmitDataRequestEvent(baseAddr))
     {
@@ -1943,6 +2153,9 @@ void LPI2C_DRV_MasterIRQHandler(uint32_t instance)
         master->highSpeedInProgress = false;
 #endif
         master->status = STATUS_ERROR;
+#if (LPI2C_MASTER_STATS != 0U)
+        master->stats.errors++;
+#endif
 
         /* End transfer: no stop generation (the module will handle that by itself
            if needed), reset FIFOs */
@@ -1964,6 +2177,9 @@ void LPI2C_DRV_MasterIRQHandler(uint32_t instance)
     {
         /* Arbitration lost */
         LPI2C_Clear_MasterArbitrationLostEvent(baseAddr);
+#if (LPI2C_MASTER_STATS != 0U)
+        master->stats.errors++;
+#endif
 
         /* End transfer: no stop generation (the module will handle that by itself
            if needed), reset FIFOs */
@@ -2003,6 +2219,9 @@ void LPI2C_DRV_MasterIRQHandler(uint32_t instance)
             master->highSpeedInProgress = false;
 #endif
             master->status = STATUS_I2C_RECEIVED_NACK;
+#if (LPI2C_MASTER_STATS != 0U)
+            master->stats.nacks++;
+#endif
 
             /* End transfer: no stop generation (the module will handle that by itself
                if needed), reset FIFOs */
@@ -2021,6 +2240,44 @@ void LPI2C_DRV_MasterIRQHandler(uint32_t instance)
     }
 }
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LPI2C_DRV_MasterIRQHandler
+ * Description   : handle non-blocking master operation when I2C interrupt occurs
+ *
+ *END**************************************************************************/
+void LPI2C_DRV_MasterIRQHandler(uint32_t instance)
+{
+    LPI2C_Type *baseAddr;
+    lpi2c_master_state_t * master;
+
+    DEV_ASSERT(instance < LPI2C_INSTANCE_COUNT);
+
+    baseAddr = g_lpi2cBase[instance];
+    master = g_lpi2cMasterStatePtr[instance];
+    DEV_ASSERT(master != NULL);
+
+    LPI2C_DRV_MasterHandleEvents(instance, baseAddr, master);
+}
+
+#if (LPI2C_DIRECT_IRQ != 0U)
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : LPI2C_DRV_Master0IRQHandler
+ * Description   : master interrupt handler bound to instance 0 in the RAM vector
+ * table; the base address is a constant and the event handling is inlined.
+ *
+ *END**************************************************************************/
+static void LPI2C_DRV_Master0IRQHandler(void)
+{
+    lpi2c_master_state_t * master = g_lpi2cMasterStatePtr[0U];
+
+    DEV_ASSERT(master != NULL);
+
+    LPI2C_DRV_MasterHandleEvents(0U, LPI2C0, master);
+}
+#endif
+
 
 /*FUNCTION**********************************************************************
  *
@@ -55,6 +55,32 @@
  * @{
  */
 
+/*******************************************************************************
+ * Definitions
+ ******************************************************************************/
+
+/*! @brief Bind the LPI2C0 master interrupt straight to an instance-specific handler.
+ *
+ * When set, LPI2C_DRV_MasterInit() installs a handler for instance 0 in the RAM
+ * vector table that skips the instance lookup of LPI2C_DRV_MasterIRQHandler().
+ * Requires the vector table in RAM, which startup sets up unless the image is
+ * linked with __flash_vector_table__.
+ */
+#ifndef LPI2C_DIRECT_IRQ
+#define LPI2C_DIRECT_IRQ  1U
+#endif
+
+/*! @brief Keep traffic statistics for every master instance.
+ *
+ * When set, the driver counts transfers, data bytes, NACKs and errors, and, once
+ * LPI2C_DRV_MasterSetStatsClock() has given it a clock, the time the bus is held
+ * from each START to its STOP. Read them with LPI2C_DRV_MasterGetStats(). They live
+ * in the master context structure, which must then start zeroed, as a static one does.
+ */
+#ifndef LPI2C_MASTER_STATS
+#define LPI2C_MASTER_STATS  1U
+#endif
+
 /*******************************************************************************
  * Enumerations.
  ******************************************************************************/
@@ -163,6 +189,34 @@ typedef struct
 #endif
 } lpi2c_baud_rate_params_t;
 
+#if (LPI2C_MASTER_STATS != 0U)
+/*!
+ * @brief Free-running up-counter the bus-busy time is measured with
+ *
+ * Differences of two readings must be right across a wrap. The counter should keep
+ * its rate in every run mode, which the core cycle counter does not.
+ * Implements : lpi2c_timestamp_t_Class
+ */
+typedef uint32_t (*lpi2c_timestamp_t)(void);
+
+/*!
+ * @brief Master traffic statistics
+ *
+ * Totals since LPI2C_DRV_MasterSetStatsClock(). A write followed by a read with a
+ * repeated START counts as two transfers but one bus-busy period.
+ * Implements : lpi2c_master_stats_t_Class
+ */
+typedef struct
+{
+    uint32_t transfers;                         /*!< Transfers started, each with a START or repeated START */
+    uint32_t txBytes;                           /*!< Data bytes of the send transfers, address bytes not included */
+    uint32_t rxBytes;                           /*!< Data bytes of the receive transfers */
+    uint32_t nacks;                             /*!< Transfers ended by a NACK */
+    uint32_t errors;                            /*!< Transfers ended by a lost arbitration, a FIFO or a DMA error */
+    uint64_t busyTicks;                         /*!< Time from each START to its STOP, in ticks of the stats clock */
+} lpi2c_master_stats_t;
+#endif
+
 /*! @cond DRIVER_INTERNAL_USE_ONLY */
 /* LPI2C master commands */
 typedef enum
@@ -224,6 +278,15 @@ typedef struct
     void *callbackParam;                    /* Parameter for the master callback function */
     bool abortedTransfer;                   /* Specifies if master has aborted transfer */
     uint32_t baudrate;                      /* Baud rate in Hz*/
+#if (LPI2C_MASTER_STATS != 0U)
+    lpi2c_master_stats_t stats;             /* Traffic statistics */
+    lpi2c_timestamp_t timestamp;            /* Clock of the bus-busy time, NULL while it is not measured */
+    uint32_t timestampHz;                   /* Rate of the clock */
+    uint32_t busyStart;                     /* Clock reading at the START that claimed the bus */
+    uint32_t txTailTicks;                   /* Last byte and STOP still on the wire when a send ends */
+    uint32_t rxTailTicks;                   /* STOP still on the wire when a receive ends */
+    bool busHeld;                           /* START sent and STOP not yet */
+#endif
 /*! @endcond */
 } lpi2c_master_state_t;
 
@@ -468,6 +531,33 @@ status_t LPI2C_DRV_MasterGetTransferStatus(uint32_t instance, uint32_t *bytesRem
  */
 void LPI2C_DRV_MasterIRQHandler(uint32_t instance);
 
+#if (LPI2C_MASTER_STATS != 0U)
+/*!
+ * @brief Set the clock of the bus-busy time and clear the master traffic statistics
+ *
+ * Call after LPI2C_DRV_MasterInit(). The statistics are kept across
+ * LPI2C_DRV_MasterDeinit() and LPI2C_DRV_MasterInit(), so a re-initialization does
+ * not clear them. The end-of-transfer interrupt comes while the last bits are
+ * still on the wire; they are added at the rate set by LPI2C_DRV_MasterSetBaudRate().
+ *
+ * @param instance  LPI2C peripheral instance number
+ * @param timestamp  free-running up-counter, or NULL to only count transfers and bytes
+ * @param timestampHz  rate of the counter in Hz
+ */
+void LPI2C_DRV_MasterSetStatsClock(uint32_t instance, lpi2c_timestamp_t timestamp, uint32_t timestampHz);
+
+
+/*!
+ * @brief Get the master traffic statistics
+ *
+ * A bus held right now counts as busy up to this call. Callable from any context.
+ *
+ * @param instance  LPI2C peripheral instance number
+ * @param stats  destination of a consistent copy of the statistics
+ */
+void LPI2C_DRV_MasterGetStats(uint32_t instance, lpi2c_master_stats_t * stats);
+#endif
+
 
 /*!
  * @brief Initialize the I2C slave mode driver
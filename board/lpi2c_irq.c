@@ -60,6 +60,11 @@ void LPI2C0_Master_Slave_IRQHandler(void)
 
 #else
 #if (LPI2C_INSTANCE_COUNT > 0u)
+/* Executed from SRAM to avoid flash wait states */
+START_FUNCTION_DECLARATION_RAMSECTION
+void LPI2C0_Master_IRQHandler(void)
+END_FUNCTION_DECLARATION_RAMSECTION
+
 /* Implementation of LPI2C0 master handler named in startup code. */
 void LPI2C0_Master_IRQHandler(void)
 {
@@ -95,6 +95,29 @@ void OSIF_TimeDelay(const uint32_t delay);
  */
 uint32_t OSIF_GetMilliseconds(void);
 
+/*!
+ * @brief Returns the number of microseconds elapsed since starting the internal timer
+ * or starting the scheduler.
+ *
+ * The count is interpolated within the current tick from the tick timer, so
+ * it follows core clock changes like the millisecond count. It wraps every
+ * 2^32 microseconds (about 71 minutes); compare two readings by unsigned
+ * subtraction.
+ *
+ * @return the number of microseconds elapsed
+ */
+uint32_t OSIF_GetMicroseconds(void);
+
+/*!
+ * @brief Busy-waits for a number of microseconds.
+ *
+ * Meant for waits shorter than a tick; the core does not sleep and, under
+ * an RTOS, no other task of the same or lower priority runs meanwhile.
+ *
+ * @param[in] delay Time delay in microseconds.
+ */
+void OSIF_TimeDelayUs(const uint32_t delay);
+
 /*!
  * @brief Waits for a mutex and locks it.
  *
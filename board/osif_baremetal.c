@@ -68,6 +68,34 @@
 /*! @brief Converts milliseconds to ticks - in this case, one tick = one millisecond */
 #define MSEC_TO_TICK(msec) (msec)
 
+/*! @brief Sleep between ticks in OSIF_TimeDelay instead of busy-waiting.
+ * When enabled, the SysTick reload is stretched over the remaining delay and
+ * the core waits in WFI; set to 0 to restore the original polling loop. */
+#ifndef OSIF_TICKLESS_IDLE
+#define OSIF_TICKLESS_IDLE 1
+#endif
+
+/*! @brief Sleep in OSIF_SemaWait instead of spinning on the counter.
+ * When enabled, the waiter executes WFE between checks and OSIF_SemaPost
+ * issues SEV, so a driver blocked on its semaphore (e.g. a blocking LPI2C
+ * transfer on idleSemaphore) keeps the core in WAIT until an interrupt or a
+ * post wakes it; set to 0 to restore the original polling loop. */
+#ifndef OSIF_SEMA_SLEEP
+#define OSIF_SEMA_SLEEP 1
+#endif
+
+#if (OSIF_SEMA_SLEEP != 0)
+/* WFE returns at once if the event register is set, so a post that lands
+   between the counter check and the WFE is never lost. */
+#if defined (__GNUC__)
+#define osif_WaitForEvent() __asm volatile ("wfe" : : : "memory")
+#define osif_SendEvent() __asm volatile ("sev" : : : "memory")
+#else
+#define osif_WaitForEvent() __asm("wfe")
+#define osif_SendEvent() __asm("sev")
+#endif
+#endif /* (OSIF_SEMA_SLEEP != 0) */
+
 #if (FEATURE_OSIF_USE_SYSTICK != 0) || (FEATURE_OSIF_USE_PIT != 0)
 /* Only include headers for configurations that need them. */
 #include "interrupt_manager.h"
@@ -85,17 +113,37 @@ static inline uint32_t osif_GetCurrentTickCount(void)
     return s_osif_tick_cnt;
 }
 
+/*
+ * Microseconds at a tick count plus the timer cycles elapsed within that
+ * tick. The 32-bit product wraps together with the microsecond count.
+ */
+static inline uint32_t osif_TicksToUs(uint32_t ticks, uint32_t elapsed, uint32_t cycles)
+{
+    if (elapsed > cycles)
+    {
+        elapsed = cycles;
+    }
+
+    return (ticks * 1000u) + ((elapsed * 1000u) / cycles);
+}
+
 #endif /* (FEATURE_OSIF_USE_SYSTICK != 0) || (FEATURE_OSIF_USE_PIT != 0) */
 
 #if FEATURE_OSIF_USE_SYSTICK
 
-void SysTick_Handler(void);
+/* Executed from SRAM to avoid flash wait states */
+START_FUNCTION_DECLARATION_RAMSECTION
+void SysTick_Handler(void)
+END_FUNCTION_DECLARATION_RAMSECTION
 
 void SysTick_Handler(void)
 {
     osif_Tick();
 }
 
+/* Core clock cycles in one tick, as programmed in the SysTick reload register */
+static uint32_t s_osif_tick_cycles = 0u;
+
 static inline void osif_UpdateTickConfig(void)
 {
     uint32_t core_freq = 0u;
@@ -110,7 +158,8 @@ static inline void osif_UpdateTickConfig(void)
     /* For Cortex-M0 devices the systick counter is initialized with an undefined
      value, so make sure to initialize it to 0 before starting */
     S32_SysTick->CSR = S32_SysTick_CSR_ENABLE(0u);
-    S32_SysTick->RVR = S32_SysTick_RVR_RELOAD(core_freq / 1000u);
+    s_osif_tick_cycles = core_freq / 1000u;
+    S32_SysTick->RVR = S32_SysTick_RVR_RELOAD(s_osif_tick_cycles);
     if (first_init)
     {
         /* only initialize CVR on the first entry, to not cause time drift */
@@ -130,6 +179,117 @@ static inline void osif_EnableIrqGlobal(void)
     INT_SYS_EnableIRQGlobal();
 }
 
+/*
+ * Reads the tick count and the SysTick counter as one consistent pair. If
+ * the counter has wrapped but the tick interrupt is still pending (masked,
+ * or called from a higher priority handler), the tick is counted here and
+ * the counter is read again past the wrap.
+ */
+static inline uint32_t osif_GetCurrentUsCount(void)
+{
+    uint32_t cycles = s_osif_tick_cycles;
+    uint32_t ticks;
+    uint32_t current;
+
+    if (cycles == 0u)
+    {
+        /* Timer not started yet */
+        return 0u;
+    }
+
+    osif_DisableIrqGlobal();
+    ticks = s_osif_tick_cnt;
+    current = S32_SysTick->CVR;
+    if ((S32_SCB->ICSR & S32_SCB_ICSR_PENDSTSET_MASK) != 0u)
+    {
+        ticks++;
+        current = S32_SysTick->CVR;
+    }
+    osif_EnableIrqGlobal();
+
+    /* The counter runs down from the reload, which osif_Idle only stretches with interrupts masked */
+    return osif_TicksToUs(ticks, (current < cycles) ? (cycles - current) : 0u, cycles);
+}
+
+/*
+ * Sleeps for up to 'ticks' ticks with the tick interrupt suppressed.
+ * The SysTick reload is stretched so that the next interrupt comes when the
+ * delay expires (bounded by the 24-bit counter), the core enters WAIT through
+ * WFI with SLEEPDEEP cleared, and on wake-up the tick counter is advanced by
+ * the time actually spent asleep. Any other interrupt (eDMA, ADC, LPI2C) ends
+ * the sleep early; the elapsed whole ticks are still accounted for.
+ * STOP/VLPS is not used: SysTick and the bus-clocked PDB, ADC and LPI2C
+ * would stop with the core clock and break the background acquisition.
+ */
+static inline void osif_Idle(uint32_t ticks)
+{
+    uint32_t cycles = s_osif_tick_cycles;
+    uint32_t max_ticks = S32_SysTick_RVR_RELOAD_MASK / cycles;
+    uint32_t remaining;
+    uint32_t reload;
+    uint32_t elapsed;
+    uint32_t next;
+
+    if (ticks > max_ticks)
+    {
+        ticks = max_ticks;
+    }
+
+    S32_SCB->SCR &= ~S32_SCB_SCR_SLEEPDEEP_MASK;
+
+    if (ticks < 2u)
+    {
+        /* The regular tick interrupt is the next wake-up anyway */
+        STANDBY();
+        return;
+    }
+
+    osif_DisableIrqGlobal();
+
+    /* Freeze the counter and keep what is left of the current tick */
+    S32_SysTick->CSR = S32_SysTick_CSR_CLKSOURCE(1u);
+    remaining = S32_SysTick->CVR;
+    if ((remaining == 0u) || ((S32_SCB->ICSR & S32_SCB_ICSR_PENDSTSET_MASK) != 0u))
+    {
+        /* A tick is due right now, let it be counted normally */
+        S32_SysTick->CSR = S32_SysTick_CSR_ENABLE(1u) | S32_SysTick_CSR_TICKINT(1u) | S32_SysTick_CSR_CLKSOURCE(1u);
+        osif_EnableIrqGlobal();
+        return;
+    }
+
+    reload = remaining + (cycles * (ticks - 1u));
+    S32_SysTick->RVR = S32_SysTick_RVR_RELOAD(reload);
+    S32_SysTick->CVR = S32_SysTick_CVR_CURRENT(0u);
+    S32_SysTick->CSR = S32_SysTick_CSR_ENABLE(1u) | S32_SysTick_CSR_TICKINT(1u) | S32_SysTick_CSR_CLKSOURCE(1u);
+
+    /* With interrupts masked WFI still wakes on any pending interrupt */
+    STANDBY();
+
+    S32_SysTick->CSR = S32_SysTick_CSR_CLKSOURCE(1u);
+    if ((S32_SysTick->CSR & S32_SysTick_CSR_COUNTFLAG_MASK) != 0u)
+    {
+        /* Full sleep: the pending SysTick interrupt counts the last tick */
+        s_osif_tick_cnt += ticks - 1u;
+        elapsed = reload - S32_SysTick->CVR;
+        next = (elapsed < cycles) ? (cycles - elapsed) : cycles;
+    }
+    else
+    {
+        /* Early wake-up: count the whole ticks slept, keep the phase of the partial one */
+        elapsed = (cycles - remaining) + (reload - S32_SysTick->CVR);
+        s_osif_tick_cnt += elapsed / cycles;
+        next = cycles - (elapsed % cycles);
+    }
+
+    /* Finish the current tick, then fall back to the regular period */
+    S32_SysTick->RVR = S32_SysTick_RVR_RELOAD(next);
+    S32_SysTick->CVR = S32_SysTick_CVR_CURRENT(0u);
+    S32_SysTick->CSR = S32_SysTick_CSR_ENABLE(1u) | S32_SysTick_CSR_TICKINT(1u) | S32_SysTick_CSR_CLKSOURCE(1u);
+    S32_SysTick->RVR = S32_SysTick_RVR_RELOAD(cycles);
+
+    osif_EnableIrqGlobal();
+}
+
 #elif FEATURE_OSIF_USE_PIT
 
 void OSIF_PIT_IRQHandler(void);
@@ -141,6 +301,9 @@ void OSIF_PIT_IRQHandler(void)
     osif_Tick();
 }
 
+/* Timer cycles in one tick, as loaded into the PIT channel */
+static uint32_t s_osif_tick_cycles = 0u;
+
 static inline void osif_UpdateTickConfig(void)
 {
     uint32_t tick_freq = 0u;
@@ -152,6 +315,7 @@ static inline void osif_UpdateTickConfig(void)
     DEV_ASSERT(tick_freq > 0u);
     (void)clk_status;
     uint32_t tick_1ms = tick_freq / 1000u;
+    s_osif_tick_cycles = tick_1ms;
 
     /* setup timer and enable interrupt */
     base->MCR &= ~PIT_MCR_MDIS(1u); /* make sure module is started */
@@ -174,6 +338,44 @@ static inline void osif_EnableIrqGlobal(void)
     INT_SYS_EnableIRQGlobal();
 }
 
+/*
+ * Reads the tick count and the PIT channel counter as one consistent pair,
+ * counting a tick whose interrupt is still pending as for SysTick.
+ */
+static inline uint32_t osif_GetCurrentUsCount(void)
+{
+    uint32_t cycles = s_osif_tick_cycles;
+    uint32_t ticks;
+    uint32_t current;
+
+    if (cycles == 0u)
+    {
+        /* Timer not started yet */
+        return 0u;
+    }
+
+    osif_DisableIrqGlobal();
+    ticks = s_osif_tick_cnt;
+    current = OSIF_PIT->TIMER[OSIF_PIT_CHAN_ID].CVAL;
+    if ((OSIF_PIT->TIMER[OSIF_PIT_CHAN_ID].TFLG & PIT_TFLG_TIF_MASK) != 0u)
+    {
+        ticks++;
+        current = OSIF_PIT->TIMER[OSIF_PIT_CHAN_ID].CVAL;
+    }
+    osif_EnableIrqGlobal();
+
+    return osif_TicksToUs(ticks, (current < cycles) ? (cycles - current) : 0u, cycles);
+}
+
+static inline void osif_Idle(uint32_t ticks)
+{
+    (void)ticks;
+
+    /* The PIT keeps its 1 ms period, sleep until the next interrupt */
+    S32_SCB->SCR &= ~S32_SCB_SCR_SLEEPDEEP_MASK;
+    STANDBY();
+}
+
 #else /* FEATURE_OSIF_USE_SYSTICK == 0, FEATURE_OSIF_USE_PIT == 0 */
 
 static inline uint32_t osif_GetCurrentTickCount(void)
@@ -181,6 +383,11 @@ static inline uint32_t osif_GetCurrentTickCount(void)
     return 0u;
 }
 
+static inline uint32_t osif_GetCurrentUsCount(void)
+{
+    return 0u;
+}
+
 static inline void osif_UpdateTickConfig(void)
 {
     /* do not update tick */
@@ -190,6 +397,8 @@ static inline void osif_UpdateTickConfig(void)
 
 #define osif_EnableIrqGlobal() (void)0;
 
+#define osif_Idle(ticks) (void)(ticks);
+
 #endif /* FEATURE_OSIF_USE_SYSTICK */
 
 /*! @endcond */
@@ -202,6 +411,8 @@ static inline void osif_UpdateTickConfig(void)
  *
  * Function Name : OSIF_TimeDelay
  * Description   : This function blocks execution for a number of milliseconds.
+ * With OSIF_TICKLESS_IDLE the core sleeps in WFI between wake-ups instead of
+ * polling the tick counter, and no tick interrupts are taken while it waits.
  *
  * Implements : OSIF_TimeDelay_baremetal_Activity
  *END**************************************************************************/
@@ -214,6 +425,9 @@ void OSIF_TimeDelay(const uint32_t delay)
     uint32_t delay_ticks = MSEC_TO_TICK(delay);
     while (delta < delay_ticks)
     {
+#if OSIF_TICKLESS_IDLE
+        osif_Idle(delay_ticks - delta);
+#endif
         crt_ticks = osif_GetCurrentTickCount();
         delta = crt_ticks - start;
     }
@@ -241,6 +455,41 @@ uint32_t OSIF_GetMilliseconds(void)
     return osif_GetCurrentTickCount(); /* This assumes that 1 tick = 1 millisecond */
 }
 
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_GetMicroseconds
+ * Description   : This function returns the number of microseconds elapsed since
+ *                  starting the internal timer: the millisecond tick count plus
+ *                  the part of the current tick read from the timer counter.
+ *                  The timer must be initialized as for OSIF_GetMilliseconds.
+ *
+ * Implements : OSIF_GetMicroseconds_baremetal_Activity
+ *END**************************************************************************/
+uint32_t OSIF_GetMicroseconds(void)
+{
+    return osif_GetCurrentUsCount();
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_TimeDelayUs
+ * Description   : This function busy-waits for a number of microseconds. The
+ *                  elapsed time is taken by unsigned subtraction, so the wait
+ *                  is correct across a wrap of the microsecond count.
+ *
+ * Implements : OSIF_TimeDelayUs_baremetal_Activity
+ *END**************************************************************************/
+void OSIF_TimeDelayUs(const uint32_t delay)
+{
+    osif_UpdateTickConfig();
+    uint32_t start = osif_GetCurrentUsCount();
+    uint32_t delta = 0u;
+    while (delta < delay)
+    {
+        delta = osif_GetCurrentUsCount() - start;
+    }
+}
+
 /*FUNCTION**********************************************************************
  *
  * Function Name : OSIF_MutexLock
@@ -305,6 +554,9 @@ status_t OSIF_MutexDestroy(const mutex_t * const pMutex)
  * Description   : This function performs the 'wait' (decrement) operation on a semaphore.
  *      When timeout value is 0, it's the equivalent of TryWait - try to decrement but return
  *      immediately if it fails (counter is 0).
+ *      With OSIF_SEMA_SLEEP the core waits in WFE between checks; it wakes on
+ *      the SEV of OSIF_SemaPost and on every interrupt, including the tick
+ *      that the timeout is measured with.
  *
  * Implements : OSIF_SemaWait_baremetal_Activity
  *END**************************************************************************/
@@ -342,6 +594,10 @@ status_t OSIF_SemaWait(semaphore_t * const pSem,
         uint32_t start = osif_GetCurrentTickCount();
         uint32_t end = (uint32_t)(start + timeoutTicks);
         uint32_t max = end - start;
+#if (OSIF_SEMA_SLEEP != 0)
+        /* Sleep, not deep sleep: the waker is a peripheral interrupt */
+        S32_SCB->SCR &= ~S32_SCB_SCR_SLEEPDEEP_MASK;
+#endif
         while (*pSem == 0u)
         {
             uint32_t crt_ticks = osif_GetCurrentTickCount();
@@ -352,6 +608,9 @@ status_t OSIF_SemaWait(semaphore_t * const pSem,
                 osif_ret_code = STATUS_TIMEOUT;
                 break;
             }
+#if (OSIF_SEMA_SLEEP != 0)
+            osif_WaitForEvent();
+#endif
         }
     }
 
@@ -369,6 +628,7 @@ status_t OSIF_SemaWait(semaphore_t * const pSem,
  *
  * Function Name : OSIF_SemaPost
  * Description   : This function performs the 'post' (increment) operation on a semaphore.
+ *      With OSIF_SEMA_SLEEP it ends with SEV to wake a waiter sleeping in WFE.
  *
  * Implements : OSIF_SemaPost_baremetal_Activity
  *END**************************************************************************/
@@ -389,6 +649,10 @@ status_t OSIF_SemaPost(semaphore_t * const pSem)
 
     osif_EnableIrqGlobal();
 
+#if (OSIF_SEMA_SLEEP != 0)
+    osif_SendEvent();
+#endif
+
     return osif_ret_code;
 }
 
@@ -0,0 +1,453 @@
+/*
+ * Copyright (c) 2016, Freescale Semiconductor, Inc.
+ * Copyright 2016-2020 NXP
+ * All rights reserved.
+ *
+ * NXP Confidential. This software is owned or controlled by NXP and may only be
+ * used strictly in accordance with the applicable license terms. By expressly
+ * accepting such terms or by downloading, installing, activating and/or otherwise
+ * using the software, you are agreeing that you have read, and that you agree to
+ * comply with and are bound by, such license terms. If you do not agree to be
+ * bound by the applicable license terms, then you may not retain, install,
+ * activate or otherwise use the software. The production use license in
+ * Section 2.3 is expressly granted for this software.
+ */
+
+/*!
+ * @file osif_freertos.c
+ *
+ * @page misra_violations MISRA-C:2012 violations
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Directive 4.9, Function-like macro defined.
+ * The macros are used to convert time units and to select the semaphore handle.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Advisory Rule 8.7, External could be made static.
+ * Function is defined for usage by application code.
+ *
+ * @section [global]
+ * Violates MISRA 2012 Required Rule 11.6, Cast from unsigned int to pointer.
+ * This is required for initializing pointers to the module's memory map, which is located at a
+ * fixed address.
+ *
+ */
+
+#include <stdbool.h>
+#include <stddef.h>
+
+#include "device_registers.h"
+#include "osif.h"
+
+#include "devassert.h"
+
+#if !defined (USING_OS_FREERTOS)
+#error "Wrong OSIF selected. Please define symbol USING_OS_FREERTOS in project settings or change the OSIF variant"
+#endif
+
+#include "FreeRTOS.h"
+#include "task.h"
+#include "semphr.h"
+
+/*******************************************************************************
+ * Private Functions
+ ******************************************************************************/
+
+/*! @cond DRIVER_INTERNAL_USE_ONLY */
+
+/*! @brief Converts milliseconds to ticks */
+#define MSEC_TO_TICK(msec) (pdMS_TO_TICKS(msec))
+
+/*! @brief Kernel handle behind an OSIF mutex or semaphore object */
+#if configSUPPORT_STATIC_ALLOCATION == 1
+#define OSIF_HANDLE(pObj) ((pObj)->handle)
+#else
+#define OSIF_HANDLE(pObj) (*(pObj))
+#endif
+
+/*
+ * Returns true when called from an exception handler, in which case only the
+ * FromISR variants of the kernel API may be used.
+ */
+static inline bool osif_IsIsrContext(void)
+{
+    uint32_t ipsr_code = (uint32_t)((S32_SCB->ICSR & S32_SCB_ICSR_VECTACTIVE_MASK) >> S32_SCB_ICSR_VECTACTIVE_SHIFT);
+
+    return (ipsr_code != 0u);
+}
+
+/*
+ * Converts an OSIF timeout in milliseconds to kernel ticks.
+ */
+static inline TickType_t osif_TimeoutToTicks(const uint32_t timeout)
+{
+    TickType_t timeoutTicks;
+
+    if (timeout == OSIF_WAIT_FOREVER)
+    {
+        timeoutTicks = portMAX_DELAY;
+    }
+    else
+    {
+        timeoutTicks = MSEC_TO_TICK(timeout);
+    }
+
+    return timeoutTicks;
+}
+
+/*! @endcond */
+
+/*******************************************************************************
+ * Code
+ ******************************************************************************/
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_TimeDelay
+ * Description   : This function blocks the calling task for a number of
+ *                  milliseconds; other tasks run meanwhile. It must only be
+ *                  called once the scheduler has been started.
+ *
+ * Implements : OSIF_TimeDelay_freertos_Activity
+ *END**************************************************************************/
+void OSIF_TimeDelay(const uint32_t delay)
+{
+    /* One dependency for FreeRTOS config file */
+    /* INCLUDE_vTaskDelay */
+    vTaskDelay(MSEC_TO_TICK(delay));
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_GetMilliseconds
+ * Description   : This function returns the number of miliseconds elapsed since
+ *                  starting the scheduler.
+ *
+ * Implements : OSIF_GetMilliseconds_freertos_Activity
+ *END**************************************************************************/
+uint32_t OSIF_GetMilliseconds(void)
+{
+    /* This assumes that 1000 is a multiple of configTICK_RATE_HZ or vice versa */
+    return (uint32_t)((((uint64_t)xTaskGetTickCount()) * 1000u) / configTICK_RATE_HZ);
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_GetMicroseconds
+ * Description   : This function returns the number of microseconds elapsed since
+ *                  starting the scheduler: the kernel tick count plus the part
+ *                  of the current tick read from the SysTick counter of the port.
+ *
+ * Implements : OSIF_GetMicroseconds_freertos_Activity
+ *END**************************************************************************/
+uint32_t OSIF_GetMicroseconds(void)
+{
+    uint32_t cycles = S32_SysTick->RVR + 1u;
+    uint32_t current;
+    TickType_t ticks;
+    uint32_t us;
+
+    if ((S32_SysTick->CSR & S32_SysTick_CSR_ENABLE_MASK) == 0u)
+    {
+        /* Scheduler not started yet */
+        return 0u;
+    }
+
+    /* The tick interrupt runs at the kernel priority, masked by the critical section */
+    if (osif_IsIsrContext())
+    {
+        UBaseType_t mask = taskENTER_CRITICAL_FROM_ISR();
+        ticks = xTaskGetTickCountFromISR();
+        current = S32_SysTick->CVR;
+        if ((S32_SCB->ICSR & S32_SCB_ICSR_PENDSTSET_MASK) != 0u)
+        {
+            ticks++;
+            current = S32_SysTick->CVR;
+        }
+        taskEXIT_CRITICAL_FROM_ISR(mask);
+    }
+    else
+    {
+        taskENTER_CRITICAL();
+        ticks = xTaskGetTickCount();
+        current = S32_SysTick->CVR;
+        if ((S32_SCB->ICSR & S32_SCB_ICSR_PENDSTSET_MASK) != 0u)
+        {
+            ticks++;
+            current = S32_SysTick->CVR;
+        }
+        taskEXIT_CRITICAL();
+    }
+
+    /* Wraps with the 32-bit count as long as 1000000 is a multiple of configTICK_RATE_HZ */
+    us = (uint32_t)ticks * (1000000u / configTICK_RATE_HZ);
+    us += (uint32_t)((((uint64_t)(cycles - current)) * (1000000u / configTICK_RATE_HZ)) / cycles);
+
+    return us;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_TimeDelayUs
+ * Description   : This function busy-waits for a number of microseconds without
+ *                  yielding; use OSIF_TimeDelay for waits of a tick or more.
+ *
+ * Implements : OSIF_TimeDelayUs_freertos_Activity
+ *END**************************************************************************/
+void OSIF_TimeDelayUs(const uint32_t delay)
+{
+    uint32_t start = OSIF_GetMicroseconds();
+    uint32_t delta = 0u;
+    while (delta < delay)
+    {
+        delta = OSIF_GetMicroseconds() - start;
+    }
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_MutexLock
+ * Description   : This function obtains the mutex lock or returns error if timeout.
+ *
+ * Implements : OSIF_MutexLock_freertos_Activity
+ *END**************************************************************************/
+status_t OSIF_MutexLock(const mutex_t * const pMutex,
+                        const uint32_t timeout)
+{
+    /* The (pMutex == NULL) case is a valid option, signaling that the mutex does
+     * not need to be locked - do not use DEV_ASSERT in this case */
+    status_t osif_ret_code = STATUS_SUCCESS;
+
+    if (pMutex != NULL)
+    {
+        SemaphoreHandle_t mutex_handle = OSIF_HANDLE(pMutex);
+
+        /* Two dependencies for FreeRTOS config file */
+        /* INCLUDE_xQueueGetMutexHolder */
+        /* INCLUDE_xTaskGetCurrentTaskHandle */
+        if (xSemaphoreGetMutexHolder(mutex_handle) == xTaskGetCurrentTaskHandle())
+        {
+            /* The mutex is not recursive, taking it twice would deadlock */
+            osif_ret_code = STATUS_ERROR;
+        }
+        else if (xSemaphoreTake(mutex_handle, osif_TimeoutToTicks(timeout)) != pdPASS)
+        {
+            osif_ret_code = STATUS_TIMEOUT;
+        }
+        else
+        {
+            /* Mutex taken */
+        }
+    }
+
+    return osif_ret_code;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_MutexUnlock
+ * Description   : This function releases the mutex, if it is held by the calling task.
+ *
+ * Implements : OSIF_MutexUnlock_freertos_Activity
+ *END**************************************************************************/
+status_t OSIF_MutexUnlock(const mutex_t * const pMutex)
+{
+    /* The (pMutex == NULL) case is a valid option, signaling that the mutex does
+     * not need to be unlocked - do not use DEV_ASSERT in this case */
+    status_t osif_ret_code = STATUS_SUCCESS;
+
+    if (pMutex != NULL)
+    {
+        SemaphoreHandle_t mutex_handle = OSIF_HANDLE(pMutex);
+
+        if (xSemaphoreGetMutexHolder(mutex_handle) != xTaskGetCurrentTaskHandle())
+        {
+            osif_ret_code = STATUS_ERROR;
+        }
+        else if (xSemaphoreGive(mutex_handle) != pdPASS)
+        {
+            osif_ret_code = STATUS_ERROR;
+        }
+        else
+        {
+            /* Mutex released */
+        }
+    }
+
+    return osif_ret_code;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_MutexCreate
+ * Description   : This function creates a mutex.
+ *
+ * Implements : OSIF_MutexCreate_freertos_Activity
+ *END**************************************************************************/
+status_t OSIF_MutexCreate(mutex_t * const pMutex)
+{
+    /* The (pMutex == NULL) case is a valid option, signaling that the mutex does
+     * not need to be created - do not use DEV_ASSERT in this case */
+    status_t osif_ret_code = STATUS_SUCCESS;
+
+    if (pMutex != NULL)
+    {
+#if configSUPPORT_STATIC_ALLOCATION == 1
+        pMutex->handle = xSemaphoreCreateMutexStatic(&(pMutex->buffer));
+#else
+        *pMutex = xSemaphoreCreateMutex();
+#endif
+        if (OSIF_HANDLE(pMutex) == NULL)
+        {
+            osif_ret_code = STATUS_ERROR; /* mutex not created successfully */
+        }
+    }
+
+    return osif_ret_code;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_MutexDestroy
+ * Description   : This function destroys a mutex.
+ *
+ * Implements : OSIF_MutexDestroy_freertos_Activity
+ *END**************************************************************************/
+status_t OSIF_MutexDestroy(const mutex_t * const pMutex)
+{
+    /* The (pMutex == NULL) case is a valid option, signaling that the mutex does
+     * not need to be destroyed - do not use DEV_ASSERT in this case */
+    if (pMutex != NULL)
+    {
+        DEV_ASSERT(OSIF_HANDLE(pMutex) != NULL);
+        vSemaphoreDelete(OSIF_HANDLE(pMutex));
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_SemaWait
+ * Description   : This function performs the 'wait' (decrement) operation on a semaphore.
+ *      The calling task is blocked until the semaphore is posted, so the CPU is
+ *      free for other tasks while e.g. a driver transfer completes.
+ *      When timeout value is 0, it's the equivalent of TryWait - try to decrement but return
+ *      immediately if it fails (counter is 0).
+ *
+ * Implements : OSIF_SemaWait_freertos_Activity
+ *END**************************************************************************/
+status_t OSIF_SemaWait(semaphore_t * const pSem,
+                       const uint32_t timeout)
+{
+    DEV_ASSERT(pSem != NULL);
+
+    status_t osif_ret_code = STATUS_SUCCESS;
+    SemaphoreHandle_t sem_handle = OSIF_HANDLE(pSem);
+
+    if (osif_IsIsrContext())
+    {
+        /* Drivers try-wait from their interrupt handlers to reset the semaphore */
+        if (xSemaphoreTakeFromISR(sem_handle, NULL) != pdPASS)
+        {
+            osif_ret_code = STATUS_TIMEOUT;
+        }
+    }
+    else if (xSemaphoreTake(sem_handle, osif_TimeoutToTicks(timeout)) != pdPASS)
+    {
+        osif_ret_code = STATUS_TIMEOUT;
+    }
+    else
+    {
+        /* Semaphore taken */
+    }
+
+    return osif_ret_code;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_SemaPost
+ * Description   : This function performs the 'post' (increment) operation on a semaphore.
+ *      From interrupt context, a task woken by the post is switched to as soon
+ *      as the handler returns.
+ *
+ * Implements : OSIF_SemaPost_freertos_Activity
+ *END**************************************************************************/
+status_t OSIF_SemaPost(semaphore_t * const pSem)
+{
+    DEV_ASSERT(pSem != NULL);
+
+    BaseType_t operation_status;
+    status_t osif_ret_code = STATUS_SUCCESS;
+    SemaphoreHandle_t sem_handle = OSIF_HANDLE(pSem);
+
+    if (osif_IsIsrContext())
+    {
+        BaseType_t taskWoken = pdFALSE;
+        operation_status = xSemaphoreGiveFromISR(sem_handle, &taskWoken);
+        if (operation_status == pdPASS)
+        {
+            portYIELD_FROM_ISR(taskWoken);
+        }
+    }
+    else
+    {
+        operation_status = xSemaphoreGive(sem_handle);
+    }
+
+    if (operation_status != pdPASS)
+    {
+        osif_ret_code = STATUS_ERROR;
+    }
+
+    return osif_ret_code;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_SemaCreate
+ * Description   : This function creates (initializes) a counting semaphore.
+ *
+ * Implements : OSIF_SemaCreate_freertos_Activity
+ *END**************************************************************************/
+status_t OSIF_SemaCreate(semaphore_t * const pSem,
+                         const uint8_t initValue)
+{
+    DEV_ASSERT(pSem != NULL);
+
+    status_t osif_ret_code = STATUS_SUCCESS;
+
+#if configSUPPORT_STATIC_ALLOCATION == 1
+    pSem->handle = xSemaphoreCreateCountingStatic(0xFFu, initValue, &(pSem->buffer));
+#else
+    *pSem = xSemaphoreCreateCounting(0xFFu, initValue);
+#endif
+    if (OSIF_HANDLE(pSem) == NULL)
+    {
+        osif_ret_code = STATUS_ERROR; /* semaphore not created successfully */
+    }
+
+    return osif_ret_code;
+}
+
+/*FUNCTION**********************************************************************
+ *
+ * Function Name : OSIF_SemaDestroy
+ * Description   : This function destroys a semaphore object.
+ *
+ * Implements : OSIF_SemaDestroy_freertos_Activity
+ *END**************************************************************************/
+status_t OSIF_SemaDestroy(const semaphore_t * const pSem)
+{
+    DEV_ASSERT(pSem != NULL);
+    DEV_ASSERT(OSIF_HANDLE(pSem) != NULL);
+
+    vSemaphoreDelete(OSIF_HANDLE(pSem));
+
+    return STATUS_SUCCESS;
+}
+
+/*******************************************************************************
+ * EOF
+ ******************************************************************************/
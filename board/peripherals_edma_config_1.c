@@ -58,6 +58,26 @@ instance:
           - chCallback: 'NULL'
           - chCallbackParam: 'NULL'
           - enableTrigger: 'false'
+        - 1:
+          - chStateStructName: 'dmaControllerChn1_State'
+          - chConfigName: 'dmaControllerChn1_Config'
+          - chType: 'edma_channel_config_t'
+          - virtCh: '1'
+          - chPrio: 'EDMA_CHN_DEFAULT_PRIORITY'
+          - chReq: 'EDMA_REQ_ADC0'
+          - chCallback: 'NULL'
+          - chCallbackParam: 'NULL'
+          - enableTrigger: 'false'
+        - 2:
+          - chStateStructName: 'dmaControllerChn2_State'
+          - chConfigName: 'dmaControllerChn2_Config'
+          - chType: 'edma_channel_config_t'
+          - virtCh: '2'
+          - chPrio: 'EDMA_CHN_DEFAULT_PRIORITY'
+          - chReq: 'EDMA_REQ_LPUART1_TX'
+          - chCallback: 'NULL'
+          - chCallbackParam: 'NULL'
+          - enableTrigger: 'false'
     - quick_selection: 'edma_default'
  * BE CAREFUL MODIFYING THIS COMMENT - IT IS YAML SETTINGS FOR TOOLS **********/
 /* clang-format on */
@@ -74,8 +94,14 @@ edma_state_t dmaController_State;
 
 edma_chn_state_t dmaControllerChn0_State;
 
+edma_chn_state_t dmaControllerChn1_State;
+
+edma_chn_state_t dmaControllerChn2_State;
+
 edma_chn_state_t * const edmaChnStateArray[] = {
     &dmaControllerChn0_State,
+    &dmaControllerChn1_State,
+    &dmaControllerChn2_State,
 };
 
 edma_channel_config_t dmaControllerChn0_Config = {
@@ -87,8 +113,28 @@ edma_channel_config_t dmaControllerChn0_Config = {
     .enableTrigger = false,
 };
 
+edma_channel_config_t dmaControllerChn1_Config = {
+    .channelPriority = EDMA_CHN_DEFAULT_PRIORITY,
+    .virtChnConfig = EDMA_CHN1_NUMBER,
+    .source = EDMA_REQ_ADC0,
+    .callback = NULL,
+    .callbackParam = NULL,
+    .enableTrigger = false,
+};
+
+edma_channel_config_t dmaControllerChn2_Config = {
+    .channelPriority = EDMA_CHN_DEFAULT_PRIORITY,
+    .virtChnConfig = EDMA_CHN2_NUMBER,
+    .source = EDMA_REQ_LPUART1_TX,
+    .callback = NULL,
+    .callbackParam = NULL,
+    .enableTrigger = false,
+};
+
 const edma_channel_config_t * const edmaChnConfigArray[] = {
     &dmaControllerChn0_Config,
+    &dmaControllerChn1_Config,
+    &dmaControllerChn2_Config,
 };
 
 const edma_user_config_t dmaController_InitConfig = {
@@ -16,9 +16,13 @@
  ******************************************************************************/
 /*! @brief Channel number for channel configuration #0 */
 #define EDMA_CHN0_NUMBER   0U
+/*! @brief Channel number for channel configuration #1 */
+#define EDMA_CHN1_NUMBER   1U
+/*! @brief Channel number for channel configuration #2 */
+#define EDMA_CHN2_NUMBER   2U
 
 /*! @brief The total number of configured channels */
-#define EDMA_CONFIGURED_CHANNELS_COUNT  1U
+#define EDMA_CONFIGURED_CHANNELS_COUNT  3U
 
 /*******************************************************************************
  * Global variables 
@@ -29,6 +33,12 @@ extern edma_state_t dmaController_State;
 /*! @brief eDma channel state structure 0. Holds channel runtime data */
 extern edma_chn_state_t dmaControllerChn0_State;
 
+/*! @brief eDma channel state structure 1. Holds channel runtime data */
+extern edma_chn_state_t dmaControllerChn1_State;
+
+/*! @brief eDma channel state structure 2. Holds channel runtime data */
+extern edma_chn_state_t dmaControllerChn2_State;
+
 /*! @brief Array of channel state structures */
 extern edma_chn_state_t * const edmaChnStateArray[EDMA_CONFIGURED_CHANNELS_COUNT];
 
@@ -38,6 +48,12 @@ extern const edma_user_config_t dmaController_InitConfig;
 /*! @brief eDma channel 0 configuration */
 extern edma_channel_config_t dmaControllerChn0_Config;
 
+/*! @brief eDma channel 1 configuration */
+extern edma_channel_config_t dmaControllerChn1_Config;
+
+/*! @brief eDma channel 2 configuration */
+extern edma_channel_config_t dmaControllerChn2_Config;
+
 /*! @brief Array of channel configuration structures */
 extern const edma_channel_config_t * const edmaChnConfigArray[EDMA_CONFIGURED_CHANNELS_COUNT];
 
@@ -47,9 +47,9 @@ instance:
         - lpi2c_master_cfg_is10bitAddr: 'false'
         - lpi2c_master_cfg_operatingMode: 'LPI2C_FAST_MODE'
         - lpi2c_master_cfg_baudRate: '400000'
-        - lpi2c_master_cfg_transferType: 'LPI2C_USING_INTERRUPTS'
+        - lpi2c_master_cfg_transferType: 'LPI2C_USING_DMA'
         - lpi2c_master_cfg_dmaChannel: '0'
-        - lpi2c_master_cfg_masterCallback: 'NULL'
+        - lpi2c_master_cfg_masterCallback: 'I2C_Queue_MasterCallback'
         - lpi2c_master_cfg_callbackParam: 'NULL'
     - slaveConfigurationLPI2C: []
  * BE CAREFUL MODIFYING THIS COMMENT - IT IS YAML SETTINGS FOR TOOLS **********/
@@ -69,9 +69,9 @@ lpi2c_master_user_config_t lpi2c0_MasterConfig0 = {
   .is10bitAddr = false,
   .operatingMode = LPI2C_FAST_MODE,
   .baudRate = 400000UL,
-  .transferType = LPI2C_USING_INTERRUPTS,
+  .transferType = LPI2C_USING_DMA,
   .dmaChannel = 0U,
-  .masterCallback = NULL,
+  .masterCallback = I2C_Queue_MasterCallback,
   .callbackParam = NULL
 };
 
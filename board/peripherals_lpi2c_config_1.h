@@ -33,6 +33,9 @@
 /* Master module configurations */
 extern lpi2c_master_user_config_t lpi2c0_MasterConfig0;
 
+/* Master callback functions */
+extern void I2C_Queue_MasterCallback(i2c_master_event_t event, void *userData);
+
 
 
 #endif /* lpi2c_config_1_H */
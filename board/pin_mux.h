@@ -23,10 +23,16 @@ extern "C" {
 
 /*! @brief Definitions/Declarations for BOARD_InitPins Functional Group */
 /*! @brief User number of configured pins */
-#define NUM_OF_CONFIGURED_PINS0 3
+#define NUM_OF_CONFIGURED_PINS0 7
 /*! @brief User configuration structure */
 extern pin_settings_config_t g_pin_mux_InitConfigArr0[NUM_OF_CONFIGURED_PINS0];
 
+/*! @brief Parallel LCD pins (RS, EN, D4-D7 on PTD2-PTD7), maintained by hand */
+/*! @brief User number of configured pins */
+#define NUM_OF_CONFIGURED_PINS1 6
+/*! @brief User configuration structure */
+extern pin_settings_config_t g_pin_mux_InitConfigArr1[NUM_OF_CONFIGURED_PINS1];
+
 
 #if defined(__cplusplus)
 }
@@ -0,0 +1,51 @@
+/**
+ ******************************************************************************
+ * @file      adc_driver.h
+ * @brief     Host mock of the S32 SDK ADC driver: software-triggered
+ * conversions return the next value of an injected sample stream.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef ADC_DRIVER_H
+#define ADC_DRIVER_H
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+// Only the inputs the application uses; the values are the SDK's
+typedef enum
+{
+    ADC_INPUTCHAN_EXT0      = 0x00U,
+    ADC_INPUTCHAN_EXT12     = 0x0CU,
+    ADC_INPUTCHAN_BANDGAP   = 0x1BU
+} adc_inputchannel_t;
+
+typedef struct
+{
+    bool interruptEnable;
+    adc_inputchannel_t channel;
+} adc_chan_config_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void ADC_DRV_ConfigChan(const uint32_t instance, const uint8_t chanIndex,
+                        const adc_chan_config_t * const config);
+void ADC_DRV_WaitConvDone(const uint32_t instance);
+bool ADC_DRV_GetConvCompleteFlag(const uint32_t instance, const uint8_t chanIndex);
+void ADC_DRV_GetChanResult(const uint32_t instance, const uint8_t chanIndex, uint16_t * const result);
+
+void Mock_ADC_SetStream(const uint16_t *samples, uint32_t count);
+uint32_t Mock_ADC_Conversions(void);
+
+#endif /* ADC_DRIVER_H */
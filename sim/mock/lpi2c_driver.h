@@ -0,0 +1,118 @@
+/**
+ ******************************************************************************
+ * @file      lpi2c_driver.h
+ * @brief     Host mock of the S32 SDK LPI2C master driver: the subset the
+ * application layer calls, plus hooks to read back the recorded bus traffic.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef LPI2C_DRIVER_H
+#define LPI2C_DRIVER_H
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stddef.h>
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+#include "callbacks.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// The mock always keeps the traffic statistics of the SDK driver
+#define LPI2C_MASTER_STATS  1U
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+// As in the SDK; the mock only uses the rate, not the mode
+typedef enum
+{
+    LPI2C_STANDARD_MODE      = 0x0U,
+    LPI2C_FAST_MODE          = 0x1U,
+    LPI2C_FASTPLUS_MODE      = 0x2U,
+    LPI2C_HIGHSPEED_MODE     = 0x3U,
+    LPI2C_ULTRAFAST_MODE     = 0x4U
+} lpi2c_mode_t;
+
+typedef enum
+{
+    LPI2C_USING_DMA         = 0,
+    LPI2C_USING_INTERRUPTS  = 1,
+} lpi2c_transfer_type_t;
+
+typedef struct
+{
+    uint16_t slaveAddress;
+    bool is10bitAddr;
+    lpi2c_mode_t operatingMode;
+    uint32_t baudRate;
+    lpi2c_transfer_type_t transferType;
+    uint8_t dmaChannel;
+    i2c_master_callback_t masterCallback;
+    void *callbackParam;
+} lpi2c_master_user_config_t;
+
+typedef struct
+{
+    uint32_t baudRate;
+} lpi2c_baud_rate_params_t;
+
+// As in the SDK driver with LPI2C_MASTER_STATS
+typedef uint32_t (*lpi2c_timestamp_t)(void);
+
+typedef struct
+{
+    uint32_t transfers;
+    uint32_t txBytes;
+    uint32_t rxBytes;
+    uint32_t nacks;
+    uint32_t errors;
+    uint64_t busyTicks;
+} lpi2c_master_stats_t;
+
+/**
+ * @brief Traffic recorded since the last Mock_LPI2C_Reset().
+ */
+typedef struct
+{
+    uint32_t transactions;  // START to STOP or repeated START, one address byte each
+    uint32_t blocking;      // Of these, through the blocking calls
+    uint32_t tx_bytes;      // Data bytes written, address bytes not included
+    uint32_t rx_bytes;      // Data bytes read
+    uint32_t errors;        // Transfers ended by Mock_LPI2C_FailNext() or an absent address
+    uint64_t wire_ns;       // SCL time of all of them at the configured rate
+} mock_lpi2c_stats_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void LPI2C_DRV_MasterGetBaudRate(uint32_t instance, lpi2c_baud_rate_params_t *baudRate);
+status_t LPI2C_DRV_MasterSetBaudRate(uint32_t instance, const lpi2c_mode_t operatingMode,
+                                     const lpi2c_baud_rate_params_t baudRate);
+void LPI2C_DRV_MasterSetSlaveAddr(uint32_t instance, const uint16_t address, const bool is10bitAddr);
+status_t LPI2C_DRV_MasterSendData(uint32_t instance, const uint8_t *txBuff, uint32_t txSize, bool sendStop);
+status_t LPI2C_DRV_MasterSendDataBlocking(uint32_t instance, const uint8_t *txBuff, uint32_t txSize,
+                                          bool sendStop, uint32_t timeout);
+status_t LPI2C_DRV_MasterAbortTransferData(uint32_t instance);
+status_t LPI2C_DRV_MasterReceiveData(uint32_t instance, uint8_t *rxBuff, uint32_t rxSize, bool sendStop);
+status_t LPI2C_DRV_MasterReceiveDataBlocking(uint32_t instance, uint8_t *rxBuff, uint32_t rxSize,
+                                             bool sendStop, uint32_t timeout);
+status_t LPI2C_DRV_MasterGetTransferStatus(uint32_t instance, uint32_t *bytesRemaining);
+void LPI2C_DRV_MasterSetStatsClock(uint32_t instance, lpi2c_timestamp_t timestamp, uint32_t timestampHz);
+void LPI2C_DRV_MasterGetStats(uint32_t instance, lpi2c_master_stats_t *stats);
+
+void Mock_LPI2C_Reset(void);
+void Mock_LPI2C_GetStats(mock_lpi2c_stats_t *stats);
+void Mock_LPI2C_FailNext(status_t status);
+bool Mock_LPI2C_RunIrq(void);
+void Mock_LPI2C_Drain(void);
+
+#endif /* LPI2C_DRIVER_H */
@@ -0,0 +1,96 @@
+/**
+ ******************************************************************************
+ * @file      mock_adc.c
+ * @brief     Host mock of the S32 SDK ADC driver: software-triggered
+ * conversions return the next value of an injected sample stream.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "adc_driver.h"
+#include <stddef.h>
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static const uint16_t *s_samples;
+static uint32_t s_count;
+static uint32_t s_pos;
+static uint32_t s_conversions;
+
+// Result register of the last conversion
+static uint16_t s_result;
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Starts a conversion: the next stream value becomes the result.
+ */
+void ADC_DRV_ConfigChan(const uint32_t instance, const uint8_t chanIndex,
+                        const adc_chan_config_t * const config)
+{
+    (void)instance;
+    (void)chanIndex;
+    (void)config;
+
+    if (s_count == 0U)
+    {
+        return;
+    }
+    s_result = s_samples[s_pos];
+    s_pos = (s_pos + 1U < s_count) ? (s_pos + 1U) : 0U;
+    s_conversions++;
+}
+
+/**
+ * @brief Conversions complete at once on the host.
+ */
+void ADC_DRV_WaitConvDone(const uint32_t instance)
+{
+    (void)instance;
+}
+
+bool ADC_DRV_GetConvCompleteFlag(const uint32_t instance, const uint8_t chanIndex)
+{
+    (void)instance;
+    (void)chanIndex;
+
+    return true;
+}
+
+void ADC_DRV_GetChanResult(const uint32_t instance, const uint8_t chanIndex, uint16_t * const result)
+{
+    (void)instance;
+    (void)chanIndex;
+
+    *result = s_result;
+}
+
+/**
+ * @brief Injects the values later conversions return, repeated from the
+ * start once used up.
+ * @param samples 12-bit results, kept by reference.
+ * @param count   Number of values; 0 holds the last result.
+ */
+void Mock_ADC_SetStream(const uint16_t *samples, uint32_t count)
+{
+    s_samples = samples;
+    s_count = (samples != NULL) ? count : 0U;
+    s_pos = 0;
+    s_conversions = 0;
+}
+
+/**
+ * @brief Returns the number of conversions since Mock_ADC_SetStream().
+ */
+uint32_t Mock_ADC_Conversions(void)
+{
+    return s_conversions;
+}
@@ -0,0 +1,299 @@
+/**
+ ******************************************************************************
+ * @file      mock_hd44780.c
+ * @brief     Model of the HD44780 behind the PCF8574 backpack, fed with the
+ * port writes the LPI2C mock sees, so the simulation can check what the
+ * display would show.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "mock_hd44780.h"
+#include <string.h>
+#include "lcd.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define MOCK_HD44780_DDRAM      0x80U  // DDRAM addresses, both lines
+#define MOCK_HD44780_CGRAM      0x40U  // CGRAM addresses, 8 patterns of 8 rows
+
+// DDRAM content at power-up, so a missing clear shows up in the checks
+#define MOCK_HD44780_GARBAGE    '#'
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// One controller per backpack on the bus
+typedef struct
+{
+    uint8_t ddram[MOCK_HD44780_DDRAM];
+    uint8_t cgram[MOCK_HD44780_CGRAM];
+    uint8_t addr;
+    bool in_cgram;
+    uint8_t shift;               // Display shifted left by this many cells, 0..LCD_DDRAM_COLS-1
+
+    // Interface state: 8-bit until a function set with DL = 0, then nibble pairs
+    bool four_bit;
+    bool have_high;
+    uint8_t high;
+
+    // Last value on the PCF8574 port
+    uint8_t port;
+
+    uint32_t writes;
+} mock_hd44780_t;
+
+static const uint16_t s_addresses[MOCK_HD44780_COUNT] = { MOCK_HD44780_ADDRESS, MOCK_HD44780_ADDRESS_2 };
+static mock_hd44780_t s_lcds[MOCK_HD44780_COUNT];
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Returns the controller behind an address, or NULL if none answers.
+ */
+static mock_hd44780_t *Mock_HD44780_Find(uint16_t address)
+{
+    uint8_t i;
+
+    for (i = 0; i < MOCK_HD44780_COUNT; i++)
+    {
+        if (s_addresses[i] == address)
+        {
+            return &s_lcds[i];
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Executes one instruction (RS = 0) or data write (RS = 1).
+ */
+static void Mock_HD44780_Execute(mock_hd44780_t *lcd, uint8_t value, bool rs)
+{
+    if (rs)
+    {
+        if (lcd->in_cgram)
+        {
+            lcd->cgram[lcd->addr % MOCK_HD44780_CGRAM] = value;
+            lcd->addr = (uint8_t)((lcd->addr + 1U) % MOCK_HD44780_CGRAM);
+        }
+        else
+        {
+            lcd->ddram[lcd->addr % MOCK_HD44780_DDRAM] = value;
+            lcd->addr = (uint8_t)((lcd->addr + 1U) % MOCK_HD44780_DDRAM);
+        }
+        lcd->writes++;
+        return;
+    }
+
+    if ((value & LCD_SET_DDRAM_ADDR) != 0U)
+    {
+        lcd->addr = value & 0x7FU;
+        lcd->in_cgram = false;
+    }
+    else if ((value & LCD_SET_CGRAM_ADDR) != 0U)
+    {
+        lcd->addr = value & 0x3FU;
+        lcd->in_cgram = true;
+    }
+    else if ((value & LCD_FUNCTION_SET) != 0U)
+    {
+        // DL, bit 4, selects the 8-bit interface
+        lcd->four_bit = (value & 0x10U) == 0U;
+        lcd->have_high = false;
+    }
+    else if ((value & LCD_CURSOR_SHIFT) != 0U)
+    {
+        // S/C, bit 3, moves the display window; cursor-only moves are not used
+        if (value == LCD_SHIFT_LEFT)
+        {
+            lcd->shift = (uint8_t)((lcd->shift + 1U) % LCD_DDRAM_COLS);
+        }
+        else if (value == LCD_SHIFT_RIGHT)
+        {
+            lcd->shift = (uint8_t)((lcd->shift + LCD_DDRAM_COLS - 1U) % LCD_DDRAM_COLS);
+        }
+    }
+    else if (value >= LCD_ENTRY_MODE_SET)
+    {
+        // Display control and entry mode keep their reset meaning here
+    }
+    else if (value >= LCD_RETURN_HOME)
+    {
+        lcd->addr = 0;
+        lcd->in_cgram = false;
+        lcd->shift = 0;
+    }
+    else if (value == LCD_CLEAR_DISPLAY)
+    {
+        memset(lcd->ddram, ' ', sizeof(lcd->ddram));
+        lcd->addr = 0;
+        lcd->in_cgram = false;
+        lcd->shift = 0;
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Returns every controller to its power-up state.
+ */
+void Mock_HD44780_Reset(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < MOCK_HD44780_COUNT; i++)
+    {
+        memset(&s_lcds[i], 0, sizeof(s_lcds[i]));
+        memset(s_lcds[i].ddram, MOCK_HD44780_GARBAGE, sizeof(s_lcds[i].ddram));
+    }
+}
+
+/**
+ * @brief Reports whether a backpack answers at an address.
+ */
+bool Mock_HD44780_IsPresent(uint16_t address)
+{
+    return Mock_HD44780_Find(address) != NULL;
+}
+
+/**
+ * @brief Applies one PCF8574 port write to the controller behind an address.
+ * @details The controller latches D7-D4 on the falling edge of EN. In
+ * 8-bit mode every pulse is a whole instruction with D3-D0 low, as wired on
+ * the backpack; in 4-bit mode two pulses make one byte, high nibble first.
+ * Pulses with RW high are reads, which only the busy-flag poll does.
+ * @param address Backpack the write goes to; ignored if none answers there.
+ * @param port    New port value.
+ */
+void Mock_HD44780_PortWriteTo(uint16_t address, uint8_t port)
+{
+    mock_hd44780_t *lcd = Mock_HD44780_Find(address);
+    uint8_t prev;
+    uint8_t nibble;
+    bool rs;
+
+    if (lcd == NULL)
+    {
+        return;
+    }
+
+    prev = lcd->port;
+    lcd->port = port;
+    if (((prev & LCD_PCF_EN) == 0U) || ((port & LCD_PCF_EN) != 0U) || ((prev & LCD_PCF_RW) != 0U))
+    {
+        return;
+    }
+
+    nibble = prev & 0xF0U;
+    rs = (prev & LCD_PCF_RS) != 0U;
+    if (!lcd->four_bit)
+    {
+        Mock_HD44780_Execute(lcd, nibble, rs);
+    }
+    else if (!lcd->have_high)
+    {
+        lcd->high = nibble;
+        lcd->have_high = true;
+    }
+    else
+    {
+        lcd->have_high = false;
+        Mock_HD44780_Execute(lcd, (uint8_t)(lcd->high | (nibble >> 4)), rs);
+    }
+}
+
+/**
+ * @brief Applies one port write to the display at MOCK_HD44780_ADDRESS.
+ */
+void Mock_HD44780_PortWrite(uint8_t port)
+{
+    Mock_HD44780_PortWriteTo(MOCK_HD44780_ADDRESS, port);
+}
+
+/**
+ * @brief Copies the characters shown on one line of a panel.
+ * @details Lines 3 and 4 of a four-line panel are the second halves of the
+ * controller's two DDRAM lines. A display shift moves the window along the
+ * LCD_DDRAM_COLS cells of each line, wrapping at its end.
+ * @param address Backpack of the panel.
+ * @param row     Display line.
+ * @param cols    Panel width, at most MOCK_HD44780_MAX_COLS.
+ * @param dst     cols + 1 bytes; null-terminated.
+ */
+void Mock_HD44780_GetPanelLine(uint16_t address, uint8_t row, uint8_t cols, char *dst)
+{
+    const mock_hd44780_t *lcd = Mock_HD44780_Find(address);
+    uint8_t line = (uint8_t)((row & 1U) * LCD_ROW1_DDRAM);
+    uint8_t start = (uint8_t)((row >> 1) * cols);
+    uint8_t col;
+
+    for (col = 0; col < cols; col++)
+    {
+        dst[col] = (lcd != NULL)
+                 ? (char)lcd->ddram[line + ((start + col + lcd->shift) % LCD_DDRAM_COLS)] : '\0';
+    }
+    dst[cols] = '\0';
+}
+
+/**
+ * @brief Compares one line of a panel against the expected text, padded
+ * with spaces.
+ */
+bool Mock_HD44780_PanelLineIs(uint16_t address, uint8_t row, uint8_t cols, const char *text)
+{
+    char line[MOCK_HD44780_MAX_COLS + 1U];
+    uint8_t col;
+
+    Mock_HD44780_GetPanelLine(address, row, cols, line);
+    for (col = 0; col < cols; col++)
+    {
+        if (line[col] != ((*text != '\0') ? *text++ : ' '))
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
+
+/**
+ * @brief Copies the characters shown on one line of the display at
+ * MOCK_HD44780_ADDRESS.
+ * @param row Display line (0 or 1).
+ * @param dst LCD_COLS + 1 bytes; null-terminated.
+ */
+void Mock_HD44780_GetLine(uint8_t row, char *dst)
+{
+    Mock_HD44780_GetPanelLine(MOCK_HD44780_ADDRESS, row, LCD_COLS, dst);
+}
+
+/**
+ * @brief Compares one line of the display at MOCK_HD44780_ADDRESS against
+ * the expected text, padded with spaces.
+ */
+bool Mock_HD44780_LineIs(uint8_t row, const char *text)
+{
+    return Mock_HD44780_PanelLineIs(MOCK_HD44780_ADDRESS, row, LCD_COLS, text);
+}
+
+/**
+ * @brief Returns the number of data writes the display at
+ * MOCK_HD44780_ADDRESS executed since the reset.
+ */
+uint32_t Mock_HD44780_Writes(void)
+{
+    return s_lcds[0].writes;
+}
@@ -0,0 +1,49 @@
+/**
+ ******************************************************************************
+ * @file      mock_hd44780.h
+ * @brief     Model of the HD44780 behind the PCF8574 backpack, fed with the
+ * port writes the LPI2C mock sees, so the simulation can check what the
+ * display would show.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef MOCK_HD44780_H_
+#define MOCK_HD44780_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// 7-bit address of the PCF8574 backpack, lpi2c0_MasterConfig0.slaveAddress
+#define MOCK_HD44780_ADDRESS    0x27U
+
+// A second backpack on the bus, for the lcd_multi.c panels; nothing else answers
+#define MOCK_HD44780_ADDRESS_2  0x26U
+#define MOCK_HD44780_COUNT      2U
+
+// Widest panel Mock_HD44780_GetPanelLine() reads, a 2004
+#define MOCK_HD44780_MAX_COLS   20U
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void Mock_HD44780_Reset(void);
+bool Mock_HD44780_IsPresent(uint16_t address);
+void Mock_HD44780_PortWriteTo(uint16_t address, uint8_t port);
+void Mock_HD44780_PortWrite(uint8_t port);
+void Mock_HD44780_GetPanelLine(uint16_t address, uint8_t row, uint8_t cols, char *dst);
+bool Mock_HD44780_PanelLineIs(uint16_t address, uint8_t row, uint8_t cols, const char *text);
+void Mock_HD44780_GetLine(uint8_t row, char *dst);
+bool Mock_HD44780_LineIs(uint8_t row, const char *text);
+uint32_t Mock_HD44780_Writes(void);
+
+#endif /* MOCK_HD44780_H_ */
@@ -0,0 +1,392 @@
+/**
+ ******************************************************************************
+ * @file      mock_lpi2c.c
+ * @brief     Host mock of the S32 SDK LPI2C master driver: the subset the
+ * application layer calls, plus hooks to read back the recorded bus traffic.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "lpi2c_driver.h"
+#include <string.h>
+#include "peripherals_lpi2c_config_1.h"
+#include "osif.h"
+#include "mock_hd44780.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// SCL cycles of one byte and its acknowledge, and of the START and STOP around a transaction
+#define MOCK_LPI2C_BYTE_BITS    9U
+#define MOCK_LPI2C_FRAME_BITS   2U
+
+// Port value read back from the backpack: D7 (the busy flag) low
+#define MOCK_LPI2C_READ_VALUE   0x00U
+
+/*============================================================================*/
+/* Public Variables                               */
+/*============================================================================*/
+
+// As generated in board/peripherals_lpi2c_config_1.c
+lpi2c_master_user_config_t lpi2c0_MasterConfig0 =
+{
+    .slaveAddress = MOCK_HD44780_ADDRESS,
+    .is10bitAddr = false,
+    .operatingMode = LPI2C_FAST_MODE,
+    .baudRate = 400000UL,
+    .transferType = LPI2C_USING_DMA,
+    .dmaChannel = 0U,
+    .masterCallback = I2C_Queue_MasterCallback,
+    .callbackParam = NULL
+};
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static mock_lpi2c_stats_t s_stats;
+
+// What the driver's own statistics would hold; like those, not cleared by
+// Mock_LPI2C_Reset(), only by LPI2C_DRV_MasterSetStatsClock()
+static lpi2c_master_stats_t s_driver_stats;
+static uint64_t s_driver_busy_ns;
+static uint32_t s_driver_hz;
+static uint32_t s_baud_hz = 400000UL;
+static uint16_t s_address = MOCK_HD44780_ADDRESS;
+
+// Non-blocking transfer on the bus until Mock_LPI2C_RunIrq() ends it
+static bool s_pending;
+static bool s_pending_rx;
+static status_t s_pending_status;
+static uint64_t s_pending_ns;
+
+// Result of the last finished transfer, for LPI2C_DRV_MasterGetTransferStatus()
+static status_t s_status = STATUS_SUCCESS;
+
+// Set by Mock_LPI2C_FailNext() for the next transfer only
+static status_t s_fail = STATUS_SUCCESS;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Counts one transaction and returns its wire time.
+ */
+static uint64_t Mock_LPI2C_Account(uint32_t tx_size, uint32_t rx_size)
+{
+    uint64_t bits = ((1ULL + tx_size + rx_size) * MOCK_LPI2C_BYTE_BITS) + MOCK_LPI2C_FRAME_BITS;
+    uint64_t ns = (bits * 1000000000ULL) / s_baud_hz;
+
+    s_stats.transactions++;
+    s_stats.tx_bytes += tx_size;
+    s_stats.rx_bytes += rx_size;
+    s_stats.wire_ns += ns;
+
+    s_driver_stats.transfers++;
+    s_driver_stats.txBytes += tx_size;
+    s_driver_stats.rxBytes += rx_size;
+    s_driver_busy_ns += ns;
+
+    return ns;
+}
+
+/**
+ * @brief Hands written bytes to the display model at the slave address.
+ */
+static void Mock_LPI2C_Deliver(const uint8_t *buf, uint32_t size)
+{
+    uint32_t i;
+
+    for (i = 0; i < size; i++)
+    {
+        Mock_HD44780_PortWriteTo(s_address, buf[i]);
+    }
+}
+
+/**
+ * @brief Takes the status injected for this transfer, if any; an address
+ * no backpack answers to is not acknowledged.
+ */
+static status_t Mock_LPI2C_TakeStatus(void)
+{
+    status_t status = s_fail;
+
+    s_fail = STATUS_SUCCESS;
+    if ((status == STATUS_SUCCESS) && !Mock_HD44780_IsPresent(s_address))
+    {
+        status = STATUS_I2C_RECEIVED_NACK;
+    }
+    if (status == STATUS_I2C_RECEIVED_NACK)
+    {
+        s_stats.errors++;
+        s_driver_stats.nacks++;
+    }
+    else if (status != STATUS_SUCCESS)
+    {
+        s_stats.errors++;
+        s_driver_stats.errors++;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Ends a blocking transfer as the driver does: the master callback
+ * runs from the interrupt, then the call returns.
+ */
+static status_t Mock_LPI2C_FinishBlocking(uint64_t ns, status_t status)
+{
+    s_stats.blocking++;
+    Mock_OSIF_Advance(ns);
+    s_status = status;
+    if (lpi2c0_MasterConfig0.masterCallback != NULL)
+    {
+        lpi2c0_MasterConfig0.masterCallback(I2C_MASTER_EVENT_END_TRANSFER, lpi2c0_MasterConfig0.callbackParam);
+    }
+
+    return s_status;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+void LPI2C_DRV_MasterGetBaudRate(uint32_t instance, lpi2c_baud_rate_params_t *baudRate)
+{
+    (void)instance;
+    baudRate->baudRate = s_baud_hz;
+}
+
+status_t LPI2C_DRV_MasterSetBaudRate(uint32_t instance, const lpi2c_mode_t operatingMode,
+                                     const lpi2c_baud_rate_params_t baudRate)
+{
+    (void)instance;
+    (void)operatingMode;
+
+    if (s_pending || (baudRate.baudRate == 0U))
+    {
+        return STATUS_BUSY;
+    }
+    s_baud_hz = baudRate.baudRate;
+
+    return STATUS_SUCCESS;
+}
+
+void LPI2C_DRV_MasterSetSlaveAddr(uint32_t instance, const uint16_t address, const bool is10bitAddr)
+{
+    (void)instance;
+    (void)is10bitAddr;
+    s_address = address;
+}
+
+/**
+ * @brief Starts a write; it stays on the bus until Mock_LPI2C_RunIrq().
+ * @details The bytes reach the display model at once: nothing else can get
+ * on the bus before the transfer ends, so the order is the same.
+ */
+status_t LPI2C_DRV_MasterSendData(uint32_t instance, const uint8_t *txBuff, uint32_t txSize, bool sendStop)
+{
+    (void)instance;
+    (void)sendStop;
+
+    if (s_pending)
+    {
+        return STATUS_BUSY;
+    }
+
+    s_pending_status = Mock_LPI2C_TakeStatus();
+    if (s_pending_status == STATUS_SUCCESS)
+    {
+        Mock_LPI2C_Deliver(txBuff, txSize);
+    }
+    s_pending_ns = Mock_LPI2C_Account(txSize, 0U);
+    s_pending_rx = false;
+    s_pending = true;
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPI2C_DRV_MasterSendDataBlocking(uint32_t instance, const uint8_t *txBuff, uint32_t txSize,
+                                          bool sendStop, uint32_t timeout)
+{
+    status_t status;
+
+    (void)instance;
+    (void)sendStop;
+    (void)timeout;
+
+    if (s_pending)
+    {
+        return STATUS_BUSY;
+    }
+
+    status = Mock_LPI2C_TakeStatus();
+    if (status == STATUS_SUCCESS)
+    {
+        Mock_LPI2C_Deliver(txBuff, txSize);
+    }
+
+    return Mock_LPI2C_FinishBlocking(Mock_LPI2C_Account(txSize, 0U), status);
+}
+
+/**
+ * @brief Ends the write on the bus with a STOP; a read cannot be aborted.
+ */
+status_t LPI2C_DRV_MasterAbortTransferData(uint32_t instance)
+{
+    (void)instance;
+
+    if (s_pending && s_pending_rx)
+    {
+        return STATUS_UNSUPPORTED;
+    }
+    s_pending = false;
+    s_status = STATUS_I2C_ABORTED;
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPI2C_DRV_MasterReceiveData(uint32_t instance, uint8_t *rxBuff, uint32_t rxSize, bool sendStop)
+{
+    (void)instance;
+    (void)sendStop;
+
+    if (s_pending)
+    {
+        return STATUS_BUSY;
+    }
+
+    memset(rxBuff, MOCK_LPI2C_READ_VALUE, rxSize);
+    s_pending_ns = Mock_LPI2C_Account(0U, rxSize);
+    s_pending_rx = true;
+    s_pending_status = Mock_LPI2C_TakeStatus();
+    s_pending = true;
+
+    return STATUS_SUCCESS;
+}
+
+status_t LPI2C_DRV_MasterReceiveDataBlocking(uint32_t instance, uint8_t *rxBuff, uint32_t rxSize,
+                                             bool sendStop, uint32_t timeout)
+{
+    (void)instance;
+    (void)sendStop;
+    (void)timeout;
+
+    if (s_pending)
+    {
+        return STATUS_BUSY;
+    }
+
+    memset(rxBuff, MOCK_LPI2C_READ_VALUE, rxSize);
+    return Mock_LPI2C_FinishBlocking(Mock_LPI2C_Account(0U, rxSize), Mock_LPI2C_TakeStatus());
+}
+
+status_t LPI2C_DRV_MasterGetTransferStatus(uint32_t instance, uint32_t *bytesRemaining)
+{
+    (void)instance;
+
+    if (bytesRemaining != NULL)
+    {
+        *bytesRemaining = 0U;
+    }
+
+    return s_pending ? STATUS_BUSY : s_status;
+}
+
+/**
+ * @brief Clears the driver statistics; the clock only sets their rate, the
+ * bus-busy time is the modelled wire time.
+ */
+void LPI2C_DRV_MasterSetStatsClock(uint32_t instance, lpi2c_timestamp_t timestamp, uint32_t timestampHz)
+{
+    (void)instance;
+    (void)timestamp;
+
+    memset(&s_driver_stats, 0, sizeof(s_driver_stats));
+    s_driver_busy_ns = 0;
+    s_driver_hz = timestampHz;
+}
+
+/**
+ * @brief Copies the driver statistics; a transfer still pending is counted
+ * in full, a slightly earlier answer than the driver's.
+ */
+void LPI2C_DRV_MasterGetStats(uint32_t instance, lpi2c_master_stats_t *stats)
+{
+    (void)instance;
+
+    *stats = s_driver_stats;
+    stats->busyTicks = (s_driver_busy_ns * s_driver_hz) / 1000000000ULL;
+}
+
+/**
+ * @brief Clears the statistics, the pending transfer and the display model.
+ */
+void Mock_LPI2C_Reset(void)
+{
+    memset(&s_stats, 0, sizeof(s_stats));
+    s_pending = false;
+    s_status = STATUS_SUCCESS;
+    s_fail = STATUS_SUCCESS;
+    s_address = lpi2c0_MasterConfig0.slaveAddress;
+    s_baud_hz = lpi2c0_MasterConfig0.baudRate;
+    Mock_HD44780_Reset();
+}
+
+/**
+ * @brief Copies the traffic recorded since Mock_LPI2C_Reset().
+ */
+void Mock_LPI2C_GetStats(mock_lpi2c_stats_t *stats)
+{
+    *stats = s_stats;
+}
+
+/**
+ * @brief Makes the next transfer end with the given status, e.g.
+ * STATUS_I2C_RECEIVED_NACK, as if its address were not acknowledged: the
+ * wire time is spent but nothing reaches the display.
+ */
+void Mock_LPI2C_FailNext(status_t status)
+{
+    s_fail = status;
+}
+
+/**
+ * @brief Ends the non-blocking transfer on the bus, if any.
+ * @details The simulated clock moves on by its wire time and the master
+ * callback runs, as from the LPI2C0 interrupt; it may start the next one.
+ * @return false if the bus was idle.
+ */
+bool Mock_LPI2C_RunIrq(void)
+{
+    if (!s_pending)
+    {
+        return false;
+    }
+
+    s_pending = false;
+    s_status = s_pending_status;
+    Mock_OSIF_Advance(s_pending_ns);
+    if (lpi2c0_MasterConfig0.masterCallback != NULL)
+    {
+        lpi2c0_MasterConfig0.masterCallback(I2C_MASTER_EVENT_END_TRANSFER, lpi2c0_MasterConfig0.callbackParam);
+    }
+
+    return true;
+}
+
+/**
+ * @brief Runs completions until the bus stays idle.
+ */
+void Mock_LPI2C_Drain(void)
+{
+    while (Mock_LPI2C_RunIrq())
+    {
+    }
+}
@@ -0,0 +1,105 @@
+/**
+ ******************************************************************************
+ * @file      mock_osif.c
+ * @brief     Host mock of the S32 SDK OS interface: a simulated clock that
+ * only moves when the bus or a delay spends time.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "osif.h"
+#include "lpi2c_driver.h"
+#include "sim_port.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Time one poll of OSIF_GetMilliseconds() takes, so a wait with the bus idle still ends
+#define MOCK_OSIF_POLL_NS   1000U
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static uint64_t s_now_ns;
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Sleeps through the delay; a transfer on the bus finishes meanwhile.
+ */
+void OSIF_TimeDelay(const uint32_t delay)
+{
+    Mock_LPI2C_Drain();
+    s_now_ns += (uint64_t)delay * 1000000ULL;
+}
+
+/**
+ * @brief Waits out a short delay; the bus, which the target does not stop
+ * for a busy-wait, finishes its transfer meanwhile.
+ */
+void OSIF_TimeDelayUs(const uint32_t delay)
+{
+    Mock_LPI2C_Drain();
+    s_now_ns += (uint64_t)delay * 1000ULL;
+}
+
+/**
+ * @brief Returns the simulated time in milliseconds.
+ * @details Every wait in the application layer polls this, so the
+ * transfer on the bus completes here, as its interrupt would on the target.
+ */
+uint32_t OSIF_GetMilliseconds(void)
+{
+    if (!Mock_LPI2C_RunIrq())
+    {
+        s_now_ns += MOCK_OSIF_POLL_NS;
+    }
+
+    return (uint32_t)(s_now_ns / 1000000ULL);
+}
+
+/**
+ * @brief Returns the simulated time in microseconds, polled as
+ * OSIF_GetMilliseconds().
+ */
+uint32_t OSIF_GetMicroseconds(void)
+{
+    if (!Mock_LPI2C_RunIrq())
+    {
+        s_now_ns += MOCK_OSIF_POLL_NS;
+    }
+
+    return (uint32_t)(s_now_ns / 1000ULL);
+}
+
+/**
+ * @brief Returns the simulated time in nanoseconds.
+ */
+uint64_t Mock_OSIF_Now(void)
+{
+    return s_now_ns;
+}
+
+/**
+ * @brief Moves the simulated clock on.
+ */
+void Mock_OSIF_Advance(uint64_t ns)
+{
+    s_now_ns += ns;
+}
+
+/**
+ * @brief PROF_TIMESTAMP() on the host: the simulated clock at SIM_TIMESTAMP_HZ.
+ */
+uint32_t Sim_Timestamp(void)
+{
+    return (uint32_t)((s_now_ns * SIM_TIMESTAMP_HZ) / 1000000000ULL);
+}
@@ -0,0 +1,125 @@
+/**
+ ******************************************************************************
+ * @file      mock_platform.c
+ * @brief     Host stand-ins for the application modules that program
+ * registers: the clock gates, and the counters and report columns of prof.c.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "clock_gate.h"
+#include "prof.h"
+#include <stddef.h>
+#include "fmt.h"
+#include "sim_port.h"
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static uint8_t s_gate_users[CLOCK_GATE_COUNT];
+static uint32_t s_counters[PROF_CNT_COUNT];
+static prof_hist_t s_hists[PROF_HIST_COUNT];
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+void ClockGate_Init(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < CLOCK_GATE_COUNT; i++)
+    {
+        s_gate_users[i] = 0;
+    }
+}
+
+/**
+ * @brief Counts the users of a gate, as the target does before touching PCC.
+ */
+void ClockGate_Acquire(clock_gate_t gate)
+{
+    s_gate_users[gate]++;
+}
+
+void ClockGate_Release(clock_gate_t gate)
+{
+    if (s_gate_users[gate] != 0U)
+    {
+        s_gate_users[gate]--;
+    }
+}
+
+/**
+ * @brief Reports whether the gate has a user; an unbalanced release or a
+ * leaked acquire shows up here.
+ */
+bool ClockGate_IsRunning(clock_gate_t gate)
+{
+    return s_gate_users[gate] != 0U;
+}
+
+void Prof_Count(prof_counter_t id)
+{
+    s_counters[id]++;
+}
+
+uint32_t Prof_GetCount(prof_counter_t id)
+{
+    return s_counters[id];
+}
+
+uint32_t Prof_TimestampHz(void)
+{
+    return SIM_TIMESTAMP_HZ;
+}
+
+void Prof_Hist(prof_hist_id_t id, uint32_t ticks)
+{
+    uint32_t b = 0;
+
+    while ((ticks != 0U) && (b < (PROF_HIST_BUCKETS - 1U)))
+    {
+        ticks >>= 1;
+        b++;
+    }
+    s_hists[id].bucket[b]++;
+}
+
+void Prof_GetHist(prof_hist_id_t id, prof_hist_t *hist)
+{
+    *hist = s_hists[id];
+}
+
+/**
+ * @brief The report columns of prof.c, for I2C_Meter_Dump().
+ */
+char *Prof_PutText(char *dst, const char *text, uint8_t width)
+{
+    while ((text != NULL) && (*text != '\0') && (width != 0U))
+    {
+        *dst++ = *text++;
+        width--;
+    }
+    while (width-- != 0U)
+    {
+        *dst++ = ' ';
+    }
+
+    return dst;
+}
+
+char *Prof_PutValue(char *dst, uint64_t value, uint8_t decimals)
+{
+    if (value > 0x7FFFFFFFU)
+    {
+        value = 0x7FFFFFFFU;
+    }
+
+    return dst + Fmt_FixedQ(dst, PROF_VALUE_WIDTH, (int32_t)value, decimals, NULL);
+}
@@ -0,0 +1,38 @@
+/**
+ ******************************************************************************
+ * @file      osif.h
+ * @brief     Host mock of the S32 SDK OS interface: a simulated clock that
+ * only moves when the bus or a delay spends time.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef OSIF_H
+#define OSIF_H
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define OSIF_WAIT_FOREVER 0xFFFFFFFFu
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void OSIF_TimeDelay(const uint32_t delay);
+uint32_t OSIF_GetMilliseconds(void);
+void OSIF_TimeDelayUs(const uint32_t delay);
+uint32_t OSIF_GetMicroseconds(void);
+
+uint64_t Mock_OSIF_Now(void);
+void Mock_OSIF_Advance(uint64_t ns);
+
+#endif /* OSIF_H */
@@ -0,0 +1,33 @@
+/**
+ ******************************************************************************
+ * @file      peripherals_lpi2c_config_1.h
+ * @brief     Host stand-in for the generated LPI2C configuration of board/,
+ * which includes the SDK driver header directly.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef lpi2c_config_1_H
+#define lpi2c_config_1_H
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "lpi2c_driver.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define INST_LPI2C0  0U
+
+/*============================================================================*/
+/* Public Variables                               */
+/*============================================================================*/
+
+extern lpi2c_master_user_config_t lpi2c0_MasterConfig0;
+
+extern void I2C_Queue_MasterCallback(i2c_master_event_t event, void *userData);
+
+#endif /* lpi2c_config_1_H */
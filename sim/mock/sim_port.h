@@ -0,0 +1,35 @@
+/**
+ ******************************************************************************
+ * @file      sim_port.h
+ * @brief     Host replacements for the target-only macros of the application
+ * layer; the sim makefile includes it ahead of every source file.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef SIM_PORT_H_
+#define SIM_PORT_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Rate of the simulated LPIT0 timestamp, as SIRCDIV2 on the target
+#define SIM_TIMESTAMP_HZ    8000000U
+
+// LPIT0 is not mapped on the host; timestamps follow the simulated clock
+#define PROF_TIMESTAMP()    Sim_Timestamp()
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+uint32_t Sim_Timestamp(void);
+
+#endif /* SIM_PORT_H_ */
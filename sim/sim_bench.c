@@ -0,0 +1,839 @@
+/**
+ ******************************************************************************
+ * @file      sim_bench.c
+ * @brief     Host benchmark runner for the application layer: drives the
+ * filter, formatter and framebuffer code against the mock drivers in mock/,
+ * measures host time per sample and bus traffic per frame, and checks what
+ * the modelled display shows. Build and run with "make run" in sim/.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "peripherals_lpi2c_config_1.h"
+#include "lpi2c_driver.h"   // Mock: recorded bus traffic
+#include "adc_driver.h"     // Mock: injected sample stream
+#include "osif.h"           // Mock: simulated clock
+#include "mock_hd44780.h"   // Display model behind the backpack
+#include "filter.h"
+#include "anomaly.h"
+#include "fmt.h"
+#include "temp_conv.h"
+#include "lcd_fb.h"
+#include "lcd_glyph.h"
+#include "lcd_multi.h"
+#include "lcd_comp.h"
+#include "i2c_queue.h"
+#include "i2c_meter.h"
+#include "clock_gate.h"
+#include "prof.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define BENCH_SAMPLE_RATE_HZ    500U        // SAMPLER_RATE_HZ
+#define BENCH_FRAMES            640U        // Display refreshes, one per second of stream
+#define BENCH_STREAM_LEN        (BENCH_SAMPLE_RATE_HZ * BENCH_FRAMES)
+#define BENCH_PASSES            4U          // Passes over the stream per filter measurement
+#define BENCH_BLOCK             64U         // Samples per ProcessBlock() call
+#define BENCH_FMT_CALLS         1000000U
+#define BENCH_DIFF_RUNS         1000000U    // Scans of an unchanged framebuffer
+#define BENCH_ADC_CHANNEL       ADC_INPUTCHAN_EXT12
+
+#if (BENCH_STREAM_LEN % BENCH_BLOCK) != 0U
+#error "The filter runs need whole blocks"
+#endif
+
+// LM35 stream: a slow triangle between these readings plus a little noise
+#define BENCH_TEMP_LOW_C10      200         // 20.0 C
+#define BENCH_TEMP_HIGH_C10     300         // 30.0 C
+#define BENCH_NOISE_COUNTS      4U          // Peak-to-peak, in ADC counts
+
+// Paced display for the bus load run: refresh_config_t.min_interval_ms and
+// APP_I2C_METER_MS of main.c, over every rolling window of the meter
+#define BENCH_LOAD_FRAME_MS     250U
+#define BENCH_LOAD_WINDOW_MS    1000U
+#define BENCH_LOAD_WINDOWS      I2C_METER_WINDOWS
+
+// Backpack of the multi-display run that nothing answers at
+#define BENCH_ABSENT_ADDRESS    0x25U
+
+// Compositor run: pages rotated, the first LCD_FB_PAGES resident in DDRAM
+#define BENCH_COMP_PAGES        3U
+#define BENCH_COMP_DWELL_MS     3000U
+#define BENCH_COMP_PERIOD_MS    1000U
+
+// Main screen layout, as in App_UpdateDisplay()
+#define BENCH_BAR_FULL_C10      500
+#define BENCH_LABEL             "\xDF" "C    Temp"
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+// Bus traffic of one display scenario
+typedef struct
+{
+    const char *label;
+    uint32_t frames;
+    uint32_t max_bytes;
+    uint64_t host_ns;
+    mock_lpi2c_stats_t start;
+} bench_display_t;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static uint16_t s_stream[BENCH_STREAM_LEN];
+static uint16_t s_out[BENCH_BLOCK];
+
+// Keeps the computed results alive so the loops are not optimized out
+static volatile int32_t s_sink;
+
+// Completion hooks of the frames Bench_Compose() queued
+static uint32_t s_frames_done;
+
+static uint32_t s_failures;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+static uint64_t Bench_HostNs(void)
+{
+    struct timespec ts;
+
+    (void)clock_gettime(CLOCK_MONOTONIC, &ts);
+
+    return ((uint64_t)ts.tv_sec * 1000000000ULL) + (uint64_t)ts.tv_nsec;
+}
+
+/**
+ * @brief Records a failed check; the exit status counts them.
+ */
+static void Bench_Check(bool ok, const char *what)
+{
+    if (!ok)
+    {
+        printf("FAIL: %s\n", what);
+        s_failures++;
+    }
+}
+
+/**
+ * @brief Fills the stream with the LM35 output at BENCH_SAMPLE_RATE_HZ.
+ * @details One triangle period over the whole stream, with a fixed linear
+ * congruential noise sequence so every run sees the same samples.
+ */
+static void Bench_MakeStream(void)
+{
+    const uint32_t half = BENCH_STREAM_LEN / 2U;
+    uint32_t lcg = 1U;
+    uint32_t i, pos;
+    int32_t temp_c100, raw;
+
+    for (i = 0; i < BENCH_STREAM_LEN; i++)
+    {
+        pos = (i < half) ? i : (BENCH_STREAM_LEN - i);
+        temp_c100 = (BENCH_TEMP_LOW_C10 * 10) +
+                    (int32_t)(((uint64_t)pos * ((BENCH_TEMP_HIGH_C10 - BENCH_TEMP_LOW_C10) * 10)) / half);
+        lcg = (lcg * 1103515245U) + 12345U;
+        raw = (int32_t)Temp_ToRaw(temp_c100, TEMP_RES_0C01) +
+              (int32_t)((lcg >> 16) % (BENCH_NOISE_COUNTS + 1U)) - (int32_t)(BENCH_NOISE_COUNTS / 2U);
+        s_stream[i] = (uint16_t)((raw < 0) ? 0 : ((raw > (int32_t)TEMP_ADC_MAX_VALUE) ? (int32_t)TEMP_ADC_MAX_VALUE : raw));
+    }
+}
+
+static void Bench_ReportRate(const char *label, uint64_t ns, uint64_t count)
+{
+    printf("%-24s %10.2f\n", label, (double)ns / (double)count);
+}
+
+/**
+ * @brief Polled conversion, IIR smoothing and conversion to tenths of a
+ * degree for every sample of the stream.
+ */
+static void Bench_SamplePath(void)
+{
+    const adc_chan_config_t chan = { false, BENCH_ADC_CHANNEL };
+    filter_iir_t iir;
+    uint16_t raw;
+    uint64_t start;
+    uint32_t i;
+
+    Filter_IIR_Init(&iir, FILTER_IIR_ALPHA(0.25));
+    Mock_ADC_SetStream(s_stream, BENCH_STREAM_LEN);
+
+    start = Bench_HostNs();
+    for (i = 0; i < BENCH_STREAM_LEN; i++)
+    {
+        ADC_DRV_ConfigChan(0U, 0U, &chan);
+        ADC_DRV_WaitConvDone(0U);
+        ADC_DRV_GetChanResult(0U, 0U, &raw);
+        s_sink = Temp_FromRaw(Filter_IIR_Process(&iir, raw), TEMP_RES_0C1);
+    }
+    Bench_ReportRate("sample path", Bench_HostNs() - start, BENCH_STREAM_LEN);
+
+    Bench_Check(Mock_ADC_Conversions() == BENCH_STREAM_LEN, "one conversion per sample");
+}
+
+/**
+ * @brief Block processing of every filter over the stream.
+ */
+static void Bench_Filters(void)
+{
+    filter_ma_t ma;
+    filter_iir_t iir;
+    filter_median_t median;
+    uint64_t start;
+    uint32_t pass, i;
+
+    Filter_MA_Init(&ma, 16U);
+    start = Bench_HostNs();
+    for (pass = 0; pass < BENCH_PASSES; pass++)
+    {
+        for (i = 0; i < BENCH_STREAM_LEN; i += BENCH_BLOCK)
+        {
+            Filter_MA_ProcessBlock(&ma, &s_stream[i], s_out, BENCH_BLOCK);
+        }
+    }
+    Bench_ReportRate("filter ma 16", Bench_HostNs() - start, (uint64_t)BENCH_STREAM_LEN * BENCH_PASSES);
+
+    Filter_IIR_Init(&iir, FILTER_IIR_ALPHA(0.25));
+    start = Bench_HostNs();
+    for (pass = 0; pass < BENCH_PASSES; pass++)
+    {
+        for (i = 0; i < BENCH_STREAM_LEN; i += BENCH_BLOCK)
+        {
+            Filter_IIR_ProcessBlock(&iir, &s_stream[i], s_out, BENCH_BLOCK);
+        }
+    }
+    Bench_ReportRate("filter iir", Bench_HostNs() - start, (uint64_t)BENCH_STREAM_LEN * BENCH_PASSES);
+
+    Filter_Median_Init(&median, 5U);
+    start = Bench_HostNs();
+    for (pass = 0; pass < BENCH_PASSES; pass++)
+    {
+        for (i = 0; i < BENCH_STREAM_LEN; i += BENCH_BLOCK)
+        {
+            Filter_Median_ProcessBlock(&median, &s_stream[i], s_out, BENCH_BLOCK);
+        }
+    }
+    Bench_ReportRate("filter median 5", Bench_HostNs() - start, (uint64_t)BENCH_STREAM_LEN * BENCH_PASSES);
+
+    s_sink = s_out[BENCH_BLOCK - 1U];
+}
+
+/**
+ * @brief Anomaly stage over the stream, then a glitch, a step and a ramp.
+ * @details The stream's noise stays well inside the slew limit, so nothing
+ * in it may be rejected.
+ */
+static void Bench_Anomaly(void)
+{
+    static const anomaly_config_t cfg = { 16U, 3U, 4U, 16 };
+    anomaly_t a;
+    uint8_t flags, seen;
+    uint16_t out;
+    uint64_t start;
+    uint32_t pass, i;
+
+    Anomaly_Init(&a, &cfg);
+    start = Bench_HostNs();
+    for (pass = 0; pass < BENCH_PASSES; pass++)
+    {
+        for (i = 0; i < BENCH_STREAM_LEN; i++)
+        {
+            s_sink = Anomaly_Process(&a, s_stream[i], &flags);
+        }
+    }
+    Bench_ReportRate("anomaly", Bench_HostNs() - start, (uint64_t)BENCH_STREAM_LEN * BENCH_PASSES);
+    Bench_Check(a.spikes == 0U, "anomaly passes the stream");
+
+    Anomaly_Init(&a, &cfg);
+    (void)Anomaly_Process(&a, 2000U, &flags);
+    out = Anomaly_Process(&a, 2400U, &flags);
+    Bench_Check((out == 2000U) && ((flags & ANOMALY_SPIKE) != 0U), "anomaly rejects a glitch");
+    out = Anomaly_Process(&a, 2001U, &flags);
+    Bench_Check((out == 2001U) && (flags == 0U), "anomaly resumes after a glitch");
+
+    for (i = 0; i < cfg.max_rejects; i++)
+    {
+        (void)Anomaly_Process(&a, 2400U, &flags);
+    }
+    out = Anomaly_Process(&a, 2400U, &flags);
+    Bench_Check((out == 2400U) && ((flags & ANOMALY_STEP) != 0U), "anomaly accepts a held step");
+
+    // A quarter count per sample is 64 in the derivative's 8 fraction bits
+    seen = 0U;
+    for (i = 0; i < 400U; i++)
+    {
+        (void)Anomaly_Process(&a, (uint16_t)(2400U + (i / 4U)), &flags);
+        seen |= flags;
+    }
+    Bench_Check(((flags & ANOMALY_RISING) != 0U) && ((seen & ANOMALY_TREND_EDGE) != 0U), "anomaly flags a rise");
+    for (i = 0; i < 400U; i++)
+    {
+        (void)Anomaly_Process(&a, 2500U, &flags);
+    }
+    Bench_Check((flags & (ANOMALY_RISING | ANOMALY_FALLING)) == 0U, "anomaly clears a trend");
+}
+
+/**
+ * @brief The display's number format over the whole sensor range.
+ */
+static void Bench_Fmt(void)
+{
+    char text[12];
+    uint64_t start;
+    uint32_t i;
+
+    start = Bench_HostNs();
+    for (i = 0; i < BENCH_FMT_CALLS; i++)
+    {
+        s_sink = Fmt_FixedQ(text, 5U, (int32_t)(i % 1900U) - 400, 1U, NULL);
+    }
+    Bench_ReportRate("fmt fixed q", Bench_HostNs() - start, BENCH_FMT_CALLS);
+
+    (void)Fmt_FixedQ(text, 5U, 274, 1U, NULL);
+    Bench_Check(strcmp(text, " 27.4") == 0, "fmt 27.4");
+    (void)Fmt_FixedQ(text, 7U, -5, 1U, " C");
+    Bench_Check(strcmp(text, " -0.5 C") == 0, "fmt -0.5 C");
+}
+
+/**
+ * @brief Frame completion hook, as App_FrameDone().
+ */
+static void Bench_FrameDone(status_t status, void *param)
+{
+    (void)status;
+    (void)param;
+
+    s_frames_done++;
+}
+
+/**
+ * @brief Composes the main screen as App_UpdateDisplay() does and queues it.
+ */
+static status_t Bench_Compose(int32_t temp_c10)
+{
+    char text[8];
+
+    (void)Fmt_FixedQ(text, 5U, temp_c10, 1U, NULL);
+    LCD_Glyph_BeginFrame();
+    (void)LCD_Glyph_BigText(0, text);
+    LCD_Glyph_BarGraph(1, 6, 10, temp_c10, BENCH_BAR_FULL_C10);
+
+    return LCD_FB_FlushAsync(Bench_FrameDone, NULL);
+}
+
+static void Bench_DisplayBegin(bench_display_t *run, const char *label)
+{
+    run->label = label;
+    run->frames = 0;
+    run->max_bytes = 0;
+    run->host_ns = 0;
+    Mock_LPI2C_GetStats(&run->start);
+}
+
+/**
+ * @brief Accounts for one frame, from its composition until the bus is idle.
+ */
+static void Bench_DisplayFrame(bench_display_t *run, uint64_t host_start, uint32_t tx_before)
+{
+    mock_lpi2c_stats_t now;
+
+    Mock_LPI2C_Drain();
+    run->host_ns += Bench_HostNs() - host_start;
+    Mock_LPI2C_GetStats(&now);
+    if ((now.tx_bytes - tx_before) > run->max_bytes)
+    {
+        run->max_bytes = now.tx_bytes - tx_before;
+    }
+    run->frames++;
+}
+
+static void Bench_DisplayReport(const bench_display_t *run)
+{
+    mock_lpi2c_stats_t now;
+    double frames = (double)run->frames;
+
+    Mock_LPI2C_GetStats(&now);
+    printf("%-24s %8u %10.1f %8u %10.2f %10.1f %12.0f\n", run->label, run->frames,
+           (double)(now.tx_bytes - run->start.tx_bytes) / frames, run->max_bytes,
+           (double)(now.transactions - run->start.transactions) / frames,
+           (double)(now.wire_ns - run->start.wire_ns) / (frames * 1000.0),
+           (double)run->host_ns / frames);
+}
+
+static uint32_t Bench_TxBytes(void)
+{
+    mock_lpi2c_stats_t stats;
+
+    Mock_LPI2C_GetStats(&stats);
+    return stats.tx_bytes;
+}
+
+/**
+ * @brief Brings the display up as App_LcdInitStep() does.
+ */
+static void Bench_DisplayInit(void)
+{
+    bench_display_t run;
+    uint64_t start;
+
+    Mock_LPI2C_Reset();
+    Bench_DisplayBegin(&run, "init and static text");
+    start = Bench_HostNs();
+    LCD_Init();
+    LCD_FB_Init();
+    LCD_Glyph_Init();
+    LCD_FB_WriteString(0, 5, BENCH_LABEL);
+    (void)LCD_FB_FlushAsync(NULL, NULL);
+    Bench_DisplayFrame(&run, start, 0U);
+    Bench_DisplayReport(&run);
+
+    Bench_Check(Mock_HD44780_LineIs(0, "     " BENCH_LABEL), "static text on line 0");
+    Bench_Check(Mock_HD44780_LineIs(1, ""), "line 1 cleared");
+}
+
+/**
+ * @brief Refreshes once per second of stream, with the reading filtered and
+ * decimated in between: the bus cost of the real display.
+ */
+static void Bench_DisplayStream(void)
+{
+    bench_display_t run;
+    filter_iir_t iir;
+    uint16_t smoothed = 0;
+    uint64_t start;
+    uint32_t frame, i, tx;
+
+    Filter_IIR_Init(&iir, FILTER_IIR_ALPHA(0.25));
+    Bench_DisplayBegin(&run, "reading, async diff");
+    for (frame = 0; frame < BENCH_FRAMES; frame++)
+    {
+        for (i = 0; i < BENCH_SAMPLE_RATE_HZ; i++)
+        {
+            smoothed = Filter_IIR_Process(&iir, s_stream[(frame * BENCH_SAMPLE_RATE_HZ) + i]);
+        }
+        tx = Bench_TxBytes();
+        start = Bench_HostNs();
+        Bench_Check(Bench_Compose(Temp_FromRaw(smoothed, TEMP_RES_0C1)) == STATUS_SUCCESS, "frame queued");
+        Bench_DisplayFrame(&run, start, tx);
+    }
+    Bench_DisplayReport(&run);
+
+    Bench_Check(!ClockGate_IsRunning(CLOCK_GATE_LPI2C0) && !ClockGate_IsRunning(CLOCK_GATE_DMA),
+                "bus clocks released once idle");
+}
+
+/**
+ * @brief The same reading over and over: nothing should reach the bus.
+ */
+static void Bench_DisplaySteady(void)
+{
+    bench_display_t run;
+    uint64_t start;
+    uint32_t frame, tx;
+
+    Bench_DisplayBegin(&run, "steady reading");
+    s_frames_done = 0;
+    for (frame = 0; frame < BENCH_FRAMES; frame++)
+    {
+        tx = Bench_TxBytes();
+        start = Bench_HostNs();
+        (void)Bench_Compose(274);
+        Bench_DisplayFrame(&run, start, tx);
+    }
+    Bench_DisplayReport(&run);
+
+    Bench_Check((Bench_TxBytes() - run.start.tx_bytes) == run.max_bytes, "only the first steady frame sends");
+
+    // Each unchanged refresh completes at once, so the wake-on-threshold
+    // idle hook finds the display idle right after it and may enter VLPS
+    Bench_Check(s_frames_done == BENCH_FRAMES, "every steady frame completes");
+    Bench_Check((Bench_Compose(274) == STATUS_SUCCESS) && !LCD_IsBusy(), "idle after an unchanged refresh");
+}
+
+/**
+ * @brief Whole new text on both lines every frame: the worst case of the diff.
+ */
+static void Bench_DisplayRedraw(void)
+{
+    static const char * const s_screens[2][LCD_ROWS] =
+    {
+        { "ABCDEFGHIJKLMNOP", "abcdefghijklmnop" },
+        { "0123456789012345", "qrstuvwxyz!?<>=+" },
+    };
+    bench_display_t run;
+    uint64_t start;
+    uint32_t frame, tx;
+    const char * const *screen = s_screens[0];
+
+    Bench_DisplayBegin(&run, "full redraw");
+    for (frame = 0; frame < BENCH_FRAMES; frame++)
+    {
+        screen = s_screens[frame & 1U];
+        tx = Bench_TxBytes();
+        start = Bench_HostNs();
+        LCD_FB_WriteString(0, 0, screen[0]);
+        LCD_FB_WriteString(1, 0, screen[1]);
+        (void)LCD_FB_FlushAsync(NULL, NULL);
+        Bench_DisplayFrame(&run, start, tx);
+    }
+    Bench_DisplayReport(&run);
+
+    Bench_Check(Mock_HD44780_LineIs(0, screen[0]) && Mock_HD44780_LineIs(1, screen[1]),
+                "redrawn screen shown");
+}
+
+/**
+ * @brief One changed cell per frame through the blocking flush, one
+ * transaction per dirty run.
+ */
+static void Bench_DisplayBlocking(void)
+{
+    bench_display_t run;
+    uint64_t start;
+    uint32_t frame, tx;
+
+    Bench_DisplayBegin(&run, "one cell, blocking");
+    for (frame = 0; frame < BENCH_FRAMES; frame++)
+    {
+        tx = Bench_TxBytes();
+        start = Bench_HostNs();
+        LCD_FB_PutChar(1, 15, (char)('0' + (frame % 10U)));
+        (void)LCD_FB_Flush();
+        Bench_DisplayFrame(&run, start, tx);
+    }
+    Bench_DisplayReport(&run);
+
+    Bench_Check(Mock_HD44780_LineIs(1, "qrstuvwxyz!?<>=9"), "blocking flush shown");
+}
+
+/**
+ * @brief The pre-framebuffer main loop: cursor move and the whole reading,
+ * one queued transaction per byte.
+ */
+static void Bench_DisplayLegacy(void)
+{
+    bench_display_t run;
+    char text[12];
+    uint64_t start;
+    uint32_t frame, tx;
+
+    Bench_DisplayBegin(&run, "legacy string rewrite");
+    for (frame = 0; frame < BENCH_FRAMES; frame++)
+    {
+        tx = Bench_TxBytes();
+        start = Bench_HostNs();
+        (void)Fmt_FixedQ(text, 8U, 274, 1U, " C ");
+        LCD_SendCommand(LCD_SET_DDRAM_ADDR | LCD_ROW1_DDRAM);
+        LCD_SendString(text);
+        Bench_DisplayFrame(&run, start, tx);
+    }
+    Bench_DisplayReport(&run);
+
+    Bench_Check(Mock_HD44780_LineIs(1, " 27.4 C " "yz!?<>=9"), "legacy string shown");
+}
+
+/**
+ * @brief Time the diff takes to find that nothing changed.
+ */
+static void Bench_DiffScan(void)
+{
+    uint64_t start;
+    uint32_t i, tx = Bench_TxBytes();
+
+    LCD_FB_Init();
+    start = Bench_HostNs();
+    for (i = 0; i < BENCH_DIFF_RUNS; i++)
+    {
+        s_sink = LCD_FB_FlushAsync(NULL, NULL);
+    }
+    Bench_ReportRate("fb diff, clean screen", Bench_HostNs() - start, BENCH_DIFF_RUNS);
+
+    Bench_Check(Bench_TxBytes() == tx, "clean diff sends nothing");
+}
+
+/**
+ * @brief A frame whose address is not acknowledged is counted, and the
+ * queue keeps going without an error hook.
+ */
+static void Bench_BusError(void)
+{
+    char line[LCD_COLS + 1U];
+
+    Mock_LPI2C_FailNext(STATUS_I2C_RECEIVED_NACK);
+    LCD_FB_WriteString(0, 0, "nack");
+    (void)LCD_FB_FlushAsync(NULL, NULL);
+    Mock_LPI2C_Drain();
+    Bench_Check(Prof_GetCount(PROF_CNT_I2C_NACK) == 1U, "nack counted");
+
+    // The framebuffer took the lost frame as shown, so the "ck" it left is not sent again
+    LCD_FB_WriteString(0, 0, "ok");
+    (void)LCD_FB_FlushAsync(NULL, NULL);
+    Mock_LPI2C_Drain();
+    Mock_HD44780_GetLine(0, line);
+    Bench_Check(memcmp(line, "ok23", 4U) == 0, "queue runs after a nack");
+}
+
+static void Bench_Print(const char *line)
+{
+    printf("%s\n", line);
+}
+
+/**
+ * @brief A changing reading at the fastest refresh the policy allows, with
+ * the meter closing a window per second as main.c does; its figures must
+ * match the modelled wire time.
+ */
+static void Bench_BusLoad(void)
+{
+    mock_lpi2c_stats_t before, after;
+    i2c_meter_t meter;
+    uint64_t slot_ns, elapsed_ns, expect;
+    uint32_t window, frame;
+
+    I2C_Meter_Init();
+    Mock_LPI2C_GetStats(&before);
+    for (window = 0; window < BENCH_LOAD_WINDOWS; window++)
+    {
+        for (frame = 0; frame < (BENCH_LOAD_WINDOW_MS / BENCH_LOAD_FRAME_MS); frame++)
+        {
+            slot_ns = Mock_OSIF_Now() + (BENCH_LOAD_FRAME_MS * 1000000ULL);
+            (void)Bench_Compose(200 + (int32_t)(((window * 4U) + frame) * 7U));
+            Mock_LPI2C_Drain();
+            Mock_OSIF_Advance(slot_ns - Mock_OSIF_Now());
+        }
+        I2C_Meter_Update();
+    }
+    Mock_LPI2C_GetStats(&after);
+    I2C_Meter_Get(&meter);
+    I2C_Meter_Dump(Bench_Print);
+
+    elapsed_ns = (uint64_t)BENCH_LOAD_WINDOWS * BENCH_LOAD_WINDOW_MS * 1000000ULL;
+    expect = ((after.wire_ns - before.wire_ns) * 1000U) / elapsed_ns;
+    Bench_Check((meter.avg_permille + 1U >= expect) && (meter.avg_permille <= expect + 1U), "meter load matches the wire time");
+    expect = ((uint64_t)(after.tx_bytes - before.tx_bytes) * 1000U) / (BENCH_LOAD_WINDOWS * BENCH_LOAD_WINDOW_MS);
+    Bench_Check((meter.bytes_per_s + 1U >= expect) && (meter.bytes_per_s <= expect + 1U), "meter byte rate");
+    Bench_Check(meter.peak_permille >= meter.avg_permille, "peak at or above the average");
+}
+
+/**
+ * @brief A 1602 and a 2004 mirrored, the 2004 with lines of its own, plus a
+ * panel that is not fitted: every flush must be one job of one descriptor
+ * per changed panel, and a failed list must be redrawn in full.
+ */
+static void Bench_MultiDisplay(void)
+{
+    static lcd_panel_t small, large, absent;
+    bench_display_t run;
+    mock_lpi2c_stats_t before, after;
+    uint64_t start;
+    uint32_t frame, tx;
+    char text[8];
+
+    Mock_LPI2C_Reset();
+    LCD_Multi_PanelInit(&small, MOCK_HD44780_ADDRESS, 2U, 16U);
+    LCD_Multi_PanelInit(&large, MOCK_HD44780_ADDRESS_2, 4U, 20U);
+    LCD_Multi_PanelInit(&absent, BENCH_ABSENT_ADDRESS, 2U, 16U);
+    (void)LCD_Multi_Attach(&small);
+    (void)LCD_Multi_Attach(&large);
+    (void)LCD_Multi_Attach(&absent);
+    LCD_Multi_Init();
+    Bench_Check(LCD_Multi_IsOnline(&small) && LCD_Multi_IsOnline(&large), "fitted panels online");
+    Bench_Check(!LCD_Multi_IsOnline(&absent), "absent panel offline");
+
+    printf("%-24s %8s %10s %8s %10s %10s %12s\n", "panels", "frames", "bytes/fr", "max",
+           "xfers/fr", "bus us/fr", "host ns/fr");
+    Bench_DisplayBegin(&run, "1602 + 2004, one list");
+    LCD_Multi_WriteString(&large, 2, 0, "line 3 of the 2004");
+    LCD_Multi_WriteString(&large, 3, 0, "only on this panel");
+    for (frame = 0; frame < BENCH_FRAMES; frame++)
+    {
+        (void)Fmt_FixedQ(text, 5U, 200 + (int32_t)(frame % 100U), 1U, NULL);
+        LCD_Multi_WriteString(&small, 0, 0, text);
+        LCD_Multi_WriteString(&small, 0, 6, "C");
+        LCD_Multi_Mirror(&large, &small);
+
+        tx = Bench_TxBytes();
+        Mock_LPI2C_GetStats(&before);
+        start = Bench_HostNs();
+        (void)LCD_Multi_FlushAsync(NULL, NULL);
+        if (frame == 0U)
+        {
+            Bench_Check(LCD_Multi_IsBusy(), "flush returns with the list on the bus");
+        }
+        Bench_DisplayFrame(&run, start, tx);
+        Mock_LPI2C_GetStats(&after);
+        if ((after.transactions - before.transactions) != 2U)
+        {
+            Bench_Check(false, "one descriptor per changed panel");
+            break;
+        }
+    }
+    Bench_DisplayReport(&run);
+    Bench_Check(Mock_HD44780_PanelLineIs(MOCK_HD44780_ADDRESS, 0, 16U, " 23.9 C") &&
+                Mock_HD44780_PanelLineIs(MOCK_HD44780_ADDRESS_2, 0, 20U, " 23.9 C"), "reading mirrored");
+    Bench_Check(Mock_HD44780_PanelLineIs(MOCK_HD44780_ADDRESS_2, 2, 20U, "line 3 of the 2004") &&
+                Mock_HD44780_PanelLineIs(MOCK_HD44780_ADDRESS_2, 3, 20U, "only on this panel"), "2004 lines 3 and 4");
+
+    // Lost on the first panel, so neither got the change; both are redrawn
+    Mock_LPI2C_FailNext(STATUS_I2C_ARBITRATION_LOST);
+    LCD_Multi_WriteString(&small, 1, 0, "lost");
+    LCD_Multi_Mirror(&large, &small);
+    (void)LCD_Multi_FlushAsync(NULL, NULL);
+    Mock_LPI2C_Drain();
+    Bench_Check(LCD_Multi_IsOnline(&small), "panel kept online after a bus error");
+    (void)LCD_Multi_FlushAsync(NULL, NULL);
+    Mock_LPI2C_Drain();
+    Bench_Check(Mock_HD44780_PanelLineIs(MOCK_HD44780_ADDRESS, 1, 16U, "lost") &&
+                Mock_HD44780_PanelLineIs(MOCK_HD44780_ADDRESS_2, 1, 20U, "lost"), "failed list redrawn");
+}
+
+/**
+ * @brief Compositor region content: a fixed text.
+ */
+static void Bench_DrawText(char *cells, uint8_t width, void *param)
+{
+    const char *text = (const char *)param;
+    uint8_t i;
+
+    for (i = 0; (i < width) && (text[i] != '\0'); i++)
+    {
+        cells[i] = text[i];
+    }
+}
+
+/**
+ * @brief Compositor region content: a count of its own redraws.
+ */
+static void Bench_DrawCount(char *cells, uint8_t width, void *param)
+{
+    uint32_t *count = (uint32_t *)param;
+
+    (void)Fmt_FixedQ(cells, width, (int32_t)(*count)++, 0U, NULL);
+}
+
+/**
+ * @brief Polls the compositor at a given time and waits for the bus.
+ */
+static void Bench_CompFrame(bench_display_t *run, uint32_t now_ms)
+{
+    uint64_t start = Bench_HostNs();
+    uint32_t tx = Bench_TxBytes();
+
+    (void)LCD_Comp_Poll(now_ms);
+    Bench_DisplayFrame(run, start, tx);
+}
+
+/**
+ * @brief Three rotating pages over two framebuffer pages: a switch to a
+ * resident page must only cost its stale cells and the display shifts, one
+ * past LCD_FB_PAGES is rewritten in place, and a region redraws at its own
+ * rate while its page is shown.
+ */
+static void Bench_Compositor(void)
+{
+    static lcd_region_t regions[6];
+    bench_display_t redraw, shifted, in_place;
+    uint32_t count = 0;
+    uint32_t now;
+
+    Mock_LPI2C_Reset();
+    LCD_Init();
+    LCD_FB_Init();
+    LCD_Comp_Init(BENCH_COMP_PAGES, BENCH_COMP_DWELL_MS);
+    LCD_Comp_AddRegion(&regions[0], 0, 0, 0, 6, BENCH_COMP_PERIOD_MS, Bench_DrawCount, &count);
+    LCD_Comp_AddRegion(&regions[1], 0, 1, 0, 16, 0, Bench_DrawText, "page 0");
+    LCD_Comp_AddRegion(&regions[2], 1, 0, 0, 16, 0, Bench_DrawText, "page 1 resident");
+    LCD_Comp_AddRegion(&regions[3], 1, 1, 4, 8, 0, Bench_DrawText, "shifted");
+    LCD_Comp_AddRegion(&regions[4], 2, 0, 0, 16, 0, Bench_DrawText, "page 2 in place");
+    LCD_Comp_AddRegion(&regions[5], 2, 1, 0, 16, 0, Bench_DrawText, "rewritten");
+
+    printf("%-24s %8s %10s %8s %10s %10s %12s\n", "compositor", "frames", "bytes/fr", "max",
+           "xfers/fr", "bus us/fr", "host ns/fr");
+    Bench_DisplayBegin(&redraw, "region redraw");
+    Bench_CompFrame(&redraw, 0U);
+    Bench_Check(Mock_HD44780_LineIs(0, "     0") && Mock_HD44780_LineIs(1, "page 0"), "page 0 up");
+    for (now = BENCH_COMP_PERIOD_MS; now < BENCH_COMP_DWELL_MS; now += BENCH_COMP_PERIOD_MS)
+    {
+        Bench_CompFrame(&redraw, now);
+    }
+    Bench_Check(Mock_HD44780_LineIs(0, "     2"), "region redrawn at its period");
+
+    Bench_DisplayReport(&redraw);
+
+    // Explicit switches restart the dwell, so no rotation happens in between
+    Bench_DisplayBegin(&shifted, "page switch by shift");
+    LCD_Comp_ShowPage(1);
+    Bench_CompFrame(&shifted, 2500U);
+    Bench_Check((LCD_Comp_GetPage() == 1U) && Mock_HD44780_LineIs(0, "page 1 resident") &&
+                Mock_HD44780_LineIs(1, "    shifted"), "hidden page shifted into view");
+    LCD_Comp_ShowPage(0);
+    Bench_CompFrame(&shifted, 2600U);
+    Bench_Check(Mock_HD44780_LineIs(0, "     3") && Mock_HD44780_LineIs(1, "page 0"),
+                "resident page back with the region refreshed");
+    LCD_Comp_ShowPage(1);
+    Bench_CompFrame(&shifted, 2700U);
+    Bench_Check(Mock_HD44780_LineIs(0, "page 1 resident"), "unchanged page back by shifts alone");
+    Bench_DisplayReport(&shifted);
+
+    Bench_DisplayBegin(&in_place, "page switch in place");
+    LCD_Comp_ShowPage(2);
+    Bench_CompFrame(&in_place, 2800U);
+    Bench_Check(Mock_HD44780_LineIs(0, "page 2 in place") && Mock_HD44780_LineIs(1, "rewritten"),
+                "page past the resident ones rewritten in place");
+    LCD_Comp_ShowPage(1);
+    Bench_CompFrame(&in_place, 2900U);
+    Bench_Check(Mock_HD44780_LineIs(0, "page 1 resident") && Mock_HD44780_LineIs(1, "    shifted"),
+                "overwritten page redrawn in full");
+    Bench_DisplayReport(&in_place);
+
+    Bench_CompFrame(&in_place, 2900U + BENCH_COMP_DWELL_MS);
+    Bench_Check(LCD_Comp_GetPage() == 2U, "pages rotate after the dwell time");
+}
+
+/*============================================================================*/
+/* Main Function                                   */
+/*============================================================================*/
+
+int main(void)
+{
+    printf("host simulation, %u samples at %u Hz\n", BENCH_STREAM_LEN, BENCH_SAMPLE_RATE_HZ);
+    Bench_MakeStream();
+
+    printf("%-24s %10s\n", "path", "ns/sample");
+    Bench_SamplePath();
+    Bench_Filters();
+    Bench_Anomaly();
+    Bench_Fmt();
+
+    printf("%-24s %8s %10s %8s %10s %10s %12s\n", "display", "frames", "bytes/fr", "max",
+           "xfers/fr", "bus us/fr", "host ns/fr");
+    Bench_DisplayInit();
+    Bench_DisplaySteady();
+    Bench_DisplayStream();
+    Bench_DisplayRedraw();
+    Bench_DisplayBlocking();
+    Bench_DisplayLegacy();
+    Bench_DiffScan();
+    Bench_BusError();
+    Bench_BusLoad();
+    Bench_MultiDisplay();
+    Bench_Compositor();
+
+    printf("%s, %u failed checks\n", (s_failures == 0U) ? "done" : "FAILED", s_failures);
+
+    return (s_failures == 0U) ? 0 : 1;
+}
@@ -0,0 +1,477 @@
+/**
+ ******************************************************************************
+ * @file      adc_sampler.c
+ * @brief     Timer-paced ADC sampling: PDB0 hardware-triggers ADC0 at a
+ * fixed rate, so conversions run without CPU involvement.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "adc_sampler.h"
+#include <stddef.h>
+#include "S32K144.h"
+#include "clock_manager.h"
+#include "dsp_stats.h"
+#include "clock_gate.h"
+#include "perf_cfg.h"
+#include "board_fixed.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define PDB_TRGSEL_SOFTWARE     15U      // TRGSEL value selecting the software trigger
+#define PDB_MOD_MAX             0xFFFFU
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// PDB counter clock multipliers selected by SC[MULT]
+static const uint8_t s_pdb_mult[4] = { 1U, 10U, 20U, 40U };
+
+// Rate given to Sampler_Init(), kept for re-deriving the period after a clock change
+static uint32_t s_rate_hz;
+
+// Set between Sampler_Start() and Sampler_Stop(), while the ADC0 and PDB0 clocks are held
+static bool s_started;
+
+// ADC0 setup as last written, so a converter profile only changes its timing
+static adc_converter_config_t s_converter;
+
+// Conversions per result from the hardware averaging
+static uint8_t s_hw_average = 1U;
+
+// Left shift bringing results of the current resolution to 12 bits
+static uint8_t s_result_shift;
+
+/*============================================================================*/
+/* Global Variables                                */
+/*============================================================================*/
+
+const sampler_converter_t g_sampler_conv_precise =
+{
+    .resolution = ADC_RESOLUTION_12BIT,
+    .sample_time = (uint8_t)ADC_DEFAULT_SAMPLE_TIME,
+    .clock_divide = ADC_CLK_DIVIDE_1,
+    .input_clock = ADC_CLK_ALT_1,
+};
+
+const sampler_converter_t g_sampler_conv_fast =
+{
+    .resolution = ADC_RESOLUTION_12BIT,
+    .sample_time = 4U,
+    .clock_divide = ADC_CLK_DIVIDE_1,
+    .input_clock = ADC_CLK_ALT_1,
+};
+
+const sampler_converter_t g_sampler_conv_fast_10bit =
+{
+    .resolution = ADC_RESOLUTION_10BIT,
+    .sample_time = 4U,
+    .clock_divide = ADC_CLK_DIVIDE_1,
+    .input_clock = ADC_CLK_ALT_1,
+};
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Finds the smallest PDB prescaler giving a period of at most 0xFFFF ticks.
+ * @param bus_hz  PDB input (bus) clock frequency.
+ * @param rate_hz Wanted trigger rate.
+ * @param sc      Out: PRESCALER and MULT bits for PDB0->SC.
+ * @param mod     Out: value for PDB0->MOD.
+ * @return false if the rate cannot be reached with this bus clock.
+ */
+static bool Sampler_ComputePeriod(uint32_t bus_hz, uint32_t rate_hz, uint32_t *sc, uint32_t *mod)
+{
+    uint32_t mult, prescaler, ticks;
+
+    for (mult = 0; mult < 4U; mult++)
+    {
+        for (prescaler = 0; prescaler < 8U; prescaler++)
+        {
+            ticks = bus_hz / ((uint32_t)s_pdb_mult[mult] << prescaler) / rate_hz;
+            if ((ticks >= 2U) && (ticks <= (PDB_MOD_MAX + 1U)))
+            {
+                *sc = PDB_SC_PRESCALER(prescaler) | PDB_SC_MULT(mult);
+                *mod = ticks - 1U;
+                return true;
+            }
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Bits per result of a resolution setting.
+ */
+static uint8_t Sampler_ResolutionBits(adc_resolution_t resolution)
+{
+    switch (resolution)
+    {
+        case ADC_RESOLUTION_8BIT:
+            return 8U;
+        case ADC_RESOLUTION_10BIT:
+            return 10U;
+        default:
+            return 12U;
+    }
+}
+
+/**
+ * @brief ADCK frequency of the converter setup as last written.
+ */
+static uint32_t Sampler_AdckHz(adc_clk_divide_t divide)
+{
+    uint32_t input_hz = 0;
+
+    (void)CLOCK_SYS_GetFreq(ADC0_CLK, &input_hz);
+
+    return input_hz >> (uint32_t)divide;
+}
+
+/**
+ * @brief Writes s_converter to ADC0, keeping the DMA request as it is.
+ * @details The converter setup rewrites SC2[DMAEN] too, while the result
+ * stream switches it through its own copy (ADC_Stream_StartBatched()), so
+ * it is read back first: a profile applied on the fly leaves the eDMA
+ * stream running. Call with the ADC0 clock on.
+ */
+static void Sampler_WriteConverter(void)
+{
+    adc_converter_config_t current;
+
+    ADC_DRV_GetConverterConfig(SAMPLER_ADC_INSTANCE, &current);
+    s_converter.dmaEnable = current.dmaEnable;
+    ADC_DRV_ConfigConverter(SAMPLER_ADC_INSTANCE, &s_converter);
+}
+
+/**
+ * @brief Writes a converter profile into the ADC0 setup.
+ * @details Calibration depends on ADCK, so it is repeated when the clock
+ * changes; that needs the sampler stopped, otherwise the old calibration is
+ * kept until the next change while stopped.
+ * @return false if ADCK would leave SAMPLER_ADCK_MIN_HZ..SAMPLER_ADCK_MAX_HZ
+ * or the sample time is below 2 cycles; nothing is changed then.
+ */
+static bool Sampler_ApplyConverter(const sampler_converter_t *cv)
+{
+    uint32_t adck_hz = Sampler_AdckHz(cv->clock_divide);
+    bool reclock;
+
+    if ((adck_hz < SAMPLER_ADCK_MIN_HZ) || (adck_hz > SAMPLER_ADCK_MAX_HZ) || (cv->sample_time < 2U))
+    {
+        return false;
+    }
+
+    reclock = (cv->clock_divide != s_converter.clockDivide) || (cv->input_clock != s_converter.inputClock);
+    s_converter.resolution = cv->resolution;
+    s_converter.sampleTime = cv->sample_time;
+    s_converter.clockDivide = cv->clock_divide;
+    s_converter.inputClock = cv->input_clock;
+    s_result_shift = (uint8_t)(12U - Sampler_ResolutionBits(cv->resolution));
+
+    ClockGate_Acquire(CLOCK_GATE_ADC0);
+    Sampler_WriteConverter();
+    if (reclock && !s_started)
+    {
+        ADC_DRV_AutoCalibration(SAMPLER_ADC_INSTANCE);
+    }
+    ClockGate_Release(CLOCK_GATE_ADC0);
+
+    return true;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Configures ADC0 for hardware triggering and PDB0 as its pacing timer.
+ * @details PDB0 runs in continuous mode from the bus clock and fires
+ * pretrigger 0 once per period; SIM_ADCOPT (reset value) routes it to ADC0
+ * SC1[0]. ADC0 starts with g_sampler_conv_precise and is calibrated once
+ * here, before any profile is applied. The PDB is left disabled until
+ * Sampler_Start().
+ * @param channel ADC input to sample.
+ * @param rate_hz Sampling rate in Hz.
+ * @return false if the rate is not reachable from the current bus clock.
+ */
+bool Sampler_Init(adc_inputchannel_t channel, uint32_t rate_hz)
+{
+    adc_chan_config_t chan;
+    uint32_t bus_hz = 0;
+    uint32_t sc, mod;
+
+    (void)CLOCK_SYS_GetFreq(BUS_CLK, &bus_hz);
+    if ((rate_hz == 0U) || !Sampler_ComputePeriod(bus_hz, rate_hz, &sc, &mod))
+    {
+        return false;
+    }
+
+    ClockGate_Acquire(CLOCK_GATE_ADC0);
+    ClockGate_Acquire(CLOCK_GATE_PDB0);
+
+    // --- ADC0: 12-bit, hardware trigger from PDB pretrigger 0 ---
+    ADC_DRV_InitConverterStruct(&s_converter);
+    s_converter.resolution = g_sampler_conv_precise.resolution;
+    s_converter.sampleTime = g_sampler_conv_precise.sample_time;
+    s_converter.clockDivide = g_sampler_conv_precise.clock_divide;
+    s_converter.inputClock = g_sampler_conv_precise.input_clock;
+    s_converter.trigger = ADC_TRIGGER_HARDWARE;
+    s_converter.pretriggerSel = ADC_PRETRIGGER_SEL_PDB;
+    s_converter.triggerSel = ADC_TRIGGER_SEL_PDB;
+    s_converter.voltageRef = ADC_VOLTAGEREF_VREF;
+    Sampler_WriteConverter();
+    ADC_DRV_AutoCalibration(SAMPLER_ADC_INSTANCE);
+    s_result_shift = 0;
+    s_hw_average = 1U;
+
+    // With a hardware trigger, writing SC1[0] only selects the input
+    ADC_DRV_InitChanStruct(&chan);
+    chan.channel = channel;
+    ADC_DRV_ConfigChan(SAMPLER_ADC_INSTANCE, 0U, &chan);
+
+    // --- PDB0: continuous, software-started, pretrigger 0 at zero delay ---
+    PDB0->SC = 0;
+    PDB0->SC = sc | PDB_SC_CONT_MASK | PDB_SC_TRGSEL(PDB_TRGSEL_SOFTWARE);
+    PDB0->MOD = mod;
+    PDB0->CH[0].DLY[0] = 0;
+    PDB0->CH[0].C1 = PDB_C1_EN(1U) | PDB_C1_TOS(1U);
+    PDB0->CH[0].S = 0;
+    s_rate_hz = rate_hz;
+
+    ClockGate_Release(CLOCK_GATE_PDB0);
+    ClockGate_Release(CLOCK_GATE_ADC0);
+
+    return true;
+}
+
+/**
+ * @brief Re-derives the PDB0 period from the current bus clock.
+ * @details Call after the bus clock has changed, e.g. on a run-mode switch.
+ * The prescaler changes at once; while the PDB runs, the new MOD is latched
+ * at the end of the current period, so one period may come out off-rate.
+ * @return false if the rate is not reachable from the new bus clock; the old
+ * period is kept.
+ */
+bool Sampler_UpdateClock(void)
+{
+    uint32_t bus_hz = 0;
+    uint32_t sc, mod;
+
+    (void)CLOCK_SYS_GetFreq(BUS_CLK, &bus_hz);
+    if ((s_rate_hz == 0U) || !Sampler_ComputePeriod(bus_hz, s_rate_hz, &sc, &mod))
+    {
+        return false;
+    }
+
+    ClockGate_Acquire(CLOCK_GATE_PDB0);
+    PDB0->SC = (PDB0->SC & ~(PDB_SC_PRESCALER_MASK | PDB_SC_MULT_MASK)) | sc;
+    PDB0->MOD = mod;
+    if ((PDB0->SC & PDB_SC_PDBEN_MASK) != 0U)
+    {
+        PDB0->SC |= PDB_SC_LDOK_MASK;
+    }
+    ClockGate_Release(CLOCK_GATE_PDB0);
+
+    return true;
+}
+
+/**
+ * @brief Starts hardware-paced conversions.
+ * @details ADC0 and PDB0 stay clocked until Sampler_Stop().
+ */
+void Sampler_Start(void)
+{
+    if (!s_started)
+    {
+        ClockGate_Acquire(CLOCK_GATE_ADC0);
+        ClockGate_Acquire(CLOCK_GATE_PDB0);
+        s_started = true;
+    }
+    PDB0->SC |= PDB_SC_PDBEN_MASK;
+    PDB0->SC |= PDB_SC_LDOK_MASK;   // Latch MOD/IDLY/DLY, only effective once enabled
+    PDB0->SC |= PDB_SC_SWTRIG_MASK;
+}
+
+/**
+ * @brief Stops the pacing timer and releases the ADC0 and PDB0 clocks.
+ * @details Gating ADC0 also drops a conversion in progress, call this once
+ * the last wanted result is in.
+ */
+void Sampler_Stop(void)
+{
+    if (!s_started)
+    {
+        return;
+    }
+
+    PDB0->SC &= ~PDB_SC_PDBEN_MASK;
+    s_started = false;
+    ClockGate_Release(CLOCK_GATE_PDB0);
+    ClockGate_Release(CLOCK_GATE_ADC0);
+}
+
+/**
+ * @brief Reads the most recent conversion without waiting.
+ * @param result Out: conversion result scaled to 12 bits, only written when
+ *               a new one is available.
+ * @return true if a conversion completed since the last call.
+ */
+bool Sampler_GetLatest(uint16_t *result)
+{
+    if (!s_started || !BoardFixed_AdcComplete(0U))
+    {
+        return false;
+    }
+
+    // Reading R[0] clears COCO; clear any pretrigger sequence error from missed reads
+    *result = (uint16_t)(BoardFixed_AdcResult(0U) << s_result_shift);
+    PDB0->CH[0].S &= ~PDB_S_ERR_MASK;
+
+    return true;
+}
+
+/**
+ * @brief Time since the last PDB0 trigger, for latency instrumentation.
+ * @details Read from the PDB0 counter, so it is exact to one PDB tick but
+ * only known modulo the sampling period. Callable from any context while
+ * sampling runs.
+ * @param tick_hz Unit of the result, e.g. Prof_TimestampHz().
+ * @return Elapsed time in ticks of tick_hz, 0 while stopped.
+ */
+uint32_t Sampler_TriggerAge(uint32_t tick_hz)
+{
+    uint32_t cnt, mod;
+
+    if (!s_started || (s_rate_hz == 0U))
+    {
+        return 0;
+    }
+
+    cnt = PDB0->CNT;
+    mod = PDB0->MOD;
+
+    return (uint32_t)(((uint64_t)cnt * tick_hz) / ((uint64_t)(mod + 1U) * s_rate_hz));
+}
+
+/**
+ * @brief Applies the hardware part of an acquisition profile.
+ * @details Takes effect from the next conversion; the PDB period must stay
+ * longer than hw_average conversions, see Sampler_MaxRateHz(). Can be
+ * called at run time to trade precision for throughput.
+ * @param profile Profile to apply.
+ * @return false if its converter setup was refused; the averaging is
+ * applied either way.
+ */
+bool Sampler_ApplyProfile(const sampler_profile_t *profile)
+{
+    adc_average_config_t average;
+    bool ok = true;
+
+    if (profile->converter != NULL)
+    {
+        ok = Sampler_ApplyConverter(profile->converter);
+    }
+
+    ADC_DRV_InitHwAverageStruct(&average);
+    average.hwAvgEnable = profile->hw_avg_enable;
+    average.hwAverage = profile->hw_average;
+    ClockGate_Acquire(CLOCK_GATE_ADC0);
+    ADC_DRV_ConfigHwAverage(SAMPLER_ADC_INSTANCE, &average);
+    ClockGate_Release(CLOCK_GATE_ADC0);
+    s_hw_average = profile->hw_avg_enable ? (uint8_t)(4U << (uint32_t)profile->hw_average) : 1U;
+
+    return ok;
+}
+
+/**
+ * @brief Highest trigger rate a profile sustains.
+ * @details Derived from the ADCK clock and the cycle estimate of
+ * sampler_converter_t, so it follows run-mode switches. The rate given to
+ * Sampler_Init() should stay below it with some margin.
+ * @param profile Profile to rate; a NULL profile or converter stands for
+ *                the setup currently applied.
+ * @return Results per second, 0 without an ADC clock.
+ */
+uint32_t Sampler_MaxRateHz(const sampler_profile_t *profile)
+{
+    adc_resolution_t resolution = s_converter.resolution;
+    adc_clk_divide_t divide = s_converter.clockDivide;
+    uint32_t cycles = s_converter.sampleTime;
+    uint32_t average = s_hw_average;
+
+    if (profile != NULL)
+    {
+        if (profile->converter != NULL)
+        {
+            resolution = profile->converter->resolution;
+            divide = profile->converter->clock_divide;
+            cycles = profile->converter->sample_time;
+        }
+        average = profile->hw_avg_enable ? (4UL << (uint32_t)profile->hw_average) : 1U;
+    }
+    cycles += Sampler_ResolutionBits(resolution) + SAMPLER_CONV_OVERHEAD_CYCLES;
+
+    return Sampler_AdckHz(divide) / (cycles * average);
+}
+
+/**
+ * @brief Left shift that brings raw results of the current resolution to
+ * 12 bits, for code reading ADC0 registers directly.
+ */
+uint8_t Sampler_ResultShift(void)
+{
+    return s_result_shift;
+}
+
+/**
+ * @brief Routes the ADC0 hardware trigger and pretrigger 0 to PDB0 or TRGMUX.
+ * @details SIM_ADCOPT is written through the converter setup, which rewrites
+ * ADC0 SC2 as well: a hardware compare must be configured after this call.
+ * Call with the sampler stopped.
+ * @param trigger Trigger source; either one converts SC1[0].
+ */
+void Sampler_SelectTrigger(sampler_trigger_t trigger)
+{
+    if (trigger == SAMPLER_TRIGGER_TRGMUX)
+    {
+        s_converter.pretriggerSel = ADC_PRETRIGGER_SEL_TRGMUX;
+        s_converter.triggerSel = ADC_TRIGGER_SEL_TRGMUX;
+    }
+    else
+    {
+        s_converter.pretriggerSel = ADC_PRETRIGGER_SEL_PDB;
+        s_converter.triggerSel = ADC_TRIGGER_SEL_PDB;
+    }
+
+    ClockGate_Acquire(CLOCK_GATE_ADC0);
+    Sampler_WriteConverter();
+    ClockGate_Release(CLOCK_GATE_ADC0);
+}
+
+/**
+ * @brief Oversamples and decimates 4^extra_bits results into one.
+ * @param samples    At least 4^extra_bits raw results.
+ * @param extra_bits Bits to gain (0..SAMPLER_MAX_OVERSAMPLE).
+ * @return Result with 12 + extra_bits bits of resolution, whatever the
+ * converter resolution.
+ */
+PERF_HOT uint32_t Sampler_Decimate(const uint16_t *samples, uint8_t extra_bits)
+{
+    if (extra_bits > SAMPLER_MAX_OVERSAMPLE)
+    {
+        extra_bits = SAMPLER_MAX_OVERSAMPLE;
+    }
+
+    return (DSP_Sum_u16(samples, 1UL << (2U * extra_bits)) << s_result_shift) >> extra_bits;
+}
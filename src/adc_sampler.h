@@ -0,0 +1,105 @@
+/**
+ ******************************************************************************
+ * @file      adc_sampler.h
+ * @brief     Timer-paced ADC sampling: PDB0 hardware-triggers ADC0 at a
+ * fixed rate, so conversions run without CPU involvement.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef ADC_SAMPLER_H_
+#define ADC_SAMPLER_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_driver.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define SAMPLER_ADC_INSTANCE    0U     // ADC0, triggered by PDB0 pretrigger 0
+#define SAMPLER_RATE_HZ         500U   // Default sampling rate
+#define SAMPLER_MAX_OVERSAMPLE  4U     // Up to 16-bit results from 4^4 = 256 samples
+
+// ADCK limits of the S32K144 in RUN and HSRUN; a divider outside them is refused
+#define SAMPLER_ADCK_MIN_HZ     2000000U
+#define SAMPLER_ADCK_MAX_HZ     50000000U
+
+// ADCK cycles of each conversion beyond the sample and compare phases, as
+// used by Sampler_MaxRateHz(); the compare phase takes one cycle per bit
+#define SAMPLER_CONV_OVERHEAD_CYCLES 5U
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Source of the ADC0 hardware trigger and pretrigger.
+ */
+typedef enum
+{
+    SAMPLER_TRIGGER_PDB = 0,    // PDB0 pretrigger 0, paced by Sampler_Start()
+    SAMPLER_TRIGGER_TRGMUX      // TRGMUX output ADC0_ADHWT_TLA0, routed by its user
+} sampler_trigger_t;
+
+/**
+ * @brief Converter profile: resolution and how long each conversion takes.
+ * @details A conversion takes about sample_time + resolution bits +
+ * SAMPLER_CONV_OVERHEAD_CYCLES ADCK cycles. A low-impedance source such as
+ * the LM35 output settles in a few cycles, so at high rates a short sample
+ * time with hardware averaging buys more precision than one long conversion.
+ */
+typedef struct
+{
+    adc_resolution_t resolution;    // 8, 10 or 12 bits; results are scaled to 12 bits
+    uint8_t sample_time;            // Sample phase in ADCK cycles, 2..255
+    adc_clk_divide_t clock_divide;  // ADCK = input clock / 1, 2, 4 or 8
+    adc_input_clock_t input_clock;  // ADC_CLK_ALT_1, the PCC ADC0 functional clock
+} sampler_converter_t;
+
+/**
+ * @brief Acquisition profile: how much averaging is spent per result.
+ * @details Hardware averaging costs no CPU time but lengthens each conversion
+ * to hw_average samples. Software oversampling sums 4^n results and shifts by
+ * n, adding n effective bits when the input carries about 1 LSB of noise.
+ */
+typedef struct
+{
+    bool hw_avg_enable;         // Let ADC0 average in hardware
+    adc_average_t hw_average;   // 4/8/16/32 conversions per result
+    uint8_t oversample_bits;    // Extra bits by software oversampling and decimation
+    const sampler_converter_t *converter;   // NULL keeps the converter as it is
+} sampler_profile_t;
+
+/*============================================================================*/
+/* Global Variables                                */
+/*============================================================================*/
+
+// Converter profiles: the reset timing at full precision, and the shortest
+// settling the LM35 allows at 12 and 10 bits for high rates with averaging
+extern const sampler_converter_t g_sampler_conv_precise;
+extern const sampler_converter_t g_sampler_conv_fast;
+extern const sampler_converter_t g_sampler_conv_fast_10bit;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+bool Sampler_Init(adc_inputchannel_t channel, uint32_t rate_hz);
+void Sampler_Start(void);
+void Sampler_Stop(void);
+bool Sampler_UpdateClock(void);
+bool Sampler_GetLatest(uint16_t *result);
+uint32_t Sampler_TriggerAge(uint32_t tick_hz);
+bool Sampler_ApplyProfile(const sampler_profile_t *profile);
+uint32_t Sampler_MaxRateHz(const sampler_profile_t *profile);
+uint8_t Sampler_ResultShift(void);
+void Sampler_SelectTrigger(sampler_trigger_t trigger);
+uint32_t Sampler_Decimate(const uint16_t *samples, uint8_t extra_bits);
+
+#endif /* ADC_SAMPLER_H_ */
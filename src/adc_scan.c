@@ -0,0 +1,144 @@
+/**
+ ******************************************************************************
+ * @file      adc_scan.c
+ * @brief     Scan groups: several ADC0 inputs converted back to back from a
+ * single PDB0 trigger, reported in one completion event.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "adc_scan.h"
+#include "adc_sampler.h"
+#include "S32K144.h"
+#include "clock_gate.h"
+#include "board_fixed.h"
+#include <stddef.h>
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static uint16_t s_results[ADC_SCAN_MAX_CHANNELS];
+static uint8_t s_count;
+static adc_scan_callback_t s_callback;
+static void *s_param;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief ADC0 conversion complete callback, raised by the last entry of the group only.
+ * @details Every earlier entry has completed by then, since each pretrigger
+ * waits for the previous conversion.
+ */
+static void ADC_Scan_AdcCallback(const uint32_t instance, const uint8_t chanIndex,
+                                 const uint16_t result, void *parameter)
+{
+    uint8_t i;
+
+    (void)instance;
+    (void)parameter;
+
+    if ((s_count == 0U) || (chanIndex != (s_count - 1U)))
+    {
+        return;
+    }
+
+    // The driver already read the last entry; reading each other R[n] clears its COCO
+    for (i = 0; i < chanIndex; i++)
+    {
+        s_results[i] = BoardFixed_AdcResult(i);
+    }
+    s_results[chanIndex] = result;
+    if (s_callback != NULL)
+    {
+        s_callback(s_results, s_count, s_param);
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Programs a scan group into SC1[0..count-1] and chains the PDB pretriggers.
+ * @details Pretrigger 0 fires at the PDB period as set up by Sampler_Init();
+ * pretriggers 1..count-1 run in back-to-back mode, each one started by the
+ * conversion complete of the previous one, so the group converts with no
+ * CPU involvement and no gaps. Only the last entry raises an interrupt.
+ * @param channels ADC inputs, converted in this order.
+ * @param count    Number of inputs (1..ADC_SCAN_MAX_CHANNELS).
+ * @param callback Completion hook, called from interrupt context.
+ * @param param    User parameter for the hook.
+ * @return STATUS_ERROR if @p count is out of range.
+ */
+status_t ADC_Scan_Start(const adc_inputchannel_t *channels, uint8_t count,
+                        adc_scan_callback_t callback, void *param)
+{
+    adc_chan_config_t chan;
+    uint32_t enable_mask;
+    uint8_t i;
+
+    if ((count == 0U) || (count > ADC_SCAN_MAX_CHANNELS))
+    {
+        return STATUS_ERROR;
+    }
+
+    // Held until ADC_Scan_Stop(), also across a restart with a new group
+    if (s_count == 0U)
+    {
+        ClockGate_Acquire(CLOCK_GATE_ADC0);
+        ClockGate_Acquire(CLOCK_GATE_PDB0);
+    }
+    s_count = count;
+    s_callback = callback;
+    s_param = param;
+
+    // With a hardware trigger, writing SC1[n] only selects the input
+    ADC_DRV_InitChanStruct(&chan);
+    for (i = 0; i < count; i++)
+    {
+        chan.channel = channels[i];
+        chan.interruptEnable = (i == (count - 1U));
+        ADC_DRV_ConfigChan(SAMPLER_ADC_INSTANCE, i, &chan);
+    }
+
+    ADC_DRV_InstallCallback(SAMPLER_ADC_INSTANCE, ADC_Scan_AdcCallback, NULL);
+
+    // Pretrigger 0 on the delay, the rest back to back
+    enable_mask = (1UL << count) - 1U;
+    PDB0->CH[0].DLY[0] = 0;
+    PDB0->CH[0].C1 = PDB_C1_EN(enable_mask) | PDB_C1_TOS(1U) | PDB_C1_BB(enable_mask & ~1UL);
+    PDB0->CH[0].S = 0;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Returns PDB0 to a single pretrigger on SC1[0] and disarms the interrupt.
+ */
+void ADC_Scan_Stop(void)
+{
+    adc_chan_config_t chan;
+
+    if (s_count == 0U)
+    {
+        return;
+    }
+
+    ADC_DRV_InstallCallback(SAMPLER_ADC_INSTANCE, NULL, NULL);
+    PDB0->CH[0].C1 = PDB_C1_EN(1U) | PDB_C1_TOS(1U);
+
+    ADC_DRV_GetChanConfig(SAMPLER_ADC_INSTANCE, s_count - 1U, &chan);
+    chan.interruptEnable = false;
+    ADC_DRV_ConfigChan(SAMPLER_ADC_INSTANCE, s_count - 1U, &chan);
+    s_count = 0;
+
+    ClockGate_Release(CLOCK_GATE_PDB0);
+    ClockGate_Release(CLOCK_GATE_ADC0);
+}
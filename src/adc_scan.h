@@ -0,0 +1,48 @@
+/**
+ ******************************************************************************
+ * @file      adc_scan.h
+ * @brief     Scan groups: several ADC0 inputs converted back to back from a
+ * single PDB0 trigger, reported in one completion event.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef ADC_SCAN_H_
+#define ADC_SCAN_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "adc_driver.h"
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// One PDB0 channel chains 8 pretriggers, which reach ADC0 SC1[0..7]
+#define ADC_SCAN_MAX_CHANNELS   8U
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Completion hook, called from the ADC0 interrupt once the whole group is converted.
+ * @param results One 12-bit result per group entry, in group order.
+ * @param count   Number of entries in the group.
+ * @param param   User parameter passed to ADC_Scan_Start().
+ */
+typedef void (*adc_scan_callback_t)(const uint16_t *results, uint8_t count, void *param);
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t ADC_Scan_Start(const adc_inputchannel_t *channels, uint8_t count,
+                        adc_scan_callback_t callback, void *param);
+void ADC_Scan_Stop(void);
+
+#endif /* ADC_SCAN_H_ */
@@ -0,0 +1,338 @@
+/**
+ ******************************************************************************
+ * @file      adc_stream.c
+ * @brief     Streaming acquisition: eDMA moves every ADC0 result into a
+ * circular RAM buffer and reports each filled half.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "adc_stream.h"
+#include "adc_sampler.h"
+#include "S32K144.h"
+#include "clock_gate.h"
+#include "dma_alloc.h"
+#include "irq_prio.h"
+#include "prof.h"
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Most urgent channel: a result not moved before the next conversion is lost
+#define ADC_STREAM_DMA_PRIO     15U
+
+#define ADC_STREAM_CHAIN_TCDS   (2U * ADC_STREAM_MAX_BATCH)
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Ring filled by the eDMA, one 12-bit result per ADC0 conversion; the
+// batched chain uses all of it, the plain ring the first ADC_STREAM_LENGTH.
+// Only read once the eDMA has filled it, so start-up does not clear it
+static PERF_NOINIT uint16_t s_ring[ADC_STREAM_BLOCK * ADC_STREAM_CHAIN_TCDS];
+
+// Taken on the first start and kept across stops
+static uint8_t s_channel;
+static bool s_have_channel;
+
+// Chain of one TCD per block for the batched mode, from the TCD pool
+static edma_software_tcd_t *s_tcds;
+static uint8_t s_tcd_count;
+
+// Blocks per wake-up, and which half of the chain completes next
+static uint8_t s_batch;
+static uint8_t s_half;
+
+static adc_stream_callback_t s_callback;
+static void *s_param;
+
+// Set while the stream holds the ADC0 and eDMA clocks
+static bool s_running;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief eDMA channel callback for both the half and the major loop interrupt.
+ * @details The TCD does not say which of the two fired, so the remaining
+ * major count tells them apart: just past the middle it is at most half the
+ * ring, just after the wrap it has been reloaded to the full length. The
+ * entry latency, counted from the trigger of the block's last sample, goes
+ * to PROF_HIST_ISR_DMA.
+ */
+PERF_HOT static void ADC_Stream_DmaCallback(void *parameter, edma_chn_status_t status)
+{
+    uint32_t remaining;
+    const uint16_t *block;
+
+    Prof_Hist(PROF_HIST_ISR_DMA, Sampler_TriggerAge(Prof_TimestampHz()));
+    (void)parameter;
+
+    if ((status != EDMA_CHN_NORMAL) || (s_callback == NULL))
+    {
+        return;
+    }
+
+    remaining = EDMA_DRV_GetRemainingMajorIterationsCount(s_channel);
+    block = (remaining <= ADC_STREAM_BLOCK) ? &s_ring[0] : &s_ring[ADC_STREAM_BLOCK];
+    s_callback(block, ADC_STREAM_BLOCK, s_param);
+}
+
+/**
+ * @brief eDMA channel callback of the batched chain.
+ * @details Only the last TCD of each half of the chain raises an interrupt,
+ * so each call means s_batch more blocks are complete; they are handed to
+ * the hook in order. The halves alternate, so a software index is enough.
+ */
+PERF_HOT static void ADC_Stream_ChainCallback(void *parameter, edma_chn_status_t status)
+{
+    const uint16_t *block;
+    uint8_t i;
+
+    Prof_Hist(PROF_HIST_ISR_DMA, Sampler_TriggerAge(Prof_TimestampHz()));
+    (void)parameter;
+
+    if ((status != EDMA_CHN_NORMAL) || (s_callback == NULL))
+    {
+        return;
+    }
+
+    block = &s_ring[(uint32_t)s_half * s_batch * ADC_STREAM_BLOCK];
+    s_half ^= 1U;
+    for (i = 0; i < s_batch; i++)
+    {
+        s_callback(block, ADC_STREAM_BLOCK, s_param);
+        block += ADC_STREAM_BLOCK;
+    }
+}
+
+/**
+ * @brief Programs the plain ring: one TCD that wraps by itself, with the
+ * half and major loop interrupts marking the two blocks.
+ */
+static status_t ADC_Stream_ConfigRing(void)
+{
+    edma_loop_transfer_config_t loop_config;
+    edma_transfer_config_t transfer_config;
+    status_t status;
+
+    // Fixed source, destination walks the ring and wraps after the major loop
+    loop_config.majorLoopIterationCount = ADC_STREAM_LENGTH;
+    loop_config.srcOffsetEnable = false;
+    loop_config.dstOffsetEnable = false;
+    loop_config.minorLoopOffset = 0;
+    loop_config.minorLoopChnLinkEnable = false;
+    loop_config.majorLoopChnLinkEnable = false;
+
+    transfer_config.srcAddr = (uint32_t)&ADC0->R[0];
+    transfer_config.destAddr = (uint32_t)s_ring;
+    transfer_config.srcTransferSize = EDMA_TRANSFER_SIZE_2B;
+    transfer_config.destTransferSize = EDMA_TRANSFER_SIZE_2B;
+    transfer_config.srcOffset = 0;
+    transfer_config.destOffset = (int16_t)sizeof(s_ring[0]);
+    transfer_config.srcLastAddrAdjust = 0;
+    transfer_config.destLastAddrAdjust = -(int32_t)(ADC_STREAM_LENGTH * sizeof(s_ring[0]));
+    transfer_config.srcModulo = EDMA_MODULO_OFF;
+    transfer_config.destModulo = EDMA_MODULO_OFF;
+    transfer_config.minorByteTransferCount = sizeof(s_ring[0]);
+    transfer_config.scatterGatherEnable = false;
+    transfer_config.interruptEnable = true;
+    transfer_config.loopTransferConfig = &loop_config;
+
+    status = EDMA_DRV_ConfigLoopTransfer(s_channel, &transfer_config);
+    if (status == STATUS_SUCCESS)
+    {
+        EDMA_DRV_ConfigureInterrupt(s_channel, EDMA_CHN_HALF_MAJOR_LOOP_INT, true);
+        (void)EDMA_DRV_InstallCallback(s_channel, ADC_Stream_DmaCallback, NULL);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Programs the batched chain: one software TCD per block, each
+ * linking to the next and the last back to the first, so the eDMA keeps
+ * reloading them without the CPU.
+ * @details The TCD of the first block is also written to the channel; the
+ * engine fetches the rest through the scatter/gather link at the end of
+ * every block.
+ */
+static void ADC_Stream_ConfigChain(void)
+{
+    edma_loop_transfer_config_t loop_config;
+    edma_transfer_config_t transfer_config;
+    uint8_t i;
+
+    loop_config.majorLoopIterationCount = ADC_STREAM_BLOCK;
+    loop_config.srcOffsetEnable = false;
+    loop_config.dstOffsetEnable = false;
+    loop_config.minorLoopOffset = 0;
+    loop_config.minorLoopChnLinkEnable = false;
+    loop_config.majorLoopChnLinkEnable = false;
+
+    transfer_config.srcAddr = (uint32_t)&ADC0->R[0];
+    transfer_config.srcTransferSize = EDMA_TRANSFER_SIZE_2B;
+    transfer_config.destTransferSize = EDMA_TRANSFER_SIZE_2B;
+    transfer_config.srcOffset = 0;
+    transfer_config.destOffset = (int16_t)sizeof(s_ring[0]);
+    transfer_config.srcLastAddrAdjust = 0;
+    transfer_config.destLastAddrAdjust = 0;
+    transfer_config.srcModulo = EDMA_MODULO_OFF;
+    transfer_config.destModulo = EDMA_MODULO_OFF;
+    transfer_config.minorByteTransferCount = sizeof(s_ring[0]);
+    transfer_config.scatterGatherEnable = true;
+    transfer_config.loopTransferConfig = &loop_config;
+
+    // Built from the last TCD down, so the first one is left in transfer_config
+    for (i = s_tcd_count; i-- > 0U;)
+    {
+        transfer_config.destAddr = (uint32_t)&s_ring[(uint32_t)i * ADC_STREAM_BLOCK];
+        transfer_config.scatterGatherNextDescAddr = (uint32_t)&s_tcds[(i + 1U) % s_tcd_count];
+        transfer_config.interruptEnable = (((i + 1U) % s_batch) == 0U);
+        EDMA_DRV_PushConfigToSTCD(&transfer_config, &s_tcds[i]);
+    }
+
+    EDMA_DRV_PushConfigToReg(s_channel, &transfer_config);
+    EDMA_DRV_ConfigureInterrupt(s_channel, EDMA_CHN_HALF_MAJOR_LOOP_INT, false);
+    (void)EDMA_DRV_InstallCallback(s_channel, ADC_Stream_ChainCallback, NULL);
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Starts streaming ADC0 results into the RAM ring.
+ * @details ADC0 must already be set up by Sampler_Init(). Its DMA request is
+ * enabled here, so each conversion complete moves R[0] into the ring (which
+ * also clears COCO) and the CPU is only interrupted once per half ring.
+ * Sampler_GetLatest() is not usable while streaming. ADC0 and the eDMA
+ * stay clocked until ADC_Stream_Stop().
+ * @param callback Block hook, called from interrupt context.
+ * @param param    User parameter for the hook.
+ * @return Status of the eDMA channel allocation or configuration.
+ */
+status_t ADC_Stream_Start(adc_stream_callback_t callback, void *param)
+{
+    return ADC_Stream_StartBatched(callback, param, 1U);
+}
+
+/**
+ * @brief Starts streaming with the CPU woken once per batch of blocks.
+ * @details With batch above 1 the eDMA runs a closed chain of 2 * batch
+ * linked TCDs: PDB0 triggers ADC0, the eDMA moves each result and loads
+ * the next block's TCD itself, and only the last block of each half of the
+ * chain interrupts. The hook then runs batch times back to back, once per
+ * block, each block staying valid for batch block periods. Anything that
+ * must act between two particular blocks, like the bandgap channel switch,
+ * needs batch 1. The chain's TCDs come from the DMA_Alloc_Tcds() pool.
+ * @param callback Block hook, called from interrupt context.
+ * @param param    User parameter for the hook.
+ * @param batch    Blocks per wake-up, 1 to ADC_STREAM_MAX_BATCH.
+ * @return STATUS_BUSY if no channel or TCDs are left, otherwise the status
+ *         of the eDMA channel configuration.
+ */
+status_t ADC_Stream_StartBatched(adc_stream_callback_t callback, void *param, uint8_t batch)
+{
+    adc_converter_config_t converter;
+    status_t status;
+
+    if ((batch == 0U) || (batch > ADC_STREAM_MAX_BATCH))
+    {
+        return STATUS_ERROR;
+    }
+
+    if (!s_have_channel)
+    {
+        status = DMA_Alloc_Channel(EDMA_REQ_ADC0, ADC_STREAM_DMA_PRIO, IRQ_PRIO_DMA, &s_channel);
+        if (status != STATUS_SUCCESS)
+        {
+            return status;
+        }
+        s_have_channel = true;
+    }
+
+    if ((batch > 1U) && (s_tcd_count != (2U * batch)))
+    {
+        DMA_Alloc_FreeTcds(s_tcds, s_tcd_count);
+        s_tcd_count = 0;
+        s_tcds = DMA_Alloc_Tcds(2U * batch);
+        if (s_tcds == NULL)
+        {
+            return STATUS_BUSY;
+        }
+        s_tcd_count = 2U * batch;
+    }
+
+    if (!s_running)
+    {
+        ClockGate_Acquire(CLOCK_GATE_DMA);
+        ClockGate_Acquire(CLOCK_GATE_ADC0);
+        s_running = true;
+    }
+    (void)EDMA_DRV_StopChannel(s_channel);
+    s_callback = callback;
+    s_param = param;
+    s_batch = batch;
+    s_half = 0;
+
+    if (batch == 1U)
+    {
+        status = ADC_Stream_ConfigRing();
+        if (status != STATUS_SUCCESS)
+        {
+            ADC_Stream_Stop();
+            return status;
+        }
+    }
+    else
+    {
+        ADC_Stream_ConfigChain();
+    }
+
+    status = EDMA_DRV_StartChannel(s_channel);
+    if (status != STATUS_SUCCESS)
+    {
+        ADC_Stream_Stop();
+        return status;
+    }
+
+    // Let conversion complete raise DMA requests instead of being polled
+    ADC_DRV_GetConverterConfig(SAMPLER_ADC_INSTANCE, &converter);
+    converter.dmaEnable = true;
+    ADC_DRV_ConfigConverter(SAMPLER_ADC_INSTANCE, &converter);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stops streaming, returns ADC0 to CPU-read results and releases
+ * the clocks taken by ADC_Stream_Start().
+ */
+void ADC_Stream_Stop(void)
+{
+    adc_converter_config_t converter;
+
+    if (!s_running)
+    {
+        return;
+    }
+
+    ADC_DRV_GetConverterConfig(SAMPLER_ADC_INSTANCE, &converter);
+    converter.dmaEnable = false;
+    ADC_DRV_ConfigConverter(SAMPLER_ADC_INSTANCE, &converter);
+
+    (void)EDMA_DRV_StopChannel(s_channel);
+
+    s_running = false;
+    ClockGate_Release(CLOCK_GATE_ADC0);
+    ClockGate_Release(CLOCK_GATE_DMA);
+}
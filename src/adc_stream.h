@@ -0,0 +1,49 @@
+/**
+ ******************************************************************************
+ * @file      adc_stream.h
+ * @brief     Streaming acquisition: eDMA moves every ADC0 result into a
+ * circular RAM buffer and reports each filled half.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef ADC_STREAM_H_
+#define ADC_STREAM_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define ADC_STREAM_LENGTH       128U                     // Ring size in samples
+#define ADC_STREAM_BLOCK        (ADC_STREAM_LENGTH / 2U) // Samples per half-buffer event
+#define ADC_STREAM_MAX_BATCH    4U                       // Blocks per wake-up in the batched mode
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Block hook, called from the eDMA interrupt each time half of the ring fills.
+ * @param block Filled half of the ring; stays valid for ADC_STREAM_BLOCK sample periods
+ *              (times the batch with ADC_Stream_StartBatched()).
+ * @param count Number of samples in the block (ADC_STREAM_BLOCK).
+ * @param param User parameter passed to ADC_Stream_Start().
+ */
+typedef void (*adc_stream_callback_t)(const uint16_t *block, uint32_t count, void *param);
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t ADC_Stream_Start(adc_stream_callback_t callback, void *param);
+status_t ADC_Stream_StartBatched(adc_stream_callback_t callback, void *param, uint8_t batch);
+void ADC_Stream_Stop(void);
+
+#endif /* ADC_STREAM_H_ */
@@ -0,0 +1,268 @@
+/**
+ ******************************************************************************
+ * @file      agg.c
+ * @brief     Incremental sliding-window statistics: min, max, mean and
+ * standard deviation over a configurable span, at a constant cost per sample.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "agg.h"
+#include <stddef.h>
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Empties the bucket being filled.
+ */
+static void Agg_ClearBucket(agg_bucket_t *b)
+{
+    b->sum = 0;
+    b->count = 0;
+    b->sumsq = 0;
+    b->min = INT16_MAX;
+    b->max = INT16_MIN;
+}
+
+/**
+ * @brief Wraps a deque or ring position that ran past the window length.
+ */
+static uint16_t Agg_Wrap(const agg_window_t *w, uint32_t pos)
+{
+    return (uint16_t)((pos >= w->length) ? (pos - w->length) : pos);
+}
+
+/**
+ * @brief Moves the bucket being filled into the window.
+ * @details The bucket that falls out is subtracted from the totals and
+ * leaves the front of the deques. The new one enters the deques from the
+ * back after every entry it dominates is dropped, so each bucket enters
+ * and leaves a deque once: amortized constant, at most length steps.
+ */
+static void Agg_CloseBucket(agg_window_t *w)
+{
+    agg_slot_t *slots = w->slots;
+    const agg_bucket_t *cur = &w->cur;
+    agg_bucket_t *old = &slots[w->pos].bucket;
+    uint32_t seq = w->seq;
+    uint16_t back;
+
+    if (seq >= w->length)
+    {
+        w->sum -= old->sum;
+        w->sumsq -= old->sumsq;
+        w->count -= old->count;
+    }
+    if ((w->min_count != 0U) && ((seq - slots[w->min_front].min.seq) >= w->length))
+    {
+        w->min_front = Agg_Wrap(w, (uint32_t)w->min_front + 1U);
+        w->min_count--;
+    }
+    if ((w->max_count != 0U) && ((seq - slots[w->max_front].max.seq) >= w->length))
+    {
+        w->max_front = Agg_Wrap(w, (uint32_t)w->max_front + 1U);
+        w->max_count--;
+    }
+
+    *old = *cur;
+    w->sum += cur->sum;
+    w->sumsq += cur->sumsq;
+    w->count += cur->count;
+
+    // An empty bucket has no extremes; it only ages the others
+    if (cur->count != 0U)
+    {
+        while ((w->min_count != 0U) &&
+               (slots[Agg_Wrap(w, (uint32_t)w->min_front + w->min_count - 1U)].min.value >= cur->min))
+        {
+            w->min_count--;
+        }
+        back = Agg_Wrap(w, (uint32_t)w->min_front + w->min_count);
+        slots[back].min.seq = seq;
+        slots[back].min.value = cur->min;
+        w->min_count++;
+
+        while ((w->max_count != 0U) &&
+               (slots[Agg_Wrap(w, (uint32_t)w->max_front + w->max_count - 1U)].max.value <= cur->max))
+        {
+            w->max_count--;
+        }
+        back = Agg_Wrap(w, (uint32_t)w->max_front + w->max_count);
+        slots[back].max.seq = seq;
+        slots[back].max.value = cur->max;
+        w->max_count++;
+    }
+
+    w->seq = seq + 1U;
+    w->pos = Agg_Wrap(w, (uint32_t)w->pos + 1U);
+    Agg_ClearBucket(&w->cur);
+}
+
+/**
+ * @brief Integer square root, rounded down.
+ */
+static uint32_t Agg_Sqrt(uint64_t x)
+{
+    uint64_t root = 0;
+    uint64_t bit = 1ULL << 62;
+
+    while (bit > x)
+    {
+        bit >>= 2;
+    }
+    while (bit != 0U)
+    {
+        if (x >= (root + bit))
+        {
+            x -= root + bit;
+            root = (root >> 1) + bit;
+        }
+        else
+        {
+            root >>= 1;
+        }
+        bit >>= 2;
+    }
+
+    return (uint32_t)root;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Sets up an empty window spanning length * bucket_ms.
+ * @details Samples are grouped into buckets by arrival time, so the window
+ * slides one bucket at a time and its storage does not depend on the
+ * sample rate: 60 buckets of 60 s make an hour at any input rate.
+ * @param w         Window to initialize.
+ * @param slots     Array of length slots.
+ * @param length    Buckets in the window, 1..65535.
+ * @param bucket_ms Bucket period, non-zero.
+ * @return false on an invalid argument.
+ */
+bool Agg_Init(agg_window_t *w, agg_slot_t *slots, uint16_t length, uint32_t bucket_ms)
+{
+    if ((w == NULL) || (slots == NULL) || (length == 0U) || (bucket_ms == 0U))
+    {
+        return false;
+    }
+
+    w->slots = slots;
+    w->length = length;
+    w->bucket_ms = bucket_ms;
+    Agg_Reset(w);
+
+    return true;
+}
+
+/**
+ * @brief Drops every sample; the next one starts a new first bucket.
+ */
+void Agg_Reset(agg_window_t *w)
+{
+    uint16_t i;
+
+    for (i = 0; i < w->length; i++)
+    {
+        Agg_ClearBucket(&w->slots[i].bucket);
+    }
+    Agg_ClearBucket(&w->cur);
+    w->started = false;
+    w->seq = 0;
+    w->pos = 0;
+    w->sum = 0;
+    w->sumsq = 0;
+    w->count = 0;
+    w->min_front = 0;
+    w->min_count = 0;
+    w->max_front = 0;
+    w->max_count = 0;
+}
+
+/**
+ * @brief Adds one sample taken at now_ms.
+ * @details A handful of adds and compares into the current bucket; buckets
+ * whose period has passed are closed first. A gap longer than the whole
+ * window restarts it instead of closing every empty bucket in between.
+ * @param w      Window to update.
+ * @param value  Sample.
+ * @param now_ms Time of the sample, non-decreasing between calls.
+ */
+void Agg_Push(agg_window_t *w, int16_t value, uint32_t now_ms)
+{
+    agg_bucket_t *cur = &w->cur;
+
+    if (!w->started)
+    {
+        w->cur_start_ms = now_ms;
+        w->started = true;
+    }
+    else if ((now_ms - w->cur_start_ms) >= w->bucket_ms)
+    {
+        if (((now_ms - w->cur_start_ms) / w->bucket_ms) > w->length)
+        {
+            Agg_Reset(w);
+            w->cur_start_ms = now_ms;
+            w->started = true;
+        }
+        while ((now_ms - w->cur_start_ms) >= w->bucket_ms)
+        {
+            Agg_CloseBucket(w);
+            w->cur_start_ms += w->bucket_ms;
+        }
+    }
+
+    cur->sum += value;
+    cur->count++;
+    cur->sumsq += (uint64_t)((int32_t)value * value);
+    if (value < cur->min)
+    {
+        cur->min = value;
+    }
+    if (value > cur->max)
+    {
+        cur->max = value;
+    }
+}
+
+/**
+ * @brief Statistics over the completed buckets in the window.
+ * @details The totals are exact integers, so the variance comes straight
+ * from n*sumsq - sum^2 without the cancellation a float version would
+ * suffer, and without the per-sample division of Welford's update. The
+ * divisions and the square root happen here, once per query.
+ * @param w      Window to read.
+ * @param result Destination.
+ * @return false while no completed bucket holds a sample.
+ */
+bool Agg_Get(const agg_window_t *w, agg_result_t *result)
+{
+    uint64_t spread;
+    int64_t half;
+
+    if ((w->count == 0U) || (w->min_count == 0U))
+    {
+        return false;
+    }
+
+    result->count = w->count;
+    result->min = w->slots[w->min_front].min.value;
+    result->max = w->slots[w->max_front].max.value;
+
+    half = (int64_t)(w->count / 2U);
+    result->mean_q8 = (int32_t)(((w->sum * 256) + ((w->sum >= 0) ? half : -half)) / (int64_t)w->count);
+
+    // n * variance = sumsq - sum^2 / n, then scaled to Q16 for a Q8 root
+    spread = w->sumsq - (uint64_t)((w->sum * w->sum) / (int64_t)w->count);
+    result->stddev_q8 = Agg_Sqrt((spread << 16) / w->count);
+
+    return true;
+}
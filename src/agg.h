@@ -0,0 +1,106 @@
+/**
+ ******************************************************************************
+ * @file      agg.h
+ * @brief     Incremental sliding-window statistics: min, max, mean and
+ * standard deviation over a configurable span, at a constant cost per sample.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef AGG_H_
+#define AGG_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Totals of the samples that arrived within one bucket period.
+ */
+typedef struct
+{
+    int32_t sum;
+    uint32_t count;
+    uint64_t sumsq;
+    int16_t min;
+    int16_t max;
+} agg_bucket_t;
+
+/**
+ * @brief Entry of a monotonic deque: bucket number and its extreme value.
+ */
+typedef struct
+{
+    uint32_t seq;
+    int16_t value;
+} agg_extreme_t;
+
+/**
+ * @brief Per-bucket storage; one array of these per window, owned by the
+ * caller. The deque entries share the array only for sizing, not by index.
+ */
+typedef struct
+{
+    agg_bucket_t bucket;
+    agg_extreme_t min;
+    agg_extreme_t max;
+} agg_slot_t;
+
+/**
+ * @brief Window of the last `length` completed buckets of `bucket_ms` each.
+ */
+typedef struct
+{
+    agg_slot_t *slots;
+    uint16_t length;
+    uint32_t bucket_ms;
+
+    // Bucket being filled
+    agg_bucket_t cur;
+    uint32_t cur_start_ms;
+    bool started;
+
+    // Totals over the completed buckets in the window
+    uint32_t seq;               // Buckets completed so far
+    uint16_t pos;               // Slot the next completed bucket goes to
+    int64_t sum;
+    uint64_t sumsq;
+    uint32_t count;
+
+    // Monotonic deques: increasing minima and decreasing maxima, oldest first
+    uint16_t min_front;
+    uint16_t min_count;
+    uint16_t max_front;
+    uint16_t max_count;
+} agg_window_t;
+
+/**
+ * @brief Statistics of one window. Mean and standard deviation are in the
+ * sample unit with 8 fraction bits.
+ */
+typedef struct
+{
+    uint32_t count;
+    int16_t min;
+    int16_t max;
+    int32_t mean_q8;
+    uint32_t stddev_q8;
+} agg_result_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+bool Agg_Init(agg_window_t *w, agg_slot_t *slots, uint16_t length, uint32_t bucket_ms);
+void Agg_Reset(agg_window_t *w);
+void Agg_Push(agg_window_t *w, int16_t value, uint32_t now_ms);
+bool Agg_Get(const agg_window_t *w, agg_result_t *result);
+
+#endif /* AGG_H_ */
@@ -0,0 +1,113 @@
+/**
+ ******************************************************************************
+ * @file      anomaly.c
+ * @brief     Streaming anomaly stage for sensor samples: spike rejection
+ * beyond a maximum slew rate and sustained-trend flags from a fixed-point
+ * derivative, in a bounded few cycles per sample.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "anomaly.h"
+#include <stddef.h>
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Initializes the stage; the first sample seeds it.
+ * @param a   Stage state.
+ * @param cfg Limits, must stay valid.
+ */
+void Anomaly_Init(anomaly_t *a, const anomaly_config_t *cfg)
+{
+    a->cfg = cfg;
+    a->slope = 0;
+    a->spikes = 0;
+    a->last = 0;
+    a->rejects = 0;
+    a->trend = 0;
+    a->primed = 0;
+}
+
+/**
+ * @brief Checks one sample against the slew limit and updates the trend.
+ * @details A sample further than max_step from the last accepted one is a
+ * glitch and replaced by it, up to max_rejects in a row; the next one that
+ * is still that far away is accepted as a real step and restarts the
+ * derivative. Accepted samples feed the derivative, an EMA of the
+ * sample-to-sample difference, which flags a trend above trend_slope and
+ * clears it below half of that. No loops and no divisions, so the cost is
+ * the same for every sample.
+ * @param x     Sample.
+ * @param flags Out: ANOMALY_* flags of this sample.
+ * @return @p x, or the last accepted sample for a spike.
+ */
+PERF_HOT uint16_t Anomaly_Process(anomaly_t *a, uint16_t x, uint8_t *flags)
+{
+    const anomaly_config_t *cfg = a->cfg;
+    int32_t delta, slope;
+    uint8_t trend;
+    uint8_t out = 0;
+
+    if (a->primed == 0U)
+    {
+        a->last = x;
+        a->primed = 1;
+        *flags = 0;
+        return x;
+    }
+
+    delta = (int32_t)x - (int32_t)a->last;
+    if ((delta > (int32_t)cfg->max_step) || (delta < -(int32_t)cfg->max_step))
+    {
+        if (a->rejects < cfg->max_rejects)
+        {
+            a->rejects++;
+            a->spikes++;
+            *flags = (uint8_t)(ANOMALY_SPIKE | a->trend);
+            return a->last;
+        }
+
+        // Held beyond the limit: a new level, whose jump is no trend
+        out = ANOMALY_STEP;
+        delta = 0;
+        a->slope = 0;
+    }
+    a->rejects = 0;
+    a->last = x;
+
+    // Scaled by a multiply, as a falling delta is negative and may not be
+    // shifted left; the arithmetic right shift rounds the EMA down either way
+    a->slope += ((delta * (int32_t)(1UL << ANOMALY_SLOPE_FRAC_BITS)) - a->slope) >> cfg->slope_shift;
+    slope = a->slope;
+
+    trend = a->trend;
+    if (slope > cfg->trend_slope)
+    {
+        trend = ANOMALY_RISING;
+    }
+    else if (slope < -cfg->trend_slope)
+    {
+        trend = ANOMALY_FALLING;
+    }
+    else if ((slope < (cfg->trend_slope / 2)) && (slope > -(cfg->trend_slope / 2)))
+    {
+        trend = 0;
+    }
+    if (trend != a->trend)
+    {
+        out |= ANOMALY_TREND_EDGE;
+        a->trend = trend;
+    }
+
+    *flags = (uint8_t)(out | trend);
+
+    return x;
+}
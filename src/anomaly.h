@@ -0,0 +1,73 @@
+/**
+ ******************************************************************************
+ * @file      anomaly.h
+ * @brief     Streaming anomaly stage for sensor samples: spike rejection
+ * beyond a maximum slew rate and sustained-trend flags from a fixed-point
+ * derivative, in a bounded few cycles per sample.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef ANOMALY_H_
+#define ANOMALY_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Fraction bits of the smoothed derivative
+#define ANOMALY_SLOPE_FRAC_BITS 8U
+
+// Flags returned with every sample
+#define ANOMALY_SPIKE       0x01U  // Beyond the slew limit: replaced by the last accepted sample
+#define ANOMALY_STEP        0x02U  // Beyond the limit for longer than a glitch: taken as the new level
+#define ANOMALY_RISING      0x04U  // Sustained rise, held until the slope falls to half the limit
+#define ANOMALY_FALLING     0x08U  // Sustained fall, likewise
+#define ANOMALY_TREND_EDGE  0x10U  // RISING or FALLING changed with this sample
+
+// Flags worth an event: everything but a steady trend
+#define ANOMALY_EVENT_MASK  (ANOMALY_SPIKE | ANOMALY_STEP | ANOMALY_TREND_EDGE)
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Limits, in the units of the samples fed in; see TEMP_TO_RAW_DELTA().
+ */
+typedef struct
+{
+    uint16_t max_step;      // Largest change one sample period can physically bring
+    uint8_t max_rejects;    // Consecutive rejected samples before a jump counts as a step
+    uint8_t slope_shift;    // Derivative smoothing, an EMA with alpha = 2^-slope_shift
+    int32_t trend_slope;    // Smoothed derivative, ANOMALY_SLOPE_FRAC_BITS fraction bits per sample, that is a trend
+} anomaly_config_t;
+
+/**
+ * @brief Stage state; Anomaly_Init() sets it up.
+ */
+typedef struct
+{
+    const anomaly_config_t *cfg;
+    int32_t slope;          // Smoothed derivative, ANOMALY_SLOPE_FRAC_BITS fraction bits
+    uint32_t spikes;        // Samples rejected since Anomaly_Init()
+    uint16_t last;          // Last accepted sample
+    uint8_t rejects;        // Samples rejected in a row
+    uint8_t trend;          // ANOMALY_RISING, ANOMALY_FALLING or 0
+    uint8_t primed;
+} anomaly_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void Anomaly_Init(anomaly_t *a, const anomaly_config_t *cfg);
+uint16_t Anomaly_Process(anomaly_t *a, uint16_t x, uint8_t *flags);
+
+#endif /* ANOMALY_H_ */
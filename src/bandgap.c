@@ -0,0 +1,194 @@
+/**
+ ******************************************************************************
+ * @file      bandgap.c
+ * @brief     Supply compensation from the ADC0 internal bandgap: an
+ * occasional bandgap block in the sample stream tracks the actual reference
+ * voltage, and a ratiometric factor corrects every block in between.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "bandgap.h"
+#include "adc_sampler.h"
+#include "dsp_stats.h"
+#include "temp_conv.h"
+#include "board_fixed.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Bandgap reading, in 1/16 counts, of a reference at exactly TEMP_ADC_VREF_MV
+#define BANDGAP_NOMINAL_Q4      (((BANDGAP_MV * TEMP_ADC_MAX_VALUE * 16U) + (TEMP_ADC_VREF_MV / 2U)) / \
+                                 TEMP_ADC_VREF_MV)
+
+// Readings further than this fraction from the expected one are taken as a
+// fault, not as drift
+#define BANDGAP_MAX_DEVIATION_DIV 5U
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static adc_inputchannel_t s_channel;
+static uint16_t s_every;
+static uint16_t s_count;
+
+// Set while the block being filled converts the bandgap
+static bool s_measuring;
+
+// Reference correction, Q16; the nominal one until the first measurement
+static volatile uint32_t s_factor = BANDGAP_FACTOR_ONE;
+static bool s_have_factor;
+
+// Correction of the reference as wired, see Bandgap_SetReference(), and the
+// bandgap reading, in 1/16 counts, that it gives
+static uint32_t s_nominal = BANDGAP_FACTOR_ONE;
+static uint32_t s_expected_q4 = BANDGAP_NOMINAL_Q4;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Selects the input of the next hardware-triggered conversions.
+ * @details Keeps the interrupt enable, which the temperature monitor owns.
+ */
+static void Bandgap_Select(adc_inputchannel_t channel)
+{
+    BoardFixed_AdcSelectInput((uint32_t)channel);
+}
+
+/**
+ * @brief Folds one bandgap block into the correction factor.
+ * @details The reference is VBG * 4095 / reading, so the factor scaling a
+ * reading taken against it to one against the nominal reference is the
+ * nominal bandgap reading over the measured one.
+ */
+static void Bandgap_Update(const uint16_t *block, uint32_t count)
+{
+    uint32_t n = count - BANDGAP_SETTLE_SAMPLES;
+    uint32_t mean_q4;
+    uint32_t factor;
+    uint32_t deviation = s_expected_q4 / BANDGAP_MAX_DEVIATION_DIV;
+
+    // Raw results are scaled to 12 bits, as Sampler_Decimate() does
+    mean_q4 = ((DSP_Sum_u16(&block[BANDGAP_SETTLE_SAMPLES], n) << (4U + Sampler_ResultShift())) + (n / 2U)) / n;
+    if ((mean_q4 + deviation < s_expected_q4) || (mean_q4 > s_expected_q4 + deviation))
+    {
+        return;
+    }
+
+    factor = (uint32_t)((((uint64_t)BANDGAP_NOMINAL_Q4 << 16) + (mean_q4 / 2U)) / mean_q4);
+    if (!s_have_factor)
+    {
+        s_factor = factor;
+        s_have_factor = true;
+    }
+    else
+    {
+        s_factor = (uint32_t)((int32_t)s_factor + (((int32_t)factor - (int32_t)s_factor) >> BANDGAP_SMOOTH_SHIFT));
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Sets the reference voltage the board is wired for.
+ * @details Readings are corrected by this until the first bandgap
+ * measurement, and for good with compensation off. Call before
+ * Bandgap_Init(), which starts from it.
+ * @param vref_mv ADC reference in millivolts; TEMP_ADC_VREF_MV, or 0, needs
+ *                no correction.
+ */
+void Bandgap_SetReference(uint16_t vref_mv)
+{
+    uint32_t mv = (vref_mv == 0U) ? TEMP_ADC_VREF_MV : vref_mv;
+
+    s_nominal = (uint32_t)((((uint64_t)mv << 16) + (TEMP_ADC_VREF_MV / 2U)) / TEMP_ADC_VREF_MV);
+    s_factor = s_nominal;
+    s_expected_q4 = ((BANDGAP_MV * TEMP_ADC_MAX_VALUE * 16U) + (mv / 2U)) / mv;
+}
+
+/**
+ * @brief Turns on supply compensation for the ADC0 stream.
+ * @details Call after Sampler_Init(). One block in every_blocks is spent
+ * on the bandgap instead of the sensor; the first measurement is taken
+ * after every_blocks - 1 sensor blocks.
+ * @param channel      Sensor input that Sampler_Init() selected.
+ * @param every_blocks Period of the bandgap block, at least 2; 0 turns
+ *                     compensation off.
+ */
+void Bandgap_Init(adc_inputchannel_t channel, uint16_t every_blocks)
+{
+    s_channel = channel;
+    s_every = ((every_blocks == 1U) ? 2U : every_blocks);
+    s_count = 0;
+    s_measuring = false;
+    s_factor = s_nominal;
+    s_have_factor = false;
+}
+
+/**
+ * @brief Block hook; call first thing from the ADC stream callback.
+ * @details The input is switched right after a block completes, while the
+ * ADC waits for its next trigger, so the following block is converted
+ * from the bandgap as a whole and the one after from the sensor again. The
+ * switch must happen within one sample period of the block interrupt,
+ * which the DMA priority level guarantees.
+ * @param block ADC results of the completed block.
+ * @param count Number of results, more than BANDGAP_SETTLE_SAMPLES.
+ * @return true if the block was a bandgap block; it holds no sensor data.
+ */
+bool Bandgap_OnBlock(const uint16_t *block, uint32_t count)
+{
+    if (s_every == 0U)
+    {
+        return false;
+    }
+
+    if (s_measuring)
+    {
+        Bandgap_Select(s_channel);
+        s_measuring = false;
+        s_count = 0;
+        if (count > BANDGAP_SETTLE_SAMPLES)
+        {
+            Bandgap_Update(block, count);
+        }
+        return true;
+    }
+
+    if (++s_count >= (s_every - 1U))
+    {
+        Bandgap_Select(ADC_INPUTCHAN_BANDGAP);
+        s_measuring = true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief Scales a sensor reading to what it would be against the nominal reference.
+ * @details One multiply and shift per block result, at any oversampled width.
+ * @param raw Decimated sensor result.
+ * @return Corrected result.
+ */
+uint32_t Bandgap_Correct(uint32_t raw)
+{
+    return (uint32_t)((((uint64_t)raw * s_factor) + 0x8000U) >> 16);
+}
+
+/**
+ * @brief Returns the current correction factor, Q16 (BANDGAP_FACTOR_ONE = no correction).
+ */
+uint32_t Bandgap_Factor(void)
+{
+    return s_factor;
+}
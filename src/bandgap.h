@@ -0,0 +1,44 @@
+/**
+ ******************************************************************************
+ * @file      bandgap.h
+ * @brief     Supply compensation from the ADC0 internal bandgap: an
+ * occasional bandgap block in the sample stream tracks the actual reference
+ * voltage, and a ratiometric factor corrects every block in between.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef BANDGAP_H_
+#define BANDGAP_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "adc_driver.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#ifndef BANDGAP_MV
+#define BANDGAP_MV              1000U    // Nominal bandgap voltage (datasheet VBG)
+#endif
+
+#define BANDGAP_SETTLE_SAMPLES  4U       // Leading results of a bandgap block that are not used
+#define BANDGAP_SMOOTH_SHIFT    2U       // Each measurement moves the factor 1/4 of the way
+#define BANDGAP_FACTOR_ONE      0x10000UL // Q16 factor of a reference exactly at TEMP_ADC_VREF_MV
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void Bandgap_SetReference(uint16_t vref_mv);
+void Bandgap_Init(adc_inputchannel_t channel, uint16_t every_blocks);
+bool Bandgap_OnBlock(const uint16_t *block, uint32_t count);
+uint32_t Bandgap_Correct(uint32_t raw);
+uint32_t Bandgap_Factor(void);
+
+#endif /* BANDGAP_H_ */
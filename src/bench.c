@@ -0,0 +1,631 @@
+/**
+ ******************************************************************************
+ * @file      bench.c
+ * @brief     On-target benchmark runner for the Benchmark_FLASH configuration:
+ * times the LCD, I2C, ADC and temperature conversion paths with the DWT cycle
+ * counter and prints the results over semihosting.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "S32K144.h"
+#include "peripherals_lpi2c_config_1.h"
+#include "clock_config.h"	// clockMan1_InitConfig0
+#include "pin_mux.h"		// NUM_OF_CONFIGURED_PINS0
+#include "board_fixed.h"    // Straight-line pin mux and ADC0 accesses
+#include "lpi2c_driver.h"   // LPI2C low-level driver
+#include "adc_driver.h"
+#include "adc_sampler.h"    // Converter profiles and their rates
+#include "temp_conv.h"      // Fixed-point LM35 conversion
+#include "temp_cal.h"       // Calibration lookup table
+#include "lcd_fb.h"         // HD44780 driver and shadow framebuffer
+#include "lcd_glyph.h"      // Big digits and bar graph of the display handler
+#include "fmt.h"            // Allocation-free number formatting
+#include "prof.h"           // DWT cycle counter
+#include "agg.h"            // Sliding-window statistics
+#include "dma_alloc.h"      // Run-time eDMA channel allocation
+#include "irq_prio.h"       // IRQ_PRIO_I2C
+#include "i2c_meter.h"      // LPI2C0 bus utilization
+#include "mem_prof.h"       // Stack high-water mark
+#include "perf_cfg.h"       // Code cache and flash prefetch
+#include "boot_cfg.h"       // D-Flash configuration record
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define BENCH_RUNS          16U     // Repetitions per measurement
+#define BENCH_I2C_BYTES     64U     // Payload of one throughput transfer
+#define BENCH_ADC_INSTANCE  0U
+#define BENCH_ADC_CHANNEL   ADC_INPUTCHAN_EXT12
+#define BENCH_AGG_BUCKETS   60U     // Window length of the aggregation runs
+#define BENCH_I2C_DMA_PRIO  8U      // eDMA priority of the LPI2C0 channel, as in the application
+#define BENCH_BAR_FULL_C10  500     // Full bar graph, as APP_BAR_FULL_C10
+#define BENCH_FRAME_C10     123     // First reading of the display frame runs, 0.1 C
+#define BENCH_FRAME_STEP    37      // Change between runs: every digit and the bar move
+
+// PCF8574 port value with the backlight on and EN low: moves no data into the LCD
+#define BENCH_I2C_IDLE_BYTE 0x08U
+
+// ARM semihosting SYS_WRITE0: print a null-terminated string on the debug console
+#define BENCH_SEMIHOST_WRITE0   0x04U
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+// Cycle statistics of one measurement
+typedef struct
+{
+    uint32_t min;
+    uint32_t max;
+    uint32_t total;
+} bench_result_t;
+
+/*============================================================================*/
+/* Global Variables                                */
+/*============================================================================*/
+
+// State structure for the LPI2C0 master driver instance
+lpi2c_master_state_t g_lpi2c0MasterState;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static uint32_t s_core_hz;
+
+// Keeps the computed results alive so the conversion loops are not optimized out
+static volatile int32_t s_sink;
+
+// Window storage for Bench_Agg()
+static agg_slot_t s_agg_slots[BENCH_AGG_BUCKETS];
+static agg_window_t s_agg;
+
+/*============================================================================*/
+/* Private Function Prototypes                         */
+/*============================================================================*/
+
+void WDOG_disable(void);
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Prints one line on the debugger console through semihosting.
+ * @details Halts the core on the BKPT if no debugger is attached.
+ */
+static void Bench_Print(const char *line)
+{
+    register uint32_t op __asm("r0") = BENCH_SEMIHOST_WRITE0;
+    register const char *arg __asm("r1") = line;
+
+    __asm volatile ("bkpt 0xAB" : "+r" (op) : "r" (arg) : "memory");
+
+    op = BENCH_SEMIHOST_WRITE0;
+    arg = "\n";
+    __asm volatile ("bkpt 0xAB" : "+r" (op) : "r" (arg) : "memory");
+}
+
+/**
+ * @brief Prints a result as average/min/max cycles and average microseconds.
+ * @param label   Name of the measurement.
+ * @param result  Accumulated cycles of BENCH_RUNS runs.
+ */
+static void Bench_Report(const char *label, const bench_result_t *result)
+{
+    char line[80];
+    char *dst = line;
+    uint32_t avg = result->total / BENCH_RUNS;
+
+    dst = Prof_PutText(dst, label, 20U);
+    dst += Fmt_FixedQ(dst, 10U, (int32_t)avg, 0, NULL);
+    dst += Fmt_FixedQ(dst, 10U, (int32_t)result->min, 0, NULL);
+    dst += Fmt_FixedQ(dst, 10U, (int32_t)result->max, 0, NULL);
+    // Tenths of a microsecond
+    dst += Fmt_FixedQ(dst, 12U, (int32_t)(((uint64_t)avg * 10000000U) / s_core_hz), 1, " us");
+    *dst = '\0';
+
+    Bench_Print(line);
+}
+
+/**
+ * @brief Adds one sample to a result.
+ */
+static void Bench_Add(bench_result_t *result, uint32_t cycles)
+{
+    if (cycles < result->min)
+    {
+        result->min = cycles;
+    }
+    if (cycles > result->max)
+    {
+        result->max = cycles;
+    }
+    result->total += cycles;
+}
+
+/**
+ * @brief Resets a result before a measurement.
+ */
+static void Bench_Clear(bench_result_t *result)
+{
+    result->min = 0xFFFFFFFFU;
+    result->max = 0;
+    result->total = 0;
+}
+
+/**
+ * @brief LCD character, line and full-screen write times at the default baud
+ * rate, and the CPU time of one display frame.
+ */
+static void Bench_Lcd(void)
+{
+    static const char line_a[LCD_COLS] = "0123456789ABCDEF";
+    static const char line_b[LCD_COLS] = "FEDCBA9876543210";
+    bench_result_t result;
+    char text[8];
+    int32_t value;
+    uint32_t start;
+    uint8_t i, row, col;
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        LCD_SendData((uint8_t)line_a[i]);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("lcd_char", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        LCD_WriteBuffer(0, 0, ((i & 1U) != 0U) ? line_a : line_b, LCD_COLS);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("lcd_line", &result);
+
+    // Every cell changes on each run, so the flush rewrites the whole screen
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        for (row = 0; row < LCD_ROWS; row++)
+        {
+            for (col = 0; col < LCD_COLS; col++)
+            {
+                LCD_FB_PutChar(row, col, (((i + row) & 1U) != 0U) ? line_a[col] : line_b[col]);
+            }
+        }
+        start = PROF_DWT_CYCCNT;
+        (void)LCD_FB_Flush();
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("lcd_screen", &result);
+
+    // The frame of App_UpdateDisplay() for a new reading each run, glyph
+    // rewrites included; APP_BUDGET_DISPLAY is sized from its max. The bus
+    // time is outside the measurement, the eDMA sends it
+    LCD_Glyph_Init();
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        value = BENCH_FRAME_C10 + ((int32_t)i * BENCH_FRAME_STEP);
+        start = PROF_DWT_CYCCNT;
+        (void)Fmt_FixedQ(text, 5U, value, 1U, NULL);
+        LCD_Glyph_BeginFrame();
+        (void)LCD_Glyph_BigText(0, text);
+        LCD_Glyph_BarGraph(1, 6, 10, value, BENCH_BAR_FULL_C10);
+        (void)LCD_FB_FlushAsync(NULL, NULL);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+        while (LCD_IsBusy())
+        {
+        }
+    }
+    Bench_Report("lcd_frame", &result);
+}
+
+/**
+ * @brief Blocking I2C throughput at 100, 400 and 1000 kHz requested SCL.
+ * @details The payload keeps EN low with the backlight on, so the display
+ * content is untouched. The actual SCL rate set by the driver is printed too,
+ * and the share of the runs the bus was busy; the rest is driver overhead
+ * between back-to-back transfers.
+ */
+static void Bench_I2c(void)
+{
+    static const uint32_t rates[] = { 100000U, 400000U, 1000000U };
+    static uint8_t payload[BENCH_I2C_BYTES];
+    lpi2c_baud_rate_params_t baud;
+    bench_result_t result;
+    i2c_meter_t meter;
+    char line[64];
+    char *dst;
+    uint32_t start;
+    uint8_t r, i;
+
+    for (i = 0; i < BENCH_I2C_BYTES; i++)
+    {
+        payload[i] = BENCH_I2C_IDLE_BYTE;
+    }
+
+    for (r = 0; r < (uint8_t)(sizeof(rates) / sizeof(rates[0])); r++)
+    {
+        // The S32K144 LPI2C has no Fm+ mode; 1 MHz is requested in fast mode
+        baud.baudRate = rates[r];
+        (void)LPI2C_DRV_MasterSetBaudRate(INST_LPI2C0, LPI2C_FAST_MODE, baud);
+        LPI2C_DRV_MasterGetBaudRate(INST_LPI2C0, &baud);
+
+        Bench_Clear(&result);
+        I2C_Meter_Update();
+        for (i = 0; i < BENCH_RUNS; i++)
+        {
+            start = PROF_DWT_CYCCNT;
+            (void)LPI2C_DRV_MasterSendDataBlocking(INST_LPI2C0, payload, BENCH_I2C_BYTES, true, 100);
+            Bench_Add(&result, PROF_DWT_CYCCNT - start);
+        }
+        I2C_Meter_Update();
+        I2C_Meter_Get(&meter);
+
+        dst = Prof_PutText(line, "i2c_scl_hz", 12U);
+        dst += Fmt_FixedQ(dst, 8U, (int32_t)baud.baudRate, 0, NULL);
+        dst = Prof_PutText(dst, "  bytes/s", 9U);
+        dst += Fmt_FixedQ(dst, 8U, (int32_t)(((uint64_t)BENCH_I2C_BYTES * BENCH_RUNS * s_core_hz) / result.total), 0, NULL);
+        dst = Prof_PutText(dst, "  busy%", 7U);
+        dst += Fmt_FixedQ(dst, 6U, meter.load_permille, 1U, NULL);
+        *dst = '\0';
+        Bench_Print(line);
+        Bench_Report("i2c_64_bytes", &result);
+    }
+
+    baud.baudRate = lpi2c0_MasterConfig0.baudRate;
+    (void)LPI2C_DRV_MasterSetBaudRate(INST_LPI2C0, lpi2c0_MasterConfig0.operatingMode, baud);
+}
+
+/**
+ * @brief Software-triggered conversion latency per sample time and hardware
+ * averaging setting.
+ */
+static void Bench_Adc(void)
+{
+    static const uint8_t sample_times[] = { 12U, 24U, 64U, 255U };
+    static const char * const avg_labels[] = { "adc_avg_off", "adc_avg_4", "adc_avg_8", "adc_avg_16", "adc_avg_32" };
+    adc_converter_config_t converter;
+    adc_average_config_t average;
+    adc_chan_config_t chan;
+    bench_result_t result;
+    char line[24];
+    uint32_t start;
+    uint8_t s, a, i;
+
+    ADC_DRV_InitConverterStruct(&converter);
+    converter.resolution = ADC_RESOLUTION_12BIT;
+    converter.trigger = ADC_TRIGGER_SOFTWARE;
+    converter.voltageRef = ADC_VOLTAGEREF_VREF;
+    ADC_DRV_ConfigConverter(BENCH_ADC_INSTANCE, &converter);
+    ADC_DRV_AutoCalibration(BENCH_ADC_INSTANCE);
+
+    ADC_DRV_InitChanStruct(&chan);
+    chan.channel = BENCH_ADC_CHANNEL;
+
+    for (s = 0; s < (uint8_t)(sizeof(sample_times) / sizeof(sample_times[0])); s++)
+    {
+        converter.sampleTime = sample_times[s];
+        ADC_DRV_ConfigConverter(BENCH_ADC_INSTANCE, &converter);
+
+        (void)Prof_PutText(line, "adc_sample_time", 16U);
+        (void)Fmt_FixedQ(&line[16], 4U, sample_times[s], 0, NULL);
+        Bench_Print(line);
+
+        for (a = 0; a < (uint8_t)(sizeof(avg_labels) / sizeof(avg_labels[0])); a++)
+        {
+            ADC_DRV_InitHwAverageStruct(&average);
+            average.hwAvgEnable = (a != 0U);
+            average.hwAverage = (a != 0U) ? (adc_average_t)(a - 1U) : ADC_AVERAGE_4;
+            ADC_DRV_ConfigHwAverage(BENCH_ADC_INSTANCE, &average);
+
+            Bench_Clear(&result);
+            for (i = 0; i < BENCH_RUNS; i++)
+            {
+                // With a software trigger, writing SC1[0] starts the conversion
+                start = PROF_DWT_CYCCNT;
+                ADC_DRV_ConfigChan(BENCH_ADC_INSTANCE, 0U, &chan);
+                ADC_DRV_WaitConvDone(BENCH_ADC_INSTANCE);
+                Bench_Add(&result, PROF_DWT_CYCCNT - start);
+            }
+            Bench_Report(avg_labels[a], &result);
+        }
+    }
+}
+
+/**
+ * @brief Highest sampling rate of each converter profile with 8x hardware
+ * averaging, as derived by Sampler_MaxRateHz() from the ADC clock.
+ */
+static void Bench_AdcProfiles(void)
+{
+    static const sampler_converter_t * const converters[] =
+    {
+        &g_sampler_conv_precise, &g_sampler_conv_fast, &g_sampler_conv_fast_10bit
+    };
+    static const char * const labels[] = { "adc_rate_precise", "adc_rate_fast", "adc_rate_fast10" };
+    sampler_profile_t profile =
+    {
+        .hw_avg_enable = true,
+        .hw_average = ADC_AVERAGE_8,
+        .oversample_bits = 0U,
+    };
+    char line[28];
+    uint8_t i;
+
+    for (i = 0; i < (uint8_t)(sizeof(converters) / sizeof(converters[0])); i++)
+    {
+        profile.converter = converters[i];
+        (void)Prof_PutText(line, labels[i], 17U);
+        (void)Fmt_FixedQ(&line[17], 8U, (int32_t)Sampler_MaxRateHz(&profile), 0, NULL);
+        Bench_Print(line);
+    }
+}
+
+/**
+ * @brief Generic driver paths against their compile-time specialized
+ * counterparts: the pin mux and an ADC0 result read.
+ * @details Both write the same PCR values, so the pins stay as they are.
+ */
+static void Bench_Board(void)
+{
+    bench_result_t result;
+    uint16_t value;
+    uint32_t start;
+    uint8_t i;
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        PINS_DRV_Init(NUM_OF_CONFIGURED_PINS0, g_pin_mux_InitConfigArr0);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("pins_drv_init", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        BoardFixed_InitPins();
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("pins_fixed", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        ADC_DRV_GetChanResult(BENCH_ADC_INSTANCE, 0U, &value);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+        s_sink = value;
+    }
+    Bench_Report("adc_result_drv", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        value = BoardFixed_AdcResult(0U);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+        s_sink = value;
+    }
+    Bench_Report("adc_result_fixed", &result);
+}
+
+/**
+ * @brief Boot configuration: the check of a sealed record, and the whole
+ * load against whatever the D-Flash sector holds.
+ */
+static void Bench_BootCfg(void)
+{
+    static const boot_cfg_t defaults = { .magic = 0U };
+    boot_cfg_t cfg = { .i2c_baud_hz = 400000U, .lcd_address = 39U, .vref_mv = 5000U, .sample_rate_hz = 500U };
+    bench_result_t result;
+    uint32_t start;
+    uint8_t i;
+
+    BootCfg_Seal(&cfg);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        s_sink = BootCfg_Valid(&cfg);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("boot_cfg_check", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        s_sink = (BootCfg_Load(&defaults) != &defaults);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("boot_cfg_load", &result);
+}
+
+/**
+ * @brief Cost of the fixed-point temperature conversion and formatting.
+ */
+static void Bench_Temp(void)
+{
+    bench_result_t result;
+    char text[16];
+    uint32_t start;
+    uint8_t i;
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        s_sink = Temp_FromRaw((uint16_t)(i * 256U), TEMP_RES_0C1);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("temp_from_raw", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        s_sink = Temp_FromOversampled((uint32_t)i * 2048U, 3U, TEMP_RES_0C1);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("temp_oversampled", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        s_sink = TempCal_FromRaw((uint16_t)(i * 256U), TEMP_RES_0C01);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("temp_cal_lut", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        s_sink = TempCal_FromOversampled((uint32_t)i * 2048U + 5U, 3U, TEMP_RES_0C1);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("temp_cal_oversamp", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        s_sink = Fmt_FixedQ(text, 8, (int32_t)i * 37 - 200, 1, " C");
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("fmt_fixed", &result);
+}
+
+/**
+ * @brief Per-sample cost of the sliding-window statistics, within a bucket
+ * and when every sample closes one, plus the cost of a query.
+ */
+static void Bench_Agg(void)
+{
+    bench_result_t result;
+    agg_result_t stats;
+    uint32_t start;
+    uint32_t i;
+
+    // Fill the window first so buckets leave it during the measurement
+    (void)Agg_Init(&s_agg, s_agg_slots, BENCH_AGG_BUCKETS, 1U);
+    for (i = 0; i <= (2U * BENCH_AGG_BUCKETS); i++)
+    {
+        Agg_Push(&s_agg, (int16_t)((i * 37U) % 500U), i);
+    }
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        Agg_Push(&s_agg, (int16_t)((i * 37U) % 500U), 2U * BENCH_AGG_BUCKETS);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("agg_push", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        Agg_Push(&s_agg, (int16_t)((i * 37U) % 500U), (2U * BENCH_AGG_BUCKETS) + 1U + i);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    Bench_Report("agg_push_close", &result);
+
+    Bench_Clear(&result);
+    for (i = 0; i < BENCH_RUNS; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        (void)Agg_Get(&s_agg, &stats);
+        Bench_Add(&result, PROF_DWT_CYCCNT - start);
+    }
+    s_sink = stats.mean_q8;
+    Bench_Report("agg_get", &result);
+}
+
+/*============================================================================*/
+/* Main Function                                  */
+/*============================================================================*/
+
+int main(void)
+{
+    lpi2c_master_user_config_t i2c_config;
+    char line[40];
+    char *dst;
+
+    WDOG_disable();
+    MemProf_Init();
+    PerfCfg_Init();
+    CLOCK_DRV_Init(&clockMan1_InitConfig0);
+    BoardFixed_InitPins();
+    (void)DMA_Alloc_Init(0U);
+    i2c_config = lpi2c0_MasterConfig0;
+    (void)DMA_Alloc_Channel(EDMA_REQ_DISABLED, BENCH_I2C_DMA_PRIO, IRQ_PRIO_I2C, &i2c_config.dmaChannel);
+    LPI2C_DRV_MasterInit(INST_LPI2C0, &i2c_config, &g_lpi2c0MasterState);
+    (void)CLOCK_SYS_GetFreq(CORE_CLK, &s_core_hz);
+    Prof_Init();
+    I2C_Meter_Init();
+    (void)TempCal_Init();
+
+    LCD_Init();
+    LCD_FB_Init();
+
+    Bench_Print("test                       avg       min       max      avg us");
+
+    // The CPU-bound runs first straight from flash, then through the code cache
+    PerfCfg_SetCodeCache(false);
+    Bench_Print("code cache off");
+    Bench_Temp();
+    Bench_Agg();
+    PerfCfg_SetCodeCache(true);
+    dst = Prof_PutText(line, "code cache on, hot", 20U);
+    dst += Fmt_FixedQ(dst, 10U, (int32_t)PerfCfg_HotTextSize(), 0, " B");
+    *dst = '\0';
+    Bench_Print(line);
+
+    Bench_Lcd();
+    Bench_I2c();
+    Bench_Adc();
+    Bench_AdcProfiles();
+    Bench_Board();
+    Bench_BootCfg();
+    Bench_Temp();
+    Bench_Agg();
+
+    // Deepest stack any of the drivers and measurements above reached
+    MemProf_Dump(Bench_Print);
+    Bench_Print("done");
+
+    for (;;)
+    {
+    }
+
+    return 0;
+}
+
+/**
+ * @brief Disables the Watchdog timer.
+ */
+void WDOG_disable(void)
+{
+    WDOG->CNT = 0xD928C520;
+    WDOG->TOVAL = 0x0000FFFF;
+    WDOG->CS = 0x00002100;
+}
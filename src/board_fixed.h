@@ -0,0 +1,130 @@
+/**
+ ******************************************************************************
+ * @file      board_fixed.h
+ * @brief     Compile-time board layout: the LPI2C0, ADC0 (PTC14), LPUART1
+ * and CAN0 pins as straight-line register writes, and the ADC0 accesses of
+ * the interrupt paths on a statically resolved base.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef BOARD_FIXED_H_
+#define BOARD_FIXED_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "device_registers.h"
+#include "pin_mux.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Set to 0 to initialize the pins from the Pins tool array through PINS_DRV_Init()
+#ifndef BOARD_FIXED_CONFIG
+#define BOARD_FIXED_CONFIG      1
+#endif
+
+// BoardFixed_InitPins() writes these pins of g_pin_mux_InitConfigArr0 by hand
+#if BOARD_FIXED_CONFIG && (NUM_OF_CONFIGURED_PINS0 != 7)
+#error "Pins tool setup changed; update BoardFixed_InitPins() or build with BOARD_FIXED_CONFIG 0"
+#endif
+
+// The one ADC of the board, SAMPLER_ADC_INSTANCE
+#define BOARD_FIXED_ADC         ADC0
+
+// PCR values of the Pins tool setup: I2C with pull-ups, the LM35 input
+// analog, the rest on their peripheral mux; low drive, no filter, no IRQ
+#define BOARD_FIXED_PCR_I2C     (PORT_PCR_MUX(3U) | PORT_PCR_PE_MASK | PORT_PCR_PS_MASK)   // PTA2 SDA, PTA3 SCL
+#define BOARD_FIXED_PCR_ANALOG  PORT_PCR_MUX(0U)                                          // PTC14 ADC0_SE12
+#define BOARD_FIXED_PCR_UART    PORT_PCR_MUX(2U)                                          // PTC6 RX, PTC7 TX
+#define BOARD_FIXED_PCR_CAN     PORT_PCR_MUX(5U)                                          // PTE4 RX, PTE5 TX
+
+/*============================================================================*/
+/* Inline Functions                                */
+/*============================================================================*/
+
+/**
+ * @brief Muxes the board's pins, as PINS_DRV_Init() does with g_pin_mux_InitConfigArr0.
+ * @details Seven stores and three digital filter masks instead of a walk
+ * over the configuration array with a branch per field. The PORT clocks
+ * must be running, as after CLOCK_DRV_Init().
+ */
+static inline void BoardFixed_InitPins(void)
+{
+#if BOARD_FIXED_CONFIG
+    PORTA->PCR[2] = BOARD_FIXED_PCR_I2C;
+    PORTA->PCR[3] = BOARD_FIXED_PCR_I2C;
+    PORTC->PCR[14] = BOARD_FIXED_PCR_ANALOG;
+    PORTC->PCR[6] = BOARD_FIXED_PCR_UART;
+    PORTC->PCR[7] = BOARD_FIXED_PCR_UART;
+    PORTE->PCR[4] = BOARD_FIXED_PCR_CAN;
+    PORTE->PCR[5] = BOARD_FIXED_PCR_CAN;
+    PORTA->DFER &= ~((1UL << 2) | (1UL << 3));
+    PORTC->DFER &= ~((1UL << 14) | (1UL << 6) | (1UL << 7));
+    PORTE->DFER &= ~((1UL << 4) | (1UL << 5));
+#else
+    PINS_DRV_Init(NUM_OF_CONFIGURED_PINS0, g_pin_mux_InitConfigArr0);
+#endif
+}
+
+/**
+ * @brief Whether SC1[@p chan] holds a completed conversion.
+ */
+static inline bool BoardFixed_AdcComplete(uint8_t chan)
+{
+    return (BOARD_FIXED_ADC->SC1[chan] & ADC_SC1_COCO_MASK) != 0U;
+}
+
+/**
+ * @brief Result of SC1[@p chan]; reading it clears COCO.
+ */
+static inline uint16_t BoardFixed_AdcResult(uint8_t chan)
+{
+    return (uint16_t)(BOARD_FIXED_ADC->R[chan] & ADC_R_D_MASK);
+}
+
+/**
+ * @brief Selects the input of SC1[0], keeping its interrupt enable.
+ * @details Like every SC1 write this aborts a conversion in progress.
+ */
+static inline void BoardFixed_AdcSelectInput(uint32_t input)
+{
+    BOARD_FIXED_ADC->SC1[0] = (BOARD_FIXED_ADC->SC1[0] & ADC_SC1_AIEN_MASK) | ADC_SC1_ADCH(input);
+}
+
+/**
+ * @brief Enables or disables the conversion complete interrupt of SC1[0].
+ */
+static inline void BoardFixed_AdcSetInterrupt(bool enable)
+{
+    BOARD_FIXED_ADC->SC1[0] = (BOARD_FIXED_ADC->SC1[0] & ADC_SC1_ADCH_MASK) | (enable ? ADC_SC1_AIEN_MASK : 0U);
+}
+
+/**
+ * @brief Arms the range compare outside CV1..CV2, or turns the compare off.
+ * @details The ADC_DRV_ConfigHwCompare() setup of TempMon_Start() in two
+ * stores: ACFE and ACREN with ACFGT clear, so only results below @p low
+ * or above @p high set COCO.
+ * @param armed false lets every conversion complete; the limits are ignored.
+ * @param low   CV1, in result units of the current resolution.
+ * @param high  CV2, at least @p low.
+ */
+static inline void BoardFixed_AdcSetWindow(bool armed, uint16_t low, uint16_t high)
+{
+    uint32_t sc2 = BOARD_FIXED_ADC->SC2 & ~(ADC_SC2_ACFE_MASK | ADC_SC2_ACFGT_MASK | ADC_SC2_ACREN_MASK);
+
+    if (armed)
+    {
+        BOARD_FIXED_ADC->CV[0] = low;
+        BOARD_FIXED_ADC->CV[1] = high;
+        sc2 |= ADC_SC2_ACFE_MASK | ADC_SC2_ACREN_MASK;
+    }
+    BOARD_FIXED_ADC->SC2 = sc2;
+}
+
+#endif /* BOARD_FIXED_H_ */
@@ -0,0 +1,145 @@
+/**
+ ******************************************************************************
+ * @file      boot_cfg.c
+ * @brief     Boot-time configuration record in D-Flash: the field tunables
+ * as one fixed-layout, versioned struct, checked with the hardware CRC and
+ * used in place, so loading is a bounded check with no parsing.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "boot_cfg.h"
+#include <stddef.h>
+#include "S32K144.h"
+#include "S32K144_features.h"
+#include "adc_driver.h"
+#include "clock_gate.h"
+#include "datalog.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Second to last D-Flash sector, between the temperature log and the calibration
+#define BOOT_CFG_ADDR           (FEATURE_FLS_DF_START_ADDRESS + FEATURE_FLS_DF_BLOCK_SIZE - \
+                                 (2U * FEATURE_FLS_DF_BLOCK_SECTOR_SIZE))
+
+#if (DATALOG_SECTORS + 2U) * FEATURE_FLS_DF_BLOCK_SECTOR_SIZE > FEATURE_FLS_DF_BLOCK_SIZE
+#error "The configuration sector overlaps the temperature log"
+#endif
+
+// Words covered by the CRC: everything before the crc field
+#define BOOT_CFG_CRC_WORDS      (offsetof(boot_cfg_t, crc) / 4U)
+
+// CRC-32 of IEEE 802.3: reflected in and out, seed and final XOR all ones
+#define BOOT_CFG_CRC_POLY       0x04C11DB7UL
+#define BOOT_CFG_CRC_SEED       0xFFFFFFFFUL
+#define BOOT_CFG_CRC_TOT_BITS_BYTES 2U  // CTRL[TOT]/[TOTR]: bits in bytes and bytes transposed
+
+// Largest 7-bit I2C address
+#define BOOT_CFG_ADDR_7BIT_MAX  0x7FU
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Picks the configuration for this boot: the D-Flash record if it is
+ * valid, else @p defaults.
+ * @details Call after CLOCK_DRV_Init() and before the peripherals it
+ * configures are set up; ClockGate_Init() gates the CRC module again
+ * afterwards. The record is used where it is, so the cost is a few field
+ * compares and ten CRC words, whatever it holds. Without D-Flash in the
+ * FlexNVM partition the defaults are used, as by TempCal_Init().
+ * @param defaults Compiled-in configuration; must stay valid.
+ * @return The configuration in force, never NULL.
+ */
+const boot_cfg_t *BootCfg_Load(const boot_cfg_t *defaults)
+{
+    const boot_cfg_t *rec = (const boot_cfg_t *)BOOT_CFG_ADDR;
+    uint32_t depart = (SIM->FCFG1 & SIM_FCFG1_DEPART_MASK) >> SIM_FCFG1_DEPART_SHIFT;
+
+    if (((depart == 0x0U) || (depart == 0xFU)) && BootCfg_Valid(rec))
+    {
+        return rec;
+    }
+
+    return defaults;
+}
+
+/**
+ * @brief Checks a record: layout, field ranges and CRC.
+ * @details The header and ranges are checked first, so an erased sector is
+ * turned down before the CRC module is touched. Only the ranges that would
+ * keep the unit from coming up are checked; the rest is the tool's job.
+ * @param cfg Record in flash or RAM, 4-byte aligned.
+ */
+bool BootCfg_Valid(const boot_cfg_t *cfg)
+{
+    if ((cfg->magic != BOOT_CFG_MAGIC) || (cfg->version != BOOT_CFG_VERSION) ||
+        (cfg->size != (uint16_t)sizeof(boot_cfg_t)))
+    {
+        return false;
+    }
+
+    if ((cfg->i2c_baud_hz == 0U) || (cfg->lcd_address > BOOT_CFG_ADDR_7BIT_MAX) || (cfg->vref_mv == 0U) ||
+        (cfg->sample_rate_hz == 0U) || (cfg->hw_average > (uint8_t)ADC_AVERAGE_32) ||
+        (cfg->converter >= (uint8_t)BOOT_CFG_CONV_COUNT))
+    {
+        return false;
+    }
+
+    return BootCfg_Crc(cfg) == cfg->crc;
+}
+
+/**
+ * @brief CRC-32 of a record up to its crc field, on the CRC module.
+ * @details One 32-bit write per word of the fixed-size record. The module
+ * transposes bits and bytes on both sides, so little-endian words give the
+ * byte-wise reflected CRC-32 of the record in memory order. Not reentrant;
+ * only used at start-up and by service code.
+ * @param cfg Record, 4-byte aligned.
+ */
+uint32_t BootCfg_Crc(const boot_cfg_t *cfg)
+{
+    const uint32_t *word = (const uint32_t *)cfg;
+    uint32_t crc;
+    uint32_t i;
+
+    ClockGate_Acquire(CLOCK_GATE_CRC);
+
+    CRC->CTRL = CRC_CTRL_TCRC_MASK | CRC_CTRL_TOT(BOOT_CFG_CRC_TOT_BITS_BYTES) |
+                CRC_CTRL_TOTR(BOOT_CFG_CRC_TOT_BITS_BYTES) | CRC_CTRL_FXOR_MASK;
+    CRC->GPOLY = BOOT_CFG_CRC_POLY;
+    CRC->CTRL |= CRC_CTRL_WAS_MASK;
+    CRC->DATAu.DATA = BOOT_CFG_CRC_SEED;
+    CRC->CTRL &= ~CRC_CTRL_WAS_MASK;
+
+    for (i = 0; i < BOOT_CFG_CRC_WORDS; i++)
+    {
+        CRC->DATAu.DATA = word[i];
+    }
+    crc = CRC->DATAu.DATA;
+
+    ClockGate_Release(CLOCK_GATE_CRC);
+
+    return crc;
+}
+
+/**
+ * @brief Fills in the header and CRC of a record built in RAM.
+ * @details For service code that writes a new record to the configuration
+ * sector; it takes effect at the next boot.
+ * @param cfg Record with every other field set.
+ */
+void BootCfg_Seal(boot_cfg_t *cfg)
+{
+    cfg->magic = BOOT_CFG_MAGIC;
+    cfg->version = BOOT_CFG_VERSION;
+    cfg->size = (uint16_t)sizeof(boot_cfg_t);
+    cfg->crc = BootCfg_Crc(cfg);
+}
@@ -0,0 +1,88 @@
+/**
+ ******************************************************************************
+ * @file      boot_cfg.h
+ * @brief     Boot-time configuration record in D-Flash: the field tunables
+ * as one fixed-layout, versioned struct, checked with the hardware CRC and
+ * used in place, so loading is a bounded check with no parsing.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef BOOT_CFG_H_
+#define BOOT_CFG_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "refresh.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define BOOT_CFG_MAGIC          0x47464342UL  // "BCFG"
+
+// Bumped with every change of boot_cfg_t; a record of another version is ignored
+#define BOOT_CFG_VERSION        1U
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Converter profiles a record can select, see adc_sampler.h.
+ */
+typedef enum
+{
+    BOOT_CFG_CONV_PRECISE = 0,  // g_sampler_conv_precise
+    BOOT_CFG_CONV_FAST,         // g_sampler_conv_fast
+    BOOT_CFG_CONV_FAST_10BIT,   // g_sampler_conv_fast_10bit
+    BOOT_CFG_CONV_COUNT
+} boot_cfg_converter_t;
+
+/**
+ * @brief Configuration record as programmed into D-Flash.
+ * @details Fields are in the units the drivers take, so applying one is an
+ * assignment. crc is the CRC-32 (IEEE 802.3, as zlib's crc32()) of every
+ * byte before it, so a host tool can build the record with any standard
+ * implementation; BootCfg_Seal() does the same on the target. The size is
+ * a multiple of 4, so the CRC module takes it one word at a time.
+ */
+typedef struct
+{
+    uint32_t magic;                 // BOOT_CFG_MAGIC
+    uint16_t version;               // BOOT_CFG_VERSION
+    uint16_t size;                  // sizeof(boot_cfg_t)
+
+    // LCD bus: start-up rate, fastest rate negotiated, and the backpack address
+    uint32_t i2c_baud_hz;           // Rate the bus starts at and falls back to
+    uint32_t i2c_max_hz;            // Tried after i2c_baud_hz; not above it for no negotiation
+    uint16_t lcd_address;           // 7-bit address of the PCF8574 backpack
+    uint16_t vref_mv;               // ADC reference as wired; readings are scaled from TEMP_ADC_VREF_MV
+
+    // Sampling profile
+    uint16_t sample_rate_hz;        // PDB0 trigger rate
+    uint8_t hw_avg_enable;          // Nonzero for hardware averaging
+    uint8_t hw_average;             // adc_average_t
+    uint8_t converter;              // boot_cfg_converter_t
+    uint8_t reserved[3];            // 0
+
+    // Display refresh profile, in 0.1 C and milliseconds
+    refresh_config_t refresh;
+
+    uint32_t crc;
+} boot_cfg_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+const boot_cfg_t *BootCfg_Load(const boot_cfg_t *defaults);
+bool BootCfg_Valid(const boot_cfg_t *cfg);
+uint32_t BootCfg_Crc(const boot_cfg_t *cfg);
+void BootCfg_Seal(boot_cfg_t *cfg);
+
+#endif /* BOOT_CFG_H_ */
@@ -0,0 +1,381 @@
+/**
+ ******************************************************************************
+ * @file      can_node.c
+ * @brief     CAN sensor node: periodic status frames on FlexCAN0 with the
+ * filtered temperature, its min/max and alarm flags, sent from a ring of
+ * transmit mailboxes refilled by interrupt.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "can_node.h"
+#include <stddef.h>
+#include "S32K144.h"
+#include "clock_manager.h"
+#include "interrupt_manager.h"
+#include "irq_prio.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define CAN_NODE_MODULE         CAN0
+#define CAN_NODE_MB_IRQ         CAN0_ORed_0_15_MB_IRQn
+
+#define CAN_NODE_MODE_TIMEOUT   100000U  // Poll iterations allowed for freeze mode entry/exit
+
+// Bit timing: 16 time quanta per bit, sample point at 87.5 %
+#define CAN_NODE_TQ_PER_BIT     16U
+#define CAN_NODE_PROPSEG        7U
+#define CAN_NODE_PSEG1          6U
+#define CAN_NODE_PSEG2          2U
+#define CAN_NODE_RJW            2U
+
+// Classic message buffer: C/S word, ID word, two data words
+#define CAN_NODE_MB_WORDS       4U
+#define CAN_NODE_MB_CS(n)       (CAN_NODE_MODULE->RAMn[((n) * CAN_NODE_MB_WORDS) + 0U])
+#define CAN_NODE_MB_ID(n)       (CAN_NODE_MODULE->RAMn[((n) * CAN_NODE_MB_WORDS) + 1U])
+#define CAN_NODE_MB_DATA(n, w)  (CAN_NODE_MODULE->RAMn[((n) * CAN_NODE_MB_WORDS) + 2U + (w)])
+
+#define CAN_NODE_CS_CODE(x)     ((uint32_t)(x) << 24)
+#define CAN_NODE_CS_DLC(x)      ((uint32_t)(x) << 16)
+#define CAN_NODE_CODE_TX_INACTIVE 0x8U
+#define CAN_NODE_CODE_TX_DATA   0xCU
+#define CAN_NODE_ID_STD(x)      ((uint32_t)(x) << 18)
+
+#define CAN_NODE_MB_MASK        ((1UL << CAN_NODE_TX_MAILBOXES) - 1U)
+
+#if (CAN_NODE_QUEUE_LEN & (CAN_NODE_QUEUE_LEN - 1U)) != 0U
+#error "CAN_NODE_QUEUE_LEN must be a power of two"
+#endif
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+typedef struct
+{
+    uint32_t id;
+    uint32_t data[2];       // Bytes 0..3 and 4..7, byte 0 in the top bits as the MB expects
+} can_node_frame_t;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static can_node_config_t s_config;
+
+// Statistics of the sample pipeline since start-up
+static int16_t s_value;
+static int16_t s_min;
+static int16_t s_max;
+static uint8_t s_alarms;
+static bool s_have_sample;
+static bool s_fresh;
+static uint8_t s_counter;
+
+// Frames waiting for a mailbox and the mailboxes not transmitting; shared
+// with the mailbox interrupt
+static can_node_frame_t s_queue[CAN_NODE_QUEUE_LEN];
+static uint32_t s_queue_head;
+static uint32_t s_queue_tail;
+static uint32_t s_mb_free;
+
+static uint32_t s_dropped;
+static uint32_t s_dropped_reported;
+static bool s_ready;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Waits for a MCR status bit to reach a level.
+ */
+static status_t CanNode_WaitMcr(uint32_t mask, uint32_t value)
+{
+    uint32_t timeout = CAN_NODE_MODE_TIMEOUT;
+
+    while ((CAN_NODE_MODULE->MCR & mask) != value)
+    {
+        if (--timeout == 0U)
+        {
+            return STATUS_TIMEOUT;
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Copies a frame into an idle mailbox and arms it.
+ * @details The code goes in last, once ID and data are in place.
+ */
+static void CanNode_Load(uint32_t mb, const can_node_frame_t *frame)
+{
+    CAN_NODE_MB_CS(mb) = CAN_NODE_CS_CODE(CAN_NODE_CODE_TX_INACTIVE);
+    CAN_NODE_MB_ID(mb) = frame->id;
+    CAN_NODE_MB_DATA(mb, 0U) = frame->data[0];
+    CAN_NODE_MB_DATA(mb, 1U) = frame->data[1];
+    CAN_NODE_MB_CS(mb) = CAN_NODE_CS_CODE(CAN_NODE_CODE_TX_DATA) | CAN_NODE_CS_DLC(8U);
+}
+
+/**
+ * @brief Gives a frame to the first idle mailbox or queues it behind the busy ones.
+ * @details Called under IRQ_Lock() so the mailbox interrupt sees either state.
+ * @return false if every mailbox is busy and the queue is full.
+ */
+static bool CanNode_Send(const can_node_frame_t *frame)
+{
+    uint32_t mb;
+
+    if (s_mb_free != 0U)
+    {
+        for (mb = 0; (s_mb_free & (1UL << mb)) == 0U; mb++)
+        {
+        }
+        s_mb_free &= ~(1UL << mb);
+        CanNode_Load(mb, frame);
+        return true;
+    }
+
+    if ((s_queue_head - s_queue_tail) >= CAN_NODE_QUEUE_LEN)
+    {
+        return false;
+    }
+    s_queue[s_queue_head & (CAN_NODE_QUEUE_LEN - 1U)] = *frame;
+    s_queue_head++;
+
+    return true;
+}
+
+/**
+ * @brief Derives the alarm flags with hysteresis from a new sample.
+ */
+static void CanNode_UpdateAlarms(int16_t value)
+{
+    if (value > s_config.alarm_high)
+    {
+        s_alarms |= CAN_NODE_FLAG_ALARM_HIGH;
+    }
+    else if (value < (s_config.alarm_high - s_config.hysteresis))
+    {
+        s_alarms &= (uint8_t)~CAN_NODE_FLAG_ALARM_HIGH;
+    }
+
+    if (value < s_config.alarm_low)
+    {
+        s_alarms |= CAN_NODE_FLAG_ALARM_LOW;
+    }
+    else if (value > (s_config.alarm_low + s_config.hysteresis))
+    {
+        s_alarms &= (uint8_t)~CAN_NODE_FLAG_ALARM_LOW;
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Message buffers 0-15 of FlexCAN0: each completed transmission
+ * frees its mailbox, which takes the oldest queued frame right away.
+ */
+void CAN0_ORed_0_15_MB_IRQHandler(void)
+{
+    uint32_t done = CAN_NODE_MODULE->IFLAG1 & CAN_NODE_MB_MASK;
+    uint32_t mb;
+
+    CAN_NODE_MODULE->IFLAG1 = done;
+    for (mb = 0; done != 0U; mb++, done >>= 1)
+    {
+        if ((done & 1U) == 0U)
+        {
+            continue;
+        }
+        if (s_queue_tail != s_queue_head)
+        {
+            CanNode_Load(mb, &s_queue[s_queue_tail & (CAN_NODE_QUEUE_LEN - 1U)]);
+            s_queue_tail++;
+        }
+        else
+        {
+            s_mb_free |= 1UL << mb;
+        }
+    }
+}
+
+/**
+ * @brief Brings FlexCAN0 onto the bus as a transmit-only node.
+ * @details The protocol engine runs from SOSCDIV2, the crystal, since CAN
+ * timing needs better than the internal oscillators' tolerance. That clock
+ * is stopped in VLPR, so the node must idle in RUN. Received frames are
+ * not stored and the node's own frames are not echoed back.
+ * @param config Node settings; copied.
+ * @return STATUS_ERROR if the crystal cannot produce CAN_NODE_BITRATE
+ * exactly, STATUS_TIMEOUT if the module does not leave freeze mode.
+ */
+status_t CanNode_Init(const can_node_config_t *config)
+{
+    uint32_t clk_hz = 0;
+    uint32_t presdiv;
+    uint32_t i;
+    status_t status;
+
+    if (config == NULL)
+    {
+        return STATUS_ERROR;
+    }
+    s_config = *config;
+
+    (void)CLOCK_SYS_GetFreq(SOSCDIV2_CLK, &clk_hz);
+    presdiv = clk_hz / (CAN_NODE_BITRATE * CAN_NODE_TQ_PER_BIT);
+    if ((presdiv == 0U) || (presdiv > 256U) ||
+        ((presdiv * CAN_NODE_BITRATE * CAN_NODE_TQ_PER_BIT) != clk_hz))
+    {
+        return STATUS_ERROR;
+    }
+
+    // The clock source can only be selected while the module is disabled
+    CAN_NODE_MODULE->MCR |= CAN_MCR_MDIS_MASK;
+    CAN_NODE_MODULE->CTRL1 &= ~CAN_CTRL1_CLKSRC_MASK;
+    CAN_NODE_MODULE->MCR &= ~CAN_MCR_MDIS_MASK;
+    status = CanNode_WaitMcr(CAN_MCR_LPMACK_MASK, 0U);
+
+    // Configuration is only writable in freeze mode
+    CAN_NODE_MODULE->MCR |= CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK;
+    if (status == STATUS_SUCCESS)
+    {
+        status = CanNode_WaitMcr(CAN_MCR_FRZACK_MASK, CAN_MCR_FRZACK_MASK);
+    }
+    if (status != STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    CAN_NODE_MODULE->MCR = (CAN_NODE_MODULE->MCR & ~(CAN_MCR_MAXMB_MASK | CAN_MCR_FDEN_MASK)) |
+                           CAN_MCR_SRXDIS_MASK | CAN_MCR_MAXMB(CAN_NODE_TX_MAILBOXES - 1U);
+    CAN_NODE_MODULE->CTRL1 = CAN_CTRL1_PRESDIV(presdiv - 1U) |
+                             CAN_CTRL1_RJW(CAN_NODE_RJW - 1U) |
+                             CAN_CTRL1_PSEG1(CAN_NODE_PSEG1 - 1U) |
+                             CAN_CTRL1_PSEG2(CAN_NODE_PSEG2 - 1U) |
+                             CAN_CTRL1_PROPSEG(CAN_NODE_PROPSEG - 1U);
+
+    // Message buffer RAM is not reset; every mailbox starts out idle
+    for (i = 0; i < CAN_RAMn_COUNT; i++)
+    {
+        CAN_NODE_MODULE->RAMn[i] = 0U;
+    }
+    for (i = 0; i < CAN_NODE_TX_MAILBOXES; i++)
+    {
+        CAN_NODE_MB_CS(i) = CAN_NODE_CS_CODE(CAN_NODE_CODE_TX_INACTIVE);
+    }
+    s_mb_free = CAN_NODE_MB_MASK;
+    s_queue_head = 0;
+    s_queue_tail = 0;
+    CAN_NODE_MODULE->IFLAG1 = 0xFFFFFFFFU;
+    CAN_NODE_MODULE->IMASK1 = CAN_NODE_MB_MASK;
+
+    CAN_NODE_MODULE->MCR &= ~(CAN_MCR_FRZ_MASK | CAN_MCR_HALT_MASK);
+    status = CanNode_WaitMcr(CAN_MCR_FRZACK_MASK | CAN_MCR_NOTRDY_MASK, 0U);
+    if (status != STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    INT_SYS_EnableIRQ(CAN_NODE_MB_IRQ);
+    s_ready = true;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Feeds one reading of the sample pipeline into the frame contents.
+ * @param value Filtered temperature, 0.1 C steps.
+ */
+void CanNode_Sample(int16_t value)
+{
+    if (!s_have_sample)
+    {
+        s_min = value;
+        s_max = value;
+        s_have_sample = true;
+    }
+    else if (value < s_min)
+    {
+        s_min = value;
+    }
+    else if (value > s_max)
+    {
+        s_max = value;
+    }
+
+    s_value = value;
+    s_fresh = true;
+    CanNode_UpdateAlarms(value);
+}
+
+/**
+ * @brief Queues one status frame from the latest reading; call once per
+ * broadcast period.
+ * @details Nothing is sent before the first sample. Never waits for the
+ * bus: a frame that finds every mailbox and queue slot taken is counted
+ * and flagged in the next one that gets through.
+ * @return false if the frame was not queued.
+ */
+bool CanNode_Publish(void)
+{
+    can_node_frame_t frame;
+    uint8_t flags = s_alarms;
+    uint32_t lock;
+    bool queued;
+
+    if (!s_ready || !s_have_sample)
+    {
+        return false;
+    }
+
+    if (!s_fresh)
+    {
+        flags |= CAN_NODE_FLAG_STALE;
+    }
+    if (s_dropped != s_dropped_reported)
+    {
+        flags |= CAN_NODE_FLAG_DROPPED;
+    }
+
+    frame.id = CAN_NODE_ID_STD(CAN_NODE_ID_BASE + s_config.node_id);
+    frame.data[0] = ((uint32_t)(uint8_t)s_value << 24) | ((uint32_t)(uint8_t)((uint16_t)s_value >> 8) << 16) |
+                    ((uint32_t)(uint8_t)s_min << 8) | (uint32_t)(uint8_t)((uint16_t)s_min >> 8);
+    frame.data[1] = ((uint32_t)(uint8_t)s_max << 24) | ((uint32_t)(uint8_t)((uint16_t)s_max >> 8) << 16) |
+                    ((uint32_t)flags << 8) | (uint32_t)s_counter;
+
+    lock = IRQ_Lock(IRQ_PRIO_I2C);
+    queued = CanNode_Send(&frame);
+    IRQ_Unlock(lock);
+
+    if (queued)
+    {
+        s_counter++;
+        s_fresh = false;
+        s_dropped_reported = s_dropped;
+    }
+    else
+    {
+        s_dropped++;
+    }
+
+    return queued;
+}
+
+/**
+ * @brief Returns the number of frames lost to a busy or absent bus.
+ */
+uint32_t CanNode_Dropped(void)
+{
+    return s_dropped;
+}
@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @file      can_node.h
+ * @brief     CAN sensor node: periodic status frames on FlexCAN0 with the
+ * filtered temperature, its min/max and alarm flags, sent from a ring of
+ * transmit mailboxes refilled by interrupt.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef CAN_NODE_H_
+#define CAN_NODE_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#ifndef CAN_NODE_BITRATE
+#define CAN_NODE_BITRATE        500000U  // Nominal bit rate of the sensor bus
+#endif
+
+#define CAN_NODE_ID_BASE        0x500U   // Status frame ID = base + node id (11-bit)
+#define CAN_NODE_TX_MAILBOXES   4U       // Message buffers 0..3 take turns transmitting
+#define CAN_NODE_QUEUE_LEN      8U       // Frames waiting for a mailbox; power of two
+
+/*
+ * Status frame, 8 bytes, little-endian values in 0.1 C steps:
+ *   [0..1] i16 filtered temperature
+ *   [2..3] i16 minimum since start-up
+ *   [4..5] i16 maximum since start-up
+ *   [6]    u8  CAN_NODE_FLAG_* bits
+ *   [7]    u8  counter, +1 per frame, so a receiver can spot lost frames
+ */
+#define CAN_NODE_FLAG_ALARM_HIGH 0x01U   // Above alarm_high, until it drops below it by the hysteresis
+#define CAN_NODE_FLAG_ALARM_LOW  0x02U   // Below alarm_low, until it rises above it by the hysteresis
+#define CAN_NODE_FLAG_STALE      0x04U   // No new sample since the previous frame
+#define CAN_NODE_FLAG_DROPPED    0x08U   // Frames were dropped since the previous frame
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Node settings; temperatures in 0.1 C steps.
+ */
+typedef struct
+{
+    uint8_t node_id;        // 0..0xFF, added to CAN_NODE_ID_BASE
+    int16_t alarm_high;
+    int16_t alarm_low;
+    int16_t hysteresis;     // Clearance needed to leave an alarm
+} can_node_config_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t CanNode_Init(const can_node_config_t *config);
+void CanNode_Sample(int16_t value);
+bool CanNode_Publish(void);
+uint32_t CanNode_Dropped(void);
+
+#endif /* CAN_NODE_H_ */
@@ -0,0 +1,156 @@
+/**
+ ******************************************************************************
+ * @file      clock_gate.c
+ * @brief     Reference-counted peripheral clock gating: a peripheral clock
+ * only runs while at least one user holds it.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "clock_gate.h"
+#include "device_registers.h"
+#include "clock_manager.h"
+#include "pcc_hw_access.h"
+#include "sim_hw_access.h"
+#include "irq_prio.h"
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Holders of each gate; shared with the interrupts that acquire and release
+static uint8_t s_refs[CLOCK_GATE_COUNT];
+
+// Set by ClockGate_Init(); until then the clocks are left running and only counted
+static bool s_managed;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Opens or closes one gate.
+ * @details The eDMA engine is gated in SIM, its request mux in the PCC; the
+ * engine runs first and stops last.
+ */
+static void ClockGate_Set(clock_gate_t gate, bool on)
+{
+    switch (gate)
+    {
+        case CLOCK_GATE_LPI2C0:
+            PCC_SetClockMode(PCC, LPI2C0_CLK, on);
+            break;
+        case CLOCK_GATE_ADC0:
+            PCC_SetClockMode(PCC, ADC0_CLK, on);
+            break;
+        case CLOCK_GATE_PDB0:
+            PCC_SetClockMode(PCC, PDB0_CLK, on);
+            break;
+        case CLOCK_GATE_LPTMR0:
+            PCC_SetClockMode(PCC, LPTMR0_CLK, on);
+            break;
+        case CLOCK_GATE_CRC:
+            PCC_SetClockMode(PCC, CRC0_CLK, on);
+            break;
+        case CLOCK_GATE_DMA:
+            if (on)
+            {
+                SIM_SetDmaClockGate(SIM, true);
+                PCC_SetClockMode(PCC, DMAMUX0_CLK, true);
+            }
+            else
+            {
+                PCC_SetClockMode(PCC, DMAMUX0_CLK, false);
+                SIM_SetDmaClockGate(SIM, false);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Takes over the managed gates and closes every one nobody holds.
+ * @details Call once after CLOCK_DRV_Init() and before the drivers of these
+ * peripherals are initialized, which must then hold their gate. Without this
+ * call the counts are tracked but the clocks stay on, so builds that do not
+ * opt in behave as before.
+ */
+void ClockGate_Init(void)
+{
+    uint32_t lock;
+    uint8_t i;
+
+    lock = IRQ_Lock(IRQ_PRIO_DMA);
+    s_managed = true;
+    for (i = 0; i < (uint8_t)CLOCK_GATE_COUNT; i++)
+    {
+        ClockGate_Set((clock_gate_t)i, s_refs[i] != 0U);
+    }
+    IRQ_Unlock(lock);
+}
+
+/**
+ * @brief Adds a holder, starting the clock for the first one.
+ * @details Callable from interrupts at IRQ_PRIO_DMA or below. Register access to the
+ * peripheral is only allowed between Acquire and the matching Release.
+ */
+void ClockGate_Acquire(clock_gate_t gate)
+{
+    uint32_t lock;
+
+    if ((uint32_t)gate >= (uint32_t)CLOCK_GATE_COUNT)
+    {
+        return;
+    }
+
+    lock = IRQ_Lock(IRQ_PRIO_DMA);
+    if ((s_refs[gate]++ == 0U) && s_managed)
+    {
+        ClockGate_Set(gate, true);
+    }
+    IRQ_Unlock(lock);
+}
+
+/**
+ * @brief Drops a holder, gating the clock when the last one is gone.
+ * @details Callable from interrupts at IRQ_PRIO_DMA or below. The peripheral keeps its
+ * register contents while gated. An unmatched release is ignored.
+ */
+void ClockGate_Release(clock_gate_t gate)
+{
+    uint32_t lock;
+
+    if ((uint32_t)gate >= (uint32_t)CLOCK_GATE_COUNT)
+    {
+        return;
+    }
+
+    lock = IRQ_Lock(IRQ_PRIO_DMA);
+    if ((s_refs[gate] != 0U) && (--s_refs[gate] == 0U) && s_managed)
+    {
+        ClockGate_Set(gate, false);
+    }
+    IRQ_Unlock(lock);
+}
+
+/**
+ * @brief Reports whether a gate is open, either held or not yet managed.
+ */
+bool ClockGate_IsRunning(clock_gate_t gate)
+{
+    if ((uint32_t)gate >= (uint32_t)CLOCK_GATE_COUNT)
+    {
+        return false;
+    }
+
+    return !s_managed || (s_refs[gate] != 0U);
+}
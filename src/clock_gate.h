@@ -0,0 +1,48 @@
+/**
+ ******************************************************************************
+ * @file      clock_gate.h
+ * @brief     Reference-counted peripheral clock gating: a peripheral clock
+ * only runs while at least one user holds it.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef CLOCK_GATE_H_
+#define CLOCK_GATE_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Managed clock gates. Source and divider stay as CLOCK_DRV_Init()
+ * configured them; only the gate is switched.
+ */
+typedef enum
+{
+    CLOCK_GATE_LPI2C0 = 0,      // PCC LPI2C0
+    CLOCK_GATE_ADC0,            // PCC ADC0
+    CLOCK_GATE_PDB0,            // PCC PDB0
+    CLOCK_GATE_DMA,             // eDMA (SIM_PLATCGC) and PCC DMAMUX
+    CLOCK_GATE_LPTMR0,          // PCC LPTMR0
+    CLOCK_GATE_CRC,             // PCC CRC
+    CLOCK_GATE_COUNT
+} clock_gate_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void ClockGate_Init(void);
+void ClockGate_Acquire(clock_gate_t gate);
+void ClockGate_Release(clock_gate_t gate);
+bool ClockGate_IsRunning(clock_gate_t gate);
+
+#endif /* CLOCK_GATE_H_ */
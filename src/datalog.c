@@ -0,0 +1,469 @@
+/**
+ ******************************************************************************
+ * @file      datalog.c
+ * @brief     Circular temperature log in FlexNVM D-Flash: delta-timestamped
+ * 16-bit samples batched into RAM pages, with sectors erased in rotation so
+ * wear is spread evenly.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "datalog.h"
+#include <stddef.h>
+#include "S32K144.h"
+#include "S32K144_features.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define DATALOG_BASE            FEATURE_FLS_DF_START_ADDRESS
+#define DATALOG_SECTOR_SIZE     FEATURE_FLS_DF_BLOCK_SECTOR_SIZE
+#define DATALOG_PHRASE_SIZE     FEATURE_FLS_DF_BLOCK_WRITE_UNIT_SIZE
+#define DATALOG_PAGE_SIZE       64U
+#define DATALOG_PAGES           ((DATALOG_SECTOR_SIZE - DATALOG_PHRASE_SIZE) / DATALOG_PAGE_SIZE)
+
+#if (DATALOG_SECTORS < 2U) || ((DATALOG_SECTORS * DATALOG_SECTOR_SIZE) > FEATURE_FLS_DF_BLOCK_SIZE)
+#error "DATALOG_SECTORS must be at least 2 and fit in the D-Flash block"
+#endif
+
+#define DATALOG_MAGIC           0x474F4C54UL    // "TLOG", first word of a sector in use
+#define DATALOG_ERASED_WORD     0xFFFFFFFFUL
+#define DATALOG_ERASED_HALF     0xFFFFU
+
+// FTFC commands and the FCCOB address of D-Flash offset 0
+#define DATALOG_CMD_PGM8        0x07U
+#define DATALOG_CMD_ERSSCR      0x09U
+#define DATALOG_FCCOB_DFLASH    0x800000UL
+
+// FCCOBn sits in FCCOB[] with its bytes reversed per 32-bit word
+#define DATALOG_FCCOB(n)        (FTFC->FCCOB[((n) & ~3U) + 3U - ((n) & 3U)])
+
+#define DATALOG_FSTAT_ERRORS    (FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK | FTFC_FSTAT_MGSTAT0_MASK)
+
+// SMC_PMSTAT in RUN, the only mode that may program or erase
+#define DATALOG_PMSTAT_RUN      0x01U
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+// First phrase of a sector in use; seq orders the sectors of the ring
+typedef struct
+{
+    uint32_t magic;
+    uint32_t seq;
+} datalog_header_t;
+
+// One record: time since the previous record of the same page, then the sample
+typedef struct
+{
+    uint16_t delta_ms;
+    int16_t value;
+} datalog_entry_t;
+
+// Unit of programming; the first record has delta 0, unused ones stay erased
+typedef struct
+{
+    uint32_t time_ms;
+    datalog_entry_t entry[DATALOG_PAGE_RECORDS];
+} datalog_page_t;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Sector being appended to, its sequence number and the next free page in it
+static uint8_t s_head;
+static uint32_t s_seq;
+static uint8_t s_next_page;
+static bool s_mounted;
+
+// Page being filled by Datalog_Append(), and the sealed one waiting for Datalog_Flush()
+static datalog_page_t s_fill;
+static uint8_t s_fill_count;
+static uint32_t s_fill_last_ms;
+static datalog_page_t s_flush;
+static bool s_flush_pending;
+
+// Samples lost because both pages were full
+static uint32_t s_dropped;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+static const datalog_header_t *Datalog_Header(uint8_t sector)
+{
+    return (const datalog_header_t *)(DATALOG_BASE + ((uint32_t)sector * DATALOG_SECTOR_SIZE));
+}
+
+static const datalog_page_t *Datalog_Page(uint8_t sector, uint8_t page)
+{
+    return (const datalog_page_t *)(DATALOG_BASE + ((uint32_t)sector * DATALOG_SECTOR_SIZE) +
+                                   DATALOG_PHRASE_SIZE + ((uint32_t)page * DATALOG_PAGE_SIZE));
+}
+
+/**
+ * @brief Runs one FTFC command on a D-Flash address and waits for it.
+ * @details Code keeps running from P-Flash while the FlexNVM block is busy,
+ * so interrupts need not be masked. The code cache is invalidated afterwards
+ * so later reads see the new contents.
+ * @param command FTFC command code.
+ * @param address Absolute D-Flash address.
+ * @param data    DATALOG_PHRASE_SIZE bytes for a program command, else NULL.
+ */
+static status_t Datalog_Command(uint8_t command, uint32_t address, const uint8_t *data)
+{
+    uint32_t fccob_addr = (address - DATALOG_BASE) | DATALOG_FCCOB_DFLASH;
+    uint8_t i;
+
+    while ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0U)
+    {
+    }
+    FTFC->FSTAT = FTFC_FSTAT_ACCERR_MASK | FTFC_FSTAT_FPVIOL_MASK;
+
+    DATALOG_FCCOB(0U) = command;
+    DATALOG_FCCOB(1U) = (uint8_t)(fccob_addr >> 16);
+    DATALOG_FCCOB(2U) = (uint8_t)(fccob_addr >> 8);
+    DATALOG_FCCOB(3U) = (uint8_t)fccob_addr;
+    if (data != NULL)
+    {
+        // Data bytes go in memory order, as in the SDK flash driver
+        for (i = 0; i < DATALOG_PHRASE_SIZE; i++)
+        {
+            FTFC->FCCOB[4U + i] = data[i];
+        }
+    }
+
+    FTFC->FSTAT = FTFC_FSTAT_CCIF_MASK;
+    while ((FTFC->FSTAT & FTFC_FSTAT_CCIF_MASK) == 0U)
+    {
+    }
+
+    LMEM->PCCCR |= LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK | LMEM_PCCCR_GO_MASK;
+    while ((LMEM->PCCCR & LMEM_PCCCR_GO_MASK) != 0U)
+    {
+    }
+
+    return ((FTFC->FSTAT & DATALOG_FSTAT_ERRORS) != 0U) ? STATUS_ERROR : STATUS_SUCCESS;
+}
+
+/**
+ * @brief Erases a sector and stamps it as the new head of the ring.
+ * @details A reset between the two commands leaves a sector without
+ * header, which the next mount ignores and erases again when its turn comes.
+ */
+static status_t Datalog_OpenSector(uint8_t sector, uint32_t seq)
+{
+    datalog_header_t header = { DATALOG_MAGIC, seq };
+    uint32_t address = (uint32_t)Datalog_Header(sector);
+    status_t status;
+
+    status = Datalog_Command(DATALOG_CMD_ERSSCR, address, NULL);
+    if (status == STATUS_SUCCESS)
+    {
+        status = Datalog_Command(DATALOG_CMD_PGM8, address, (const uint8_t *)&header);
+    }
+    if (status == STATUS_SUCCESS)
+    {
+        s_head = sector;
+        s_seq = seq;
+        s_next_page = 0;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Clears the fill page to the erased pattern.
+ */
+static void Datalog_ResetFill(void)
+{
+    uint8_t i;
+
+    s_fill.time_ms = DATALOG_ERASED_WORD;
+    for (i = 0; i < DATALOG_PAGE_RECORDS; i++)
+    {
+        s_fill.entry[i].delta_ms = DATALOG_ERASED_HALF;
+        s_fill.entry[i].value = (int16_t)DATALOG_ERASED_HALF;
+    }
+    s_fill_count = 0;
+}
+
+/**
+ * @brief Hands the fill page over to Datalog_Flush().
+ * @return false if the previous page has not been written yet.
+ */
+static bool Datalog_Seal(void)
+{
+    if (s_flush_pending)
+    {
+        return false;
+    }
+    if (s_fill_count != 0U)
+    {
+        s_flush = s_fill;
+        s_flush_pending = true;
+        Datalog_ResetFill();
+    }
+
+    return true;
+}
+
+/**
+ * @brief Programs the sealed page, first rotating to the next sector if the
+ * head one is full. Called in RUN mode with a page pending.
+ */
+static status_t Datalog_WritePage(void)
+{
+    const uint8_t *src = (const uint8_t *)&s_flush;
+    uint32_t address;
+    status_t status = STATUS_SUCCESS;
+    uint8_t i;
+
+    // The sector after the head is the oldest: erasing sectors in ring order levels the wear
+    if (s_next_page >= DATALOG_PAGES)
+    {
+        status = Datalog_OpenSector((uint8_t)((s_head + 1U) % DATALOG_SECTORS), s_seq + 1U);
+        if (status != STATUS_SUCCESS)
+        {
+            return status;
+        }
+    }
+
+    address = (uint32_t)Datalog_Page(s_head, s_next_page);
+    for (i = 0; (i < (DATALOG_PAGE_SIZE / DATALOG_PHRASE_SIZE)) && (status == STATUS_SUCCESS); i++)
+    {
+        status = Datalog_Command(DATALOG_CMD_PGM8, address + ((uint32_t)i * DATALOG_PHRASE_SIZE),
+                                 &src[i * DATALOG_PHRASE_SIZE]);
+    }
+    s_next_page++;
+    s_flush_pending = false;
+
+    return status;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Finds the newest sector and its first free page, or starts an
+ * empty log.
+ * @details Must run in RUN mode if the log has to be created. Needs
+ * FlexNVM configured as D-Flash only, which is the factory setting; a
+ * partition with EEPROM backup is left alone.
+ * @return STATUS_SUCCESS, STATUS_UNSUPPORTED for a partitioned FlexNVM, or
+ * STATUS_ERROR if the first sector could not be prepared.
+ */
+status_t Datalog_Init(void)
+{
+    const datalog_header_t *header;
+    uint32_t depart = (SIM->FCFG1 & SIM_FCFG1_DEPART_MASK) >> SIM_FCFG1_DEPART_SHIFT;
+    bool found = false;
+    uint8_t sector;
+
+    s_mounted = false;
+    s_flush_pending = false;
+    s_dropped = 0;
+    Datalog_ResetFill();
+
+    if ((depart != 0x0U) && (depart != 0xFU))
+    {
+        return STATUS_UNSUPPORTED;
+    }
+
+    // Newest is the largest sequence number, compared modulo 2^32
+    for (sector = 0; sector < DATALOG_SECTORS; sector++)
+    {
+        header = Datalog_Header(sector);
+        if ((header->magic == DATALOG_MAGIC) && (!found || ((int32_t)(header->seq - s_seq) > 0)))
+        {
+            s_head = sector;
+            s_seq = header->seq;
+            found = true;
+        }
+    }
+    if (!found)
+    {
+        if (Datalog_OpenSector(0U, 1U) != STATUS_SUCCESS)
+        {
+            return STATUS_ERROR;
+        }
+    }
+    else
+    {
+        // Pages are written in order, so the first erased one ends the sector's data
+        for (s_next_page = 0; s_next_page < DATALOG_PAGES; s_next_page++)
+        {
+            if (Datalog_Page(s_head, s_next_page)->time_ms == DATALOG_ERASED_WORD)
+            {
+                break;
+            }
+        }
+    }
+    s_mounted = true;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Adds one sample to the RAM page; never touches the flash.
+ * @details Records within a page store 16-bit deltas, so a gap longer than
+ * DATALOG_MAX_DELTA_MS seals the page early and the sample opens a new one
+ * with a full timestamp. Main context only.
+ * @param value  Sample to log.
+ * @param now_ms Time of the sample, e.g. OSIF_GetMilliseconds().
+ * @return true when a sealed page waits for Datalog_Flush().
+ */
+bool Datalog_Append(int16_t value, uint32_t now_ms)
+{
+    datalog_entry_t *entry;
+
+    if ((s_fill_count == DATALOG_PAGE_RECORDS) ||
+        ((s_fill_count != 0U) && ((now_ms - s_fill_last_ms) > DATALOG_MAX_DELTA_MS)))
+    {
+        if (!Datalog_Seal())
+        {
+            s_dropped++;
+            return true;
+        }
+    }
+
+    entry = &s_fill.entry[s_fill_count];
+    if (s_fill_count == 0U)
+    {
+        // An all-ones time would read back as an erased page
+        s_fill.time_ms = (now_ms == DATALOG_ERASED_WORD) ? (now_ms - 1U) : now_ms;
+        entry->delta_ms = 0;
+    }
+    else
+    {
+        entry->delta_ms = (uint16_t)(now_ms - s_fill_last_ms);
+    }
+    entry->value = value;
+    s_fill_last_ms = now_ms;
+    s_fill_count++;
+
+    if (s_fill_count == DATALOG_PAGE_RECORDS)
+    {
+        (void)Datalog_Seal();
+    }
+
+    return s_flush_pending;
+}
+
+/**
+ * @brief Programs the sealed page, erasing the oldest sector first when the
+ * head sector is full.
+ * @details Blocks for the page's eight phrase programs, plus a sector erase
+ * once every DATALOG_PAGES pages. Program and erase are only allowed in RUN,
+ * so the caller switches out of HSRUN or VLPR around the call. A page that
+ * fails is skipped, since a partly programmed phrase cannot be written again.
+ * @param partial Also seal and write a page that is not full yet, e.g.
+ * before power-down.
+ * @return STATUS_SUCCESS (also with nothing to write), STATUS_BUSY when not
+ * in RUN mode, or STATUS_ERROR on a flash error.
+ */
+status_t Datalog_Flush(bool partial)
+{
+    status_t status = STATUS_SUCCESS;
+
+    if (!s_mounted)
+    {
+        return STATUS_SUCCESS;
+    }
+    if ((SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK) != DATALOG_PMSTAT_RUN)
+    {
+        return (s_flush_pending || (partial && (s_fill_count != 0U))) ? STATUS_BUSY : STATUS_SUCCESS;
+    }
+
+    // A partial flush may have to write the pending page first, then the fill page
+    do
+    {
+        if (partial)
+        {
+            (void)Datalog_Seal();
+        }
+        if (!s_flush_pending)
+        {
+            break;
+        }
+        status = Datalog_WritePage();
+    } while (partial && (status == STATUS_SUCCESS) && (s_fill_count != 0U));
+
+    return status;
+}
+
+/**
+ * @brief Returns the number of samples refused because a sealed page was
+ * still waiting for Datalog_Flush().
+ */
+uint32_t Datalog_Dropped(void)
+{
+    return s_dropped;
+}
+
+/**
+ * @brief Positions a cursor on the oldest record in flash.
+ * @details Samples still in RAM are not visible until flushed.
+ */
+void Datalog_ReadBegin(datalog_cursor_t *cursor)
+{
+    cursor->sector = (uint8_t)((s_head + 1U) % DATALOG_SECTORS);
+    cursor->sectors_left = s_mounted ? (uint8_t)DATALOG_SECTORS : 0U;
+    cursor->page = 0;
+    cursor->record = 0;
+    cursor->time_ms = 0;
+}
+
+/**
+ * @brief Decodes the next record, oldest first.
+ * @details Walks the ring from the sector after the head, skipping sectors
+ * without a header. Must not run between Datalog_Flush() calls that rotate
+ * into the sector under the cursor.
+ * @return false once every record has been read.
+ */
+bool Datalog_ReadNext(datalog_cursor_t *cursor, datalog_record_t *record)
+{
+    const datalog_page_t *page;
+    const datalog_entry_t *entry;
+
+    while (cursor->sectors_left != 0U)
+    {
+        if ((Datalog_Header(cursor->sector)->magic == DATALOG_MAGIC) && (cursor->page < DATALOG_PAGES))
+        {
+            page = Datalog_Page(cursor->sector, cursor->page);
+            if (page->time_ms != DATALOG_ERASED_WORD)
+            {
+                entry = &page->entry[cursor->record];
+                if ((cursor->record < DATALOG_PAGE_RECORDS) && (entry->delta_ms != DATALOG_ERASED_HALF))
+                {
+                    cursor->time_ms = (cursor->record == 0U) ? page->time_ms : (cursor->time_ms + entry->delta_ms);
+                    cursor->record++;
+                    record->time_ms = cursor->time_ms;
+                    record->value = entry->value;
+                    return true;
+                }
+
+                // End of this page, the next one may follow
+                cursor->page++;
+                cursor->record = 0;
+                continue;
+            }
+        }
+
+        // No (more) data in this sector
+        cursor->sector = (uint8_t)((cursor->sector + 1U) % DATALOG_SECTORS);
+        cursor->sectors_left--;
+        cursor->page = 0;
+        cursor->record = 0;
+    }
+
+    return false;
+}
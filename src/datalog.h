@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @file      datalog.h
+ * @brief     Circular temperature log in FlexNVM D-Flash: delta-timestamped
+ * 16-bit samples batched into RAM pages, with sectors erased in rotation so
+ * wear is spread evenly.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef DATALOG_H_
+#define DATALOG_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// D-Flash sectors given to the log, from the start of FlexNVM
+#ifndef DATALOG_SECTORS
+#define DATALOG_SECTORS         16U
+#endif
+
+#define DATALOG_PAGE_RECORDS    15U     // Records per batched page write
+#define DATALOG_MAX_DELTA_MS    0xFFFEU // Longest gap inside a page; 0xFFFF marks erased flash
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief One decoded sample.
+ */
+typedef struct
+{
+    uint32_t time_ms;            // OSIF_GetMilliseconds() at Datalog_Append()
+    int16_t value;
+} datalog_record_t;
+
+/**
+ * @brief Read position for Datalog_ReadNext(); opaque to the caller.
+ */
+typedef struct
+{
+    uint8_t sector;
+    uint8_t sectors_left;
+    uint8_t page;
+    uint8_t record;
+    uint32_t time_ms;
+} datalog_cursor_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t Datalog_Init(void);
+bool Datalog_Append(int16_t value, uint32_t now_ms);
+status_t Datalog_Flush(bool partial);
+uint32_t Datalog_Dropped(void);
+
+void Datalog_ReadBegin(datalog_cursor_t *cursor);
+bool Datalog_ReadNext(datalog_cursor_t *cursor, datalog_record_t *record);
+
+#endif /* DATALOG_H_ */
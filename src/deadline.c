@@ -0,0 +1,308 @@
+/**
+ ******************************************************************************
+ * @file      deadline.c
+ * @brief     Deadline monitor: cycle budgets for the scheduled handlers, the
+ * watchdog refreshed only while every handler keeps to its budget.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "deadline.h"
+#include <stddef.h>
+#include "S32K144.h"
+#include "interrupt_manager.h"
+#include "osif.h"
+#include "fmt.h"
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define DEADLINE_WDOG_UNLOCK    0xD928C520U  // CNT write opening the configuration
+#define DEADLINE_WDOG_REFRESH   0xB480A602U  // CNT write restarting the timeout
+#define DEADLINE_LPO_PER_MS     128U         // WDOG counter ticks per millisecond
+
+// Marks the record of the overrun that preceded a watchdog reset as valid
+#define DEADLINE_RESET_MAGIC    0x444C4E45U
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+typedef struct
+{
+    const sched_event_t *event;
+    const char *name;
+} deadline_watch_t;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static deadline_watch_t s_watched[DEADLINE_MAX_WATCHED];
+static uint8_t s_watched_count;
+
+static uint32_t s_default_budget;
+static deadline_stats_t s_stats;
+
+// Latest overruns, oldest overwritten first
+static deadline_overrun_t s_log[DEADLINE_LOG_DEPTH];
+static uint8_t s_log_next;
+static uint8_t s_log_filled;
+
+// Overruns since the last window closed
+static uint32_t s_window_overruns;
+
+static sched_timer_t s_window_timer;
+
+// Last overrun, kept across the watchdog reset it may lead to
+static PERF_NOINIT deadline_overrun_t s_last;
+static PERF_NOINIT uint32_t s_last_magic;
+static deadline_overrun_t s_reset_cause;
+static bool s_have_cause;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Name a handler was registered with, or NULL.
+ */
+static const char *Deadline_Name(const sched_event_t *event)
+{
+    uint8_t i;
+
+    for (i = 0; i < s_watched_count; i++)
+    {
+        if (s_watched[i].event == event)
+        {
+            return s_watched[i].name;
+        }
+    }
+
+    return NULL;
+}
+
+/**
+ * @brief Scheduler monitor: checks each handler run against its budget.
+ */
+PERF_HOT static void Deadline_Check(sched_event_t *event, uint32_t cycles)
+{
+    uint32_t budget = (event->budget != 0U) ? event->budget : s_default_budget;
+    deadline_overrun_t *entry;
+
+    if ((budget == 0U) || (cycles <= budget))
+    {
+        return;
+    }
+
+    s_window_overruns++;
+    s_stats.overruns++;
+
+    entry = &s_log[s_log_next];
+    entry->name = Deadline_Name(event);
+    entry->cycles = cycles;
+    entry->budget = budget;
+    entry->ms = OSIF_GetMilliseconds();
+    s_log_next = (uint8_t)((s_log_next + 1U) % DEADLINE_LOG_DEPTH);
+    if (s_log_filled < DEADLINE_LOG_DEPTH)
+    {
+        s_log_filled++;
+    }
+
+    s_last = *entry;
+    s_last_magic = DEADLINE_RESET_MAGIC;
+}
+
+/**
+ * @brief Closes a window: refreshes the watchdog if it met every budget.
+ * @details Runs as a scheduled handler itself, so a handler that never
+ * returns also stops the refreshes.
+ */
+static void Deadline_Window(void *param)
+{
+    (void)param;
+
+    if (s_window_overruns == 0U)
+    {
+        WDOG->CNT = DEADLINE_WDOG_REFRESH;
+        s_stats.refreshes++;
+    }
+    else
+    {
+        s_stats.withheld++;
+    }
+    s_window_overruns = 0;
+}
+
+/**
+ * @brief Enables the watchdog with a DEADLINE_TIMEOUT_MS timeout.
+ * @details Needs CS[UPDATE] left set by the start-up code. The counter runs
+ * from the LPO in RUN, VLPR and WFI, and pauses in VLPS and while the core
+ * is halted by a debugger. The whole sequence must complete within 128 bus
+ * clocks of the unlock, hence the interrupt lock.
+ */
+static void Deadline_EnableWatchdog(void)
+{
+    INT_SYS_DisableIRQGlobal();
+    WDOG->CNT = DEADLINE_WDOG_UNLOCK;
+    WDOG->TOVAL = DEADLINE_TIMEOUT_MS * DEADLINE_LPO_PER_MS;
+    WDOG->WIN = 0;
+    WDOG->CS = WDOG_CS_EN_MASK | WDOG_CS_CLK(1U) | WDOG_CS_CMD32EN_MASK |
+               WDOG_CS_UPDATE_MASK | WDOG_CS_WAIT_MASK;
+    INT_SYS_EnableIRQGlobal();
+
+    while ((WDOG->CS & WDOG_CS_RCS_MASK) == 0U)
+    {
+        // New configuration takes a few LPO cycles to apply
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Gives a scheduled handler its own cycle budget.
+ * @details May be called before or after Deadline_Init(), from the main
+ * context. Budgets are in DWT cycles, so one handler costs about the same
+ * in every run mode, flash wait states aside. Interrupts taken during the
+ * run count against it.
+ * @param event         The handler's event; for a timer, &timer->event.
+ * @param name          Label for Deadline_Dump() and the overrun log.
+ * @param budget_cycles Cycles per run; 0 falls back to the default budget.
+ */
+void Deadline_Watch(sched_event_t *event, const char *name, uint32_t budget_cycles)
+{
+    event->budget = budget_cycles;
+    if ((Deadline_Name(event) == NULL) && (s_watched_count < DEADLINE_MAX_WATCHED))
+    {
+        s_watched[s_watched_count].event = event;
+        s_watched[s_watched_count].name = name;
+        s_watched_count++;
+    }
+}
+
+/**
+ * @brief Starts timing every handler and hands the watchdog to the monitor.
+ * @details Call after Sched_Init() and Prof_Init(), just before Sched_Run().
+ * From here on the watchdog is refreshed once per DEADLINE_WINDOW_MS
+ * window in which no handler overran; sporadic overruns are logged and
+ * tolerated, while overruns in every window for DEADLINE_TIMEOUT_MS, or a
+ * handler that never returns, reset the MCU.
+ * @param default_budget Cycles for handlers without a budget of their own;
+ *                       0 leaves them unchecked.
+ */
+void Deadline_Init(uint32_t default_budget)
+{
+    s_stats.watchdog_reset = (RCM->SRS & RCM_SRS_WDOG_MASK) != 0U;
+    s_have_cause = s_stats.watchdog_reset && (s_last_magic == DEADLINE_RESET_MAGIC);
+    if (s_have_cause)
+    {
+        s_reset_cause = s_last;
+    }
+    s_last_magic = 0;
+
+    s_default_budget = default_budget;
+    s_stats.overruns = 0;
+    s_stats.refreshes = 0;
+    s_stats.withheld = 0;
+    s_log_next = 0;
+    s_log_filled = 0;
+    s_window_overruns = 0;
+
+    Sched_SetMonitor(Deadline_Check);
+    Sched_TimerInit(&s_window_timer, Deadline_Window, NULL);
+    Deadline_Watch(&s_window_timer.event, "deadline", 0U);
+    Sched_TimerStart(&s_window_timer, DEADLINE_WINDOW_MS, DEADLINE_WINDOW_MS);
+    Deadline_EnableWatchdog();
+}
+
+/**
+ * @brief Reports the totals since Deadline_Init().
+ */
+void Deadline_GetStats(deadline_stats_t *stats)
+{
+    *stats = s_stats;
+}
+
+/**
+ * @brief Copies the latest overruns, newest first.
+ * @param log Destination for up to max entries.
+ * @param max Capacity of log.
+ * @return Entries copied.
+ */
+uint8_t Deadline_GetLog(deadline_overrun_t *log, uint8_t max)
+{
+    uint8_t n, slot;
+
+    for (n = 0; (n < max) && (n < s_log_filled); n++)
+    {
+        slot = (uint8_t)((s_log_next + DEADLINE_LOG_DEPTH - 1U - n) % DEADLINE_LOG_DEPTH);
+        log[n] = s_log[slot];
+    }
+
+    return n;
+}
+
+/**
+ * @brief Reports the overrun that preceded the last reset, if the watchdog
+ * caused it.
+ * @param last Out: the overrun, when known.
+ * @return false if the last reset was not from the watchdog, or no
+ * overrun was recorded before it, e.g. because a handler hung.
+ */
+bool Deadline_GetResetCause(deadline_overrun_t *last)
+{
+    if (!s_have_cause)
+    {
+        return false;
+    }
+    *last = s_reset_cause;
+
+    return true;
+}
+
+/**
+ * @brief Prints every watched handler's budget and worst run, then the
+ * window totals.
+ * @param print Line sink, the same as for Prof_Dump().
+ */
+void Deadline_Dump(prof_print_t print)
+{
+    char line[PROF_NAME_WIDTH + (3U * PROF_VALUE_WIDTH) + 1U];
+    const sched_event_t *event;
+    char *dst;
+    uint8_t i;
+
+    if (print == NULL)
+    {
+        return;
+    }
+
+    print("handler          budget      worst    percent");
+    for (i = 0; i < s_watched_count; i++)
+    {
+        event = s_watched[i].event;
+        dst = Prof_PutText(line, s_watched[i].name, PROF_NAME_WIDTH);
+        dst = Prof_PutValue(dst, event->budget, 0U);
+        dst = Prof_PutValue(dst, event->worst, 0U);
+        dst = Prof_PutValue(dst, (event->budget != 0U) ?
+                            (((uint64_t)event->worst * 100U) / event->budget) : 0U, 0U);
+        *dst = '\0';
+        print(line);
+    }
+
+    print("deadline       overruns  refreshes   withheld");
+    dst = Prof_PutText(line, s_stats.watchdog_reset ? "wdog reset" : "", PROF_NAME_WIDTH);
+    dst = Prof_PutValue(dst, s_stats.overruns, 0U);
+    dst = Prof_PutValue(dst, s_stats.refreshes, 0U);
+    dst = Prof_PutValue(dst, s_stats.withheld, 0U);
+    *dst = '\0';
+    print(line);
+}
@@ -0,0 +1,85 @@
+/**
+ ******************************************************************************
+ * @file      deadline.h
+ * @brief     Deadline monitor: cycle budgets for the scheduled handlers, the
+ * watchdog refreshed only while every handler keeps to its budget.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef DEADLINE_H_
+#define DEADLINE_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sched.h"
+#include "prof.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// The watchdog is refreshed at most once per window, and only if no
+// handler overran in it
+#ifndef DEADLINE_WINDOW_MS
+#define DEADLINE_WINDOW_MS      100U
+#endif
+
+// Watchdog timeout, from the 128 kHz LPO; a hung handler or this many
+// milliseconds of overrunning windows in a row resets the MCU
+#ifndef DEADLINE_TIMEOUT_MS
+#define DEADLINE_TIMEOUT_MS     500U
+#endif
+
+#if (DEADLINE_TIMEOUT_MS * 128U) > 0xFFFFU
+#error "DEADLINE_TIMEOUT_MS exceeds the 16-bit watchdog timeout"
+#endif
+#if DEADLINE_TIMEOUT_MS <= DEADLINE_WINDOW_MS
+#error "DEADLINE_TIMEOUT_MS must span more than one window"
+#endif
+
+#define DEADLINE_MAX_WATCHED    8U   // Handlers with a name in Deadline_Dump()
+#define DEADLINE_LOG_DEPTH      8U   // Latest overruns kept
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief One handler run over its budget.
+ */
+typedef struct
+{
+    const char *name;            // As given to Deadline_Watch(), or NULL
+    uint32_t cycles;
+    uint32_t budget;
+    uint32_t ms;                 // OSIF_GetMilliseconds() at the end of the run
+} deadline_overrun_t;
+
+/**
+ * @brief Totals since Deadline_Init().
+ */
+typedef struct
+{
+    uint32_t overruns;
+    uint32_t refreshes;          // Windows that met every budget
+    uint32_t withheld;           // Windows with an overrun, left unrefreshed
+    bool watchdog_reset;         // The last reset came from the watchdog
+} deadline_stats_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void Deadline_Watch(sched_event_t *event, const char *name, uint32_t budget_cycles);
+void Deadline_Init(uint32_t default_budget);
+void Deadline_GetStats(deadline_stats_t *stats);
+uint8_t Deadline_GetLog(deadline_overrun_t *log, uint8_t max);
+bool Deadline_GetResetCause(deadline_overrun_t *last);
+void Deadline_Dump(prof_print_t print);
+
+#endif /* DEADLINE_H_ */
@@ -0,0 +1,234 @@
+/**
+ ******************************************************************************
+ * @file      dma_alloc.c
+ * @brief     eDMA channel allocator and software TCD pool, so the ADC
+ * stream, the LPI2C0 master and the telemetry UART each take a channel at
+ * run time instead of hard-coding one.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "dma_alloc.h"
+#include <stddef.h>
+#include "peripherals_edma_config_1.h"
+#include "interrupt_manager.h"
+#include "clock_gate.h"
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Driver state of every channel, handed to the eDMA driver on allocation
+static edma_chn_state_t s_chn_states[DMA_ALLOC_CHANNELS];
+
+// Bit n set while channel n is in use
+static volatile uint32_t s_chn_used;
+
+static uint8_t s_irq_prio_limit;
+
+// One spare TCD of room, so the pool can start on a 32-byte boundary
+static uint8_t s_tcd_storage[STCD_SIZE(DMA_ALLOC_TCD_COUNT + 1U)];
+static edma_software_tcd_t *s_tcds;
+
+// Bit n set while TCD n is free
+static volatile uint32_t s_tcd_free;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Claims the highest free channel at or below priority.
+ * @return The channel, or DMA_ALLOC_CHANNELS if none is left.
+ */
+static uint8_t DMA_Alloc_Claim(uint8_t priority)
+{
+    uint32_t used = __atomic_load_n(&s_chn_used, __ATOMIC_ACQUIRE);
+    uint32_t candidates;
+    uint32_t channel;
+
+    do
+    {
+        candidates = ~used & ((2UL << priority) - 1U);
+        if (candidates == 0U)
+        {
+            return DMA_ALLOC_CHANNELS;
+        }
+        channel = 31U - (uint32_t)__builtin_clz(candidates);
+    } while (!__atomic_compare_exchange_n(&s_chn_used, &used, used | (1UL << channel),
+                                          true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    return (uint8_t)channel;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Initializes the eDMA controller with every channel free.
+ * @details Replaces EDMA_DRV_Init() with the channel tables of the board
+ * configuration; the controller settings still come from
+ * dmaController_InitConfig. Call once with the eDMA clock running.
+ * @param irq_prio_limit Most urgent NVIC level a channel interrupt may get,
+ *                       e.g. the kernel-aware level of an RTOS port; 0 for
+ *                       no limit.
+ * @return Status of the eDMA driver initialization.
+ */
+status_t DMA_Alloc_Init(uint8_t irq_prio_limit)
+{
+    uint8_t i;
+
+    s_irq_prio_limit = irq_prio_limit;
+    s_chn_used = 0;
+    s_tcds = (edma_software_tcd_t *)STCD_ADDR(s_tcd_storage);
+    s_tcd_free = (DMA_ALLOC_TCD_COUNT == 32U) ? 0xFFFFFFFFU : ((1UL << DMA_ALLOC_TCD_COUNT) - 1U);
+    for (i = 0; i < DMA_ALLOC_CHANNELS; i++)
+    {
+        s_chn_states[i].virtChn = i;
+    }
+
+    return EDMA_DRV_Init(&dmaController_State, &dmaController_InitConfig, NULL, NULL, 0U);
+}
+
+/**
+ * @brief Takes a channel for one client and sets it up for its request source.
+ * @details With fixed-priority arbitration the eDMA serves the channel with
+ * the highest number first, and each channel keeps its reset priority, so
+ * the channel number is the priority. The client gets the channel matching
+ * its priority, or the next less urgent free one; priorities therefore
+ * never need renumbering and stay unique. The channel interrupt is enabled
+ * at irq_prio, or at the limit from DMA_Alloc_Init() if that is less urgent.
+ * @param request  DMA request source, EDMA_REQ_DISABLED for drivers that
+ *                 select theirs per transfer (LPI2C).
+ * @param priority Arbitration priority, 0 (lowest) to DMA_ALLOC_CHANNELS - 1.
+ * @param irq_prio NVIC level of the channel interrupt, one of the IRQ_PRIO_ levels.
+ * @param channel  Receives the channel number.
+ * @return STATUS_BUSY if no channel at or below priority is free.
+ */
+status_t DMA_Alloc_Channel(dma_request_source_t request, uint8_t priority, uint8_t irq_prio,
+                           uint8_t *channel)
+{
+    edma_channel_config_t config;
+    status_t status;
+    uint8_t chn;
+
+    if ((channel == NULL) || (priority >= DMA_ALLOC_CHANNELS))
+    {
+        return STATUS_ERROR;
+    }
+
+    chn = DMA_Alloc_Claim(priority);
+    if (chn >= DMA_ALLOC_CHANNELS)
+    {
+        return STATUS_BUSY;
+    }
+
+    config.channelPriority = EDMA_CHN_DEFAULT_PRIORITY;
+    config.virtChnConfig = chn;
+    config.source = request;
+    config.callback = NULL;
+    config.callbackParam = NULL;
+    config.enableTrigger = false;
+
+    ClockGate_Acquire(CLOCK_GATE_DMA);
+    status = EDMA_DRV_ChannelInit(&s_chn_states[chn], &config);
+    ClockGate_Release(CLOCK_GATE_DMA);
+    if (status != STATUS_SUCCESS)
+    {
+        __atomic_fetch_and(&s_chn_used, ~(1UL << chn), __ATOMIC_RELEASE);
+        return status;
+    }
+
+    INT_SYS_SetPriority((IRQn_Type)((uint32_t)DMA0_IRQn + chn),
+                        (irq_prio < s_irq_prio_limit) ? s_irq_prio_limit : irq_prio);
+    *channel = chn;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stops a channel and returns it to the allocator.
+ */
+void DMA_Alloc_Free(uint8_t channel)
+{
+    if ((channel >= DMA_ALLOC_CHANNELS) || ((s_chn_used & (1UL << channel)) == 0U))
+    {
+        return;
+    }
+
+    ClockGate_Acquire(CLOCK_GATE_DMA);
+    (void)EDMA_DRV_ReleaseChannel(channel);
+    ClockGate_Release(CLOCK_GATE_DMA);
+    __atomic_fetch_and(&s_chn_used, ~(1UL << channel), __ATOMIC_RELEASE);
+}
+
+/**
+ * @brief Takes count consecutive software TCDs for a scatter/gather chain.
+ * @details The run starts on a 32-byte boundary, as the eDMA requires of
+ * the TCDs it reloads, and can be passed to
+ * EDMA_DRV_ConfigScatterGatherTransfer() with tcdCount = count. Lock-free
+ * like Pool_Alloc(); the lowest fitting run is taken.
+ * @param count Number of TCDs, 1 to DMA_ALLOC_TCD_COUNT.
+ * @return The first TCD, or NULL if no run of that length is free.
+ */
+edma_software_tcd_t *DMA_Alloc_Tcds(uint8_t count)
+{
+    uint32_t free_mask = __atomic_load_n(&s_tcd_free, __ATOMIC_ACQUIRE);
+    uint32_t run;
+    uint32_t first;
+
+    if ((count == 0U) || (count > DMA_ALLOC_TCD_COUNT))
+    {
+        return NULL;
+    }
+
+    run = (count == 32U) ? 0xFFFFFFFFU : ((1UL << count) - 1U);
+    do
+    {
+        for (first = 0; first <= (DMA_ALLOC_TCD_COUNT - count); first++)
+        {
+            if ((free_mask & (run << first)) == (run << first))
+            {
+                break;
+            }
+        }
+        if (first > (DMA_ALLOC_TCD_COUNT - count))
+        {
+            return NULL;
+        }
+    } while (!__atomic_compare_exchange_n(&s_tcd_free, &free_mask, free_mask & ~(run << first),
+                                          true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    return &s_tcds[first];
+}
+
+/**
+ * @brief Returns a run taken with DMA_Alloc_Tcds(); callable from the
+ * completion callback of the chain that used it.
+ * @param tcds  First TCD of the run.
+ * @param count Length it was allocated with.
+ */
+void DMA_Alloc_FreeTcds(edma_software_tcd_t *tcds, uint8_t count)
+{
+    uint32_t first;
+    uint32_t run;
+
+    if ((tcds < s_tcds) || (count == 0U))
+    {
+        return;
+    }
+
+    first = (uint32_t)(tcds - s_tcds);
+    if ((first + count) > DMA_ALLOC_TCD_COUNT)
+    {
+        return;
+    }
+
+    run = (count == 32U) ? 0xFFFFFFFFU : ((1UL << count) - 1U);
+    __atomic_fetch_or(&s_tcd_free, run << first, __ATOMIC_RELEASE);
+}
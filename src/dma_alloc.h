@@ -0,0 +1,49 @@
+/**
+ ******************************************************************************
+ * @file      dma_alloc.h
+ * @brief     eDMA channel allocator and software TCD pool, so the ADC
+ * stream, the LPI2C0 master and the telemetry UART each take a channel at
+ * run time instead of hard-coding one.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef DMA_ALLOC_H_
+#define DMA_ALLOC_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "edma_driver.h"
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define DMA_ALLOC_CHANNELS      FEATURE_DMA_CHANNELS   // 16 on S32K144
+
+// Software TCDs for scatter/gather chains, 32 bytes each
+#ifndef DMA_ALLOC_TCD_COUNT
+#define DMA_ALLOC_TCD_COUNT     16U
+#endif
+
+#if DMA_ALLOC_TCD_COUNT > 32U
+#error "DMA_ALLOC_TCD_COUNT exceeds the 32-bit free mask"
+#endif
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t DMA_Alloc_Init(uint8_t irq_prio_limit);
+status_t DMA_Alloc_Channel(dma_request_source_t request, uint8_t priority, uint8_t irq_prio,
+                           uint8_t *channel);
+void DMA_Alloc_Free(uint8_t channel);
+edma_software_tcd_t *DMA_Alloc_Tcds(uint8_t count);
+void DMA_Alloc_FreeTcds(edma_software_tcd_t *tcds, uint8_t count);
+
+#endif /* DMA_ALLOC_H_ */
@@ -0,0 +1,167 @@
+/**
+ ******************************************************************************
+ * @file      dsp_cm4.h
+ * @brief     Cortex-M4 DSP extension intrinsics (SMLAD, SSAT, USAT, UADD16,
+ * packed min/max) with portable C fallbacks for cores or host builds without them.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef DSP_CM4_H_
+#define DSP_CM4_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <string.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// GCC defines __ARM_FEATURE_DSP for -mcpu=cortex-m4
+#if defined (__GNUC__) && defined (__ARM_FEATURE_DSP)
+#define DSP_HAS_SIMD    1
+#else
+#define DSP_HAS_SIMD    0
+#endif
+
+/**
+ * @brief Packs two signed 16-bit values into one word: @p lo in bits 0..15, @p hi in 16..31.
+ */
+#define DSP_PACK16(lo, hi)  (((uint32_t)(uint16_t)(lo)) | ((uint32_t)(uint16_t)(hi) << 16))
+
+/**
+ * @brief Saturates a signed value to a signed @p bits - bit range (SSAT).
+ * @details @p bits must be a compile-time constant (1..32).
+ */
+#if DSP_HAS_SIMD
+#define DSP_SSAT(val, bits) \
+    __extension__ ({ int32_t __r; __asm ("ssat %0, %1, %2" : "=r" (__r) : "I" (bits), "r" ((int32_t)(val))); __r; })
+#else
+#define DSP_SSAT(val, bits) DSP_SsatC((int32_t)(val), (bits))
+#endif
+
+/**
+ * @brief Saturates a signed value to an unsigned @p bits - bit range (USAT).
+ * @details @p bits must be a compile-time constant (0..31).
+ */
+#if DSP_HAS_SIMD
+#define DSP_USAT(val, bits) \
+    __extension__ ({ uint32_t __r; __asm ("usat %0, %1, %2" : "=r" (__r) : "I" (bits), "r" ((int32_t)(val))); __r; })
+#else
+#define DSP_USAT(val, bits) DSP_UsatC((int32_t)(val), (bits))
+#endif
+
+/*============================================================================*/
+/* Inline Functions                                */
+/*============================================================================*/
+
+#if !DSP_HAS_SIMD
+/**
+ * @brief Portable SSAT.
+ */
+static inline int32_t DSP_SsatC(int32_t val, uint32_t bits)
+{
+    const int32_t max = (int32_t)((1UL << (bits - 1U)) - 1U);
+    const int32_t min = -max - 1;
+
+    return (val > max) ? max : ((val < min) ? min : val);
+}
+
+/**
+ * @brief Portable USAT.
+ */
+static inline uint32_t DSP_UsatC(int32_t val, uint32_t bits)
+{
+    const int32_t max = (int32_t)((1UL << bits) - 1U);
+
+    return (val > max) ? (uint32_t)max : ((val < 0) ? 0U : (uint32_t)val);
+}
+#endif
+
+/**
+ * @brief Loads two consecutive 16-bit samples as one word (first sample in the low half).
+ * @details memcpy keeps this free of aliasing issues; GCC turns it into a single LDR.
+ */
+static inline uint32_t DSP_LOAD2(const uint16_t *p)
+{
+    uint32_t w;
+    (void)memcpy(&w, p, sizeof(w));
+    return w;
+}
+
+/**
+ * @brief Stores one word as two consecutive 16-bit samples.
+ */
+static inline void DSP_STORE2(uint16_t *p, uint32_t w)
+{
+    (void)memcpy(p, &w, sizeof(w));
+}
+
+/**
+ * @brief Dual unsigned 16-bit add, each lane wrapping on its own (UADD16).
+ */
+static inline uint32_t DSP_UADD16(uint32_t x, uint32_t y)
+{
+#if DSP_HAS_SIMD
+    uint32_t r;
+    __asm ("uadd16 %0, %1, %2" : "=r" (r) : "r" (x), "r" (y));
+    return r;
+#else
+    return ((x + y) & 0x0000FFFFU) | (((x >> 16) + (y >> 16)) << 16);
+#endif
+}
+
+/**
+ * @brief Lane-wise unsigned 16-bit minimum (USUB16 + SEL in one asm block,
+ * so nothing can clobber the GE flags in between).
+ */
+static inline uint32_t DSP_UMIN16(uint32_t x, uint32_t y)
+{
+#if DSP_HAS_SIMD
+    uint32_t r;
+    __asm ("usub16 %0, %1, %2\n\tsel %0, %2, %1" : "=&r" (r) : "r" (x), "r" (y) : "cc");
+    return r;
+#else
+    const uint32_t lo = ((x & 0xFFFFU) < (y & 0xFFFFU)) ? (x & 0xFFFFU) : (y & 0xFFFFU);
+    const uint32_t hi = ((x >> 16) < (y >> 16)) ? (x >> 16) : (y >> 16);
+    return lo | (hi << 16);
+#endif
+}
+
+/**
+ * @brief Lane-wise unsigned 16-bit maximum (USUB16 + SEL).
+ */
+static inline uint32_t DSP_UMAX16(uint32_t x, uint32_t y)
+{
+#if DSP_HAS_SIMD
+    uint32_t r;
+    __asm ("usub16 %0, %1, %2\n\tsel %0, %1, %2" : "=&r" (r) : "r" (x), "r" (y) : "cc");
+    return r;
+#else
+    const uint32_t lo = ((x & 0xFFFFU) > (y & 0xFFFFU)) ? (x & 0xFFFFU) : (y & 0xFFFFU);
+    const uint32_t hi = ((x >> 16) > (y >> 16)) ? (x >> 16) : (y >> 16);
+    return lo | (hi << 16);
+#endif
+}
+
+/**
+ * @brief Dual signed 16x16 multiply with 32-bit accumulate (SMLAD).
+ * @return acc + x.lo * y.lo + x.hi * y.hi
+ */
+static inline int32_t DSP_SMLAD(uint32_t x, uint32_t y, int32_t acc)
+{
+#if DSP_HAS_SIMD
+    int32_t r;
+    __asm ("smlad %0, %1, %2, %3" : "=r" (r) : "r" (x), "r" (y), "r" (acc));
+    return r;
+#else
+    return acc + ((int32_t)(int16_t)x * (int32_t)(int16_t)y)
+               + ((int32_t)(int16_t)(x >> 16) * (int32_t)(int16_t)(y >> 16));
+#endif
+}
+
+#endif /* DSP_CM4_H_ */
@@ -0,0 +1,194 @@
+/**
+ ******************************************************************************
+ * @file      dsp_stats.c
+ * @brief     Block statistics kernels over uint16_t ADC sample blocks, using
+ * the Cortex-M4 packed 16-bit SIMD instructions (two samples per instruction).
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "dsp_stats.h"
+#include "dsp_cm4.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// UADD16 lanes hold 16 bits: 16 sample pairs of 12 bits each (16 * 4095) still fit
+#define DSP_SUM_CHUNK_PAIRS     16U
+
+// SMLAD squares two 12-bit samples per step; 32 steps (~1.07e9) keep the int32 accumulator positive
+#define DSP_SQ_CHUNK_PAIRS      32U
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Sums a block of 12-bit samples.
+ * @details Two samples are added per UADD16 into 16-bit lanes, which are
+ * folded into the 32-bit total every DSP_SUM_CHUNK_PAIRS pairs.
+ * @param x     Samples, at most 12 bits wide.
+ * @param count Number of samples.
+ * @return Sum of the samples.
+ */
+uint32_t DSP_Sum_u16(const uint16_t *x, uint32_t count)
+{
+    uint32_t total = 0;
+    uint32_t lanes, pairs, n;
+
+    pairs = count / 2U;
+    while (pairs != 0U)
+    {
+        n = (pairs < DSP_SUM_CHUNK_PAIRS) ? pairs : DSP_SUM_CHUNK_PAIRS;
+        pairs -= n;
+        lanes = 0;
+        while (n-- != 0U)
+        {
+            lanes = DSP_UADD16(lanes, DSP_LOAD2(x));
+            x += 2;
+        }
+        total += (lanes & 0xFFFFU) + (lanes >> 16);
+    }
+    if ((count & 1U) != 0U)
+    {
+        total += *x;
+    }
+
+    return total;
+}
+
+/**
+ * @brief Rounded mean of a block of 12-bit samples.
+ * @return Mean, or 0 for an empty block.
+ */
+uint16_t DSP_Mean_u16(const uint16_t *x, uint32_t count)
+{
+    if (count == 0U)
+    {
+        return 0;
+    }
+
+    return (uint16_t)((DSP_Sum_u16(x, count) + (count / 2U)) / count);
+}
+
+/**
+ * @brief Finds the smallest and largest sample of a block.
+ * @details Tracks minimum and maximum of both lanes with USUB16/SEL and
+ * combines the lanes at the end.
+ * @param x     Samples (any 16-bit values).
+ * @param count Number of samples (at least 1).
+ * @param min   Out: smallest sample.
+ * @param max   Out: largest sample.
+ */
+void DSP_MinMax_u16(const uint16_t *x, uint32_t count, uint16_t *min, uint16_t *max)
+{
+    uint32_t lo = 0xFFFFFFFFU;
+    uint32_t hi = 0;
+    uint32_t pairs = count / 2U;
+    uint32_t w;
+    uint16_t mn, mx;
+
+    while (pairs-- != 0U)
+    {
+        w = DSP_LOAD2(x);
+        lo = DSP_UMIN16(lo, w);
+        hi = DSP_UMAX16(hi, w);
+        x += 2;
+    }
+
+    mn = (uint16_t)(((lo & 0xFFFFU) < (lo >> 16)) ? (lo & 0xFFFFU) : (lo >> 16));
+    mx = (uint16_t)(((hi & 0xFFFFU) > (hi >> 16)) ? (hi & 0xFFFFU) : (hi >> 16));
+    if ((count & 1U) != 0U)
+    {
+        mn = (*x < mn) ? *x : mn;
+        mx = (*x > mx) ? *x : mx;
+    }
+
+    *min = mn;
+    *max = mx;
+}
+
+/**
+ * @brief Population variance of a block of samples.
+ * @details One SMLAD squares and accumulates two samples; a second SMLAD with
+ * a (1, 1) multiplier accumulates their sum in the same pass.
+ * @param x     Samples, at most 12 bits wide.
+ * @param count Number of samples.
+ * @return Variance in LSB^2, or 0 for an empty block.
+ */
+uint32_t DSP_Variance_u16(const uint16_t *x, uint32_t count)
+{
+    const uint32_t ones = DSP_PACK16(1, 1);
+    uint64_t sum_sq = 0;
+    uint64_t sum = 0;
+    uint64_t sq;
+    int32_t acc_sq, acc;
+    uint32_t pairs, n, w;
+
+    if (count == 0U)
+    {
+        return 0;
+    }
+
+    pairs = count / 2U;
+    while (pairs != 0U)
+    {
+        n = (pairs < DSP_SQ_CHUNK_PAIRS) ? pairs : DSP_SQ_CHUNK_PAIRS;
+        pairs -= n;
+        acc_sq = 0;
+        acc = 0;
+        while (n-- != 0U)
+        {
+            w = DSP_LOAD2(x);
+            acc_sq = DSP_SMLAD(w, w, acc_sq);
+            acc = DSP_SMLAD(w, ones, acc);
+            x += 2;
+        }
+        sum_sq += (uint32_t)acc_sq;
+        sum += (uint32_t)acc;
+    }
+    if ((count & 1U) != 0U)
+    {
+        sum_sq += (uint32_t)*x * *x;
+        sum += *x;
+    }
+
+    // n * sum(x^2) - sum(x)^2, divided by n^2
+    sq = (sum_sq * count) - (sum * sum);
+
+    return (uint32_t)(sq / ((uint64_t)count * count));
+}
+
+/**
+ * @brief Scales a block by a Q12 gain, saturating to 16 bits.
+ * @details Two samples are loaded and stored per word; each product is
+ * rounded, shifted and clamped with USAT. @p out may alias @p x.
+ * @param x        Input samples.
+ * @param out      Output samples.
+ * @param count    Number of samples.
+ * @param gain_q12 Gain in Q12 (4096 = 1.0, up to ~16.0).
+ */
+void DSP_Scale_u16(const uint16_t *x, uint16_t *out, uint32_t count, uint16_t gain_q12)
+{
+    uint32_t pairs = count / 2U;
+    uint32_t w, lo, hi;
+
+    while (pairs-- != 0U)
+    {
+        w = DSP_LOAD2(x);
+        lo = DSP_USAT((int32_t)((((w & 0xFFFFU) * gain_q12) + 0x800U) >> 12), 16);
+        hi = DSP_USAT((int32_t)((((w >> 16) * gain_q12) + 0x800U) >> 12), 16);
+        DSP_STORE2(out, lo | (hi << 16));
+        x += 2;
+        out += 2;
+    }
+    if ((count & 1U) != 0U)
+    {
+        *out = (uint16_t)DSP_USAT((int32_t)((((uint32_t)*x * gain_q12) + 0x800U) >> 12), 16);
+    }
+}
@@ -0,0 +1,29 @@
+/**
+ ******************************************************************************
+ * @file      dsp_stats.h
+ * @brief     Block statistics kernels over uint16_t ADC sample blocks, using
+ * the Cortex-M4 packed 16-bit SIMD instructions (two samples per instruction).
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef DSP_STATS_H_
+#define DSP_STATS_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+uint32_t DSP_Sum_u16(const uint16_t *x, uint32_t count);
+uint16_t DSP_Mean_u16(const uint16_t *x, uint32_t count);
+void DSP_MinMax_u16(const uint16_t *x, uint32_t count, uint16_t *min, uint16_t *max);
+uint32_t DSP_Variance_u16(const uint16_t *x, uint32_t count);
+void DSP_Scale_u16(const uint16_t *x, uint16_t *out, uint32_t count, uint16_t gain_q12);
+
+#endif /* DSP_STATS_H_ */
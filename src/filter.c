@@ -0,0 +1,205 @@
+/**
+ ******************************************************************************
+ * @file      filter.c
+ * @brief     Fixed-point streaming filters for sensor samples: moving
+ * average, first-order IIR and small-window median.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "filter.h"
+#include "dsp_cm4.h"
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Initializes a moving average.
+ * @param f   Filter state.
+ * @param len Window length (1..FILTER_MA_MAX_LEN).
+ */
+void Filter_MA_Init(filter_ma_t *f, uint8_t len)
+{
+    if (len == 0U)
+    {
+        len = 1U;
+    }
+    if (len > FILTER_MA_MAX_LEN)
+    {
+        len = FILTER_MA_MAX_LEN;
+    }
+
+    f->len = len;
+    f->pos = 0;
+    f->fill = 0;
+    f->sum = 0;
+}
+
+/**
+ * @brief Adds one sample to a moving average.
+ * @details The running sum makes the cost independent of the window length:
+ * one add, one subtract and one divide per sample. Until the window is full
+ * the average is taken over the samples seen so far.
+ * @return Rounded average of the current window.
+ */
+uint16_t Filter_MA_Process(filter_ma_t *f, uint16_t x)
+{
+    if (f->fill == f->len)
+    {
+        f->sum -= f->history[f->pos];
+    }
+    else
+    {
+        f->fill++;
+    }
+    f->history[f->pos] = x;
+    f->sum += x;
+    if (++f->pos == f->len)
+    {
+        f->pos = 0;
+    }
+
+    return (uint16_t)((f->sum + (f->fill / 2U)) / f->fill);
+}
+
+/**
+ * @brief Runs a moving average over a block; @p out may alias @p in.
+ */
+void Filter_MA_ProcessBlock(filter_ma_t *f, const uint16_t *in, uint16_t *out, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        out[i] = Filter_MA_Process(f, in[i]);
+    }
+}
+
+/**
+ * @brief Initializes a first-order IIR low-pass.
+ * @param f         Filter state.
+ * @param alpha_q15 Weight of the new sample in Q15 (see FILTER_IIR_ALPHA()).
+ */
+void Filter_IIR_Init(filter_iir_t *f, int16_t alpha_q15)
+{
+    if (alpha_q15 < 1)
+    {
+        alpha_q15 = 1;
+    }
+
+    // Weight of the new sample in the low half, weight of the state in the high half
+    f->coeffs = DSP_PACK16(alpha_q15, 32768 - alpha_q15);
+    f->y = 0;
+    f->primed = 0;
+}
+
+/**
+ * @brief Filters one sample: y = alpha * x + (1 - alpha) * y.
+ * @details Both products and their sum come from a single SMLAD, the rounding
+ * constant is its accumulator and SSAT bounds the result. The first sample
+ * seeds the state so the output does not ramp up from zero.
+ * @param x Sample, at most 15 bits wide.
+ * @return Filtered value, same scale as @p x.
+ */
+PERF_HOT uint16_t Filter_IIR_Process(filter_iir_t *f, uint16_t x)
+{
+    int32_t acc;
+
+    if (f->primed == 0U)
+    {
+        f->y = (int16_t)x;
+        f->primed = 1;
+        return x;
+    }
+
+    acc = DSP_SMLAD(DSP_PACK16(x, f->y), f->coeffs, 1 << 14);
+    f->y = (int16_t)DSP_SSAT(acc >> 15, 16);
+
+    return (uint16_t)f->y;
+}
+
+/**
+ * @brief Runs the IIR over a block; @p out may alias @p in.
+ */
+PERF_HOT void Filter_IIR_ProcessBlock(filter_iir_t *f, const uint16_t *in, uint16_t *out, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        out[i] = Filter_IIR_Process(f, in[i]);
+    }
+}
+
+/**
+ * @brief Initializes a median filter.
+ * @param f   Filter state.
+ * @param len Window length; rounded up to odd and capped at FILTER_MEDIAN_MAX_LEN.
+ */
+void Filter_Median_Init(filter_median_t *f, uint8_t len)
+{
+    len |= 1U;
+    if (len > FILTER_MEDIAN_MAX_LEN)
+    {
+        len = FILTER_MEDIAN_MAX_LEN;
+    }
+
+    f->len = len;
+    f->pos = 0;
+    f->fill = 0;
+}
+
+/**
+ * @brief Adds one sample to a median filter.
+ * @details The window is small, so an insertion sort of a local copy is
+ * cheaper than maintaining a sorted structure. Rejects single-sample spikes
+ * that an average would smear.
+ * @return Median of the current window.
+ */
+uint16_t Filter_Median_Process(filter_median_t *f, uint16_t x)
+{
+    uint16_t sorted[FILTER_MEDIAN_MAX_LEN];
+    uint16_t v;
+    uint8_t i, j;
+
+    f->history[f->pos] = x;
+    if (++f->pos == f->len)
+    {
+        f->pos = 0;
+    }
+    if (f->fill < f->len)
+    {
+        f->fill++;
+    }
+
+    for (i = 0; i < f->fill; i++)
+    {
+        v = f->history[i];
+        for (j = i; (j > 0U) && (sorted[j - 1U] > v); j--)
+        {
+            sorted[j] = sorted[j - 1U];
+        }
+        sorted[j] = v;
+    }
+
+    return sorted[f->fill / 2U];
+}
+
+/**
+ * @brief Runs the median filter over a block; @p out may alias @p in.
+ */
+void Filter_Median_ProcessBlock(filter_median_t *f, const uint16_t *in, uint16_t *out, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        out[i] = Filter_Median_Process(f, in[i]);
+    }
+}
@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ * @file      filter.h
+ * @brief     Fixed-point streaming filters for sensor samples: moving
+ * average, first-order IIR and small-window median.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef FILTER_H_
+#define FILTER_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define FILTER_MA_MAX_LEN       64U   // Longest moving-average window
+#define FILTER_MEDIAN_MAX_LEN   7U    // Longest (odd) median window
+
+/**
+ * @brief IIR smoothing factor in Q15 from a fraction, e.g. FILTER_IIR_ALPHA(0.25).
+ */
+#define FILTER_IIR_ALPHA(a)     ((int16_t)((a) * 32768.0 + 0.5))
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+// Moving average over the last len samples, kept as a running sum
+typedef struct
+{
+    uint16_t history[FILTER_MA_MAX_LEN];
+    uint32_t sum;
+    uint8_t len;
+    uint8_t pos;
+    uint8_t fill;
+} filter_ma_t;
+
+// First-order IIR: y += alpha * (x - y); inputs are unsigned 15-bit or narrower
+typedef struct
+{
+    uint32_t coeffs;   // alpha and 1 - alpha (Q15), packed for SMLAD
+    int16_t y;
+    uint8_t primed;
+} filter_iir_t;
+
+// Median over the last len samples
+typedef struct
+{
+    uint16_t history[FILTER_MEDIAN_MAX_LEN];
+    uint8_t len;
+    uint8_t pos;
+    uint8_t fill;
+} filter_median_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void Filter_MA_Init(filter_ma_t *f, uint8_t len);
+uint16_t Filter_MA_Process(filter_ma_t *f, uint16_t x);
+void Filter_MA_ProcessBlock(filter_ma_t *f, const uint16_t *in, uint16_t *out, uint32_t count);
+
+void Filter_IIR_Init(filter_iir_t *f, int16_t alpha_q15);
+uint16_t Filter_IIR_Process(filter_iir_t *f, uint16_t x);
+void Filter_IIR_ProcessBlock(filter_iir_t *f, const uint16_t *in, uint16_t *out, uint32_t count);
+
+void Filter_Median_Init(filter_median_t *f, uint8_t len);
+uint16_t Filter_Median_Process(filter_median_t *f, uint16_t x);
+void Filter_Median_ProcessBlock(filter_median_t *f, const uint16_t *in, uint16_t *out, uint32_t count);
+
+#endif /* FILTER_H_ */
@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * @file      fmt.c
+ * @brief     Tiny allocation-free formatter for integer and fixed-point
+ * values, used instead of sprintf() for the LCD.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "fmt.h"
+#include <stddef.h>
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Formats a scaled integer as "[-]int[.frac]unit", right-aligned.
+ * @details No varargs and no locale: digits are produced in reverse into a
+ * small local buffer, then copied out behind the padding. A value of 2734
+ * with 2 decimals and unit " C" gives "27.34 C".
+ * @param dst      Destination; must hold max(width, result length) + 1 chars.
+ * @param width    Field width including sign and unit; shorter results are padded
+ *                 with leading spaces, longer ones are not truncated.
+ * @param value    Value in steps of 10^-decimals.
+ * @param decimals Number of fractional digits (0..FMT_MAX_DECIMALS).
+ * @param unit     Suffix copied after the number, or NULL.
+ * @return Number of characters written, excluding the terminating null.
+ */
+PERF_HOT uint8_t Fmt_FixedQ(char *dst, uint8_t width, int32_t value, uint8_t decimals, const char *unit)
+{
+    char digits[12U + FMT_MAX_DECIMALS];
+    uint32_t mag = (value < 0) ? (0U - (uint32_t)value) : (uint32_t)value;
+    uint8_t n = 0;
+    uint8_t len, unit_len = 0;
+    char *out = dst;
+
+    if (decimals > FMT_MAX_DECIMALS)
+    {
+        decimals = FMT_MAX_DECIMALS;
+    }
+    if (unit != NULL)
+    {
+        while (unit[unit_len] != '\0')
+        {
+            unit_len++;
+        }
+    }
+
+    // Least significant digit first; at least one integer digit before the point
+    do
+    {
+        if ((decimals != 0U) && (n == decimals))
+        {
+            digits[n++] = '.';
+        }
+        digits[n++] = (char)('0' + (mag % 10U));
+        mag /= 10U;
+    } while ((mag != 0U) || (n <= decimals));
+
+    len = (uint8_t)(n + unit_len + ((value < 0) ? 1U : 0U));
+    while (width > len)
+    {
+        *out++ = ' ';
+        width--;
+    }
+    if (value < 0)
+    {
+        *out++ = '-';
+    }
+    while (n != 0U)
+    {
+        *out++ = digits[--n];
+    }
+    while ((unit != NULL) && (*unit != '\0'))
+    {
+        *out++ = *unit++;
+    }
+    *out = '\0';
+
+    return (uint8_t)(out - dst);
+}
@@ -0,0 +1,31 @@
+/**
+ ******************************************************************************
+ * @file      fmt.h
+ * @brief     Tiny allocation-free formatter for integer and fixed-point
+ * values, used instead of sprintf() for the LCD.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef FMT_H_
+#define FMT_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define FMT_MAX_DECIMALS    4U   // Largest supported number of fractional digits
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+uint8_t Fmt_FixedQ(char *dst, uint8_t width, int32_t value, uint8_t decimals, const char *unit);
+
+#endif /* FMT_H_ */
@@ -0,0 +1,245 @@
+/**
+ ******************************************************************************
+ * @file      i2c_async.c
+ * @brief     Handle-based asynchronous LPI2C0 transactions: submit returns a
+ * token, completion sets a bit in an event word and optionally calls back,
+ * and any set of tokens can be waited on with a timeout.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "i2c_async.h"
+#include <stddef.h>
+#include "osif.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define I2C_ASYNC_SLOT_MASK     0xFFU
+#define I2C_ASYNC_GEN_SHIFT     8U
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+typedef struct
+{
+    i2c_job_t job;
+    i2c_job_callback_t callback;
+    void *param;
+    uint32_t start_ms;
+    uint32_t timeout_ms;
+    volatile status_t status;
+    uint32_t gen;                // Reuse count, part of the token
+} i2c_async_slot_t;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static i2c_async_slot_t s_slots[I2C_ASYNC_SLOTS];
+
+// Bit n set while slot n is free
+static volatile uint32_t s_free = (I2C_ASYNC_SLOTS == 32U) ? 0xFFFFFFFFU : ((1UL << I2C_ASYNC_SLOTS) - 1U);
+
+// Bit n set once the transaction of slot n has completed, until its result is taken
+static volatile uint32_t s_events;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Returns the slot a token refers to, or NULL for a stale or invalid token.
+ */
+static i2c_async_slot_t *I2C_Async_Slot(i2c_token_t token)
+{
+    uint32_t index = (token & I2C_ASYNC_SLOT_MASK) - 1U;
+
+    if ((index >= I2C_ASYNC_SLOTS) || ((s_free & (1UL << index)) != 0U) ||
+        (s_slots[index].gen != (token >> I2C_ASYNC_GEN_SHIFT)))
+    {
+        return NULL;
+    }
+
+    return &s_slots[index];
+}
+
+/**
+ * @brief Queue completion of a slot's job, in interrupt context or from a cancel.
+ */
+static void I2C_Async_Done(status_t status, void *param)
+{
+    i2c_async_slot_t *slot = (i2c_async_slot_t *)param;
+
+    slot->status = status;
+    __atomic_fetch_or(&s_events, 1UL << (uint32_t)(slot - s_slots), __ATOMIC_RELEASE);
+    if (slot->callback != NULL)
+    {
+        slot->callback(status, slot->param);
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Queues a transaction and returns its token at once.
+ * @details The descriptors run through I2C_Queue_Submit(), so they keep
+ * their place in order with the LCD frames and must stay valid until the
+ * transaction completes. Callable from interrupts at IRQ_PRIO_I2C or below.
+ * @param xfers      Descriptors, kept valid until completion.
+ * @param count      Number of descriptors.
+ * @param timeout_ms Time from submission after which the transaction is
+ *                   withdrawn with STATUS_TIMEOUT, or I2C_ASYNC_FOREVER.
+ *                   Checked by I2C_Async_Poll() and the wait and result calls.
+ * @param callback   Optional hook, called in interrupt context on completion.
+ * @param param      User parameter for the hook.
+ * @return The token, or I2C_ASYNC_NO_TOKEN if no slot is free or the list is empty.
+ */
+i2c_token_t I2C_Async_Submit(const i2c_xfer_t *xfers, uint8_t count, uint32_t timeout_ms,
+                             i2c_job_callback_t callback, void *param)
+{
+    uint32_t free_mask = __atomic_load_n(&s_free, __ATOMIC_ACQUIRE);
+    uint32_t index;
+    i2c_async_slot_t *slot;
+
+    do
+    {
+        if (free_mask == 0U)
+        {
+            return I2C_ASYNC_NO_TOKEN;
+        }
+        index = (uint32_t)__builtin_ctz(free_mask);
+    } while (!__atomic_compare_exchange_n(&s_free, &free_mask, free_mask & ~(1UL << index),
+                                          true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    slot = &s_slots[index];
+    slot->gen = (slot->gen + 1U) & (0xFFFFFFFFU >> I2C_ASYNC_GEN_SHIFT);
+    slot->callback = callback;
+    slot->param = param;
+    slot->start_ms = OSIF_GetMilliseconds();
+    slot->timeout_ms = timeout_ms;
+    slot->status = STATUS_BUSY;
+    __atomic_fetch_and(&s_events, ~(1UL << index), __ATOMIC_RELEASE);
+
+    if (I2C_Queue_Submit(&slot->job, xfers, count, I2C_Async_Done, slot) != STATUS_SUCCESS)
+    {
+        __atomic_fetch_or(&s_free, 1UL << index, __ATOMIC_RELEASE);
+        return I2C_ASYNC_NO_TOKEN;
+    }
+
+    return (slot->gen << I2C_ASYNC_GEN_SHIFT) | (index + 1U);
+}
+
+/**
+ * @brief Returns the event bit of a token, for I2C_Async_Wait() masks.
+ * @return The bit, or 0 for a stale token.
+ */
+uint32_t I2C_Async_Event(i2c_token_t token)
+{
+    return (I2C_Async_Slot(token) != NULL) ? (1UL << ((token & I2C_ASYNC_SLOT_MASK) - 1U)) : 0U;
+}
+
+/**
+ * @brief Returns the event word: one set bit per completed transaction
+ * whose result has not been taken yet.
+ */
+uint32_t I2C_Async_Events(void)
+{
+    return __atomic_load_n(&s_events, __ATOMIC_ACQUIRE);
+}
+
+/**
+ * @brief Withdraws every transaction past its timeout.
+ * @details A transaction stuck in a read cannot be withdrawn and is retried
+ * on the next poll. Main context.
+ */
+void I2C_Async_Poll(void)
+{
+    uint32_t now = OSIF_GetMilliseconds();
+    uint32_t pending = ~s_free & ~I2C_Async_Events();
+    i2c_async_slot_t *slot;
+    uint8_t i;
+
+    for (i = 0; i < I2C_ASYNC_SLOTS; i++)
+    {
+        slot = &s_slots[i];
+        if (((pending & (1UL << i)) != 0U) && (slot->timeout_ms != I2C_ASYNC_FOREVER) &&
+            ((now - slot->start_ms) >= slot->timeout_ms))
+        {
+            (void)I2C_Queue_Cancel(&slot->job, STATUS_TIMEOUT);
+        }
+    }
+}
+
+/**
+ * @brief Waits for any or all of a set of transactions.
+ * @details Polls the event word, withdrawing transactions that pass their
+ * own timeout on the way, so every one of them ends within its timeout
+ * whatever the wait does. Main context.
+ * @param events     OR of I2C_Async_Event() bits.
+ * @param all        true to wait for every event, false for the first.
+ * @param timeout_ms Longest wait, 0 to only check, or I2C_ASYNC_FOREVER.
+ * @return The bits of events that are set; the results are still to be taken.
+ */
+uint32_t I2C_Async_Wait(uint32_t events, bool all, uint32_t timeout_ms)
+{
+    uint32_t start = OSIF_GetMilliseconds();
+    uint32_t done;
+
+    for (;;)
+    {
+        I2C_Async_Poll();
+        done = I2C_Async_Events() & events;
+        if ((all && (done == events)) || (!all && (done != 0U)))
+        {
+            return done;
+        }
+        if ((timeout_ms != I2C_ASYNC_FOREVER) && ((OSIF_GetMilliseconds() - start) >= timeout_ms))
+        {
+            return done;
+        }
+    }
+}
+
+/**
+ * @brief Takes the result of a transaction and frees its token.
+ * @details While the transaction is pending this only checks its timeout
+ * and returns STATUS_BUSY; the token stays valid.
+ * @return STATUS_BUSY while pending, STATUS_TIMEOUT if it was withdrawn,
+ *         STATUS_ERROR for a stale token, otherwise the I2C status.
+ */
+status_t I2C_Async_Result(i2c_token_t token)
+{
+    i2c_async_slot_t *slot = I2C_Async_Slot(token);
+    uint32_t bit;
+    status_t status;
+
+    if (slot == NULL)
+    {
+        return STATUS_ERROR;
+    }
+
+    bit = 1UL << (uint32_t)(slot - s_slots);
+    if ((I2C_Async_Events() & bit) == 0U)
+    {
+        I2C_Async_Poll();
+        if ((I2C_Async_Events() & bit) == 0U)
+        {
+            return STATUS_BUSY;
+        }
+    }
+
+    status = slot->status;
+    __atomic_fetch_and(&s_events, ~bit, __ATOMIC_RELEASE);
+    __atomic_fetch_or(&s_free, bit, __ATOMIC_RELEASE);
+
+    return status;
+}
@@ -0,0 +1,60 @@
+/**
+ ******************************************************************************
+ * @file      i2c_async.h
+ * @brief     Handle-based asynchronous LPI2C0 transactions: submit returns a
+ * token, completion sets a bit in an event word and optionally calls back,
+ * and any set of tokens can be waited on with a timeout.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef I2C_ASYNC_H_
+#define I2C_ASYNC_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "i2c_queue.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Transactions in flight at once; one event bit each
+#ifndef I2C_ASYNC_SLOTS
+#define I2C_ASYNC_SLOTS     8U
+#endif
+
+#if I2C_ASYNC_SLOTS > 32U
+#error "I2C_ASYNC_SLOTS exceeds the 32-bit event word"
+#endif
+
+#define I2C_ASYNC_NO_TOKEN  0U          // Returned when every slot is in use
+#define I2C_ASYNC_FOREVER   0xFFFFFFFFU // Timeout that never expires
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Transaction handle: slot number in the low byte, a reuse count
+ * above it, so a stale token never matches a later transaction.
+ */
+typedef uint32_t i2c_token_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+i2c_token_t I2C_Async_Submit(const i2c_xfer_t *xfers, uint8_t count, uint32_t timeout_ms,
+                             i2c_job_callback_t callback, void *param);
+uint32_t I2C_Async_Event(i2c_token_t token);
+uint32_t I2C_Async_Events(void);
+void I2C_Async_Poll(void);
+uint32_t I2C_Async_Wait(uint32_t events, bool all, uint32_t timeout_ms);
+status_t I2C_Async_Result(i2c_token_t token);
+
+#endif /* I2C_ASYNC_H_ */
@@ -0,0 +1,198 @@
+/**
+ ******************************************************************************
+ * @file      i2c_meter.c
+ * @brief     LPI2C0 bus utilization meter: rolling bus-busy share, byte and
+ * transfer rates from the master driver's traffic statistics.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "i2c_meter.h"
+#include <stddef.h>
+#include "peripherals_lpi2c_config_1.h"
+#include "fmt.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+// Traffic of one closed window, in PROF_TIMESTAMP() ticks
+typedef struct
+{
+    uint32_t elapsed;
+    uint32_t busy;
+    uint32_t bytes;
+    uint32_t transfers;
+} i2c_meter_window_t;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static i2c_meter_window_t s_windows[I2C_METER_WINDOWS];
+static uint8_t s_next;       // Slot the next window goes to
+static uint8_t s_filled;     // Closed windows held, up to I2C_METER_WINDOWS
+
+// Driver statistics and time at the start of the open window
+static lpi2c_master_stats_t s_last;
+static uint32_t s_last_ts;
+
+static uint16_t s_peak;
+static uint32_t s_ts_hz;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Clock of the driver's bus-busy time, the same as the windows'.
+ */
+static uint32_t I2C_Meter_Timestamp(void)
+{
+    return PROF_TIMESTAMP();
+}
+
+/**
+ * @brief Share of a time span, in 0.1 % steps, capped at 1000.
+ */
+static uint16_t I2C_Meter_Permille(uint64_t busy, uint64_t elapsed)
+{
+    if (elapsed == 0U)
+    {
+        return 0;
+    }
+    if (busy >= elapsed)
+    {
+        return 1000U;
+    }
+
+    return (uint16_t)((busy * 1000U) / elapsed);
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Hands the PROF_TIMESTAMP() clock to the LPI2C0 master driver and
+ * opens the first window.
+ * @details Call after Prof_Init() and LPI2C_DRV_MasterInit(). Clears the
+ * driver statistics. Without a timestamp clock only bytes and transfers are
+ * counted and every share reads 0.
+ */
+void I2C_Meter_Init(void)
+{
+    s_ts_hz = Prof_TimestampHz();
+    LPI2C_DRV_MasterSetStatsClock(INST_LPI2C0, (s_ts_hz != 0U) ? I2C_Meter_Timestamp : NULL, s_ts_hz);
+
+    LPI2C_DRV_MasterGetStats(INST_LPI2C0, &s_last);
+    s_last_ts = PROF_TIMESTAMP();
+    s_next = 0;
+    s_filled = 0;
+    s_peak = 0;
+}
+
+/**
+ * @brief Closes the open window and starts the next one.
+ * @details Meant to be called at a fixed period, e.g. once a second from a
+ * scheduler timer; the period sets the resolution of the peak. A window must
+ * stay below one wrap of PROF_TIMESTAMP(). Main context only.
+ */
+void I2C_Meter_Update(void)
+{
+    i2c_meter_window_t *win = &s_windows[s_next];
+    lpi2c_master_stats_t stats;
+    uint32_t now;
+    uint64_t busy;
+    uint16_t load;
+
+    LPI2C_DRV_MasterGetStats(INST_LPI2C0, &stats);
+    now = PROF_TIMESTAMP();
+
+    busy = stats.busyTicks - s_last.busyTicks;
+    win->elapsed = now - s_last_ts;
+    win->busy = (busy > win->elapsed) ? win->elapsed : (uint32_t)busy;
+    win->bytes = (stats.txBytes - s_last.txBytes) + (stats.rxBytes - s_last.rxBytes);
+    win->transfers = stats.transfers - s_last.transfers;
+    s_last = stats;
+    s_last_ts = now;
+
+    s_next = (uint8_t)((s_next + 1U) % I2C_METER_WINDOWS);
+    if (s_filled < I2C_METER_WINDOWS)
+    {
+        s_filled++;
+    }
+
+    load = I2C_Meter_Permille(win->busy, win->elapsed);
+    if (load > s_peak)
+    {
+        s_peak = load;
+    }
+}
+
+/**
+ * @brief Reports the bus load as of the last I2C_Meter_Update().
+ * @details The rolling figures cover the closed windows held, so they start
+ * from the first one rather than from zero. Main context only.
+ * @param meter Destination; all zero before the first update.
+ */
+void I2C_Meter_Get(i2c_meter_t *meter)
+{
+    uint64_t elapsed = 0, busy = 0, bytes = 0, transfers = 0;
+    uint8_t last = (uint8_t)((s_next + I2C_METER_WINDOWS - 1U) % I2C_METER_WINDOWS);
+    uint8_t i;
+
+    for (i = 0; i < s_filled; i++)
+    {
+        elapsed += s_windows[i].elapsed;
+        busy += s_windows[i].busy;
+        bytes += s_windows[i].bytes;
+        transfers += s_windows[i].transfers;
+    }
+
+    meter->load_permille = (s_filled == 0U) ? 0U
+                         : I2C_Meter_Permille(s_windows[last].busy, s_windows[last].elapsed);
+    meter->avg_permille = I2C_Meter_Permille(busy, elapsed);
+    meter->peak_permille = s_peak;
+    meter->bytes_per_s = (elapsed == 0U) ? 0U : (uint32_t)((bytes * s_ts_hz) / elapsed);
+    meter->transfers_per_s = (elapsed == 0U) ? 0U : (uint32_t)((transfers * s_ts_hz) / elapsed);
+    meter->nacks = s_last.nacks;
+    meter->errors = s_last.errors;
+}
+
+/**
+ * @brief Prints the bus load as of the last I2C_Meter_Update(): the shares
+ * in percent, then the rolling data rates.
+ * @param print Line sink, the same as for Prof_Dump().
+ */
+void I2C_Meter_Dump(prof_print_t print)
+{
+    char line[PROF_NAME_WIDTH + (5U * PROF_VALUE_WIDTH) + 1U];
+    char *dst;
+    i2c_meter_t meter;
+
+    if (print == NULL)
+    {
+        return;
+    }
+
+    I2C_Meter_Get(&meter);
+    print("i2c bus           load%       avg%      peak%    bytes/s     xfer/s");
+
+    dst = Prof_PutText(line, "lpi2c0", PROF_NAME_WIDTH);
+    dst = Prof_PutValue(dst, meter.load_permille, 1U);
+    dst = Prof_PutValue(dst, meter.avg_permille, 1U);
+    dst = Prof_PutValue(dst, meter.peak_permille, 1U);
+    dst = Prof_PutValue(dst, meter.bytes_per_s, 0U);
+    dst = Prof_PutValue(dst, meter.transfers_per_s, 0U);
+    *dst = '\0';
+    print(line);
+}
@@ -0,0 +1,57 @@
+/**
+ ******************************************************************************
+ * @file      i2c_meter.h
+ * @brief     LPI2C0 bus utilization meter: rolling bus-busy share, byte and
+ * transfer rates from the master driver's traffic statistics.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef I2C_METER_H_
+#define I2C_METER_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "prof.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Closed windows the rolling figures cover; with one I2C_Meter_Update()
+// per second, the last 8 s
+#ifndef I2C_METER_WINDOWS
+#define I2C_METER_WINDOWS   8U
+#endif
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Bus load as of the last I2C_Meter_Update(); shares in 0.1 % steps.
+ */
+typedef struct
+{
+    uint16_t load_permille;     // Bus-busy share of the last window
+    uint16_t avg_permille;      // The same over the rolling windows
+    uint16_t peak_permille;     // Busiest window since I2C_Meter_Init()
+    uint32_t bytes_per_s;       // Data bytes both ways, over the rolling windows
+    uint32_t transfers_per_s;   // START or repeated START, over the rolling windows
+    uint32_t nacks;             // Since I2C_Meter_Init()
+    uint32_t errors;            // Lost arbitration, FIFO and DMA errors since I2C_Meter_Init()
+} i2c_meter_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void I2C_Meter_Init(void);
+void I2C_Meter_Update(void);
+void I2C_Meter_Get(i2c_meter_t *meter);
+void I2C_Meter_Dump(prof_print_t print);
+
+#endif /* I2C_METER_H_ */
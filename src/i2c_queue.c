@@ -0,0 +1,468 @@
+/**
+ ******************************************************************************
+ * @file      i2c_queue.c
+ * @brief     Asynchronous transaction queue for LPI2C0: chains lists of
+ * transfer descriptors back-to-back from the master completion interrupt.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "i2c_queue.h"
+#include <stddef.h>
+#include "peripherals_lpi2c_config_1.h"
+#include "irq_prio.h"
+#include "clock_gate.h"
+#include "prof.h"
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Job on the bus is the head; later submissions wait behind it
+static i2c_job_t * volatile s_head;
+static i2c_job_t *s_tail;
+
+// Bumped for every transfer put on the bus, so a job that progresses, or a
+// reused one, is not mistaken for a stalled one
+static volatile uint32_t s_started;
+static uint32_t s_stall_mark;
+static i2c_job_t *s_stall_job;
+
+// Start of the transfer on the bus and its nominal wire time, for PROF_HIST_ISR_I2C
+static uint32_t s_xfer_start;
+static uint32_t s_xfer_ticks;
+static uint32_t s_byte_ticks;
+
+// Told about every failure; while it holds the fault no job reaches the bus
+static i2c_error_hook_t s_error_hook;
+static volatile bool s_faulted;
+
+// Address the driver is left on between jobs, for blocking transfers; 0 for
+// the one of lpi2c0_MasterConfig0
+static uint16_t s_home_address;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Puts the current half of the current descriptor on the bus.
+ * @details Empty halves are skipped by the caller, so at least one side of
+ * the descriptor has data.
+ */
+static status_t I2C_Queue_StartXfer(const i2c_job_t *job)
+{
+    const i2c_xfer_t *xfer = &job->xfers[job->index];
+
+    // The address byte goes out in either half
+    s_xfer_ticks = ((job->rx_phase ? xfer->rx_size : xfer->tx_size) + 1U) * s_byte_ticks;
+    s_xfer_start = PROF_TIMESTAMP();
+    if (job->rx_phase)
+    {
+        return LPI2C_DRV_MasterReceiveData(INST_LPI2C0, xfer->rx_buf, xfer->rx_size, xfer->send_stop);
+    }
+
+    LPI2C_DRV_MasterSetSlaveAddr(INST_LPI2C0, xfer->address, false);
+    // With a read to follow the write ends in a repeated START, not a STOP
+    return LPI2C_DRV_MasterSendData(INST_LPI2C0, xfer->tx_buf, xfer->tx_size,
+                                    (xfer->rx_size == 0U) ? xfer->send_stop : false);
+}
+
+/**
+ * @brief Moves the head job to its next non-empty half-descriptor.
+ * @return false once every descriptor of the job is done.
+ */
+static bool I2C_Queue_Advance(i2c_job_t *job)
+{
+    const i2c_xfer_t *xfer;
+
+    for (;;)
+    {
+        xfer = &job->xfers[job->index];
+        if (!job->rx_phase && (xfer->rx_size != 0U))
+        {
+            job->rx_phase = true;
+            if (xfer->tx_size == 0U)
+            {
+                // Read-only descriptor: the address has not been set yet
+                LPI2C_DRV_MasterSetSlaveAddr(INST_LPI2C0, xfer->address, false);
+            }
+            return true;
+        }
+
+        job->index++;
+        job->rx_phase = false;
+        if (job->index >= job->count)
+        {
+            return false;
+        }
+        if (job->xfers[job->index].tx_size != 0U)
+        {
+            return true;
+        }
+    }
+}
+
+/**
+ * @brief Starts the head job, retiring every job that cannot start.
+ * @details Called with the LPI2C0 interrupt unable to preempt. When the queue
+ * drains the home address, see I2C_Queue_SetHomeAddress(), is restored, so blocking callers keep
+ * talking to the device they expect, and the bus clocks taken by
+ * I2C_Queue_Submit() are released. While the queue is faulted every job is
+ * retired with STATUS_I2C_BUS_BUSY instead of started.
+ */
+static void I2C_Queue_Kick(void)
+{
+    i2c_job_t *job;
+    status_t status;
+
+    while (s_head != NULL)
+    {
+        job = s_head;
+        job->index = 0;
+        job->rx_phase = false;
+        status = STATUS_SUCCESS;
+        if (s_faulted)
+        {
+            // Retired without touching the bus, so the queue drains for the recovery
+            status = STATUS_I2C_BUS_BUSY;
+        }
+        else if ((job->xfers[0].tx_size != 0U) || I2C_Queue_Advance(job))
+        {
+            status = I2C_Queue_StartXfer(job);
+            if (status == STATUS_SUCCESS)
+            {
+                s_started++;
+                return;
+            }
+            I2C_Queue_ReportError(status);
+        }
+
+        // Faulted, empty, or the bus refused the first transfer
+        s_head = job->next;
+        job->pending = false;
+        if (job->callback != NULL)
+        {
+            job->callback(status, job->param);
+        }
+    }
+
+    s_tail = NULL;
+    LPI2C_DRV_MasterSetSlaveAddr(INST_LPI2C0,
+                                 (s_home_address != 0U) ? s_home_address : lpi2c0_MasterConfig0.slaveAddress,
+                                 false);
+    ClockGate_Release(CLOCK_GATE_DMA);
+    ClockGate_Release(CLOCK_GATE_LPI2C0);
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Queues a list of descriptors and returns immediately.
+ * @details Jobs run in submission order. Within a job each descriptor is
+ * started from the completion interrupt of the previous one, so the bus only
+ * idles for the few microseconds the handler takes, not for a round trip
+ * through the application. With LPI2C_USING_DMA the bytes themselves move by
+ * eDMA. The first failing descriptor ends its job; later jobs still run.
+ * Blocking driver calls return STATUS_BUSY while a job is on the bus.
+ * LPI2C0 and the eDMA are clocked from the first submission until the queue
+ * drains.
+ * Callable from interrupts at IRQ_PRIO_I2C or below, including from a job
+ * callback.
+ * @param job      Caller-owned job storage; must not already be pending.
+ * @param xfers    Descriptors, kept valid until the callback.
+ * @param count    Number of descriptors.
+ * @param callback Optional completion hook.
+ * @param param    User parameter for the hook.
+ * @return STATUS_SUCCESS if queued, STATUS_BUSY if the job is still pending,
+ *         STATUS_ERROR on an empty list, STATUS_I2C_BUS_BUSY while the
+ *         queue is faulted.
+ */
+status_t I2C_Queue_Submit(i2c_job_t *job, const i2c_xfer_t *xfers, uint8_t count,
+                          i2c_job_callback_t callback, void *param)
+{
+    uint32_t lock;
+
+    if ((xfers == NULL) || (count == 0U))
+    {
+        return STATUS_ERROR;
+    }
+    if (job->pending)
+    {
+        return STATUS_BUSY;
+    }
+    if (s_faulted)
+    {
+        return STATUS_I2C_BUS_BUSY;
+    }
+
+    job->xfers = xfers;
+    job->count = count;
+    job->callback = callback;
+    job->param = param;
+    job->next = NULL;
+    job->pending = true;
+
+    // The completion interrupt must not retire the head between the check and the link
+    lock = IRQ_Lock(IRQ_PRIO_I2C);
+    if (s_head == NULL)
+    {
+        ClockGate_Acquire(CLOCK_GATE_LPI2C0);
+        ClockGate_Acquire(CLOCK_GATE_DMA);
+        s_head = job;
+        s_tail = job;
+        I2C_Queue_Kick();
+    }
+    else
+    {
+        s_tail->next = job;
+        s_tail = job;
+    }
+    IRQ_Unlock(lock);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Withdraws a pending job, e.g. once its deadline has passed.
+ * @details A job still waiting is unlinked. The job on the bus is ended
+ * with a forced STOP and the next one started, unless it is in a read,
+ * which the LPI2C cannot abort midway. A withdrawn job's callback runs
+ * from this call with the given status, which also goes to the error
+ * hook. Callable from interrupts at IRQ_PRIO_I2C or below.
+ * @param job    Job passed to I2C_Queue_Submit().
+ * @param status Status reported to its callback, e.g. STATUS_TIMEOUT.
+ * @return STATUS_SUCCESS if withdrawn, STATUS_ERROR if the job is not
+ *         pending, STATUS_UNSUPPORTED if it is reading.
+ */
+status_t I2C_Queue_Cancel(i2c_job_t *job, status_t status)
+{
+    i2c_job_t *prev;
+    uint32_t lock;
+
+    lock = IRQ_Lock(IRQ_PRIO_I2C);
+    if (!job->pending)
+    {
+        IRQ_Unlock(lock);
+        return STATUS_ERROR;
+    }
+
+    if (job == s_head)
+    {
+        if (LPI2C_DRV_MasterAbortTransferData(INST_LPI2C0) != STATUS_SUCCESS)
+        {
+            IRQ_Unlock(lock);
+            return STATUS_UNSUPPORTED;
+        }
+        // Before the next job starts, so a fault already holds it back
+        I2C_Queue_ReportError(status);
+        s_head = job->next;
+        job->pending = false;
+        I2C_Queue_Kick();
+    }
+    else
+    {
+        for (prev = s_head; prev->next != job; prev = prev->next)
+        {
+        }
+        prev->next = job->next;
+        if (s_tail == job)
+        {
+            s_tail = prev;
+        }
+        job->pending = false;
+        I2C_Queue_ReportError(status);
+    }
+    IRQ_Unlock(lock);
+
+    if (job->callback != NULL)
+    {
+        job->callback(status, job->param);
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Reports whether no job is queued or running.
+ */
+bool I2C_Queue_IsIdle(void)
+{
+    return s_head == NULL;
+}
+
+/**
+ * @brief Withdraws the job on the bus if it has not finished since the
+ * previous call.
+ * @details Meant to be called at a period well above the longest job, e.g.
+ * from a watchdog timer or a bounded wait. A slave holding SDA low keeps the
+ * LPI2C from ever issuing its START, and nothing else would end that job.
+ * The job is withdrawn with STATUS_TIMEOUT through I2C_Queue_Cancel(), so the
+ * error hook sees it. A job in its read half cannot be withdrawn and is
+ * tried again on the next call.
+ * @return true if a job was withdrawn.
+ */
+bool I2C_Queue_CheckStall(void)
+{
+    i2c_job_t *job = s_head;
+    uint32_t started = s_started;
+
+    if ((job == NULL) || (job != s_stall_job) || (started != s_stall_mark))
+    {
+        s_stall_job = job;
+        s_stall_mark = started;
+        return false;
+    }
+
+    s_stall_job = NULL;
+    return I2C_Queue_Cancel(job, STATUS_TIMEOUT) == STATUS_SUCCESS;
+}
+
+/**
+ * @brief Sets the SCL rate the completion latency is measured against.
+ * @details With a rate, each queued transfer's completion interrupt adds
+ * the time it took beyond nine bit times per byte to PROF_HIST_ISR_I2C.
+ * Call after Prof_Init() and after the rate changes.
+ * @param baud_hz Rate reported by LPI2C_DRV_MasterGetBaudRate(); 0 stops
+ *                the measurement.
+ */
+void I2C_Queue_SetBusRate(uint32_t baud_hz)
+{
+    s_byte_ticks = (baud_hz == 0U) ? 0U : ((9U * Prof_TimestampHz()) / baud_hz);
+}
+
+/**
+ * @brief Sets the address the driver is returned to once the queue drains.
+ * @details Blocking transfers that bypass the queue go there, so this is
+ * the LCD's address as given to LCD_SetAddress().
+ * @param address 7-bit address; 0 for lpi2c0_MasterConfig0.slaveAddress.
+ */
+void I2C_Queue_SetHomeAddress(uint16_t address)
+{
+    s_home_address = address;
+}
+
+/**
+ * @brief Installs the observer of failed transfers, e.g. a bus recovery.
+ * @details Without a hook failures are only counted and the queue never
+ * faults.
+ * @param hook Called from the context that saw the failure, or NULL.
+ */
+void I2C_Queue_SetErrorHook(i2c_error_hook_t hook)
+{
+    s_error_hook = hook;
+}
+
+/**
+ * @brief Counts a failed transfer by type and passes it to the error hook.
+ * @details Called by the queue for its own jobs; blocking callers pass the
+ * status of their driver calls here too, so every failure on the bus is
+ * counted in one place. STATUS_SUCCESS is ignored. Callable from any context.
+ * @param status Result of the transfer.
+ */
+void I2C_Queue_ReportError(status_t status)
+{
+    prof_counter_t counter;
+
+    switch (status)
+    {
+    case STATUS_SUCCESS:
+        return;
+    case STATUS_I2C_RECEIVED_NACK:
+        counter = PROF_CNT_I2C_NACK;
+        break;
+    case STATUS_I2C_ARBITRATION_LOST:
+        counter = PROF_CNT_I2C_ARB_LOST;
+        break;
+    case STATUS_TIMEOUT:
+        counter = PROF_CNT_I2C_TIMEOUT;
+        break;
+    case STATUS_BUSY:
+    case STATUS_I2C_BUS_BUSY:
+        counter = PROF_CNT_I2C_BUS_BUSY;
+        break;
+    default:
+        counter = PROF_CNT_I2C_OTHER;
+        break;
+    }
+    Prof_Count(counter);
+
+    if ((s_error_hook != NULL) && s_error_hook(status))
+    {
+        s_faulted = true;
+    }
+}
+
+/**
+ * @brief Reports whether the error hook holds the bus faulted.
+ * @details Blocking callers check this to skip a transfer that would only
+ * run into the driver timeout.
+ */
+bool I2C_Queue_IsFaulted(void)
+{
+    return s_faulted;
+}
+
+/**
+ * @brief Lets jobs reach the bus again once the fault has been dealt with.
+ */
+void I2C_Queue_ClearFault(void)
+{
+    s_faulted = false;
+}
+
+/**
+ * @brief LPI2C0 master callback (registered in lpi2c0_MasterConfig0).
+ * @details Runs in interrupt context at the end of every transfer, including
+ * the blocking ones, which are ignored while the queue is idle. The next
+ * half-descriptor, or the next job, goes on the bus before the finished
+ * job's callback runs.
+ */
+void I2C_Queue_MasterCallback(i2c_master_event_t event, void *userData)
+{
+    i2c_job_t *job = s_head;
+    uint32_t elapsed = PROF_TIMESTAMP() - s_xfer_start;
+    status_t status;
+
+    (void)userData;
+
+    if ((event != I2C_MASTER_EVENT_END_TRANSFER) || (job == NULL))
+    {
+        return;
+    }
+
+    if (s_byte_ticks != 0U)
+    {
+        Prof_Hist(PROF_HIST_ISR_I2C, (elapsed > s_xfer_ticks) ? (elapsed - s_xfer_ticks) : 0U);
+    }
+
+    status = LPI2C_DRV_MasterGetTransferStatus(INST_LPI2C0, NULL);
+    if (status == STATUS_SUCCESS)
+    {
+        if (I2C_Queue_Advance(job))
+        {
+            status = I2C_Queue_StartXfer(job);
+            if (status == STATUS_SUCCESS)
+            {
+                s_started++;
+                return;
+            }
+        }
+    }
+
+    // Reported before the next job starts, so a fault already holds it back
+    I2C_Queue_ReportError(status);
+    s_head = job->next;
+    job->pending = false;
+    I2C_Queue_Kick();
+    if (job->callback != NULL)
+    {
+        job->callback(status, job->param);
+    }
+}
@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * @file      i2c_queue.h
+ * @brief     Asynchronous transaction queue for LPI2C0: chains lists of
+ * transfer descriptors back-to-back from the master completion interrupt.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef I2C_QUEUE_H_
+#define I2C_QUEUE_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lpi2c_driver.h"
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief One I2C transaction: an optional write followed by an optional read
+ * on the same address, joined by a repeated START.
+ */
+typedef struct
+{
+    uint16_t address;            // 7-bit slave address
+    const uint8_t *tx_buf;       // Bytes to write, or NULL
+    uint32_t tx_size;
+    uint8_t *rx_buf;             // Destination of the read, or NULL
+    uint32_t rx_size;
+    bool send_stop;              // false leaves the bus claimed for the next descriptor
+} i2c_xfer_t;
+
+/**
+ * @brief Completion hook of a job, called from the LPI2C/eDMA interrupt.
+ * @param status STATUS_SUCCESS, or the error of the descriptor that failed.
+ * @param param  User parameter passed to I2C_Queue_Submit().
+ */
+typedef void (*i2c_job_callback_t)(status_t status, void *param);
+
+/**
+ * @brief Observer of every failed transfer, see I2C_Queue_SetErrorHook().
+ * @param status The error, never STATUS_SUCCESS.
+ * @return true to hold the queue faulted until I2C_Queue_ClearFault().
+ */
+typedef bool (*i2c_error_hook_t)(status_t status);
+
+/**
+ * @brief A list of descriptors run as one unit.
+ * @details Owned by the caller, like the descriptors and buffers it points
+ * to, and left untouched until its callback has run.
+ */
+typedef struct i2c_job
+{
+    const i2c_xfer_t *xfers;
+    uint8_t count;
+    i2c_job_callback_t callback;
+    void *param;
+    struct i2c_job *next;
+    uint8_t index;               // Descriptor on the bus
+    bool rx_phase;               // Its read half is on the bus
+    volatile bool pending;       // Queued or running
+} i2c_job_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t I2C_Queue_Submit(i2c_job_t *job, const i2c_xfer_t *xfers, uint8_t count,
+                          i2c_job_callback_t callback, void *param);
+status_t I2C_Queue_Cancel(i2c_job_t *job, status_t status);
+bool I2C_Queue_IsIdle(void);
+bool I2C_Queue_CheckStall(void);
+void I2C_Queue_SetBusRate(uint32_t baud_hz);
+void I2C_Queue_SetHomeAddress(uint16_t address);
+void I2C_Queue_SetErrorHook(i2c_error_hook_t hook);
+void I2C_Queue_ReportError(status_t status);
+bool I2C_Queue_IsFaulted(void);
+void I2C_Queue_ClearFault(void);
+void I2C_Queue_MasterCallback(i2c_master_event_t event, void *userData);
+
+#endif /* I2C_QUEUE_H_ */
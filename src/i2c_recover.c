@@ -0,0 +1,275 @@
+/**
+ ******************************************************************************
+ * @file      i2c_recover.c
+ * @brief     Background LPI2C0 bus recovery: frees a slave stuck on SDA
+ * with up to nine SCL clocks and a STOP from GPIO, then reinitializes the
+ * master, without holding up the rest of the application.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "i2c_recover.h"
+#include <stddef.h>
+#include "S32K144.h"
+#include "pin_mux.h"
+#include "clock_manager.h"
+#include "peripherals_lpi2c_config_1.h"
+#include "i2c_queue.h"
+#include "sched.h"
+#include "clock_gate.h"
+#include "prof.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// LPI2C0 pins as routed in pin_mux.c: SDA on PTA2, SCL on PTA3, both ALT3
+#define I2C_RECOVER_PORT        PORTA
+#define I2C_RECOVER_GPIO        PTA
+#define I2C_RECOVER_SDA_PIN     2U
+#define I2C_RECOVER_SCL_PIN     3U
+#define I2C_RECOVER_MUX         PORT_MUX_ALT3
+
+#define I2C_RECOVER_SDA_MASK    (1UL << I2C_RECOVER_SDA_PIN)
+#define I2C_RECOVER_SCL_MASK    (1UL << I2C_RECOVER_SCL_PIN)
+
+// A slave sending a byte lets go of SDA within eight clocks, the ninth is its acknowledge slot
+#define I2C_RECOVER_CLOCKS      9U
+
+// Half period of the recovery clock, 100 kHz so any slave can follow
+#define I2C_RECOVER_HALF_NS     5000U
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Master configuration and state of the running application, for the reinit
+static const lpi2c_master_user_config_t *s_config;
+static lpi2c_master_state_t *s_state;
+
+static i2c_recover_callback_t s_callback;
+static void *s_param;
+
+// Posted by the queue's error hook, from whichever context saw the failure
+static sched_event_t s_event;
+
+// Periodic watchdog; also retries a recovery that could not free the bus
+static sched_timer_t s_watchdog;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Spins for a number of loop iterations, at least 3 cycles each.
+ */
+static void I2C_Recover_Delay(uint32_t loops)
+{
+    while (loops-- != 0U)
+    {
+        __asm volatile ("nop");
+    }
+}
+
+/**
+ * @brief Reads SDA from the pin itself, whatever the mux selects.
+ */
+static bool I2C_Recover_SdaHigh(void)
+{
+    return (I2C_RECOVER_GPIO->PDIR & I2C_RECOVER_SDA_MASK) != 0U;
+}
+
+/**
+ * @brief Drives a line low, or releases it to the pull-ups.
+ * @details The output latches stay low, so flipping the direction emulates
+ * an open-drain output and a slave can still stretch SCL or hold SDA.
+ */
+static void I2C_Recover_Line(uint32_t mask, bool low)
+{
+    if (low)
+    {
+        I2C_RECOVER_GPIO->PDDR |= mask;
+    }
+    else
+    {
+        I2C_RECOVER_GPIO->PDDR &= ~mask;
+    }
+}
+
+/**
+ * @brief Clocks a stuck slave free and ends its transaction with a STOP.
+ * @details Both pins are taken from the LPI2C for the duration. Each SCL
+ * pulse lets the slave shift out one more bit of the byte it was sending;
+ * once SDA reads high a STOP resets every slave's state machine. The clock
+ * runs at 100 kHz, so the whole sequence takes about 100 us.
+ * @return true if SDA is high afterwards.
+ */
+static bool I2C_Recover_Bus(void)
+{
+    uint32_t core_hz = 0;
+    uint32_t loops;
+    uint8_t i;
+    bool released;
+
+    (void)CLOCK_SYS_GetFreq(CORE_CLK, &core_hz);
+    loops = (((core_hz / 1000000U) * I2C_RECOVER_HALF_NS) / 3000U) + 1U;
+
+    I2C_RECOVER_GPIO->PCOR = I2C_RECOVER_SDA_MASK | I2C_RECOVER_SCL_MASK;
+    I2C_Recover_Line(I2C_RECOVER_SDA_MASK | I2C_RECOVER_SCL_MASK, false);
+    PINS_DRV_SetMuxModeSel(I2C_RECOVER_PORT, I2C_RECOVER_SDA_PIN, PORT_MUX_AS_GPIO);
+    PINS_DRV_SetMuxModeSel(I2C_RECOVER_PORT, I2C_RECOVER_SCL_PIN, PORT_MUX_AS_GPIO);
+    I2C_Recover_Delay(loops);
+
+    for (i = 0; (i < I2C_RECOVER_CLOCKS) && !I2C_Recover_SdaHigh(); i++)
+    {
+        I2C_Recover_Line(I2C_RECOVER_SCL_MASK, true);
+        I2C_Recover_Delay(loops);
+        I2C_Recover_Line(I2C_RECOVER_SCL_MASK, false);
+        I2C_Recover_Delay(loops);
+    }
+
+    // STOP: SDA rises while SCL is high
+    I2C_Recover_Line(I2C_RECOVER_SCL_MASK, true);
+    I2C_Recover_Delay(loops);
+    I2C_Recover_Line(I2C_RECOVER_SDA_MASK, true);
+    I2C_Recover_Delay(loops);
+    I2C_Recover_Line(I2C_RECOVER_SCL_MASK, false);
+    I2C_Recover_Delay(loops);
+    I2C_Recover_Line(I2C_RECOVER_SDA_MASK, false);
+    I2C_Recover_Delay(loops);
+    released = I2C_Recover_SdaHigh();
+
+    PINS_DRV_SetMuxModeSel(I2C_RECOVER_PORT, I2C_RECOVER_SDA_PIN, I2C_RECOVER_MUX);
+    PINS_DRV_SetMuxModeSel(I2C_RECOVER_PORT, I2C_RECOVER_SCL_PIN, I2C_RECOVER_MUX);
+
+    return released;
+}
+
+/**
+ * @brief Queue error hook: holds the queue on errors that point at the bus
+ * rather than at one device.
+ * @details A NACK only means the addressed device is absent or busy, so
+ * it is left to the caller. Runs in the context that saw the failure,
+ * often the LPI2C0 interrupt, so the recovery itself is only posted.
+ */
+static bool I2C_Recover_OnError(status_t status)
+{
+    if ((status != STATUS_TIMEOUT) && (status != STATUS_I2C_ARBITRATION_LOST) &&
+        (status != STATUS_I2C_BUS_BUSY))
+    {
+        return false;
+    }
+
+    (void)Sched_Post(&s_event);
+
+    return true;
+}
+
+/**
+ * @brief Watchdog and recovery handler, from the event or the timer.
+ * @details A job stuck on the bus is withdrawn first, which faults the
+ * queue and drains it. SDA held low with nothing on the bus is a fault of
+ * its own, counted as a busy bus. With the queue idle and faulted the bus
+ * is recovered; if SDA stays low the fault is kept, so transfers keep
+ * failing at once, and the next period tries again.
+ * @param param Unused.
+ */
+static void I2C_Recover_Check(void *param)
+{
+    (void)param;
+
+    if (!I2C_Queue_IsIdle())
+    {
+        (void)I2C_Queue_CheckStall();
+        return;
+    }
+
+    if (!I2C_Queue_IsFaulted())
+    {
+        if (I2C_Recover_SdaHigh())
+        {
+            return;
+        }
+        I2C_Queue_ReportError(STATUS_I2C_BUS_BUSY);
+    }
+
+    if (I2C_Recover_Run() && (s_callback != NULL))
+    {
+        s_callback(s_param);
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Arms recovery for the LPI2C0 master.
+ * @details Installs the I2C queue error hook and starts the watchdog. Call
+ * after LPI2C_DRV_MasterInit() and the scheduler's Sched_Init(). Without
+ * it the queue only counts its errors.
+ * @param config   Configuration the master was initialized with, including
+ *                 its allocated eDMA channel; kept for the reinit.
+ * @param state    Master driver state, kept likewise.
+ * @param callback Optional hook once the bus is usable again, e.g. to
+ *                 restart the LCD, which has lost anything sent meanwhile.
+ * @param param    User parameter for the hook.
+ */
+void I2C_Recover_Init(const lpi2c_master_user_config_t *config, lpi2c_master_state_t *state,
+                      i2c_recover_callback_t callback, void *param)
+{
+    s_config = config;
+    s_state = state;
+    s_callback = callback;
+    s_param = param;
+
+    Sched_EventInit(&s_event, I2C_Recover_Check, NULL);
+    Sched_TimerInit(&s_watchdog, I2C_Recover_Check, NULL);
+    I2C_Queue_SetErrorHook(I2C_Recover_OnError);
+    Sched_TimerStart(&s_watchdog, I2C_RECOVER_CHECK_MS, I2C_RECOVER_CHECK_MS);
+}
+
+/**
+ * @brief Recovers the bus and reinitializes the master, keeping its rate.
+ * @details Takes about 100 us at any core clock. Main context only, with
+ * the I2C queue idle; normally run by the watchdog, but also usable once at
+ * start-up for a slave left stuck by a brownout. Clears the queue fault
+ * when SDA is free, and counts the outcome.
+ * @return true if the bus is free.
+ */
+bool I2C_Recover_Run(void)
+{
+    lpi2c_baud_rate_params_t baud;
+    bool released;
+
+    if (s_config == NULL)
+    {
+        return false;
+    }
+
+    ClockGate_Acquire(CLOCK_GATE_LPI2C0);
+    LPI2C_DRV_MasterGetBaudRate(INST_LPI2C0, &baud);
+
+    released = I2C_Recover_Bus();
+
+    // A full reinit resets the FIFOs and the master state machine, whatever the failure left behind
+    (void)LPI2C_DRV_MasterDeinit(INST_LPI2C0);
+    (void)LPI2C_DRV_MasterInit(INST_LPI2C0, s_config, s_state);
+    (void)LPI2C_DRV_MasterSetBaudRate(INST_LPI2C0, LPI2C_FAST_MODE, baud);
+    ClockGate_Release(CLOCK_GATE_LPI2C0);
+
+    if (!released)
+    {
+        Prof_Count(PROF_CNT_I2C_RECOVER_FAIL);
+        return false;
+    }
+
+    Prof_Count(PROF_CNT_I2C_RECOVERED);
+    I2C_Queue_ClearFault();
+
+    return true;
+}
@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ * @file      i2c_recover.h
+ * @brief     Background LPI2C0 bus recovery: frees a slave stuck on SDA
+ * with up to nine SCL clocks and a STOP from GPIO, then reinitializes the
+ * master, without holding up the rest of the application.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef I2C_RECOVER_H_
+#define I2C_RECOVER_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lpi2c_driver.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Watchdog period: SDA is checked and a job stuck on the bus is withdrawn
+// once it has not finished within one to two periods; well above the
+// longest LCD frame at the slowest bus rate
+#ifndef I2C_RECOVER_CHECK_MS
+#define I2C_RECOVER_CHECK_MS    50U
+#endif
+
+#if I2C_RECOVER_CHECK_MS == 0U
+#error "I2C_RECOVER_CHECK_MS must be non-zero, it also retries a failed recovery"
+#endif
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Called from the main context once the bus is usable again.
+ * @param param User parameter given to I2C_Recover_Init().
+ */
+typedef void (*i2c_recover_callback_t)(void *param);
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void I2C_Recover_Init(const lpi2c_master_user_config_t *config, lpi2c_master_state_t *state,
+                      i2c_recover_callback_t callback, void *param);
+bool I2C_Recover_Run(void);
+
+#endif /* I2C_RECOVER_H_ */
@@ -0,0 +1,219 @@
+/**
+ ******************************************************************************
+ * @file      i2c_slave.c
+ * @brief     LPI2C0 slave exposing the sensor as a small register map, served
+ * from a double-buffered snapshot so a host read never waits on the sampler.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "i2c_slave.h"
+#include <stdbool.h>
+#include "lpi2c_driver.h"
+#include "peripherals_lpi2c_config_1.h"
+#include "spsc.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define I2C_SLAVE_NO_SNAPSHOT   0xFFU
+
+/*============================================================================*/
+/* Private Function Prototypes                         */
+/*============================================================================*/
+
+static void I2C_Slave_Callback(i2c_slave_event_t event, void *param);
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static lpi2c_slave_state_t s_state;
+
+static const lpi2c_slave_user_config_t s_config =
+{
+    .slaveAddress = I2C_SLAVE_ADDRESS,
+    .is10bitAddr = false,
+    .operatingMode = LPI2C_FAST_MODE,
+    .slaveListening = true,
+    .transferType = LPI2C_USING_INTERRUPTS,
+    .dmaChannel = 0U,
+    .slaveCallback = I2C_Slave_Callback,
+    .callbackParam = NULL,
+};
+
+// The host reads s_front; the main context only ever writes the other one
+static uint8_t s_maps[2][I2C_SLAVE_MAP_SIZE];
+static volatile uint8_t s_front;
+
+// Snapshot a host read is taking its bytes from, or I2C_SLAVE_NO_SNAPSHOT
+static volatile uint8_t s_in_use = I2C_SLAVE_NO_SNAPSHOT;
+
+// Register pointer and the byte a host write lands in
+static uint8_t s_pointer;
+static uint8_t s_rx_byte;
+static bool s_rx_armed;
+
+// Filtered range and update count, kept by the main context
+static int16_t s_min;
+static int16_t s_max;
+static uint16_t s_seq;
+static bool s_have_reading;
+
+// Latest reading; one the host held back goes out with the next update
+static int16_t s_latest;
+static int16_t s_filtered;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Slave events from the LPI2C0 interrupt.
+ * @details A read is served straight from the front snapshot, so it needs
+ * no copy and no lock. The written byte is taken as the register pointer
+ * once the write ends, at the repeated start or stop.
+ */
+static void I2C_Slave_Callback(i2c_slave_event_t event, void *param)
+{
+    uint32_t remaining = 1U;
+    uint8_t map;
+
+    (void)param;
+
+    switch (event)
+    {
+        case I2C_SLAVE_EVENT_RX_REQ:
+            s_rx_armed = true;
+            (void)LPI2C_DRV_SlaveSetRxBuffer(INST_LPI2C0, &s_rx_byte, 1U);
+            break;
+
+        case I2C_SLAVE_EVENT_TX_REQ:
+            map = s_front;
+            s_in_use = map;
+            if (s_pointer < I2C_SLAVE_MAP_SIZE)
+            {
+                (void)LPI2C_DRV_SlaveSetTxBuffer(INST_LPI2C0, &s_maps[map][s_pointer],
+                                                 I2C_SLAVE_MAP_SIZE - (uint32_t)s_pointer);
+            }
+            break;
+
+        case I2C_SLAVE_EVENT_STOP:
+            if (s_rx_armed)
+            {
+                (void)LPI2C_DRV_SlaveGetTransferStatus(INST_LPI2C0, &remaining);
+                if (remaining == 0U)
+                {
+                    s_pointer = s_rx_byte;
+                }
+                s_rx_armed = false;
+            }
+            s_in_use = I2C_SLAVE_NO_SNAPSHOT;
+            break;
+
+        default:
+            // Bytes beyond the map or the pointer: the driver pads or discards them
+            break;
+    }
+}
+
+/**
+ * @brief Stores a little-endian 16-bit register.
+ */
+static void I2C_Slave_Put16(uint8_t *map, uint8_t reg, uint16_t value)
+{
+    map[reg] = (uint8_t)value;
+    map[reg + 1U] = (uint8_t)(value >> 8);
+}
+
+/**
+ * @brief Fills the back snapshot and makes it the one hosts read.
+ * @return false if a host read still holds the back snapshot.
+ */
+static bool I2C_Slave_Publish(void)
+{
+    uint8_t back = (uint8_t)(s_front ^ 1U);
+    uint8_t *map = s_maps[back];
+
+    // A read only ever starts on the front snapshot, so the back one cannot
+    // become busy after this check
+    if (s_in_use == back)
+    {
+        return false;
+    }
+
+    map[I2C_SLAVE_REG_ID] = I2C_SLAVE_ID_VALUE;
+    map[I2C_SLAVE_REG_STATUS] = I2C_SLAVE_STATUS_VALID;
+    I2C_Slave_Put16(map, I2C_SLAVE_REG_LATEST, (uint16_t)s_latest);
+    I2C_Slave_Put16(map, I2C_SLAVE_REG_FILTERED, (uint16_t)s_filtered);
+    I2C_Slave_Put16(map, I2C_SLAVE_REG_MIN, (uint16_t)s_min);
+    I2C_Slave_Put16(map, I2C_SLAVE_REG_MAX, (uint16_t)s_max);
+    I2C_Slave_Put16(map, I2C_SLAVE_REG_SEQ, ++s_seq);
+
+    // The snapshot must be complete before a host can pick it
+    SPSC_DMB();
+    s_front = back;
+
+    return true;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Starts answering at the given address on LPI2C0.
+ * @details LPI2C_DRV_SlaveInit() resets the whole module, so this mode
+ * replaces the LPI2C0 master; the caller keeps CLOCK_GATE_LPI2C0 held for
+ * as long as the slave should answer. Until the first update the map reads
+ * with STATUS clear.
+ * @param address 7-bit slave address, normally I2C_SLAVE_ADDRESS.
+ */
+status_t I2C_Slave_Init(uint16_t address)
+{
+    lpi2c_slave_user_config_t config = s_config;
+    uint8_t i;
+
+    for (i = 0; i < 2U; i++)
+    {
+        s_maps[i][I2C_SLAVE_REG_ID] = I2C_SLAVE_ID_VALUE;
+    }
+    config.slaveAddress = address;
+
+    return LPI2C_DRV_SlaveInit(INST_LPI2C0, &config, &s_state);
+}
+
+/**
+ * @brief Publishes a new reading; main context only.
+ * @details Never waits: if a host is still reading the buffer that would be
+ * written, the reading is kept and goes out with the next update, and the
+ * host meanwhile sees the previous consistent snapshot.
+ * @param latest   Temperature of the latest block before filtering.
+ * @param filtered Filtered temperature.
+ */
+void I2C_Slave_Update(int16_t latest, int16_t filtered)
+{
+    if (!s_have_reading)
+    {
+        s_min = filtered;
+        s_max = filtered;
+        s_have_reading = true;
+    }
+    else if (filtered < s_min)
+    {
+        s_min = filtered;
+    }
+    else if (filtered > s_max)
+    {
+        s_max = filtered;
+    }
+
+    s_latest = latest;
+    s_filtered = filtered;
+    (void)I2C_Slave_Publish();
+}
@@ -0,0 +1,53 @@
+/**
+ ******************************************************************************
+ * @file      i2c_slave.h
+ * @brief     LPI2C0 slave exposing the sensor as a small register map, served
+ * from a double-buffered snapshot so a host read never waits on the sampler.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef I2C_SLAVE_H_
+#define I2C_SLAVE_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#ifndef I2C_SLAVE_ADDRESS
+#define I2C_SLAVE_ADDRESS       0x48U    // 7-bit address on the host's bus
+#endif
+
+/*
+ * Register map. A write of one byte sets the register pointer; a read
+ * returns bytes from the pointer onwards, auto-incrementing, all taken from
+ * the same snapshot. 16-bit registers are little-endian, temperatures in
+ * 0.1 C steps. Reads past the end return 0xFF.
+ */
+#define I2C_SLAVE_REG_ID        0x00U    // u8  I2C_SLAVE_ID_VALUE
+#define I2C_SLAVE_REG_STATUS    0x01U    // u8  I2C_SLAVE_STATUS_* bits
+#define I2C_SLAVE_REG_LATEST    0x02U    // i16 Latest block, before the IIR filter
+#define I2C_SLAVE_REG_FILTERED  0x04U    // i16 Filtered temperature, as on the LCD
+#define I2C_SLAVE_REG_MIN       0x06U    // i16 Minimum filtered temperature since start-up
+#define I2C_SLAVE_REG_MAX       0x08U    // i16 Maximum filtered temperature since start-up
+#define I2C_SLAVE_REG_SEQ       0x0AU    // u16 Snapshot counter, +1 per published update
+#define I2C_SLAVE_MAP_SIZE      0x0CU
+
+#define I2C_SLAVE_ID_VALUE      0x35U
+#define I2C_SLAVE_STATUS_VALID  0x01U    // At least one reading has been published
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t I2C_Slave_Init(uint16_t address);
+void I2C_Slave_Update(int16_t latest, int16_t filtered);
+
+#endif /* I2C_SLAVE_H_ */
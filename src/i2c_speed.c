@@ -0,0 +1,132 @@
+/**
+ ******************************************************************************
+ * @file      i2c_speed.c
+ * @brief     Start-up bus-speed negotiation for an LPI2C master: probes the
+ * attached devices at escalating rates and keeps the fastest one that works.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "i2c_speed.h"
+#include <stddef.h>
+#include <stdbool.h>
+#include "lpi2c_driver.h"
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Checks every device at the rate currently programmed.
+ * @details A one-byte read is used as the probe: it needs an ACK on the
+ * address, keeps SCL toggling through a data phase and leaves the outputs of
+ * port expanders untouched. Any NACK, lost arbitration, stuck bus or timeout
+ * fails the rate.
+ * @return STATUS_SUCCESS, or the first error seen.
+ */
+static status_t I2C_Speed_Probe(uint32_t instance, const uint16_t *addrs, uint8_t addr_count)
+{
+    status_t status;
+    uint8_t rx;
+    uint8_t dev, round;
+
+    for (dev = 0; dev < addr_count; dev++)
+    {
+        LPI2C_DRV_MasterSetSlaveAddr(instance, addrs[dev], false);
+        for (round = 0; round < I2C_SPEED_PROBE_ROUNDS; round++)
+        {
+            status = LPI2C_DRV_MasterReceiveDataBlocking(instance, &rx, 1U, true, I2C_SPEED_TIMEOUT_MS);
+            if (status != STATUS_SUCCESS)
+            {
+                return status;
+            }
+        }
+    }
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Programs a nominal SCL rate in fast-mode timing.
+ * @details This part has no Fm+ operating mode, so rates above 400 kHz are
+ * reached by the fast-mode divider search alone.
+ * @return STATUS_BUSY if a transfer is still running.
+ */
+static status_t I2C_Speed_Apply(uint32_t instance, uint32_t rate_hz)
+{
+    lpi2c_baud_rate_params_t baud;
+
+    baud.baudRate = rate_hz;
+    return LPI2C_DRV_MasterSetBaudRate(instance, LPI2C_FAST_MODE, baud);
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Raises the bus rate step by step while every device keeps answering.
+ * @details Rates are tried in the given order, which should be ascending.
+ * The first rate that fails ends the search and the last good one is
+ * re-applied, so a marginal device is never left on a rate it just failed.
+ * If even the first rate fails, it stays programmed and its error is
+ * returned. The slave address is left at the last probed device; the caller
+ * restores its own. Blocking; call once at start-up before other traffic.
+ * @param instance   LPI2C instance, already initialized as master.
+ * @param addrs      7-bit addresses of the devices on the bus.
+ * @param addr_count Number of addresses.
+ * @param rates      Candidate SCL rates in Hz, slowest first.
+ * @param rate_count Number of rates.
+ * @param locked_hz  Receives the SCL rate actually produced by the dividers;
+ *                   may be NULL.
+ * @return STATUS_SUCCESS if at least the first rate works, STATUS_ERROR on
+ *         bad arguments, otherwise the probe error at the first rate.
+ */
+status_t I2C_Speed_Negotiate(uint32_t instance, const uint16_t *addrs, uint8_t addr_count,
+                             const uint32_t *rates, uint8_t rate_count, uint32_t *locked_hz)
+{
+    status_t status = STATUS_ERROR;
+    lpi2c_baud_rate_params_t actual;
+    bool locked = false;
+    uint8_t i;
+
+    if ((addrs == NULL) || (rates == NULL) || (addr_count == 0U) || (rate_count == 0U))
+    {
+        return STATUS_ERROR;
+    }
+
+    for (i = 0; i < rate_count; i++)
+    {
+        status = I2C_Speed_Apply(instance, rates[i]);
+        if (status == STATUS_SUCCESS)
+        {
+            status = I2C_Speed_Probe(instance, addrs, addr_count);
+        }
+        if (status != STATUS_SUCCESS)
+        {
+            break;
+        }
+        locked = true;
+    }
+
+    if (locked)
+    {
+        if (i < rate_count)
+        {
+            (void)I2C_Speed_Apply(instance, rates[i - 1U]);
+        }
+        status = STATUS_SUCCESS;
+    }
+
+    if (locked_hz != NULL)
+    {
+        LPI2C_DRV_MasterGetBaudRate(instance, &actual);
+        *locked_hz = actual.baudRate;
+    }
+
+    return status;
+}
@@ -0,0 +1,34 @@
+/**
+ ******************************************************************************
+ * @file      i2c_speed.h
+ * @brief     Start-up bus-speed negotiation for an LPI2C master: probes the
+ * attached devices at escalating rates and keeps the fastest one that works.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef I2C_SPEED_H_
+#define I2C_SPEED_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define I2C_SPEED_PROBE_ROUNDS  8U   // Transactions per device and rate that must all succeed
+#define I2C_SPEED_TIMEOUT_MS    10U  // Per-transaction timeout while probing
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t I2C_Speed_Negotiate(uint32_t instance, const uint16_t *addrs, uint8_t addr_count,
+                             const uint32_t *rates, uint8_t rate_count, uint32_t *locked_hz);
+
+#endif /* I2C_SPEED_H_ */
@@ -0,0 +1,71 @@
+/**
+ ******************************************************************************
+ * @file      irq_prio.c
+ * @brief     Central interrupt priority plan and BASEPRI critical sections
+ * that only mask the levels sharing the protected data.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "irq_prio.h"
+#include "device_registers.h"
+#include "interrupt_manager.h"
+
+#if IRQ_PRIO_BITS != FEATURE_NVIC_PRIO_BITS
+#error "IRQ_PRIO_BITS does not match the NVIC of this device"
+#endif
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+typedef struct
+{
+    IRQn_Type irq;
+    uint8_t prio;
+} irq_prio_entry_t;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// The whole plan in one place; every interrupt the application enables is
+// listed, except the eDMA channels, whose numbers are only known once
+// DMA_Alloc_Channel() hands them out: it sets each one to the level its
+// client passes (ADC stream IRQ_PRIO_DMA, LPI2C0 and telemetry IRQ_PRIO_I2C)
+static const irq_prio_entry_t s_plan[] =
+{
+    { ADC0_IRQn,          IRQ_PRIO_SAMPLING },  // IRQ_PRIO_DMA while the wake monitor owns it
+    { PDB0_IRQn,          IRQ_PRIO_SAMPLING },
+    { DMA_Error_IRQn,     IRQ_PRIO_DMA },
+    { LPI2C0_Master_IRQn, IRQ_PRIO_I2C },
+    { LPI2C0_Slave_IRQn,  IRQ_PRIO_I2C },       // Register-map slave, replaces the master when used
+    { CAN0_ORed_0_15_MB_IRQn, IRQ_PRIO_I2C },   // CAN node transmit mailboxes
+    { SysTick_IRQn,       IRQ_PRIO_TICK },
+};
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Programs the priority of every interrupt in the plan.
+ * @details Call once at start-up, before the first of them is enabled. A
+ * critical section must lock at the most urgent level of any interrupt that
+ * shares its data, so data shared with IRQ_PRIO_SAMPLING handlers stays in
+ * wait-free structures (SPSC, pool) instead of behind a lock. The FreeRTOS
+ * port keeps its own kernel priorities and does not use this plan.
+ */
+void IRQ_Prio_Init(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < (uint8_t)(sizeof(s_plan) / sizeof(s_plan[0])); i++)
+    {
+        INT_SYS_SetPriority(s_plan[i].irq, s_plan[i].prio);
+    }
+}
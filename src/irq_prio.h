@@ -0,0 +1,79 @@
+/**
+ ******************************************************************************
+ * @file      irq_prio.h
+ * @brief     Central interrupt priority plan and BASEPRI critical sections
+ * that only mask the levels sharing the protected data.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef IRQ_PRIO_H_
+#define IRQ_PRIO_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// NVIC levels, lower preempts higher; 0 is left free as it cannot be masked by BASEPRI
+#define IRQ_PRIO_SAMPLING   1U   // ADC0, PDB0: conversion timing
+#define IRQ_PRIO_DMA        2U   // ADC result stream channel, eDMA errors
+#define IRQ_PRIO_I2C        3U   // LPI2C0 master and its eDMA channel, telemetry UART, CAN mailboxes
+#define IRQ_PRIO_TICK       4U   // SysTick; a late tick is caught up, never lost
+
+#define IRQ_PRIO_BITS       4U   // Implemented priority bits (FEATURE_NVIC_PRIO_BITS)
+
+#if defined(__GNUC__) && defined(__ARM_ARCH)
+/**
+ * @brief Masks every interrupt at level prio and below, leaving the more
+ * urgent ones running.
+ * @details BASEPRI_MAX only ever raises the mask, so nested sections are
+ * safe and a section entered from an interrupt never unmasks its own level.
+ * @param prio One of the IRQ_PRIO_ levels: the most urgent level that
+ *             touches the protected data.
+ * @return Previous mask, for IRQ_Unlock().
+ */
+static inline uint32_t IRQ_Lock(uint32_t prio)
+{
+    uint32_t prev;
+
+    __asm volatile ("mrs %0, basepri" : "=r" (prev));
+    __asm volatile ("msr basepri_max, %0" :: "r" (prio << (8U - IRQ_PRIO_BITS)) : "memory");
+
+    return prev;
+}
+
+/**
+ * @brief Restores the mask saved by IRQ_Lock().
+ */
+static inline void IRQ_Unlock(uint32_t prev)
+{
+    __asm volatile ("msr basepri, %0" :: "r" (prev) : "memory");
+}
+#else
+static inline uint32_t IRQ_Lock(uint32_t prio)
+{
+    (void)prio;
+    __asm volatile ("" ::: "memory");
+    return 0U;
+}
+
+static inline void IRQ_Unlock(uint32_t prev)
+{
+    (void)prev;
+    __asm volatile ("" ::: "memory");
+}
+#endif
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void IRQ_Prio_Init(void);
+
+#endif /* IRQ_PRIO_H_ */
@@ -0,0 +1,988 @@
+/**
+ ******************************************************************************
+ * @file      lcd.c
+ * @brief     HD44780 1602 LCD driver over a PCF8574 I2C backpack, or over
+ * GPIO in 4-bit parallel mode (LCD_TRANSPORT).
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "lcd.h"
+#include "peripherals_lpi2c_config_1.h"
+#include "lpi2c_driver.h"   // LPI2C low-level driver
+#include "osif.h"           // OS Interface for OSIF_TimeDelay() and OSIF_TimeDelayUs()
+#include "irq_prio.h"
+#include "i2c_queue.h"      // Asynchronous LPI2C0 transactions
+#include "clock_gate.h"     // LPI2C0 and eDMA clocks around blocking transfers
+#include "pool.h"           // Transfer buffers owned by the queue until completion
+#include "prof.h"
+#if LCD_TRANSPORT == LCD_TRANSPORT_GPIO
+#include "lcd_gpio.h"       // RS/EN/D4-D7 on port pins
+#endif
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+// One composed PCF8574 byte stream plus its completion hook
+typedef struct
+{
+    uint8_t bytes[LCD_FRAME_MAX_BYTES];
+    uint32_t len;
+    lcd_frame_callback_t callback;
+    void *param;
+    i2c_xfer_t xfer;             // Single write of bytes to the backpack
+    i2c_job_t job;
+} lcd_frame_t;
+
+// One queued nibble or byte; the block belongs to the I2C queue until LCD_CmdDone()
+typedef struct
+{
+    i2c_job_t job;
+    i2c_xfer_t xfer;
+    uint8_t bytes[LCD_MAX_BYTES_PER_CHAR];
+} lcd_cmd_t;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Front buffer is owned by the eDMA while on the bus, back buffer by the application
+static lcd_frame_t s_frames[2];
+static lcd_frame_t * volatile s_front = &s_frames[0];
+static lcd_frame_t * volatile s_back = &s_frames[1];
+
+// Set while the front frame is on the bus
+static volatile bool s_front_busy;
+
+// Set when the back frame is complete and waits for the front one to finish
+static volatile bool s_back_queued;
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_I2C
+// Blocks for LCD_SendByte() and the reset nibbles, set up once by LCD_InitBegin()
+static POOL_STORAGE(s_cmd_storage, sizeof(lcd_cmd_t), LCD_CMD_POOL_BLOCKS);
+static pool_t s_cmd_pool;
+static bool s_cmd_pool_ready;
+#else
+// Set once LCD_InitBegin() has configured the pins
+static bool s_pins_ready;
+#endif
+
+// Idle port writes after each byte, see LCD_SetBusRate()
+static uint8_t s_pad_bytes;
+
+// Backpack address set by LCD_SetAddress(); 0 for the one of lpi2c0_MasterConfig0
+static uint16_t s_address;
+
+// Sequence being played by LCD_SeqStep(), and the offset of its next transfer
+static const lcd_seq_t *s_seq;
+static uint16_t s_seq_pos;
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_I2C
+// Transfer of one sequence span, straight from the flash table
+static i2c_job_t s_seq_job;
+static i2c_xfer_t s_seq_xfer;
+static volatile bool s_seq_busy;
+#endif
+
+// Reset into 4-bit mode: single nibbles while the controller may still be
+// in 8-bit mode, where every EN pulse is a complete instruction
+static const uint8_t s_seq_init_bytes[] =
+{
+    LCD_SEQ_DELAY(50),                              // Wait for LCD to power up
+    LCD_SEQ_NIBBLE(0x30), LCD_SEQ_DELAY(5),         // Over 4.1 ms
+    LCD_SEQ_NIBBLE(0x30), LCD_SEQ_DELAY_US(150),    // Over 100 us
+    LCD_SEQ_NIBBLE(0x30), LCD_SEQ_DELAY_US(50),     // Over the 37 us of an instruction
+    LCD_SEQ_NIBBLE(0x20), LCD_SEQ_DELAY_US(50),     // Set to 4-bit interface
+    LCD_SEQ_CMD(LCD_FUNCTION_SET | 0x08),           // 4-bit mode, 2 lines, 5x8 font
+    LCD_SEQ_CMD(LCD_DISPLAY_CONTROL | 0x04),        // Display on, cursor off, blink off
+    LCD_SEQ_CMD(LCD_CLEAR_DISPLAY),                 // Clear display
+    LCD_SEQ_DELAY(2),                               // This command takes longer to execute
+    LCD_SEQ_CMD(LCD_ENTRY_MODE_SET | 0x02),         // Increment cursor, no display shift
+    LCD_SEQ_CMD(LCD_RETURN_HOME),                   // Return cursor to home position
+    LCD_SEQ_DELAY(2),                               // So is this one, before any DMA frame goes out
+};
+
+static const uint8_t s_seq_clear_bytes[] =
+{
+    LCD_SEQ_CMD(LCD_CLEAR_DISPLAY),
+    LCD_SEQ_DELAY(2),
+};
+
+static const uint8_t s_seq_display_off_bytes[] =
+{
+    LCD_SEQ_CMD(LCD_DISPLAY_CONTROL),
+};
+
+static const uint8_t s_seq_display_on_bytes[] =
+{
+    LCD_SEQ_CMD(LCD_DISPLAY_CONTROL | 0x04),
+};
+
+#if LCD_USE_BUSY_FLAG
+// Set once the controller is in 4-bit mode and its busy flag can be read
+static bool s_bf_valid;
+#endif
+
+/*============================================================================*/
+/* Public Variables                               */
+/*============================================================================*/
+
+const lcd_seq_t g_lcd_seq_init = { s_seq_init_bytes, sizeof(s_seq_init_bytes) };
+const lcd_seq_t g_lcd_seq_clear = { s_seq_clear_bytes, sizeof(s_seq_clear_bytes) };
+const lcd_seq_t g_lcd_seq_display_off = { s_seq_display_off_bytes, sizeof(s_seq_display_off_bytes) };
+const lcd_seq_t g_lcd_seq_display_on = { s_seq_display_on_bytes, sizeof(s_seq_display_on_bytes) };
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_I2C
+/**
+ * @brief Holds the LPI2C0 and eDMA clocks for a blocking transfer.
+ */
+static void LCD_BusAcquire(void)
+{
+    ClockGate_Acquire(CLOCK_GATE_LPI2C0);
+    ClockGate_Acquire(CLOCK_GATE_DMA);
+}
+
+/**
+ * @brief Drops the clocks taken by LCD_BusAcquire().
+ */
+static void LCD_BusRelease(void)
+{
+    ClockGate_Release(CLOCK_GATE_DMA);
+    ClockGate_Release(CLOCK_GATE_LPI2C0);
+}
+
+/**
+ * @brief Address the backpack's transfers go to.
+ */
+static uint16_t LCD_Address(void)
+{
+    return (s_address != 0U) ? s_address : lpi2c0_MasterConfig0.slaveAddress;
+}
+
+/**
+ * @brief One turn of a wait on the I2C queue: every LCD_QUEUE_STALL_MS the
+ * queue is checked for a job that has stopped moving.
+ * @details A slave holding SDA low would otherwise keep the wait spinning
+ * forever. The withdrawn job fails with STATUS_TIMEOUT, which ends the wait.
+ * @param mark Time of the last check, set by the caller before the loop.
+ */
+static void LCD_PollStall(uint32_t *mark)
+{
+    if ((OSIF_GetMilliseconds() - *mark) >= LCD_QUEUE_STALL_MS)
+    {
+        (void)I2C_Queue_CheckStall();
+        *mark = OSIF_GetMilliseconds();
+    }
+}
+
+/**
+ * @brief Waits until every queued transfer is off the bus, so a blocking
+ * driver call is not refused with STATUS_BUSY and keeps its place in order.
+ */
+static void LCD_Drain(void)
+{
+    uint32_t mark = OSIF_GetMilliseconds();
+
+    while (!I2C_Queue_IsIdle())
+    {
+        LCD_PollStall(&mark);
+    }
+}
+
+/**
+ * @brief Queue completion hook of a command block: hands it back to the pool.
+ */
+static void LCD_CmdDone(status_t status, void *param)
+{
+    (void)status;
+    (void)Pool_Free(&s_cmd_pool, param);
+}
+
+/**
+ * @brief Takes a command block, waiting for a completion to return one when
+ * all are on the bus. Must not be called with interrupts masked.
+ */
+static lcd_cmd_t *LCD_CmdAlloc(void)
+{
+    lcd_cmd_t *cmd;
+    uint32_t mark = OSIF_GetMilliseconds();
+
+    while ((cmd = (lcd_cmd_t *)Pool_Alloc(&s_cmd_pool)) == NULL)
+    {
+        LCD_PollStall(&mark);
+    }
+
+    return cmd;
+}
+
+/**
+ * @brief Queues the bytes of a command block and returns at once.
+ * @details Ownership passes to the queue; the block returns to the pool
+ * from LCD_CmdDone(), on success or failure.
+ */
+static void LCD_CmdSubmit(lcd_cmd_t *cmd, uint8_t len)
+{
+    cmd->xfer.address = LCD_Address();
+    cmd->xfer.tx_buf = cmd->bytes;
+    cmd->xfer.tx_size = len;
+    cmd->xfer.rx_buf = NULL;
+    cmd->xfer.rx_size = 0;
+    cmd->xfer.send_stop = true;
+
+    if (I2C_Queue_Submit(&cmd->job, &cmd->xfer, 1U, LCD_CmdDone, cmd) != STATUS_SUCCESS)
+    {
+        (void)Pool_Free(&s_cmd_pool, cmd);
+    }
+}
+#endif
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_I2C
+/**
+ * @brief Queue completion of a sequence span: the job may be reused.
+ */
+static void LCD_SeqDone(status_t status, void *param)
+{
+    (void)status;
+    (void)param;
+    s_seq_busy = false;
+}
+#endif
+
+/**
+ * @brief Waits until the last sequence span is off the bus.
+ * @details Port writes over GPIO are complete on return, so only the I2C
+ * transfer has to be waited for.
+ */
+static void LCD_SeqWait(void)
+{
+#if LCD_TRANSPORT == LCD_TRANSPORT_I2C
+    uint32_t mark = OSIF_GetMilliseconds();
+
+    while (s_seq_busy)
+    {
+        LCD_PollStall(&mark);
+    }
+#endif
+}
+
+/**
+ * @brief Sends one span of a sequence, the port writes up to the next delay marker.
+ * @details Over I2C the span is a single queued write read by the eDMA
+ * straight from flash, behind anything already queued. Over GPIO each port
+ * write is replayed on the pins.
+ */
+static void LCD_SeqSend(const uint8_t *bytes, uint16_t len)
+{
+#if LCD_TRANSPORT == LCD_TRANSPORT_GPIO
+    uint16_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        LCD_GPIO_WritePort(bytes[i]);
+    }
+#else
+    // The previous span has had its delay, so this only waits on a slow bus
+    LCD_SeqWait();
+
+    s_seq_xfer.address = LCD_Address();
+    s_seq_xfer.tx_buf = bytes;
+    s_seq_xfer.tx_size = len;
+    s_seq_xfer.rx_buf = NULL;
+    s_seq_xfer.rx_size = 0;
+    s_seq_xfer.send_stop = true;
+
+    s_seq_busy = true;
+    if (I2C_Queue_Submit(&s_seq_job, &s_seq_xfer, 1U, LCD_SeqDone, NULL) != STATUS_SUCCESS)
+    {
+        s_seq_busy = false;
+    }
+#endif
+}
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_I2C
+static void LCD_FrameDone(status_t status, void *param);
+
+/**
+ * @brief Swaps front and back buffers and queues the new front frame.
+ * @details Called with the LPI2C0 interrupt unable to preempt: either from
+ * LCD_FrameSend() inside a critical section or from LCD_FrameDone().
+ */
+static void LCD_SwapAndStart(void)
+{
+    lcd_frame_t *frame = s_back;
+    status_t status;
+
+    s_back = s_front;
+    s_front = frame;
+    s_back_queued = false;
+    s_front_busy = true;
+
+    frame->xfer.address = LCD_Address();
+    frame->xfer.tx_buf = frame->bytes;
+    frame->xfer.tx_size = frame->len;
+    frame->xfer.rx_buf = NULL;
+    frame->xfer.rx_size = 0;
+    frame->xfer.send_stop = true;
+
+    // A refused start is reported through LCD_FrameDone() by the queue itself
+    status = I2C_Queue_Submit(&frame->job, &frame->xfer, 1U, LCD_FrameDone, frame);
+    if (status != STATUS_SUCCESS)
+    {
+        s_front_busy = false;
+        if (frame->callback != NULL)
+        {
+            frame->callback(status, frame->param);
+        }
+    }
+}
+
+/**
+ * @brief Queue completion of the front frame, in interrupt context.
+ * @details A queued back buffer is flipped to the front and submitted right away.
+ */
+static void LCD_FrameDone(status_t status, void *param)
+{
+    lcd_frame_t *frame = (lcd_frame_t *)param;
+
+    s_front_busy = false;
+    if (frame->callback != NULL)
+    {
+        frame->callback(status, frame->param);
+    }
+    if (s_back_queued)
+    {
+        LCD_SwapAndStart();
+    }
+}
+#endif
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Expands one HD44780 byte into the four PCF8574 port writes that clock
+ * it in, followed by the idle writes the current bus rate needs.
+ * @details Shared with lcd_multi.c, whose panels sit on the same bus and
+ * take the padding set by LCD_SetBusRate().
+ * @param dst    Destination for up to LCD_MAX_BYTES_PER_CHAR bytes.
+ * @param data   The 8-bit data byte to send.
+ * @param rs_bit Register Select bit (0 for command, 1 for data).
+ * @return Number of bytes written.
+ */
+uint8_t LCD_PackByte(uint8_t *dst, uint8_t data, uint8_t rs_bit)
+{
+    uint8_t i;
+    uint8_t high_nibble = data & 0xF0;
+    uint8_t low_nibble = (data << 4) & 0xF0;
+
+    // Payload for the high nibble (EN pulse)
+    dst[0] = (high_nibble | rs_bit | 0x08 | 0x04); // Data | RS | Backlight | EN=1
+    dst[1] = (high_nibble | rs_bit | 0x08);        // Data | RS | Backlight | EN=0
+
+    // Payload for the low nibble (EN pulse)
+    dst[2] = (low_nibble | rs_bit | 0x08 | 0x04);  // Data | RS | Backlight | EN=1
+    dst[3] = (low_nibble | rs_bit | 0x08);         // Data | RS | Backlight | EN=0
+
+    // Repeating the last write keeps EN low and only spends bus time
+    for (i = 0; i < s_pad_bytes; i++)
+    {
+        dst[LCD_BYTES_PER_CHAR + i] = dst[3];
+    }
+
+    return (uint8_t)(LCD_BYTES_PER_CHAR + s_pad_bytes);
+}
+
+/**
+ * @brief Sends a single byte to the LCD via I2C.
+ * @details This function splits the byte into two 4-bit nibbles and sends them sequentially,
+ * toggling the Enable (EN) pin for each nibble.
+ * The port writes are packed straight into a pool block that is queued
+ * behind any transfer already on the bus, so the call returns without
+ * waiting for the I2C transaction and the order with frames is kept.
+ * With the GPIO transport the nibbles are clocked out directly and the call
+ * returns after the controller's execution time.
+ * @param data The 8-bit data byte to send.
+ * @param rs_bit Register Select bit (0 for command, 1 for data).
+ */
+void LCD_SendByte(uint8_t data, uint8_t rs_bit)
+{
+#if LCD_TRANSPORT == LCD_TRANSPORT_GPIO
+    LCD_GPIO_WriteByte(data, rs_bit);
+#else
+    lcd_cmd_t *cmd;
+
+#if LCD_USE_BUSY_FLAG
+    if (s_bf_valid)
+    {
+        (void)LCD_WaitReady();
+    }
+#endif
+
+    cmd = LCD_CmdAlloc();
+    LCD_CmdSubmit(cmd, LCD_PackByte(cmd->bytes, data, rs_bit));
+#endif
+}
+
+/**
+ * @brief Writes a run of characters starting at a given cell in one I2C transaction.
+ * @details The DDRAM move and all characters are packed into a single PCF8574
+ * byte stream, so the START/address/STOP overhead is paid once per run instead
+ * of once per character. At 400 kHz the two port writes between consecutive
+ * EN falling edges (~45 us) already cover the 37 us HD44780 write time; on
+ * faster buses LCD_SetBusRate() pads each character to keep that margin.
+ * Over GPIO the bytes are written one after the other, paced by the
+ * execution time alone. A failed transfer is reported to the I2C queue's
+ * error counters; while the queue is faulted the run is dropped.
+ * @param row Display line (0 or 1).
+ * @param col Starting DDRAM column; LCD_COLS and up are off screen unless
+ *            the display is shifted.
+ * @param buf Characters to write (not null-terminated).
+ * @param len Number of characters; clipped at LCD_COLS and at the end of
+ *            the DDRAM line.
+ */
+void LCD_WriteBuffer(uint8_t row, uint8_t col, const char *buf, uint8_t len)
+{
+#if LCD_TRANSPORT == LCD_TRANSPORT_I2C
+    status_t status;
+    uint8_t i2c_payload[(1U + LCD_COLS) * LCD_MAX_BYTES_PER_CHAR];
+    uint8_t *dst = i2c_payload;
+#endif
+    uint8_t i;
+
+    if ((row >= LCD_ROWS) || (col >= LCD_DDRAM_COLS) || (len == 0U))
+    {
+        return;
+    }
+    if (len > (LCD_DDRAM_COLS - col))
+    {
+        len = LCD_DDRAM_COLS - col;
+    }
+    if (len > LCD_COLS)
+    {
+        len = LCD_COLS;
+    }
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_GPIO
+    LCD_GPIO_WriteByte((uint8_t)(LCD_SET_DDRAM_ADDR | ((row * LCD_ROW1_DDRAM) + col)), 0);
+    for (i = 0; i < len; i++)
+    {
+        LCD_GPIO_WriteByte((uint8_t)buf[i], 1);
+    }
+#else
+#if LCD_USE_BUSY_FLAG
+    // The run itself is paced by the byte stream, only its start needs the flag
+    if (s_bf_valid)
+    {
+        (void)LCD_WaitReady();
+    }
+#endif
+
+    // Cursor move followed by the characters themselves
+    dst += LCD_PackByte(dst, (uint8_t)(LCD_SET_DDRAM_ADDR | ((row * LCD_ROW1_DDRAM) + col)), 0);
+    for (i = 0; i < len; i++)
+    {
+        dst += LCD_PackByte(dst, (uint8_t)buf[i], 1);
+    }
+
+    LCD_Drain();
+    if (I2C_Queue_IsFaulted())
+    {
+        // The bus is being recovered; the driver would only run into its timeout
+        return;
+    }
+    LCD_BusAcquire();
+    PROF_BEGIN(PROF_I2C_BLOCKING);
+    status = LPI2C_DRV_MasterSendDataBlocking(INST_LPI2C0, i2c_payload, (uint32_t)(dst - i2c_payload), true, 100);
+    PROF_END(PROF_I2C_BLOCKING);
+    LCD_BusRelease();
+    I2C_Queue_ReportError(status);
+#endif
+}
+
+/**
+ * @brief Loads the pattern of one custom character into CGRAM.
+ * @details The CGRAM move and the eight pattern rows go out in a single
+ * transaction, after everything already queued so frames that still show the
+ * old pattern are not overtaken. The address counter is left in CGRAM; every
+ * run written afterwards starts with its own DDRAM move.
+ * @param slot CGRAM slot (0..LCD_CGRAM_SLOTS - 1).
+ * @param rows LCD_GLYPH_ROWS pattern rows, top first, pixels in bits 4-0.
+ */
+void LCD_WriteGlyph(uint8_t slot, const uint8_t *rows)
+{
+#if LCD_TRANSPORT == LCD_TRANSPORT_I2C
+    status_t status;
+    uint8_t i2c_payload[(1U + LCD_GLYPH_ROWS) * LCD_MAX_BYTES_PER_CHAR];
+    uint8_t *dst = i2c_payload;
+#endif
+    uint8_t i;
+
+    if (slot >= LCD_CGRAM_SLOTS)
+    {
+        return;
+    }
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_GPIO
+    LCD_GPIO_WriteByte((uint8_t)(LCD_SET_CGRAM_ADDR | (slot * LCD_GLYPH_ROWS)), 0);
+    for (i = 0; i < LCD_GLYPH_ROWS; i++)
+    {
+        LCD_GPIO_WriteByte(rows[i] & 0x1FU, 1);
+    }
+#else
+#if LCD_USE_BUSY_FLAG
+    if (s_bf_valid)
+    {
+        (void)LCD_WaitReady();
+    }
+#endif
+
+    dst += LCD_PackByte(dst, (uint8_t)(LCD_SET_CGRAM_ADDR | (slot * LCD_GLYPH_ROWS)), 0);
+    for (i = 0; i < LCD_GLYPH_ROWS; i++)
+    {
+        dst += LCD_PackByte(dst, rows[i] & 0x1FU, 1);
+    }
+
+    LCD_Drain();
+    if (I2C_Queue_IsFaulted())
+    {
+        return;
+    }
+    LCD_BusAcquire();
+    status = LPI2C_DRV_MasterSendDataBlocking(INST_LPI2C0, i2c_payload, (uint32_t)(dst - i2c_payload), true, 100);
+    LCD_BusRelease();
+    I2C_Queue_ReportError(status);
+#endif
+}
+
+/**
+ * @brief Adapts the byte stream to the SCL rate actually in use.
+ * @details Between the EN falling edge that completes one byte and the one
+ * that starts the next there are two port writes of 9 SCL cycles each. Above
+ * ~480 kHz that is shorter than LCD_EXEC_TIME_NS, so idle writes are added
+ * after each byte to make up the difference.
+ * @param baud_hz SCL frequency reported by LPI2C_DRV_MasterGetBaudRate().
+ */
+void LCD_SetBusRate(uint32_t baud_hz)
+{
+    // Port writes needed to cover the execution time, rounded up
+    uint32_t gap = (uint32_t)((((uint64_t)LCD_EXEC_TIME_NS * baud_hz) + 8999999999ULL) / 9000000000ULL);
+
+    gap = (gap > 2U) ? (gap - 2U) : 0U;
+    s_pad_bytes = (uint8_t)((gap > LCD_MAX_PAD_BYTES) ? LCD_MAX_PAD_BYTES : gap);
+}
+
+/**
+ * @brief Moves the backpack to another I2C address, e.g. from a boot configuration.
+ * @details Call before LCD_InitBegin(). Only the pending frames' address
+ * changes; blocking transfers go to the address I2C_Queue_SetHomeAddress()
+ * leaves the driver on, which must be the same.
+ * @param address 7-bit address; 0 returns to lpi2c0_MasterConfig0.slaveAddress.
+ */
+void LCD_SetAddress(uint16_t address)
+{
+    s_address = address;
+}
+
+/**
+ * @brief Polls the HD44780 busy flag until the controller accepts a new
+ * instruction.
+ * @details D7-D4 are released high so the PCF8574 can read them, RW is
+ * raised and the high nibble (BF and AC6-AC4) is read while EN is high. The
+ * low nibble is clocked out unread to keep the 4-bit transfer aligned, and
+ * RW is dropped again before returning. Each poll is about 7 bus bytes, so
+ * at 400 kHz the flag is seen within ~0.2 ms of clearing.
+ * @return STATUS_SUCCESS when ready, STATUS_TIMEOUT after
+ * LCD_BUSY_TIMEOUT_MS, STATUS_I2C_BUS_BUSY while the I2C queue is
+ * faulted, or the I2C error. Always STATUS_SUCCESS when LCD_USE_BUSY_FLAG
+ * is 0.
+ */
+status_t LCD_WaitReady(void)
+{
+#if LCD_USE_BUSY_FLAG
+    // D7-D4 high (inputs) | Backlight | RW=1, and the same with EN=1
+    static const uint8_t s_read_start[2] = { 0xF0 | 0x08 | 0x02, 0xF0 | 0x08 | 0x02 | 0x04 };
+    // End the high nibble, clock the low nibble, then RW=0 with EN low
+    static const uint8_t s_read_end[4] = { 0xF0 | 0x08 | 0x02, 0xF0 | 0x08 | 0x02 | 0x04, 0xF0 | 0x08 | 0x02, 0x08 };
+    uint32_t start;
+    status_t status;
+    uint8_t port;
+
+    LCD_Drain();
+    if (I2C_Queue_IsFaulted())
+    {
+        return STATUS_I2C_BUS_BUSY;
+    }
+    start = OSIF_GetMilliseconds();
+    LCD_BusAcquire();
+    do
+    {
+        status = LPI2C_DRV_MasterSendDataBlocking(INST_LPI2C0, s_read_start, sizeof(s_read_start), true, 100);
+        if (status == STATUS_SUCCESS)
+        {
+            status = LPI2C_DRV_MasterReceiveDataBlocking(INST_LPI2C0, &port, 1U, true, 100);
+        }
+        if (status == STATUS_SUCCESS)
+        {
+            status = LPI2C_DRV_MasterSendDataBlocking(INST_LPI2C0, s_read_end, sizeof(s_read_end), true, 100);
+        }
+        if ((status == STATUS_SUCCESS) && ((port & 0x80U) != 0U))
+        {
+            status = STATUS_TIMEOUT;
+        }
+    } while ((status == STATUS_TIMEOUT) && ((OSIF_GetMilliseconds() - start) < LCD_BUSY_TIMEOUT_MS));
+    LCD_BusRelease();
+
+    return status;
+#else
+    return STATUS_SUCCESS;
+#endif
+}
+
+/**
+ * @brief Sends a command to the LCD.
+ * @param command The command byte to send.
+ */
+void LCD_SendCommand(uint8_t command)
+{
+    LCD_SendByte(command, 0); // RS = 0 for commands
+}
+
+/**
+ * @brief Sends a data character to the LCD.
+ * @param data The character byte to send.
+ */
+void LCD_SendData(uint8_t data)
+{
+    LCD_SendByte(data, 1); // RS = 1 for data
+}
+
+/**
+ * @brief Sends a null-terminated string to the LCD.
+ * @param str Pointer to the string.
+ */
+void LCD_SendString(char *str)
+{
+    PROF_BEGIN(PROF_LCD_SEND_STRING);
+    while (*str)
+    {
+        LCD_SendData(*str++);
+    }
+    PROF_END(PROF_LCD_SEND_STRING);
+}
+
+/**
+ * @brief Starts playing a precompiled sequence; follow with LCD_SeqStep().
+ * @details Call LCD_InitBegin() first, once, so the transport is set up.
+ * @param seq Table to play, e.g. g_lcd_seq_clear.
+ */
+void LCD_SeqStart(const lcd_seq_t *seq)
+{
+    s_seq = seq;
+    s_seq_pos = 0;
+}
+
+/**
+ * @brief Sends the next span of the sequence without waiting.
+ * @details Everything up to the next millisecond delay marker goes out as
+ * one transfer; the caller owns the delay, as with LCD_InitStep().
+ * Microsecond delays are too short for a timer, so they are waited out
+ * here, after their transfer has left the bus, and the next span follows.
+ * @return Milliseconds to wait before the next call, or LCD_SEQ_DONE once
+ * the whole table has been sent.
+ */
+uint32_t LCD_SeqStep(void)
+{
+    const uint8_t *bytes;
+    uint16_t start, len;
+    uint8_t mark, delay;
+
+    if ((s_seq == NULL) || (s_seq_pos >= s_seq->len))
+    {
+        return LCD_SEQ_DONE;
+    }
+
+    bytes = s_seq->bytes;
+    for (;;)
+    {
+        start = s_seq_pos;
+        while ((s_seq_pos < s_seq->len) && ((bytes[s_seq_pos] & LCD_PCF_BL) != 0U))
+        {
+            s_seq_pos++;
+        }
+        len = s_seq_pos - start;
+        if (len != 0U)
+        {
+            LCD_SeqSend(&bytes[start], len);
+        }
+
+        if (s_seq_pos >= s_seq->len)
+        {
+            return 0U;
+        }
+
+        // A marker is always followed by its delay
+        mark = bytes[s_seq_pos];
+        delay = bytes[s_seq_pos + 1U];
+        s_seq_pos += 2U;
+        if (mark != LCD_SEQ_MARK_US)
+        {
+            return delay;
+        }
+
+        LCD_SeqWait();
+        OSIF_TimeDelayUs(delay);
+        if (s_seq_pos >= s_seq->len)
+        {
+            return 0U;
+        }
+    }
+}
+
+/**
+ * @brief Plays a whole sequence, sleeping through its delays.
+ * @param seq Table to play.
+ */
+void LCD_SeqRun(const lcd_seq_t *seq)
+{
+    uint32_t delay_ms;
+
+    LCD_SeqStart(seq);
+    for (delay_ms = LCD_SeqStep(); delay_ms != LCD_SEQ_DONE; delay_ms = LCD_SeqStep())
+    {
+        OSIF_TimeDelay(delay_ms);
+    }
+}
+
+/**
+ * @brief Restarts the power-up sequence; follow with LCD_InitStep().
+ */
+void LCD_InitBegin(void)
+{
+#if LCD_TRANSPORT == LCD_TRANSPORT_GPIO
+    // Only once: the pins keep their configuration across restarts
+    if (!s_pins_ready)
+    {
+        LCD_GPIO_Init();
+        s_pins_ready = true;
+    }
+#else
+    // Only once: blocks of an earlier run may still be on the bus
+    if (!s_cmd_pool_ready)
+    {
+        (void)Pool_Init(&s_cmd_pool, s_cmd_storage, sizeof(lcd_cmd_t), LCD_CMD_POOL_BLOCKS);
+        s_cmd_pool_ready = true;
+    }
+#endif
+    LCD_SeqStart(&g_lcd_seq_init);
+#if LCD_USE_BUSY_FLAG
+    s_bf_valid = false;
+#endif
+}
+
+/**
+ * @brief Runs the next step of the power-up sequence without waiting.
+ * @details Plays g_lcd_seq_init, one transfer per step. The busy flag is
+ * not valid before the function set, so the table keeps fixed delays
+ * throughout; with LCD_USE_BUSY_FLAG the flag is polled once at the end
+ * and used from then on. The caller owns the waiting, so other bring-up
+ * can fill the gaps.
+ * @return Milliseconds to wait before the next call, or LCD_INIT_DONE once
+ * the display is ready for frames.
+ */
+uint32_t LCD_InitStep(void)
+{
+    uint32_t delay_ms = LCD_SeqStep();
+
+#if LCD_USE_BUSY_FLAG
+    if ((delay_ms == LCD_INIT_DONE) && !s_bf_valid)
+    {
+        s_bf_valid = true;
+        (void)LCD_WaitReady();
+    }
+#endif
+
+    return delay_ms;
+}
+
+/**
+ * @brief Initializes the LCD into 4-bit communication mode.
+ * @details Blocking wrapper around LCD_InitBegin()/LCD_InitStep() that
+ * sleeps through every step delay, about 59 ms in total.
+ */
+void LCD_Init(void)
+{
+    uint32_t delay_ms;
+
+    LCD_InitBegin();
+    for (delay_ms = LCD_InitStep(); delay_ms != LCD_INIT_DONE; delay_ms = LCD_InitStep())
+    {
+        OSIF_TimeDelay(delay_ms);
+    }
+}
+
+/**
+ * @brief Starts composing a new frame in the back buffer.
+ * @return false while the back buffer still holds a queued frame; the caller
+ * should keep its changes and try again later.
+ */
+bool LCD_FrameBegin(void)
+{
+    if (s_back_queued)
+    {
+        return false;
+    }
+    s_back->len = 0;
+
+    return true;
+}
+
+/**
+ * @brief Appends a DDRAM move and a run of characters to the back buffer.
+ * @param row Display line (0 or 1).
+ * @param col Starting DDRAM column, as for LCD_WriteBuffer().
+ * @param buf Characters to write (not null-terminated).
+ * @param len Number of characters; clipped at LCD_COLS and at the end of
+ *            the DDRAM line.
+ * @return false if the run does not fit in the frame buffer.
+ */
+bool LCD_FrameAppendRun(uint8_t row, uint8_t col, const char *buf, uint8_t len)
+{
+    lcd_frame_t *frame = s_back;
+#if LCD_TRANSPORT == LCD_TRANSPORT_I2C
+    uint8_t i;
+#endif
+
+    if ((row >= LCD_ROWS) || (col >= LCD_DDRAM_COLS) || (len == 0U))
+    {
+        return true;
+    }
+    if (len > (LCD_DDRAM_COLS - col))
+    {
+        len = LCD_DDRAM_COLS - col;
+    }
+    if (len > LCD_COLS)
+    {
+        len = LCD_COLS;
+    }
+    if ((frame->len + ((1U + len) * (LCD_BYTES_PER_CHAR + s_pad_bytes))) > LCD_FRAME_MAX_BYTES)
+    {
+        return false;
+    }
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_GPIO
+    // No bus to hand the frame to: the run goes out now, len only marks the frame non-empty
+    LCD_WriteBuffer(row, col, buf, len);
+    frame->len++;
+#else
+    frame->len += LCD_PackByte(&frame->bytes[frame->len], (uint8_t)(LCD_SET_DDRAM_ADDR | ((row * LCD_ROW1_DDRAM) + col)), 0);
+    for (i = 0; i < len; i++)
+    {
+        frame->len += LCD_PackByte(&frame->bytes[frame->len], (uint8_t)buf[i], 1);
+    }
+#endif
+
+    return true;
+}
+
+/**
+ * @brief Appends one short instruction, e.g. a display shift, to the back buffer.
+ * @details Only for instructions within LCD_EXEC_TIME_NS, which the byte
+ * padding covers; clear and home need their own delay.
+ * @param command The command byte.
+ * @return false if it does not fit in the frame buffer.
+ */
+bool LCD_FrameAppendCommand(uint8_t command)
+{
+    lcd_frame_t *frame = s_back;
+
+    if ((frame->len + LCD_BYTES_PER_CHAR + s_pad_bytes) > LCD_FRAME_MAX_BYTES)
+    {
+        return false;
+    }
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_GPIO
+    LCD_GPIO_WriteByte(command, 0);
+    frame->len++;
+#else
+    frame->len += LCD_PackByte(&frame->bytes[frame->len], command, 0);
+#endif
+
+    return true;
+}
+
+/**
+ * @brief Queues the composed back buffer and returns immediately.
+ * @details If the bus is idle the buffers are swapped and the frame starts at
+ * once; otherwise the swap happens in the completion interrupt as soon as
+ * the front frame completes, like a vsync flip. Frames share LPI2C0 with the
+ * other I2C queue jobs and run in submission order. With the master configured for
+ * LPI2C_USING_DMA the eDMA moves the frame into MTDR, so the CPU takes no
+ * per-byte interrupts and never waits for the bus. Over GPIO every run was
+ * already written by LCD_FrameAppendRun(), and the hook is called from here;
+ * so is it for an empty frame, so every STATUS_SUCCESS gets exactly one call.
+ * @param callback Optional hook invoked when the frame is done, from interrupt
+ *                 context or, for a frame already complete, before returning.
+ * @param param    User parameter for the hook.
+ * @return STATUS_SUCCESS if the frame was queued (or was empty),
+ * STATUS_BUSY if the back buffer already holds a queued frame.
+ */
+status_t LCD_FrameSend(lcd_frame_callback_t callback, void *param)
+{
+#if LCD_TRANSPORT == LCD_TRANSPORT_I2C
+    uint32_t lock;
+#endif
+
+    if (s_back_queued)
+    {
+        return STATUS_BUSY;
+    }
+    if (s_back->len == 0U)
+    {
+        // Nothing to send: done already, as over GPIO
+        if (callback != NULL)
+        {
+            callback(STATUS_SUCCESS, param);
+        }
+        return STATUS_SUCCESS;
+    }
+
+#if LCD_TRANSPORT == LCD_TRANSPORT_GPIO
+    s_back->len = 0;
+    if (callback != NULL)
+    {
+        callback(STATUS_SUCCESS, param);
+    }
+#else
+    s_back->callback = callback;
+    s_back->param = param;
+
+    // The completion interrupt must not flip the buffers between the check and the queueing
+    lock = IRQ_Lock(IRQ_PRIO_I2C);
+    s_back_queued = true;
+    if (!s_front_busy)
+    {
+        LCD_SwapAndStart();
+    }
+    IRQ_Unlock(lock);
+#endif
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Reports whether a non-blocking frame is still being transmitted.
+ */
+bool LCD_IsBusy(void)
+{
+    return s_front_busy || s_back_queued;
+}
@@ -0,0 +1,193 @@
+/**
+ ******************************************************************************
+ * @file      lcd.h
+ * @brief     HD44780 1602 LCD driver over a PCF8574 I2C backpack, or over
+ * GPIO in 4-bit parallel mode (LCD_TRANSPORT).
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef LCD_H_
+#define LCD_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Set to 1 to wait on the HD44780 busy flag instead of worst-case delays;
+// needs the backpack's P1 wired to RW, as on the common PCF8574 modules
+#ifndef LCD_USE_BUSY_FLAG
+#define LCD_USE_BUSY_FLAG   0
+#endif
+
+// Link to the controller: the PCF8574 I2C backpack or direct GPIO, see lcd_gpio.h
+#define LCD_TRANSPORT_I2C   0
+#define LCD_TRANSPORT_GPIO  1
+#ifndef LCD_TRANSPORT
+#define LCD_TRANSPORT       LCD_TRANSPORT_I2C
+#endif
+
+#if (LCD_TRANSPORT == LCD_TRANSPORT_GPIO) && LCD_USE_BUSY_FLAG
+#error "The GPIO transport ties RW low, so the busy flag cannot be read"
+#endif
+
+// LCD_InitStep() and LCD_SeqStep() result once the sequence is complete
+#define LCD_INIT_DONE       0xFFFFFFFFU
+#define LCD_SEQ_DONE        LCD_INIT_DONE
+
+// Longest busy-flag poll before giving up, above the 1.52 ms of clear/home
+#define LCD_BUSY_TIMEOUT_MS 5U
+
+// Period at which a wait on the I2C queue checks for a stalled job, well
+// above the longest frame; a stuck job is withdrawn after one to two
+#define LCD_QUEUE_STALL_MS  50U
+
+// HD44780 LCD Controller Commands
+#define LCD_CLEAR_DISPLAY   0x01
+#define LCD_RETURN_HOME     0x02
+#define LCD_ENTRY_MODE_SET  0x04
+#define LCD_DISPLAY_CONTROL 0x08
+#define LCD_CURSOR_SHIFT    0x10
+#define LCD_FUNCTION_SET    0x20
+#define LCD_SET_CGRAM_ADDR  0x40
+#define LCD_SET_DDRAM_ADDR  0x80
+
+// Display geometry and DDRAM layout of a 1602 module
+#define LCD_ROWS            2U
+#define LCD_COLS            16U
+#define LCD_ROW1_DDRAM      0x40U  // DDRAM address of the first cell on line 2
+#define LCD_DDRAM_COLS      40U    // DDRAM cells per line; the display shows a window of LCD_COLS
+
+// Display shift by one cell, both lines at once: LEFT moves the window to higher addresses
+#define LCD_SHIFT_LEFT      (LCD_CURSOR_SHIFT | 0x08)
+#define LCD_SHIFT_RIGHT     (LCD_CURSOR_SHIFT | 0x08 | 0x04)
+
+// Screens of LCD_COLS cells side by side in DDRAM, switched by display
+// shifts instead of rewriting every cell; see LCD_FB_ShowPage()
+#ifndef LCD_FB_PAGES
+#define LCD_FB_PAGES        1U
+#endif
+#if (LCD_FB_PAGES == 0U) || ((LCD_FB_PAGES * LCD_COLS) > LCD_DDRAM_COLS)
+#error "LCD_FB_PAGES screens must fit side by side in one DDRAM line"
+#endif
+
+// Custom characters: 8 CGRAM slots of 5x8 pixels, shown as codes 0-7 (or 8-15)
+#define LCD_CGRAM_SLOTS     8U
+#define LCD_GLYPH_ROWS      8U
+
+// PCF8574 port writes needed to clock one byte in 4-bit mode (2 nibbles x EN high/low)
+#define LCD_BYTES_PER_CHAR  4U
+
+// Idle port writes appended per byte on fast buses, so the HD44780 is done before the next one
+#define LCD_MAX_PAD_BYTES   4U
+#define LCD_MAX_BYTES_PER_CHAR (LCD_BYTES_PER_CHAR + LCD_MAX_PAD_BYTES)
+
+// HD44780 execution time of a data write or a short command
+#define LCD_EXEC_TIME_NS    37000U
+
+// PCF8574 port bits: P0 = RS, P1 = RW, P2 = EN, P3 = backlight, P7-P4 = D7-D4
+#define LCD_PCF_RS          0x01U
+#define LCD_PCF_RW          0x02U
+#define LCD_PCF_EN          0x04U
+#define LCD_PCF_BL          0x08U
+
+/*
+ * Compile-time PCF8574 byte streams for lcd_seq_t tables. Every byte is
+ * padded for the fastest bus LCD_SetBusRate() supports, so a table holds
+ * at any rate. The backlight bit is set in every port write, so a byte
+ * without it can only be a delay marker: LCD_SEQ_DELAY(ms) ends a transfer
+ * and waits ms (1-255) before the next one; LCD_SEQ_DELAY_US(us) waits us
+ * (1-255) once the transfer is off the bus, without returning to the caller.
+ */
+#define LCD_SEQ_MARK        0x00U
+#define LCD_SEQ_MARK_US     0x01U
+#define LCD_SEQ_DELAY(ms)   LCD_SEQ_MARK, (uint8_t)(ms)
+#define LCD_SEQ_DELAY_US(us) LCD_SEQ_MARK_US, (uint8_t)(us)
+
+#define LCD_SEQ_PORT(n, rs)         ((uint8_t)(((n) & 0xF0U) | (rs) | LCD_PCF_BL))
+#define LCD_SEQ_NIBBLE_RS(n, rs)    (uint8_t)(LCD_SEQ_PORT(n, rs) | LCD_PCF_EN), LCD_SEQ_PORT(n, rs)
+#define LCD_SEQ_NIBBLE(n)           LCD_SEQ_NIBBLE_RS(n, 0U)
+
+#if LCD_MAX_PAD_BYTES != 4U
+#error "LCD_SEQ_BYTE() writes four pad bytes"
+#endif
+#define LCD_SEQ_BYTE(d, rs)         LCD_SEQ_NIBBLE_RS(d, rs), LCD_SEQ_NIBBLE_RS((d) << 4, rs), \
+                                    LCD_SEQ_PORT((d) << 4, rs), LCD_SEQ_PORT((d) << 4, rs), \
+                                    LCD_SEQ_PORT((d) << 4, rs), LCD_SEQ_PORT((d) << 4, rs)
+#define LCD_SEQ_CMD(c)              LCD_SEQ_BYTE(c, 0U)
+#define LCD_SEQ_DATA(d)             LCD_SEQ_BYTE(d, LCD_PCF_RS)
+
+// Worst-case frame: every line of every page split into runs two clean cells
+// apart, each run with its own move, then the shifts to the farthest page
+#define LCD_FRAME_MAX_BYTES (((LCD_FB_PAGES * LCD_ROWS * (LCD_COLS + (LCD_COLS / 2U))) + \
+                              ((LCD_FB_PAGES - 1U) * LCD_COLS)) * LCD_MAX_BYTES_PER_CHAR)
+
+// Single-byte transfers queued at once; LCD_SendByte() waits for one to complete when all are taken
+#define LCD_CMD_POOL_BLOCKS 8U
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Completion hook for a DMA frame, called from the LPI2C/eDMA interrupt.
+ * @param status Final status of the I2C transfer.
+ * @param param  User parameter passed to LCD_FrameSend().
+ */
+typedef void (*lcd_frame_callback_t)(status_t status, void *param);
+
+/**
+ * @brief A precompiled command sequence: PCF8574 port writes built with
+ * the LCD_SEQ_ macros, with delay markers between the transfers.
+ */
+typedef struct
+{
+    const uint8_t *bytes;
+    uint16_t len;
+} lcd_seq_t;
+
+/*============================================================================*/
+/* Public Variables                               */
+/*============================================================================*/
+
+extern const lcd_seq_t g_lcd_seq_init;          // Power-up reset into 4-bit mode, display on and cleared
+extern const lcd_seq_t g_lcd_seq_clear;         // Clear and home; the framebuffer must be reset after it
+extern const lcd_seq_t g_lcd_seq_display_off;   // Blank the display, DDRAM kept
+extern const lcd_seq_t g_lcd_seq_display_on;    // Show DDRAM again
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+uint8_t LCD_PackByte(uint8_t *dst, uint8_t data, uint8_t rs_bit);
+void LCD_SendByte(uint8_t data, uint8_t rs_bit);
+void LCD_SendCommand(uint8_t command);
+void LCD_SendData(uint8_t data);
+void LCD_SendString(char *str);
+void LCD_WriteBuffer(uint8_t row, uint8_t col, const char *buf, uint8_t len);
+void LCD_WriteGlyph(uint8_t slot, const uint8_t *rows);
+void LCD_SetBusRate(uint32_t baud_hz);
+void LCD_SetAddress(uint16_t address);
+status_t LCD_WaitReady(void);
+
+bool LCD_FrameBegin(void);
+bool LCD_FrameAppendRun(uint8_t row, uint8_t col, const char *buf, uint8_t len);
+bool LCD_FrameAppendCommand(uint8_t command);
+status_t LCD_FrameSend(lcd_frame_callback_t callback, void *param);
+bool LCD_IsBusy(void);
+void LCD_SeqStart(const lcd_seq_t *seq);
+uint32_t LCD_SeqStep(void);
+void LCD_SeqRun(const lcd_seq_t *seq);
+void LCD_InitBegin(void);
+uint32_t LCD_InitStep(void);
+void LCD_Init(void);
+
+#endif /* LCD_H_ */
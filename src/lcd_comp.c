@@ -0,0 +1,261 @@
+/**
+ ******************************************************************************
+ * @file      lcd_comp.c
+ * @brief     Screen compositor on the LCD framebuffer: regions with their own
+ * refresh period and content callback, grouped into rotating pages.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "lcd_comp.h"
+#include <stddef.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define LCD_COMP_NO_PAGE        0xFFU  // Framebuffer page holding no compositor page yet
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static lcd_region_t *s_regions;
+static uint8_t s_pages;
+static uint32_t s_dwell_ms;
+
+static uint8_t s_page;          // Compositor page in view
+static uint8_t s_request;       // Page to bring up on the next poll
+static bool s_switch;           // s_request is pending
+static uint8_t s_slot;          // Framebuffer page s_page is drawn in
+static uint32_t s_since_ms;     // When s_page came up
+static bool s_dirty;            // Drawn cells not yet queued
+
+// Compositor page each framebuffer page currently holds
+static uint8_t s_holds[LCD_FB_PAGES];
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Draws a region into the selected framebuffer page.
+ */
+static void LCD_Comp_Draw(lcd_region_t *region)
+{
+    char cells[LCD_COLS];
+    uint8_t i;
+
+    for (i = 0; i < region->width; i++)
+    {
+        cells[i] = ' ';
+    }
+    region->draw(cells, region->width, region->param);
+    for (i = 0; i < region->width; i++)
+    {
+        LCD_FB_PutChar(region->row, (uint8_t)(region->col + i), cells[i]);
+    }
+    s_dirty = true;
+}
+
+/**
+ * @brief Brings a page up: draws all its regions and selects it for view.
+ * @details A page below LCD_FB_PAGES is drawn in its own, hidden DDRAM
+ * columns and shifted into view by the next flush; only its cells that
+ * changed since it was last shown go out. Any other page is drawn in place
+ * over the page in view, cleared first if that held something else.
+ */
+static void LCD_Comp_Enter(uint8_t page, uint32_t now_ms)
+{
+    lcd_region_t *region;
+    uint8_t slot = (page < LCD_FB_PAGES) ? page : s_slot;
+
+    LCD_FB_SelectPage(slot);
+    if (s_holds[slot] != page)
+    {
+        LCD_FB_Clear();
+        s_holds[slot] = page;
+    }
+    for (region = s_regions; region != NULL; region = region->next)
+    {
+        if (region->page == page)
+        {
+            LCD_Comp_Draw(region);
+            region->due_ms = now_ms + region->period_ms;
+        }
+    }
+    LCD_FB_ShowPage(slot);
+
+    s_page = page;
+    s_slot = slot;
+    s_since_ms = now_ms;
+    s_dirty = true;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Resets the compositor with no regions; page 0 comes up on the
+ * first poll.
+ * @details Call after LCD_FB_Init(). The compositor owns the framebuffer
+ * from then on.
+ * @param pages    Pages to rotate through, 1..LCD_COMP_MAX_PAGES.
+ * @param dwell_ms Time each page stays up; 0 only switches on
+ * LCD_Comp_ShowPage().
+ */
+void LCD_Comp_Init(uint8_t pages, uint32_t dwell_ms)
+{
+    uint8_t slot;
+
+    if (pages == 0U)
+    {
+        pages = 1U;
+    }
+    if (pages > LCD_COMP_MAX_PAGES)
+    {
+        pages = LCD_COMP_MAX_PAGES;
+    }
+
+    s_regions = NULL;
+    s_pages = pages;
+    s_dwell_ms = dwell_ms;
+    s_page = 0;
+    s_slot = 0;
+    s_request = 0;
+    s_switch = true;
+    s_dirty = false;
+    for (slot = 0; slot < LCD_FB_PAGES; slot++)
+    {
+        s_holds[slot] = LCD_COMP_NO_PAGE;
+    }
+    LCD_FB_SelectPage(0);
+    LCD_FB_ShowPage(0);
+}
+
+/**
+ * @brief Adds a region; it is first drawn when its page comes up.
+ * @param region    Caller-owned storage.
+ * @param page      Page it belongs to.
+ * @param row       Display line.
+ * @param col       First column.
+ * @param width     Cells; clipped at the end of the line.
+ * @param period_ms Redraw period while the page is shown; 0 for static content.
+ * @param draw      Content callback.
+ * @param param     User parameter for the callback.
+ */
+void LCD_Comp_AddRegion(lcd_region_t *region, uint8_t page, uint8_t row, uint8_t col, uint8_t width,
+                        uint32_t period_ms, lcd_comp_draw_t draw, void *param)
+{
+    if ((row >= LCD_ROWS) || (col >= LCD_COLS) || (draw == NULL))
+    {
+        return;
+    }
+    if (width > (LCD_COLS - col))
+    {
+        width = LCD_COLS - col;
+    }
+
+    region->draw = draw;
+    region->param = param;
+    region->period_ms = period_ms;
+    region->due_ms = 0;
+    region->page = page;
+    region->row = row;
+    region->col = col;
+    region->width = width;
+    region->next = s_regions;
+    s_regions = region;
+}
+
+/**
+ * @brief Brings a page up on the next poll and restarts its dwell time.
+ * @param page 0..pages-1; out-of-range pages are ignored.
+ */
+void LCD_Comp_ShowPage(uint8_t page)
+{
+    if (page < s_pages)
+    {
+        s_request = page;
+        s_switch = true;
+    }
+}
+
+/**
+ * @brief Page in view, or about to be after the next flush.
+ */
+uint8_t LCD_Comp_GetPage(void)
+{
+    return s_page;
+}
+
+/**
+ * @brief Rotates pages, redraws the regions that are due and queues the
+ * changes through LCD_FB_FlushAsync().
+ * @details Only regions of the page in view are redrawn; the others wait
+ * until their page comes up. Main context only, e.g. from a scheduler timer
+ * restarted with the returned wait.
+ * @param now_ms Current time; wraps freely.
+ * @return Milliseconds until the next region or page switch is due, at most
+ * LCD_COMP_IDLE_MS; LCD_COMP_RETRY_MS while the LCD back buffer is occupied.
+ */
+uint32_t LCD_Comp_Poll(uint32_t now_ms)
+{
+    lcd_region_t *region;
+    uint32_t wait = LCD_COMP_IDLE_MS;
+    uint32_t left;
+
+    if (!s_switch && (s_dwell_ms != 0U) && (s_pages > 1U) && ((now_ms - s_since_ms) >= s_dwell_ms))
+    {
+        s_request = (uint8_t)((s_page + 1U) % s_pages);
+        s_switch = true;
+    }
+    if (s_switch)
+    {
+        s_switch = false;
+        LCD_Comp_Enter(s_request, now_ms);
+    }
+
+    LCD_FB_SelectPage(s_slot);
+    for (region = s_regions; region != NULL; region = region->next)
+    {
+        if ((region->page != s_page) || (region->period_ms == 0U))
+        {
+            continue;
+        }
+        if ((int32_t)(now_ms - region->due_ms) >= 0)
+        {
+            LCD_Comp_Draw(region);
+            region->due_ms = now_ms + region->period_ms;
+        }
+        left = region->due_ms - now_ms;
+        if (left < wait)
+        {
+            wait = left;
+        }
+    }
+    if ((s_dwell_ms != 0U) && (s_pages > 1U))
+    {
+        left = s_dwell_ms - (now_ms - s_since_ms);
+        if (left < wait)
+        {
+            wait = left;
+        }
+    }
+
+    if (s_dirty)
+    {
+        if (LCD_FB_FlushAsync(NULL, NULL) != STATUS_SUCCESS)
+        {
+            return LCD_COMP_RETRY_MS;
+        }
+        s_dirty = false;
+    }
+
+    return wait;
+}
@@ -0,0 +1,80 @@
+/**
+ ******************************************************************************
+ * @file      lcd_comp.h
+ * @brief     Screen compositor on the LCD framebuffer: regions with their own
+ * refresh period and content callback, grouped into rotating pages.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef LCD_COMP_H_
+#define LCD_COMP_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd_fb.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Pages the compositor rotates through; the first LCD_FB_PAGES of them stay
+// resident in DDRAM and come into view by display shifts
+#ifndef LCD_COMP_MAX_PAGES
+#define LCD_COMP_MAX_PAGES      4U
+#endif
+
+// Longest wait LCD_Comp_Poll() reports when nothing is scheduled
+#ifndef LCD_COMP_IDLE_MS
+#define LCD_COMP_IDLE_MS        1000U
+#endif
+
+// Wait reported while the LCD back buffer is occupied
+#define LCD_COMP_RETRY_MS       1U
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Content callback of a region.
+ * @param cells Region cells, filled with spaces beforehand.
+ * @param width Number of cells.
+ * @param param User parameter given to LCD_Comp_AddRegion().
+ */
+typedef void (*lcd_comp_draw_t)(char *cells, uint8_t width, void *param);
+
+/**
+ * @brief A rectangle of one line on one page, owned by the caller.
+ * @details Set up by LCD_Comp_AddRegion(); must stay valid while the
+ * compositor runs.
+ */
+typedef struct lcd_region
+{
+    lcd_comp_draw_t draw;
+    void *param;
+    uint32_t period_ms;          // Redraw period while its page is shown; 0 draws it only when the page comes up
+    uint32_t due_ms;             // Next redraw
+    uint8_t page;
+    uint8_t row;
+    uint8_t col;
+    uint8_t width;
+    struct lcd_region *next;
+} lcd_region_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void LCD_Comp_Init(uint8_t pages, uint32_t dwell_ms);
+void LCD_Comp_AddRegion(lcd_region_t *region, uint8_t page, uint8_t row, uint8_t col, uint8_t width,
+                        uint32_t period_ms, lcd_comp_draw_t draw, void *param);
+void LCD_Comp_ShowPage(uint8_t page);
+uint8_t LCD_Comp_GetPage(void);
+uint32_t LCD_Comp_Poll(uint32_t now_ms);
+
+#endif /* LCD_COMP_H_ */
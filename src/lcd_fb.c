@@ -0,0 +1,317 @@
+/**
+ ******************************************************************************
+ * @file      lcd_fb.c
+ * @brief     Shadow framebuffer for the 1602 LCD that only transmits
+ * the cells which changed since the last flush, with LCD_FB_PAGES screens
+ * held side by side in DDRAM.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "lcd_fb.h"
+#include "prof.h"
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// What the application wants on screen, per page
+static char s_pending[LCD_FB_PAGES][LCD_ROWS][LCD_COLS];
+
+// What the HD44780 DDRAM currently holds, per page
+static char s_shown[LCD_FB_PAGES][LCD_ROWS][LCD_COLS];
+
+static uint8_t s_draw;          // Page PutChar and friends write to
+static uint8_t s_visible;       // Page the next flush shifts into view
+static uint8_t s_shown_page;    // Page currently in view
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Finds the next dirty run on a line.
+ * @details Runs separated by a single clean cell are merged, since rewriting
+ * that cell costs the same bus time as the cursor move it saves.
+ * @param page Page to scan.
+ * @param row  Display line to scan.
+ * @param col  In: column to start scanning from. Out: first column of the run.
+ * @return Length of the run, or 0 if the rest of the line is clean.
+ */
+PERF_HOT static uint8_t LCD_FB_NextRun(uint8_t page, uint8_t row, uint8_t *col)
+{
+    const char *pending = s_pending[page][row];
+    const char *shown = s_shown[page][row];
+    uint8_t c = *col;
+    uint8_t end;
+
+    while ((c < LCD_COLS) && (pending[c] == shown[c]))
+    {
+        c++;
+    }
+    if (c >= LCD_COLS)
+    {
+        return 0;
+    }
+
+    // Extend the run over dirty cells and single clean gaps
+    *col = c;
+    end = c;
+    while (++c < LCD_COLS)
+    {
+        if (pending[c] != shown[c])
+        {
+            end = c;
+        }
+        else if ((uint8_t)(c - end) > 1U)
+        {
+            break;
+        }
+    }
+
+    return (uint8_t)(end - *col + 1U);
+}
+
+/**
+ * @brief Display shifts that bring the requested page into view.
+ * @param command Out: LCD_SHIFT_LEFT or LCD_SHIFT_RIGHT.
+ * @return Number of shifts, LCD_COLS per page crossed; 0 if already in view.
+ */
+static uint8_t LCD_FB_Shifts(uint8_t *command)
+{
+    if (s_visible >= s_shown_page)
+    {
+        *command = LCD_SHIFT_LEFT;
+        return (uint8_t)((s_visible - s_shown_page) * LCD_COLS);
+    }
+
+    *command = LCD_SHIFT_RIGHT;
+    return (uint8_t)((s_shown_page - s_visible) * LCD_COLS);
+}
+
+/**
+ * @brief Records that the pending pages are now what the controller holds
+ * and shows.
+ */
+PERF_HOT static void LCD_FB_Commit(void)
+{
+    uint8_t page, row, col;
+
+    for (page = 0; page < LCD_FB_PAGES; page++)
+    {
+        for (row = 0; row < LCD_ROWS; row++)
+        {
+            for (col = 0; col < LCD_COLS; col++)
+            {
+                s_shown[page][row][col] = s_pending[page][row][col];
+            }
+        }
+    }
+    s_shown_page = s_visible;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Initializes the framebuffer for a freshly cleared display.
+ * @details Must be called right after LCD_Init(), which leaves DDRAM filled
+ * with spaces and the display unshifted. Page 0 is drawn to and shown.
+ */
+void LCD_FB_Init(void)
+{
+    uint8_t page, row, col;
+
+    for (page = 0; page < LCD_FB_PAGES; page++)
+    {
+        for (row = 0; row < LCD_ROWS; row++)
+        {
+            for (col = 0; col < LCD_COLS; col++)
+            {
+                s_pending[page][row][col] = ' ';
+                s_shown[page][row][col] = ' ';
+            }
+        }
+    }
+    s_draw = 0;
+    s_visible = 0;
+    s_shown_page = 0;
+}
+
+/**
+ * @brief Fills the pending screen of the drawing page with spaces.
+ * @details Nothing is sent until LCD_FB_Flush() is called.
+ */
+void LCD_FB_Clear(void)
+{
+    uint8_t row, col;
+
+    for (row = 0; row < LCD_ROWS; row++)
+    {
+        for (col = 0; col < LCD_COLS; col++)
+        {
+            s_pending[s_draw][row][col] = ' ';
+        }
+    }
+}
+
+/**
+ * @brief Selects the page that LCD_FB_Clear(), LCD_FB_PutChar() and
+ * LCD_FB_WriteString() draw to.
+ * @details A hidden page is written to its own DDRAM columns, off screen,
+ * so it can be prepared while another one is shown.
+ * @param page 0..LCD_FB_PAGES-1; out-of-range pages are ignored.
+ */
+void LCD_FB_SelectPage(uint8_t page)
+{
+    if (page < LCD_FB_PAGES)
+    {
+        s_draw = page;
+    }
+}
+
+/**
+ * @brief Brings a page into view on the next flush.
+ * @details The flush shifts the display LCD_COLS cells per page crossed,
+ * one 37 us instruction each, after writing the dirty cells of every page:
+ * for a 1602 page 16 shift bytes instead of up to 32 characters and the
+ * cursor moves between them.
+ * @param page 0..LCD_FB_PAGES-1; out-of-range pages are ignored.
+ */
+void LCD_FB_ShowPage(uint8_t page)
+{
+    if (page < LCD_FB_PAGES)
+    {
+        s_visible = page;
+    }
+}
+
+/**
+ * @brief Places a character into the pending screen of the drawing page.
+ * @param row Display line (0 or 1).
+ * @param col Column (0..15). Out-of-range cells are ignored.
+ * @param c   Character to place.
+ */
+void LCD_FB_PutChar(uint8_t row, uint8_t col, char c)
+{
+    if ((row < LCD_ROWS) && (col < LCD_COLS))
+    {
+        s_pending[s_draw][row][col] = c;
+    }
+}
+
+/**
+ * @brief Writes a string into the pending screen, clipped at the end of the line.
+ * @param row Display line (0 or 1).
+ * @param col Starting column.
+ * @param str Null-terminated string.
+ */
+void LCD_FB_WriteString(uint8_t row, uint8_t col, const char *str)
+{
+    while ((*str != '\0') && (col < LCD_COLS))
+    {
+        LCD_FB_PutChar(row, col++, *str++);
+    }
+}
+
+/**
+ * @brief Sends the difference between the pending and shown screens.
+ * @details Each dirty run goes out as one batched I2C transaction through
+ * LCD_WriteBuffer(). Runs separated by a single clean cell are merged, since
+ * rewriting that cell costs the same bus time as the cursor move it saves.
+ * Then the display shifts to the page chosen by LCD_FB_ShowPage(), one
+ * command each.
+ * @return Number of I2C transactions issued (0 when the screen is unchanged).
+ */
+PERF_HOT uint8_t LCD_FB_Flush(void)
+{
+    uint8_t page, row, col, len;
+    uint8_t shifts, command;
+    uint8_t sent = 0;
+
+    PROF_BEGIN(PROF_LCD_FLUSH);
+    for (page = 0; page < LCD_FB_PAGES; page++)
+    {
+        for (row = 0; row < LCD_ROWS; row++)
+        {
+            col = 0;
+            while ((len = LCD_FB_NextRun(page, row, &col)) != 0U)
+            {
+                LCD_WriteBuffer(row, (uint8_t)((page * LCD_COLS) + col), &s_pending[page][row][col], len);
+                col += len;
+                sent++;
+            }
+        }
+    }
+    for (shifts = LCD_FB_Shifts(&command); shifts != 0U; shifts--)
+    {
+        LCD_SendCommand(command);
+        sent++;
+    }
+    LCD_FB_Commit();
+    PROF_END(PROF_LCD_FLUSH);
+
+    return sent;
+}
+
+/**
+ * @brief Composes all dirty runs into the LCD back buffer and queues it.
+ * @details Never waits for the bus: the frame goes out now if LPI2C0 is idle,
+ * or is flipped to the front from the completion interrupt otherwise. Since
+ * frames reach the display in order, the shown screen is updated as soon as
+ * the frame is queued. If the back buffer is still occupied nothing is
+ * composed and the changes stay pending for the next call. A page switch
+ * goes out in the same frame, after the cells, so a hidden page drawn in the
+ * same pass comes into view complete. Should the frame buffer refuse a run,
+ * the runs before it still go out but nothing is recorded as shown, so every
+ * change is sent again by the next call.
+ * @param callback Optional completion hook, called from interrupt context, or
+ *                 before returning when nothing changed; see LCD_FrameSend().
+ * @param param    User parameter for the hook.
+ * @return STATUS_SUCCESS when the frame was queued or nothing changed,
+ * STATUS_BUSY while both buffers are in use.
+ */
+PERF_HOT status_t LCD_FB_FlushAsync(lcd_frame_callback_t callback, void *param)
+{
+    uint8_t page, row, col, len;
+    uint8_t shifts, command;
+    status_t status;
+    bool complete = true;
+
+    if (!LCD_FrameBegin())
+    {
+        return STATUS_BUSY;
+    }
+
+    for (page = 0; page < LCD_FB_PAGES; page++)
+    {
+        for (row = 0; row < LCD_ROWS; row++)
+        {
+            col = 0;
+            while ((len = LCD_FB_NextRun(page, row, &col)) != 0U)
+            {
+                complete = complete &&
+                           LCD_FrameAppendRun(row, (uint8_t)((page * LCD_COLS) + col), &s_pending[page][row][col], len);
+                col += len;
+            }
+        }
+    }
+    for (shifts = LCD_FB_Shifts(&command); shifts != 0U; shifts--)
+    {
+        complete = complete && LCD_FrameAppendCommand(command);
+    }
+
+    status = LCD_FrameSend(callback, param);
+    if ((status == STATUS_SUCCESS) && complete)
+    {
+        LCD_FB_Commit();
+    }
+
+    return status;
+}
@@ -0,0 +1,34 @@
+/**
+ ******************************************************************************
+ * @file      lcd_fb.h
+ * @brief     Shadow framebuffer for the 1602 LCD that only transmits
+ * the cells which changed since the last flush, with LCD_FB_PAGES screens
+ * held side by side in DDRAM.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef LCD_FB_H_
+#define LCD_FB_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "lcd.h"
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void LCD_FB_Init(void);
+void LCD_FB_Clear(void);
+void LCD_FB_PutChar(uint8_t row, uint8_t col, char c);
+void LCD_FB_WriteString(uint8_t row, uint8_t col, const char *str);
+void LCD_FB_SelectPage(uint8_t page);
+void LCD_FB_ShowPage(uint8_t page);
+uint8_t LCD_FB_Flush(void);
+status_t LCD_FB_FlushAsync(lcd_frame_callback_t callback, void *param);
+
+#endif /* LCD_FB_H_ */
@@ -0,0 +1,300 @@
+/**
+ ******************************************************************************
+ * @file      lcd_glyph.c
+ * @brief     LRU cache of custom characters in the 8 HD44780 CGRAM slots,
+ * with bar-graph and double-height digit rendering into the framebuffer.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "lcd_glyph.h"
+#include "lcd_fb.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define LCD_GLYPH_EMPTY     0xFFU   // Slot id of a slot with unknown contents
+#define LCD_GLYPH_CODE_BASE 8U      // Codes 8-15 alias CGRAM 0-7 and are never a string terminator
+
+#define LCD_GLYPH_FONT_ROWS 7U      // Rows of the 5x7 digit font, doubled for two lines
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+typedef struct
+{
+    uint8_t id;                 // lcd_glyph_id_t loaded, or LCD_GLYPH_EMPTY
+    uint8_t frame;              // Frame that last asked for it; pinned while current
+    uint32_t used;              // LRU clock at the last request
+} lcd_glyph_slot_t;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static lcd_glyph_slot_t s_slots[LCD_CGRAM_SLOTS];
+
+// Current frame stamp; never 0, which marks a slot as unpinned
+static uint8_t s_frame;
+
+// Advances on every request, so the smallest stamp is the least recently used
+static uint32_t s_clock;
+
+// Digits 0-9 as in the A00 character ROM, pixels in bits 4-0
+static const uint8_t s_digit_font[10][LCD_GLYPH_FONT_ROWS] =
+{
+    { 0x0E, 0x11, 0x13, 0x15, 0x19, 0x11, 0x0E },
+    { 0x04, 0x0C, 0x04, 0x04, 0x04, 0x04, 0x0E },
+    { 0x0E, 0x11, 0x01, 0x02, 0x04, 0x08, 0x1F },
+    { 0x1F, 0x02, 0x04, 0x02, 0x01, 0x11, 0x0E },
+    { 0x02, 0x06, 0x0A, 0x12, 0x1F, 0x02, 0x02 },
+    { 0x1F, 0x10, 0x1E, 0x01, 0x01, 0x11, 0x0E },
+    { 0x06, 0x08, 0x10, 0x1E, 0x11, 0x11, 0x0E },
+    { 0x1F, 0x01, 0x02, 0x04, 0x08, 0x08, 0x08 },
+    { 0x0E, 0x11, 0x11, 0x0E, 0x11, 0x11, 0x0E },
+    { 0x0E, 0x11, 0x11, 0x0F, 0x01, 0x02, 0x0C },
+};
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Generates the CGRAM pattern of a glyph.
+ * @details Digits are the 5x7 font with every row doubled: rows 0-3 fill the
+ * upper cell, rows 4-6 the lower one, whose last two lines stay blank.
+ */
+static void LCD_Glyph_Render(lcd_glyph_id_t id, uint8_t rows[LCD_GLYPH_ROWS])
+{
+    uint8_t i, mask, first;
+    const uint8_t *font;
+
+    if (id < LCD_GLYPH_DIGIT_TOP)
+    {
+        mask = (uint8_t)((0x1FU << (LCD_GLYPH_BAR_STEPS - 1U - (uint8_t)(id - LCD_GLYPH_BAR))) & 0x1FU);
+        for (i = 0; i < LCD_GLYPH_ROWS; i++)
+        {
+            rows[i] = mask;
+        }
+        return;
+    }
+
+    if (id < LCD_GLYPH_DIGIT_BOTTOM)
+    {
+        font = s_digit_font[id - LCD_GLYPH_DIGIT_TOP];
+        first = 0;
+    }
+    else
+    {
+        font = s_digit_font[id - LCD_GLYPH_DIGIT_BOTTOM];
+        first = LCD_GLYPH_ROWS / 2U;
+    }
+    for (i = 0; i < LCD_GLYPH_ROWS; i++)
+    {
+        uint8_t src = (uint8_t)(first + (i / 2U));
+
+        rows[i] = (src < LCD_GLYPH_FONT_ROWS) ? font[src] : 0U;
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Forgets every slot; call after LCD_Init(), since CGRAM powers up
+ * with random contents.
+ */
+void LCD_Glyph_Init(void)
+{
+    uint8_t i;
+
+    for (i = 0; i < LCD_CGRAM_SLOTS; i++)
+    {
+        s_slots[i].id = LCD_GLYPH_EMPTY;
+        s_slots[i].frame = 0;
+        s_slots[i].used = 0;
+    }
+    s_frame = 1U;
+    s_clock = 0;
+}
+
+/**
+ * @brief Starts a new screen: glyphs requested from now on are pinned and
+ * the ones of the previous screen become evictable.
+ * @details A slot is rewritten as soon as it is evicted, and every cell
+ * showing its code changes with it. Each frame must therefore request every
+ * glyph still on screen, not only the ones in cells that changed.
+ */
+void LCD_Glyph_BeginFrame(void)
+{
+    uint8_t i;
+
+    if (++s_frame == 0U)
+    {
+        // Stamps wrapped: unpin everything rather than trust 256-frame-old marks
+        for (i = 0; i < LCD_CGRAM_SLOTS; i++)
+        {
+            s_slots[i].frame = 0;
+        }
+        s_frame = 1U;
+    }
+}
+
+/**
+ * @brief Returns the character code of a glyph, loading it into CGRAM on a miss.
+ * @details A hit costs nothing on the bus. A miss takes an empty slot, or the
+ * least recently used one not needed by the current frame, and uploads its 8
+ * rows in one transfer through LCD_WriteGlyph(). Main context only.
+ * @param id Glyph to show.
+ * @return Code to place in the framebuffer (8-15), or LCD_GLYPH_NONE if all
+ * slots are pinned by this frame.
+ */
+char LCD_Glyph_Get(lcd_glyph_id_t id)
+{
+    uint8_t rows[LCD_GLYPH_ROWS];
+    uint8_t i, victim = LCD_CGRAM_SLOTS;
+
+    if ((uint32_t)id >= (uint32_t)LCD_GLYPH_COUNT)
+    {
+        return LCD_GLYPH_NONE;
+    }
+
+    s_clock++;
+    for (i = 0; i < LCD_CGRAM_SLOTS; i++)
+    {
+        if (s_slots[i].id == (uint8_t)id)
+        {
+            s_slots[i].frame = s_frame;
+            s_slots[i].used = s_clock;
+            return (char)(LCD_GLYPH_CODE_BASE + i);
+        }
+        if ((s_slots[i].frame != s_frame) &&
+            ((victim == LCD_CGRAM_SLOTS) || (s_slots[i].used < s_slots[victim].used)))
+        {
+            victim = i;
+        }
+    }
+    if (victim == LCD_CGRAM_SLOTS)
+    {
+        return LCD_GLYPH_NONE;
+    }
+
+    LCD_Glyph_Render(id, rows);
+    LCD_WriteGlyph(victim, rows);
+    s_slots[victim].id = (uint8_t)id;
+    s_slots[victim].frame = s_frame;
+    s_slots[victim].used = s_clock;
+
+    return (char)(LCD_GLYPH_CODE_BASE + victim);
+}
+
+/**
+ * @brief Draws a horizontal bar of width cells into the framebuffer.
+ * @details Full cells use the ROM block, so at most one partial cell and one
+ * CGRAM slot are needed per bar.
+ * @param row   Display line.
+ * @param col   First column of the bar.
+ * @param width Bar length in cells.
+ * @param value Level to show, clamped to 0..full.
+ * @param full  Level of a completely filled bar; must be positive.
+ */
+void LCD_Glyph_BarGraph(uint8_t row, uint8_t col, uint8_t width, int32_t value, int32_t full)
+{
+    uint32_t steps, lit;
+    uint8_t i;
+    char c;
+
+    if ((full <= 0) || (width == 0U))
+    {
+        return;
+    }
+    if (value < 0)
+    {
+        value = 0;
+    }
+    if (value > full)
+    {
+        value = full;
+    }
+
+    steps = (uint32_t)width * LCD_GLYPH_BAR_STEPS;
+    lit = (uint32_t)((((uint64_t)value * steps) + ((uint32_t)full / 2U)) / (uint32_t)full);
+
+    for (i = 0; i < width; i++)
+    {
+        if (lit >= LCD_GLYPH_BAR_STEPS)
+        {
+            c = LCD_GLYPH_FULL;
+            lit -= LCD_GLYPH_BAR_STEPS;
+        }
+        else if (lit != 0U)
+        {
+            c = LCD_Glyph_Get((lcd_glyph_id_t)(LCD_GLYPH_BAR + (lit - 1U)));
+            if (c == LCD_GLYPH_NONE)
+            {
+                c = ' ';
+            }
+            lit = 0;
+        }
+        else
+        {
+            c = ' ';
+        }
+        LCD_FB_PutChar(row, (uint8_t)(col + i), c);
+    }
+}
+
+/**
+ * @brief Draws text two lines high, one column per character.
+ * @details Digits use two glyphs each, so a reading such as "-12.3" needs
+ * six slots and leaves two for other users; repeated digits share theirs.
+ * '.' sits on the lower line, '-' as '_' on the upper one near mid-height,
+ * and any other character is drawn normally on the upper line.
+ * @param col  First column.
+ * @param text Null-terminated text, clipped at the end of the line.
+ * @return Number of columns drawn.
+ */
+uint8_t LCD_Glyph_BigText(uint8_t col, const char *text)
+{
+    uint8_t start = col;
+    char top, bottom;
+
+    while ((*text != '\0') && (col < LCD_COLS))
+    {
+        top = *text;
+        bottom = ' ';
+        if ((*text >= '0') && (*text <= '9'))
+        {
+            top = LCD_Glyph_Get((lcd_glyph_id_t)(LCD_GLYPH_DIGIT_TOP + (*text - '0')));
+            bottom = LCD_Glyph_Get((lcd_glyph_id_t)(LCD_GLYPH_DIGIT_BOTTOM + (*text - '0')));
+            if ((top == LCD_GLYPH_NONE) || (bottom == LCD_GLYPH_NONE))
+            {
+                // Out of slots: fall back to the ROM digit rather than half a glyph
+                top = *text;
+                bottom = ' ';
+            }
+        }
+        else if (*text == '.')
+        {
+            top = ' ';
+            bottom = '.';
+        }
+        else if (*text == '-')
+        {
+            top = '_';
+        }
+        LCD_FB_PutChar(0, col, top);
+        LCD_FB_PutChar(1, col, bottom);
+        text++;
+        col++;
+    }
+
+    return (uint8_t)(col - start);
+}
@@ -0,0 +1,53 @@
+/**
+ ******************************************************************************
+ * @file      lcd_glyph.h
+ * @brief     LRU cache of custom characters in the 8 HD44780 CGRAM slots,
+ * with bar-graph and double-height digit rendering into the framebuffer.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef LCD_GLYPH_H_
+#define LCD_GLYPH_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "lcd.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define LCD_GLYPH_NONE      '\0'    // LCD_Glyph_Get() result when no slot can be freed
+#define LCD_GLYPH_FULL      '\xFF'  // Solid block in the HD44780 A00 character ROM
+#define LCD_GLYPH_BAR_STEPS 5U      // Bar-graph resolution per cell, one per pixel column
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Identifiers of the patterns the cache can generate.
+ */
+typedef enum
+{
+    LCD_GLYPH_BAR = 0,                          // + 0..3: left 1..4 pixel columns lit
+    LCD_GLYPH_DIGIT_TOP = LCD_GLYPH_BAR + 4,    // + 0..9: upper half of a double-height digit
+    LCD_GLYPH_DIGIT_BOTTOM = LCD_GLYPH_DIGIT_TOP + 10, // + 0..9: lower half
+    LCD_GLYPH_COUNT = LCD_GLYPH_DIGIT_BOTTOM + 10
+} lcd_glyph_id_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void LCD_Glyph_Init(void);
+void LCD_Glyph_BeginFrame(void);
+char LCD_Glyph_Get(lcd_glyph_id_t id);
+void LCD_Glyph_BarGraph(uint8_t row, uint8_t col, uint8_t width, int32_t value, int32_t full);
+uint8_t LCD_Glyph_BigText(uint8_t col, const char *text);
+
+#endif /* LCD_GLYPH_H_ */
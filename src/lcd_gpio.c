@@ -0,0 +1,128 @@
+/**
+ ******************************************************************************
+ * @file      lcd_gpio.c
+ * @brief     Parallel 4-bit HD44780 transport: RS, EN and D4-D7 driven
+ * straight from GPIO, as an alternative to the PCF8574 I2C backpack.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "lcd_gpio.h"
+#include "S32K144.h"
+#include "pin_mux.h"
+#include "lcd.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define LCD_GPIO_RS_MASK    (1UL << LCD_GPIO_RS_PIN)
+#define LCD_GPIO_EN_MASK    (1UL << LCD_GPIO_EN_PIN)
+#define LCD_GPIO_DATA_MASK  (0xFUL << LCD_GPIO_D4_PIN)
+
+// Busy-wait iterations for a time in ns, at no less than 3 cycles each and the
+// fastest core clock (HSRUN); slower run modes only wait longer
+#define LCD_GPIO_CORE_MAX_MHZ   112U
+#define LCD_GPIO_LOOPS(ns)      ((((ns) * LCD_GPIO_CORE_MAX_MHZ) / 3000U) + 1U)
+
+#define LCD_GPIO_EN_PULSE_NS    450U    // PWEH, also covers the address setup and hold times
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Set by a port write with EN high, until the write that drops it
+static bool s_port_en;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Spins for a number of LCD_GPIO_LOOPS() iterations.
+ */
+static void LCD_GPIO_Delay(uint32_t loops)
+{
+    while (loops-- != 0U)
+    {
+        __asm volatile ("nop");
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Configures the six LCD pins as outputs, all low.
+ * @details PORTD is clocked by CLOCK_DRV_Init().
+ */
+void LCD_GPIO_Init(void)
+{
+    PINS_DRV_Init(NUM_OF_CONFIGURED_PINS1, g_pin_mux_InitConfigArr1);
+    LCD_GPIO_PORT->PCOR = LCD_GPIO_RS_MASK | LCD_GPIO_EN_MASK | LCD_GPIO_DATA_MASK;
+}
+
+/**
+ * @brief Presents one nibble on D4-D7 and latches it with an EN pulse.
+ * @details Data and RS change through PCOR/PSOR while EN is low, so the
+ * intermediate state is never latched and no read-modify-write of PDOR races
+ * with other users of the port.
+ * @param nibble Value for D7-D4, in the upper four bits.
+ * @param rs_bit Register Select (0 for command, non-zero for data).
+ */
+void LCD_GPIO_WriteNibble(uint8_t nibble, uint8_t rs_bit)
+{
+    uint32_t set = ((uint32_t)(nibble >> 4) << LCD_GPIO_D4_PIN) & LCD_GPIO_DATA_MASK;
+
+    if (rs_bit != 0U)
+    {
+        set |= LCD_GPIO_RS_MASK;
+    }
+    LCD_GPIO_PORT->PCOR = (LCD_GPIO_RS_MASK | LCD_GPIO_DATA_MASK) & ~set;
+    LCD_GPIO_PORT->PSOR = set;
+
+    LCD_GPIO_PORT->PSOR = LCD_GPIO_EN_MASK;
+    LCD_GPIO_Delay(LCD_GPIO_LOOPS(LCD_GPIO_EN_PULSE_NS));
+    LCD_GPIO_PORT->PCOR = LCD_GPIO_EN_MASK;
+    LCD_GPIO_Delay(LCD_GPIO_LOOPS(LCD_GPIO_EN_PULSE_NS));
+}
+
+/**
+ * @brief Writes one byte as two nibbles and waits out its execution time.
+ * @details Without RW there is no busy flag, so every byte waits
+ * LCD_EXEC_TIME_NS; clear and home need the caller's longer delay on top.
+ * @param data   The 8-bit data byte to send.
+ * @param rs_bit Register Select (0 for command, non-zero for data).
+ */
+void LCD_GPIO_WriteByte(uint8_t data, uint8_t rs_bit)
+{
+    LCD_GPIO_WriteNibble(data & 0xF0U, rs_bit);
+    LCD_GPIO_WriteNibble((uint8_t)(data << 4), rs_bit);
+    LCD_GPIO_Delay(LCD_GPIO_LOOPS(LCD_EXEC_TIME_NS));
+}
+
+/**
+ * @brief Replays one PCF8574 port write from an lcd_seq_t table on the pins.
+ * @details A write with EN high clocks its nibble in; the following write
+ * that drops EN waits out the execution time, since a table paces bytes by
+ * bus time that the pins do not take. Pad writes do nothing.
+ * @param port Port byte, with the LCD_PCF_ bit layout.
+ */
+void LCD_GPIO_WritePort(uint8_t port)
+{
+    if ((port & LCD_PCF_EN) != 0U)
+    {
+        LCD_GPIO_WriteNibble(port & 0xF0U, port & LCD_PCF_RS);
+        s_port_en = true;
+    }
+    else if (s_port_en)
+    {
+        s_port_en = false;
+        LCD_GPIO_Delay(LCD_GPIO_LOOPS(LCD_EXEC_TIME_NS));
+    }
+}
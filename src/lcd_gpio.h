@@ -0,0 +1,38 @@
+/**
+ ******************************************************************************
+ * @file      lcd_gpio.h
+ * @brief     Parallel 4-bit HD44780 transport: RS, EN and D4-D7 driven
+ * straight from GPIO, as an alternative to the PCF8574 I2C backpack.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef LCD_GPIO_H_
+#define LCD_GPIO_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Wiring, matching g_pin_mux_InitConfigArr1 in pin_mux.c; RW is tied to GND
+#define LCD_GPIO_PORT       PTD
+#define LCD_GPIO_RS_PIN     2U
+#define LCD_GPIO_EN_PIN     3U
+#define LCD_GPIO_D4_PIN     4U      // D4-D7 on four consecutive pins from here
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void LCD_GPIO_Init(void);
+void LCD_GPIO_WriteNibble(uint8_t nibble, uint8_t rs_bit);
+void LCD_GPIO_WriteByte(uint8_t data, uint8_t rs_bit);
+void LCD_GPIO_WritePort(uint8_t port);
+
+#endif /* LCD_GPIO_H_ */
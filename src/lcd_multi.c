@@ -0,0 +1,539 @@
+/**
+ ******************************************************************************
+ * @file      lcd_multi.c
+ * @brief     Several PCF8574 HD44780 panels (1602, 2004) on LPI2C0, each with
+ * its own framebuffer, flushed together as one queued I2C transaction list.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "lcd_multi.h"
+#include <stddef.h>
+#include "osif.h"
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static lcd_panel_t *s_panels[LCD_MULTI_MAX_PANELS];
+static uint8_t s_count;
+
+// One job carries a transfer per panel; s_sent[i] is the panel of s_xfers[i]
+static i2c_job_t s_job;
+static i2c_xfer_t s_xfers[LCD_MULTI_MAX_PANELS];
+static lcd_panel_t *s_sent[LCD_MULTI_MAX_PANELS];
+static uint8_t s_sent_count;
+static volatile bool s_busy;
+
+// Completion hook of the flush on the bus, NULL for the power-up spans
+static lcd_frame_callback_t s_callback;
+static void *s_callback_param;
+
+// Offset of the next span of g_lcd_seq_init
+static uint16_t s_seq_pos;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief DDRAM address of the first cell of a line.
+ * @details The controller has two DDRAM lines; on four-line panels lines 3
+ * and 4 are the second halves of lines 1 and 2.
+ */
+static uint8_t LCD_Multi_RowDdram(const lcd_panel_t *panel, uint8_t row)
+{
+    return (uint8_t)(((row & 1U) * LCD_ROW1_DDRAM) + ((row >> 1) * panel->cols));
+}
+
+/**
+ * @brief Finds the next dirty run on a line, as LCD_FB_NextRun() does.
+ * @details While the panel is being resynced every cell counts as dirty.
+ * @param panel Panel to scan.
+ * @param row   Display line.
+ * @param col   In: column to start scanning from. Out: first column of the run.
+ * @return Length of the run, or 0 if the rest of the line is clean.
+ */
+PERF_HOT static uint8_t LCD_Multi_NextRun(const lcd_panel_t *panel, uint8_t row, uint8_t *col)
+{
+    uint8_t c = *col;
+    uint8_t end;
+
+    if (panel->resync)
+    {
+        return (c < panel->cols) ? (uint8_t)(panel->cols - c) : 0U;
+    }
+
+    while ((c < panel->cols) && (panel->pending[row][c] == panel->shown[row][c]))
+    {
+        c++;
+    }
+    if (c >= panel->cols)
+    {
+        return 0;
+    }
+
+    // Extend the run over dirty cells and single clean gaps
+    *col = c;
+    end = c;
+    while (++c < panel->cols)
+    {
+        if (panel->pending[row][c] != panel->shown[row][c])
+        {
+            end = c;
+        }
+        else if ((uint8_t)(c - end) > 1U)
+        {
+            break;
+        }
+    }
+
+    return (uint8_t)(end - *col + 1U);
+}
+
+/**
+ * @brief Packs every dirty run of a panel, each behind its DDRAM move, into
+ * the panel's byte stream.
+ * @return Length of the stream, 0 when the panel is unchanged.
+ */
+PERF_HOT static uint16_t LCD_Multi_Compose(lcd_panel_t *panel)
+{
+    uint8_t *dst = panel->bytes;
+    uint8_t row, col, len, i;
+
+    for (row = 0; row < panel->rows; row++)
+    {
+        col = 0;
+        while ((len = LCD_Multi_NextRun(panel, row, &col)) != 0U)
+        {
+            dst += LCD_PackByte(dst, (uint8_t)(LCD_SET_DDRAM_ADDR | (LCD_Multi_RowDdram(panel, row) + col)), 0);
+            for (i = 0; i < len; i++)
+            {
+                dst += LCD_PackByte(dst, (uint8_t)panel->pending[row][col + i], 1);
+            }
+            col += len;
+        }
+    }
+
+    return (uint16_t)(dst - panel->bytes);
+}
+
+/**
+ * @brief Records that the pending screen is now what the panel shows.
+ */
+static void LCD_Multi_Commit(lcd_panel_t *panel)
+{
+    uint8_t row, col;
+
+    for (row = 0; row < panel->rows; row++)
+    {
+        for (col = 0; col < panel->cols; col++)
+        {
+            panel->shown[row][col] = panel->pending[row][col];
+        }
+    }
+    panel->resync = false;
+}
+
+/**
+ * @brief Queue completion of the transaction list, in interrupt context.
+ * @details The queue ends a list at its first failing descriptor, which
+ * job.index still names. That panel and every later one may show anything,
+ * so they are resynced; one whose address was not acknowledged is also
+ * taken offline until the next LCD_Multi_InitBegin().
+ */
+static void LCD_Multi_Done(status_t status, void *param)
+{
+    uint8_t i;
+
+    (void)param;
+
+    if (status != STATUS_SUCCESS)
+    {
+        for (i = s_job.index; i < s_sent_count; i++)
+        {
+            s_sent[i]->resync = true;
+        }
+        if ((status == STATUS_I2C_RECEIVED_NACK) && (s_job.index < s_sent_count))
+        {
+            s_sent[s_job.index]->online = false;
+        }
+    }
+
+    s_busy = false;
+    if (s_callback != NULL)
+    {
+        s_callback(status, s_callback_param);
+    }
+}
+
+/**
+ * @brief Queues the s_sent_count descriptors as one job.
+ * @details Every descriptor but the last ends in a repeated START, so the
+ * list holds the bus from the first panel to the last.
+ */
+static status_t LCD_Multi_Submit(void)
+{
+    status_t status;
+    uint8_t i;
+
+    for (i = 0; i < s_sent_count; i++)
+    {
+        s_xfers[i].rx_buf = NULL;
+        s_xfers[i].rx_size = 0;
+        s_xfers[i].send_stop = (i == (s_sent_count - 1U));
+    }
+
+    // Set first: a start the queue refuses completes from inside the call
+    s_busy = true;
+    status = I2C_Queue_Submit(&s_job, s_xfers, s_sent_count, LCD_Multi_Done, NULL);
+    if (status != STATUS_SUCCESS)
+    {
+        s_busy = false;
+    }
+
+    return status;
+}
+
+/**
+ * @brief Waits for the transaction list on the bus, withdrawing it if it
+ * stops moving, as the waits in lcd.c do.
+ */
+static void LCD_Multi_Wait(void)
+{
+    uint32_t mark = OSIF_GetMilliseconds();
+
+    while (s_busy)
+    {
+        if ((OSIF_GetMilliseconds() - mark) >= LCD_QUEUE_STALL_MS)
+        {
+            (void)I2C_Queue_CheckStall();
+            mark = OSIF_GetMilliseconds();
+        }
+    }
+}
+
+/**
+ * @brief Sends one span of the power-up sequence to every online panel.
+ * @details The descriptors share the flash table, so the span costs one
+ * address byte per panel on top of the bytes themselves.
+ */
+static void LCD_Multi_SendSpan(const uint8_t *bytes, uint16_t len)
+{
+    uint8_t i;
+
+    LCD_Multi_Wait();
+    s_sent_count = 0;
+    for (i = 0; i < s_count; i++)
+    {
+        if (s_panels[i]->online)
+        {
+            s_xfers[s_sent_count].address = s_panels[i]->address;
+            s_xfers[s_sent_count].tx_buf = bytes;
+            s_xfers[s_sent_count].tx_size = len;
+            s_sent[s_sent_count++] = s_panels[i];
+        }
+    }
+    if (s_sent_count != 0U)
+    {
+        s_callback = NULL;
+        (void)LCD_Multi_Submit();
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Sets up a panel with a blank screen.
+ * @param panel   Caller-owned storage.
+ * @param address 7-bit address of its PCF8574 backpack.
+ * @param rows    Lines, e.g. 2 for a 1602 or 4 for a 2004; at most LCD_MULTI_MAX_ROWS.
+ * @param cols    Columns, e.g. 16 or 20; at most LCD_MULTI_MAX_COLS.
+ */
+void LCD_Multi_PanelInit(lcd_panel_t *panel, uint16_t address, uint8_t rows, uint8_t cols)
+{
+    uint8_t row, col;
+
+    panel->address = address;
+    panel->rows = (rows > LCD_MULTI_MAX_ROWS) ? LCD_MULTI_MAX_ROWS : rows;
+    panel->cols = (cols > LCD_MULTI_MAX_COLS) ? LCD_MULTI_MAX_COLS : cols;
+    for (row = 0; row < LCD_MULTI_MAX_ROWS; row++)
+    {
+        for (col = 0; col < LCD_MULTI_MAX_COLS; col++)
+        {
+            panel->pending[row][col] = ' ';
+            panel->shown[row][col] = ' ';
+        }
+    }
+    panel->online = false;
+    panel->resync = false;
+}
+
+/**
+ * @brief Adds a panel to the ones brought up and flushed together.
+ * @details Attach every panel before LCD_Multi_InitBegin(); a panel stays
+ * offline until then. Main context only.
+ * @return STATUS_SUCCESS, or STATUS_ERROR when LCD_MULTI_MAX_PANELS are
+ * already attached.
+ */
+status_t LCD_Multi_Attach(lcd_panel_t *panel)
+{
+    if (s_count >= LCD_MULTI_MAX_PANELS)
+    {
+        return STATUS_ERROR;
+    }
+
+    s_panels[s_count++] = panel;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Restarts the power-up sequence on every attached panel; follow with
+ * LCD_Multi_InitStep().
+ * @details Every panel is put back online and counted as blank, so what is
+ * pending is drawn again by the first flush after the sequence. Also the way
+ * to bring back a panel that went offline. Call LCD_SetBusRate() first, as
+ * the panels share its padding.
+ */
+void LCD_Multi_InitBegin(void)
+{
+    uint8_t i, row, col;
+
+    LCD_Multi_Wait();
+    for (i = 0; i < s_count; i++)
+    {
+        for (row = 0; row < LCD_MULTI_MAX_ROWS; row++)
+        {
+            for (col = 0; col < LCD_MULTI_MAX_COLS; col++)
+            {
+                s_panels[i]->shown[row][col] = ' ';
+            }
+        }
+        s_panels[i]->online = true;
+        s_panels[i]->resync = false;
+    }
+    s_seq_pos = 0;
+}
+
+/**
+ * @brief Runs the next step of the power-up sequence on all panels at once.
+ * @details Plays g_lcd_seq_init as LCD_InitStep() does, each span going to
+ * every panel in one transaction list, so the sequence takes as long for
+ * several panels as for one. A panel that does not acknowledge drops out.
+ * @return Milliseconds to wait before the next call, or LCD_INIT_DONE once
+ * the panels are ready for flushes and LCD_Multi_IsOnline() is final.
+ */
+uint32_t LCD_Multi_InitStep(void)
+{
+    const uint8_t *bytes = g_lcd_seq_init.bytes;
+    uint16_t len = g_lcd_seq_init.len;
+    uint16_t start;
+    uint8_t mark, delay;
+
+    if (s_seq_pos >= len)
+    {
+        LCD_Multi_Wait();
+        return LCD_INIT_DONE;
+    }
+
+    for (;;)
+    {
+        start = s_seq_pos;
+        while ((s_seq_pos < len) && ((bytes[s_seq_pos] & LCD_PCF_BL) != 0U))
+        {
+            s_seq_pos++;
+        }
+        if (s_seq_pos != start)
+        {
+            LCD_Multi_SendSpan(&bytes[start], (uint16_t)(s_seq_pos - start));
+        }
+
+        if (s_seq_pos >= len)
+        {
+            return 0U;
+        }
+
+        // A marker is always followed by its delay
+        mark = bytes[s_seq_pos];
+        delay = bytes[s_seq_pos + 1U];
+        s_seq_pos += 2U;
+        if (mark != LCD_SEQ_MARK_US)
+        {
+            return delay;
+        }
+
+        LCD_Multi_Wait();
+        OSIF_TimeDelayUs(delay);
+        if (s_seq_pos >= len)
+        {
+            return 0U;
+        }
+    }
+}
+
+/**
+ * @brief Brings every attached panel up.
+ * @details Blocking wrapper around LCD_Multi_InitBegin()/LCD_Multi_InitStep().
+ */
+void LCD_Multi_Init(void)
+{
+    uint32_t delay_ms;
+
+    LCD_Multi_InitBegin();
+    for (delay_ms = LCD_Multi_InitStep(); delay_ms != LCD_INIT_DONE; delay_ms = LCD_Multi_InitStep())
+    {
+        OSIF_TimeDelay(delay_ms);
+    }
+}
+
+/**
+ * @brief Fills the pending screen of a panel with spaces.
+ */
+void LCD_Multi_Clear(lcd_panel_t *panel)
+{
+    uint8_t row, col;
+
+    for (row = 0; row < panel->rows; row++)
+    {
+        for (col = 0; col < panel->cols; col++)
+        {
+            panel->pending[row][col] = ' ';
+        }
+    }
+}
+
+/**
+ * @brief Places a character into the pending screen of a panel.
+ * @details Out-of-range cells are ignored.
+ */
+void LCD_Multi_PutChar(lcd_panel_t *panel, uint8_t row, uint8_t col, char c)
+{
+    if ((row < panel->rows) && (col < panel->cols))
+    {
+        panel->pending[row][col] = c;
+    }
+}
+
+/**
+ * @brief Writes a string into the pending screen of a panel, clipped at the
+ * end of the line.
+ */
+void LCD_Multi_WriteString(lcd_panel_t *panel, uint8_t row, uint8_t col, const char *str)
+{
+    while ((*str != '\0') && (col < panel->cols))
+    {
+        LCD_Multi_PutChar(panel, row, col++, *str++);
+    }
+}
+
+/**
+ * @brief Copies the pending screen of one panel onto another.
+ * @details Only the area both panels have is copied, so a 1602 mirrored
+ * onto a 2004 fills its top-left corner and leaves the rest to the caller.
+ */
+void LCD_Multi_Mirror(lcd_panel_t *dst, const lcd_panel_t *src)
+{
+    uint8_t rows = (dst->rows < src->rows) ? dst->rows : src->rows;
+    uint8_t cols = (dst->cols < src->cols) ? dst->cols : src->cols;
+    uint8_t row, col;
+
+    for (row = 0; row < rows; row++)
+    {
+        for (col = 0; col < cols; col++)
+        {
+            dst->pending[row][col] = src->pending[row][col];
+        }
+    }
+}
+
+/**
+ * @brief Composes the dirty runs of every online panel and queues them as
+ * one transaction list.
+ * @details Each changed panel gets one descriptor holding all of its runs,
+ * joined to the next by a repeated START, so a flush costs one job however
+ * many panels changed and never waits for the bus. What the panels show is
+ * recorded once the list is queued, as with LCD_FB_FlushAsync(); a failed
+ * list marks the affected panels for a full redraw on the next flush.
+ * @param callback Optional completion hook, called from interrupt context.
+ * @param param    User parameter for the hook.
+ * @return STATUS_SUCCESS when the list was queued or nothing changed,
+ * STATUS_BUSY while the previous list is still on the bus, or the error of
+ * I2C_Queue_Submit().
+ */
+PERF_HOT status_t LCD_Multi_FlushAsync(lcd_frame_callback_t callback, void *param)
+{
+    status_t status;
+    uint16_t len;
+    uint8_t i;
+
+    if (s_busy)
+    {
+        return STATUS_BUSY;
+    }
+
+    s_sent_count = 0;
+    for (i = 0; i < s_count; i++)
+    {
+        if (!s_panels[i]->online)
+        {
+            continue;
+        }
+        len = LCD_Multi_Compose(s_panels[i]);
+        if (len != 0U)
+        {
+            s_xfers[s_sent_count].address = s_panels[i]->address;
+            s_xfers[s_sent_count].tx_buf = s_panels[i]->bytes;
+            s_xfers[s_sent_count].tx_size = len;
+            s_sent[s_sent_count++] = s_panels[i];
+        }
+    }
+    if (s_sent_count == 0U)
+    {
+        return STATUS_SUCCESS;
+    }
+
+    // Before the submission, whose completion may already mark a failure
+    for (i = 0; i < s_sent_count; i++)
+    {
+        LCD_Multi_Commit(s_sent[i]);
+    }
+
+    s_callback = callback;
+    s_callback_param = param;
+    status = LCD_Multi_Submit();
+    if (status != STATUS_SUCCESS)
+    {
+        for (i = 0; i < s_sent_count; i++)
+        {
+            s_sent[i]->resync = true;
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief Reports whether a transaction list is still on the bus.
+ */
+bool LCD_Multi_IsBusy(void)
+{
+    return s_busy;
+}
+
+/**
+ * @brief Reports whether a panel acknowledged its last transfer.
+ * @details An offline panel is left out of every flush until the next
+ * LCD_Multi_InitBegin().
+ */
+bool LCD_Multi_IsOnline(const lcd_panel_t *panel)
+{
+    return panel->online;
+}
@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ * @file      lcd_multi.h
+ * @brief     Several PCF8574 HD44780 panels (1602, 2004) on LPI2C0, each with
+ * its own framebuffer, flushed together as one queued I2C transaction list.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef LCD_MULTI_H_
+#define LCD_MULTI_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "lcd.h"
+#include "i2c_queue.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Panels attached at once; one I2C descriptor each
+#ifndef LCD_MULTI_MAX_PANELS
+#define LCD_MULTI_MAX_PANELS    4U
+#endif
+
+// Largest supported geometry, a 2004 module; a 1602 uses the top-left corner
+#define LCD_MULTI_MAX_ROWS      4U
+#define LCD_MULTI_MAX_COLS      20U
+
+// Worst-case frame of one panel, as LCD_FRAME_MAX_BYTES
+#define LCD_MULTI_FRAME_MAX_BYTES (LCD_MULTI_MAX_ROWS * (LCD_MULTI_MAX_COLS + (LCD_MULTI_MAX_COLS / 2U)) * LCD_MAX_BYTES_PER_CHAR)
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief One display: its backpack address, geometry and framebuffers.
+ * @details Owned by the caller and set up with LCD_Multi_PanelInit(). The
+ * byte stream belongs to the I2C queue while LCD_Multi_IsBusy().
+ */
+typedef struct
+{
+    uint16_t address;            // 7-bit PCF8574 address
+    uint8_t rows;
+    uint8_t cols;
+    char pending[LCD_MULTI_MAX_ROWS][LCD_MULTI_MAX_COLS];   // What the application wants on screen
+    char shown[LCD_MULTI_MAX_ROWS][LCD_MULTI_MAX_COLS];     // What the controller is showing
+    uint8_t bytes[LCD_MULTI_FRAME_MAX_BYTES];
+    volatile bool online;        // Cleared when its address is not acknowledged
+    volatile bool resync;        // shown is not trusted: every cell goes out on the next flush
+} lcd_panel_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void LCD_Multi_PanelInit(lcd_panel_t *panel, uint16_t address, uint8_t rows, uint8_t cols);
+status_t LCD_Multi_Attach(lcd_panel_t *panel);
+void LCD_Multi_InitBegin(void);
+uint32_t LCD_Multi_InitStep(void);
+void LCD_Multi_Init(void);
+
+void LCD_Multi_Clear(lcd_panel_t *panel);
+void LCD_Multi_PutChar(lcd_panel_t *panel, uint8_t row, uint8_t col, char c);
+void LCD_Multi_WriteString(lcd_panel_t *panel, uint8_t row, uint8_t col, const char *str);
+void LCD_Multi_Mirror(lcd_panel_t *dst, const lcd_panel_t *src);
+
+status_t LCD_Multi_FlushAsync(lcd_frame_callback_t callback, void *param);
+bool LCD_Multi_IsBusy(void);
+bool LCD_Multi_IsOnline(const lcd_panel_t *panel);
+
+#endif /* LCD_MULTI_H_ */
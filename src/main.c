@@ -14,27 +14,153 @@
 #include "S32K144.h"
 #include "peripherals_lpi2c_config_1.h"
 #include "clock_config.h"	// clockMan1_InitConfig0
-#include "pin_mux.h"		// NUM_OF_CONFIGURED_PINS0
+#include "board_fixed.h"    // Straight-line pin mux of the fixed board layout
 #include "lpi2c_driver.h"   // LPI2C low-level driver
-#include "adc_driver.h"     // ADC driver
-#include "osif.h"           // OS Interface for OSIF_TimeDelay()
-#include "stdio.h"          // Standard I/O for sprintf()
+#include "adc_sampler.h"    // PDB-paced ADC sampling
+#include "sensor_lm35.h"    // LM35 behind the sensor interface
+#include "temp_cal.h"       // Per-board calibration lookup table
+#include "lcd_fb.h"         // HD44780 driver and shadow framebuffer
+#include "lcd_glyph.h"      // CGRAM glyph cache, bar graph and large digits
+#include "fmt.h"            // Allocation-free number formatting
+#include "refresh.h"        // Change-threshold, rate-limited display refresh
+#include "sched.h"          // Cooperative event scheduler
+#include "prof.h"           // DWT cycle profiling
+#include "i2c_speed.h"      // Start-up I2C bus-speed negotiation
+#include "i2c_queue.h"      // Asynchronous LPI2C0 transactions
+#include "i2c_meter.h"      // LPI2C0 bus utilization
+#include "power.h"          // HSRUN/RUN/VLPR run-mode switching
+#include "clock_gate.h"     // Reference-counted peripheral clocks
+#include "dma_alloc.h"      // Run-time eDMA channel allocation
+#include "irq_prio.h"       // Interrupt priority plan
+#include "datalog.h"        // Flash-backed temperature log
+#include "telemetry.h"      // Binary sample stream over LPUART1
+#include "can_node.h"       // Periodic CAN status frames
+#include "i2c_slave.h"      // Register-mapped I2C slave mode
+#include "agg.h"            // Sliding-window statistics
+#include "bandgap.h"        // Bandgap supply compensation
+#include "i2c_recover.h"    // Background LPI2C0 bus recovery
+#include "mem_prof.h"       // Stack high-water mark
+#include "deadline.h"       // Handler cycle budgets and the watchdog
+#include "wake_mon.h"       // LPTMR-triggered compare window in VLPS
+#include "perf_cfg.h"       // Code cache and flash prefetch
+#include "boot_cfg.h"       // Field tunables from D-Flash
+#include "osif.h"           // OSIF_GetMilliseconds() for the refresh policy
 
 /*============================================================================*/
 /* Defines                                   */
 /*============================================================================*/
 
-// HD44780 LCD Controller Commands
-#define LCD_CLEAR_DISPLAY   0x01
-#define LCD_RETURN_HOME     0x02
-#define LCD_ENTRY_MODE_SET  0x04
-#define LCD_DISPLAY_CONTROL 0x08
-#define LCD_FUNCTION_SET    0x20
-#define LCD_SET_DDRAM_ADDR  0x80
-
-// Application-specific constants for better readability
-#define ADC_VREF_MV         5000.0f  // V-Reference for ADC in millivolts (5V)
-#define ADC_MAX_VALUE       4095.0f  // Max value for a 12-bit ADC
+// Temperature of a full bar graph, in 0.1 C steps; 10 cells give 1 C per pixel column
+#define APP_BAR_FULL_C10    500
+
+// One logged reading per interval; a 15-record page then goes to flash every 15 s
+#define APP_LOG_INTERVAL_MS 1000U
+
+// Set to 1 to broadcast status frames on CAN; the CAN clock needs the
+// crystal, so the node then idles in RUN instead of VLPR
+#ifndef APP_CAN_NODE
+#define APP_CAN_NODE        0
+#endif
+
+#define APP_CAN_PERIOD_MS   100U
+
+// One latency histogram slice goes out over telemetry this often, so the
+// whole set repeats every PROF_HIST_COUNT * 4 slices; 0 sends none
+#ifndef APP_HIST_FRAME_MS
+#define APP_HIST_FRAME_MS   250U
+#endif
+
+#define APP_HIST_SLICES     (PROF_HIST_BUCKETS / TELEMETRY_HIST_BUCKETS)
+
+// Length of one LPI2C0 utilization window, see I2C_Meter_Get(); 0 leaves
+// the meter off
+#ifndef APP_I2C_METER_MS
+#define APP_I2C_METER_MS    1000U
+#endif
+
+// eDMA priority of the LCD frames: below the ADC stream, above telemetry
+#define APP_I2C_DMA_PRIO    8U
+
+// Set to 1 to answer a host as an I2C slave on LPI2C0; the LCD then needs
+// the parallel transport, since LPI2C0 can no longer drive it
+#ifndef APP_I2C_SLAVE
+#define APP_I2C_SLAVE       0
+#endif
+
+#if APP_I2C_SLAVE && (LCD_TRANSPORT != LCD_TRANSPORT_GPIO)
+#error "APP_I2C_SLAVE takes over LPI2C0; build with LCD_TRANSPORT=LCD_TRANSPORT_GPIO"
+#endif
+
+// ADC blocks per wake-up; above 1 (up to ADC_STREAM_MAX_BATCH) the eDMA
+// chains the blocks by itself and the CPU only sees every batch
+#ifndef APP_ADC_BATCH
+#define APP_ADC_BATCH       1U
+#endif
+
+// One ADC block in this many measures the bandgap instead of the LM35, about
+// every 8 s at 500 Hz; 0 leaves readings relative to the nominal reference.
+// The input switch needs a wake-up between every two blocks
+#ifndef APP_VREF_COMP_BLOCKS
+#if APP_ADC_BATCH > 1U
+#define APP_VREF_COMP_BLOCKS 0U
+#else
+#define APP_VREF_COMP_BLOCKS 64U
+#endif
+#endif
+
+#if (APP_ADC_BATCH > 1U) && (APP_VREF_COMP_BLOCKS != 0U)
+#error "APP_VREF_COMP_BLOCKS needs APP_ADC_BATCH 1"
+#endif
+
+// Set to 0 to leave the watchdog off and the handlers untimed
+#ifndef APP_DEADLINES
+#define APP_DEADLINES       1
+#endif
+
+// Cycle budgets of the scheduled handlers, see Deadline_Watch(). The
+// conversion includes a Datalog page write every 15 s; a sector erase when
+// the log wraps overruns it once, which costs one withheld refresh. The
+// display budget is a frame as Benchmark_FLASH's lcd_frame times it, with
+// headroom for the policy and a full-screen diff; it only holds because
+// the handler stays in one run mode, see App_UpdateDisplay()
+#define APP_BUDGET_CONVERT  200000U
+#define APP_BUDGET_DISPLAY  40000U
+#define APP_BUDGET_LCD_INIT 20000U
+#define APP_BUDGET_DEFAULT  100000U  // Every other handler
+
+// Set to 1 to leave the PDB stream off and convert once per APP_WAKE_PERIOD_MS
+// from LPTMR0 with the core in VLPS; it is only woken, and the LCD redrawn,
+// while the reading is outside APP_WAKE_LOW_C10 .. APP_WAKE_HIGH_C10 and for
+// the first one back inside. Readings are neither filtered nor supply-corrected
+#ifndef APP_WAKE_ON_THRESHOLD
+#define APP_WAKE_ON_THRESHOLD 0
+#endif
+#define APP_WAKE_PERIOD_MS  1000U
+#define APP_WAKE_LOW_C10    150
+#define APP_WAKE_HIGH_C10   350
+
+#if APP_WAKE_ON_THRESHOLD && (APP_CAN_NODE || APP_I2C_SLAVE)
+#error "APP_WAKE_ON_THRESHOLD stops the bus clock; build without APP_CAN_NODE and APP_I2C_SLAVE"
+#endif
+
+// Software oversampling of the LM35 blocks, and the conversions behind each
+// block result: 4^bits per block, APP_ADC_BATCH blocks per wake-up
+#define APP_OVERSAMPLE_BITS 3U
+#define APP_BLOCK_SAMPLES   ((1UL << (2U * APP_OVERSAMPLE_BITS)) * APP_ADC_BATCH)
+
+// Anomaly stage on the block results: an LM35 in air cannot move faster than
+// 2.0 C/s, so a larger jump is a glitch for up to 3 blocks in a row, and a
+// smoothed slope beyond 1.0 C/min flags a trend, cleared below half of that
+#define APP_MAX_SLEW_C10_S  20U
+#define APP_MAX_REJECTS     3U
+#define APP_TREND_C10_MIN   10U
+#define APP_TREND_SHIFT     7U    // Slope averaged over about 128 blocks, 16 s
+
+#if APP_CAN_NODE
+#define APP_IDLE_PROFILE    POWER_PROFILE_RUN
+#else
+#define APP_IDLE_PROFILE    POWER_PROFILE_VLPR
+#endif
 
 /*============================================================================*/
 /* Global Variables                                */
@@ -44,19 +170,200 @@
 lpi2c_master_state_t g_lpi2c0MasterState;
 
 // Global variables to hold sensor data
-int    g_temperature_celsius; // Use integer for precision
-uint16_t g_adc_result;
+int    g_temperature_celsius; // In 0.1 C steps
+uint32_t g_adc_result; // Latest filtered ADC block, as read from s_sensor
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Tunables of a unit without a configuration record in D-Flash:
+// - the LCD backpack at 39 on a bus negotiated from 400 kHz up to 1 MHz,
+//   and the 5 V reference the conversion assumes
+// - short 12-bit conversions with 8x hardware averaging each at 500 Hz
+// - redraws within 0.25 s of a 0.2 C change, and at least every 5 s;
+//   sampling runs much faster, so jitter below the band never reaches the bus
+static const boot_cfg_t s_boot_defaults =
+{
+    .magic = BOOT_CFG_MAGIC,
+    .version = BOOT_CFG_VERSION,
+    .size = (uint16_t)sizeof(boot_cfg_t),
+    .i2c_baud_hz = 400000U,
+    .i2c_max_hz = 1000000U,
+    .lcd_address = 39U,
+    .vref_mv = TEMP_ADC_VREF_MV,
+    .sample_rate_hz = SAMPLER_RATE_HZ,
+    .hw_avg_enable = 1U,
+    .hw_average = (uint8_t)ADC_AVERAGE_8,
+    .converter = (uint8_t)BOOT_CFG_CONV_FAST,
+    .refresh =
+    {
+        .hysteresis = 2,
+        .min_interval_ms = 250U,
+        .max_age_ms = 5000U,
+    },
+};
+
+// Configuration in force: the D-Flash record, or s_boot_defaults
+static const boot_cfg_t *s_boot_cfg = &s_boot_defaults;
+
+// Converter profiles in boot_cfg_converter_t order
+static const sampler_converter_t *const s_boot_converters[BOOT_CFG_CONV_COUNT] =
+{
+    &g_sampler_conv_precise,
+    &g_sampler_conv_fast,
+    &g_sampler_conv_fast_10bit,
+};
+
+// Conversions as s_boot_cfg selects, then 64 results decimated to 15 bits;
+// with a short converter the ADC is awake for a fraction of each period
+static sampler_profile_t s_adc_profile =
+{
+    .oversample_bits = APP_OVERSAMPLE_BITS,
+};
+
+// Limits of the anomaly stage in decimated counts per block result, for
+// the block period of the configured rate
+static anomaly_config_t s_anomaly_config =
+{
+    .max_rejects = APP_MAX_REJECTS,
+    .slope_shift = APP_TREND_SHIFT,
+};
+
+// Posted by the sensor's interrupt when a block is rejected or a trend starts or ends
+static sched_event_t s_anomaly_event;
+
+// The LM35 on ADC0: PDB0-paced, APP_ADC_BATCH blocks per wake-up, with
+// bandgap compensation and the block results screened for glitches and
+// smoothed before the display; the rate comes from s_boot_cfg
+static sensor_lm35_config_t s_lm35_config =
+{
+    .channel = ADC_INPUTCHAN_EXT12,    // Corresponds to your configured ADC pin
+    .batch = APP_ADC_BATCH,
+    .vref_comp_blocks = APP_VREF_COMP_BLOCKS,
+    .profile = &s_adc_profile,
+    .alpha_q15 = FILTER_IIR_ALPHA(0.25),
+    .anomaly = &s_anomaly_config,
+    .anomaly_event = &s_anomaly_event,
+};
+static sensor_lm35_t s_lm35 = { .cfg = &s_lm35_config };
+static sensor_t s_sensor;
+
+// Posted by the sensor's interrupt for every queued batch
+static sched_event_t s_adc_event;
+
+#if APP_WAKE_ON_THRESHOLD
+// Latest reading from the wake monitor, converted by s_adc_event
+static volatile uint16_t s_wake_raw;
+#endif
+
+// Paces the display as s_boot_cfg->refresh sets
+static refresh_policy_t s_refresh;
+
+// Fires when a rate-capped change or the max age becomes due
+static sched_timer_t s_display_timer;
+
+// Paces the LCD power-up sequence one step at a time
+static sched_timer_t s_lcd_init_timer;
+
+// Timestamp of the first reading change not yet on screen, for PROF_HIST_VALUE_TO_LCD
+static uint32_t s_change_ts;
+static bool s_change_pending;
+
+// The same, handed to each frame in flight; the LCD has at most two
+static uint32_t s_frame_ts[2];
+static uint8_t s_frame_slot;
+
+#if APP_HIST_FRAME_MS
+// Sends the next histogram slice, cycling through all of them
+static sched_timer_t s_hist_timer;
+static uint8_t s_hist_slice;
+#endif
+
+// Set once the static text is out; the first reading is shown as soon as both are there
+static bool s_lcd_ready;
+static bool s_have_reading;
+
+// Trend marker next to the unit: '+' rising, '-' falling, blank when steady
+static char s_trend_char = ' ';
+
+#if !APP_I2C_SLAVE
+// LPI2C0 master setup with its allocated eDMA channel, kept for bus recovery
+static lpi2c_master_user_config_t s_i2c_config;
+
+#if APP_I2C_METER_MS
+// Closes one bus utilization window per period
+static sched_timer_t s_i2c_meter_timer;
+#endif
+#endif
+
+// Devices on LPI2C0 (the LCD backpack) and the SCL rates tried for them,
+// slowest first, as s_boot_cfg sets them
+static uint16_t s_i2c_devices[1];
+static uint32_t s_i2c_rates[2];
+static uint8_t s_i2c_rate_count;
+
+// Re-paces PDB0 whenever a profile switch changes the bus clock
+static power_client_t s_power_sampler;
+
+// Time of the last logged reading
+static uint32_t s_log_ms;
+
+// Statistics of the reading over the last minute in 1 s buckets and the
+// last hour in 1 min buckets, for the per-minute and per-hour reports;
+// Agg_Init() clears the slots, so start-up does not
+static PERF_NOINIT agg_slot_t s_stats_minute_slots[60];
+static agg_window_t s_stats_minute;
+static PERF_NOINIT agg_slot_t s_stats_hour_slots[60];
+static agg_window_t s_stats_hour;
+
+#if APP_CAN_NODE
+// Node 1 on the sensor bus, alarms outside 5.0 .. 60.0 C with 1.0 C hysteresis
+static const can_node_config_t s_can_config =
+{
+    .node_id = 1U,
+    .alarm_high = 600,
+    .alarm_low = 50,
+    .hysteresis = 10,
+};
+
+// Paces the status frames
+static sched_timer_t s_can_timer;
+#endif
 
 /*============================================================================*/
 /* Private Function Prototypes                         */
 /*============================================================================*/
 
 void WDOG_disable(void);
-void LCD_SendByte(uint8_t data, uint8_t rs_bit);
-void LCD_SendCommand(uint8_t command);
-void LCD_SendData(uint8_t data);
-void LCD_SendString(char *str);
-void LCD_Init(void);
+static void App_SensorReady(sensor_t *sensor, void *param);
+#if APP_WAKE_ON_THRESHOLD
+static void App_WakeReading(uint16_t raw, bool in_range, void *param);
+static void App_WakeConvert(void *param);
+static void App_Idle(void);
+#else
+static void App_ConvertTemperature(void *param);
+#endif
+static status_t App_UpdateDisplay(void);
+static void App_Refresh(void *param);
+static void App_LogSample(uint32_t now_ms);
+static void App_LcdInitStep(void *param);
+static void App_ApplyBootCfg(void);
+static void App_Anomaly(void *param);
+static void App_FrameDone(status_t status, void *param);
+#if APP_HIST_FRAME_MS
+static void App_SendHistogram(void *param);
+#endif
+#if !APP_I2C_SLAVE
+static void App_I2cRecovered(void *param);
+#if APP_I2C_METER_MS
+static void App_I2cMeter(void *param);
+#endif
+#endif
+static void App_PowerChanged(power_profile_t profile, void *param);
+#if APP_CAN_NODE
+static void App_CanPublish(void *param);
+#endif
 
 /*============================================================================*/
 /* Main Function                                  */
@@ -64,63 +371,149 @@ void LCD_Init(void);
 
 int main(void)
 {
-    // Buffer to hold the formatted temperature string
-    char temp_string[16];
+#if !APP_I2C_SLAVE
+    uint32_t i2c_rate_hz;
+#endif
 
     /*--------------------------------------------------*/
     /* 1. One-Time System Initialization       */
     /*--------------------------------------------------*/
     WDOG_disable();
-    CLOCK_DRV_Init(&clockMan1_InitConfig0);
-    PINS_DRV_Init(NUM_OF_CONFIGURED_PINS0, g_pin_mux_InitConfigArr0);
-
-    // Initialize LPI2C0 in master mode
-    LPI2C_DRV_MasterInit(INST_LPI2C0, &lpi2c0_MasterConfig0, &g_lpi2c0MasterState);
 
-    // Initialize the LCD display
-    LCD_Init();
+    // Paint the stack before anything runs on it, for MemProf_Get()
+    MemProf_Init();
+    PerfCfg_Init();
+    CLOCK_DRV_Init(&clockMan1_InitConfig0);
 
-    // --- ADC Initialization Block ---
-    adc_chan_config_t adc_channel_config;
-    ADC_DRV_InitChanStruct(&adc_channel_config);
-    adc_channel_config.channel = ADC_INPUTCHAN_EXT12; // Corresponds to your configured ADC pin
+    // Field tunables, checked in place in D-Flash, before anything they configure is set up
+    s_boot_cfg = BootCfg_Load(&s_boot_defaults);
+    App_ApplyBootCfg();
+
+    // Sampling preempts DMA, DMA preempts I2C, and the tick yields to all of them
+    IRQ_Prio_Init();
+    Power_Init();
+    Power_Register(&s_power_sampler, App_PowerChanged, NULL);
+
+    // Still in RUN, so an empty log can be created; without a log the app runs on
+    (void)Datalog_Init();
+
+    // This board's correction table from D-Flash, or the nominal LM35 scale without one
+    (void)TempCal_Init();
+
+    // From here on LPI2C0, ADC0, PDB0 and the eDMA only run while someone holds them
+    ClockGate_Init();
+    BoardFixed_InitPins();
+    Prof_Init();
+
+    // Start the scheduler tick before anything can post to it
+    Sched_Init();
+#if APP_WAKE_ON_THRESHOLD
+    Sched_EventInit(&s_adc_event, App_WakeConvert, NULL);
+#else
+    Sched_EventInit(&s_adc_event, App_ConvertTemperature, NULL);
+#endif
+    Sched_TimerInit(&s_display_timer, App_Refresh, NULL);
+    Sched_EventInit(&s_anomaly_event, App_Anomaly, NULL);
+    Refresh_Init(&s_refresh, &s_boot_cfg->refresh);
+    (void)Agg_Init(&s_stats_minute, s_stats_minute_slots,
+                   sizeof(s_stats_minute_slots) / sizeof(s_stats_minute_slots[0]), 1000U);
+    (void)Agg_Init(&s_stats_hour, s_stats_hour_slots,
+                   sizeof(s_stats_hour_slots) / sizeof(s_stats_hour_slots[0]), 60000U);
+    Sched_TimerInit(&s_lcd_init_timer, App_LcdInitStep, NULL);
+
+    // The LCD power-up wait starts now and elapses while the rest is brought up
+    LCD_InitBegin();
+    Sched_TimerStart(&s_lcd_init_timer, LCD_InitStep(), 0);
+
+    // Held for the bus bring-up; later transfers take the clocks themselves
+    ClockGate_Acquire(CLOCK_GATE_LPI2C0);
+    ClockGate_Acquire(CLOCK_GATE_DMA);
+
+    // Initialize the eDMA controller; each client below takes its channel from the allocator
+    (void)DMA_Alloc_Init(0U);
+
+#if APP_I2C_SLAVE
+    // LPI2C0 answers the host's reads from here on, in every run mode, so its clock stays on
+    (void)I2C_Slave_Init(I2C_SLAVE_ADDRESS);
+    ClockGate_Release(CLOCK_GATE_DMA);
+#else
+    // Initialize LPI2C0 in master mode; LCD frames go out through an allocated channel
+    s_i2c_config = lpi2c0_MasterConfig0;
+    s_i2c_config.slaveAddress = s_boot_cfg->lcd_address;
+    s_i2c_config.baudRate = s_boot_cfg->i2c_baud_hz;
+    (void)DMA_Alloc_Channel(EDMA_REQ_DISABLED, APP_I2C_DMA_PRIO, IRQ_PRIO_I2C, &s_i2c_config.dmaChannel);
+    LPI2C_DRV_MasterInit(INST_LPI2C0, &s_i2c_config, &g_lpi2c0MasterState);
+
+    // Failed transfers are counted and a stuck bus is freed in the background;
+    // a slave left mid-byte by a brownout is freed before the negotiation
+    I2C_Recover_Init(&s_i2c_config, &g_lpi2c0MasterState, App_I2cRecovered, NULL);
+    (void)I2C_Recover_Run();
+
+    // Run the bus as fast as every device on it allows, then pace the LCD for that rate
+    i2c_rate_hz = s_boot_cfg->i2c_baud_hz;
+    (void)I2C_Speed_Negotiate(INST_LPI2C0, s_i2c_devices, sizeof(s_i2c_devices) / sizeof(s_i2c_devices[0]),
+                              s_i2c_rates, s_i2c_rate_count, &i2c_rate_hz);
+    LPI2C_DRV_MasterSetSlaveAddr(INST_LPI2C0, s_boot_cfg->lcd_address, false);
+    LCD_SetBusRate(i2c_rate_hz);
+    I2C_Queue_SetBusRate(i2c_rate_hz);
+#if APP_I2C_METER_MS
+    // Bus load from here on; the driver keeps its totals across a bus recovery
+    I2C_Meter_Init();
+    Sched_TimerInit(&s_i2c_meter_timer, App_I2cMeter, NULL);
+    Sched_TimerStart(&s_i2c_meter_timer, APP_I2C_METER_MS, APP_I2C_METER_MS);
+#endif
+    ClockGate_Release(CLOCK_GATE_DMA);
+    ClockGate_Release(CLOCK_GATE_LPI2C0);
+#endif
+
+    // Stream every converted block over LPUART1 through eDMA
+    (void)Telemetry_Init(TELEMETRY_BAUD_HZ);
+
+#if APP_HIST_FRAME_MS
+    // Tail latencies follow the samples on the same link
+    Sched_TimerInit(&s_hist_timer, App_SendHistogram, NULL);
+    Sched_TimerStart(&s_hist_timer, APP_HIST_FRAME_MS, APP_HIST_FRAME_MS);
+#endif
+
+#if APP_CAN_NODE
+    // Broadcast the reading on CAN; a node that cannot join the bus still shows it locally
+    if (CanNode_Init(&s_can_config) == STATUS_SUCCESS)
+    {
+        Sched_TimerInit(&s_can_timer, App_CanPublish, NULL);
+        Sched_TimerStart(&s_can_timer, APP_CAN_PERIOD_MS, APP_CAN_PERIOD_MS);
+    }
+#endif
+
+    // --- Sensor Initialization Block ---
+    // PDB0 triggers ADC0 at a fixed rate and the eDMA collects the results in blocks;
+    // calibration and the first block overlap the LCD power-up
+    (void)Sensor_Init(&s_sensor, &g_sensor_lm35, &s_lm35, App_SensorReady, NULL);
+#if APP_WAKE_ON_THRESHOLD
+    // LPTMR0 triggers ADC0 instead, and the scheduler idles in VLPS once the
+    // reading is in range and on screen
+    (void)WakeMon_Start(APP_WAKE_LOW_C10, APP_WAKE_HIGH_C10, TEMP_RES_0C1, APP_WAKE_PERIOD_MS,
+                        App_WakeReading, NULL);
+    Sched_SetIdle(App_Idle);
+#else
+    (void)Sensor_StartBatch(&s_sensor);
+#endif
 
     /*--------------------------------------------------*/
-    /* 2. Display Static Content on LCD           */
+    /* 2. Event Loop                    */
     /*--------------------------------------------------*/
-    // This is done once to prevent screen flickering inside the main loop
-    LCD_SendCommand(LCD_CLEAR_DISPLAY);
-    OSIF_TimeDelay(2);
-    LCD_SendCommand(0x80); // Move cursor to the beginning of the first line
-    LCD_SendString("Temperature:");
-    
-    /*--------------------------------------------------*/
-    /* 3. Main Loop                     */
-    /*--------------------------------------------------*/
-    while (1)
-    {     
-        // --- Read Temperature from Sensor --
-        ADC_DRV_ConfigChan(0, 0, &adc_channel_config);
-        ADC_DRV_WaitConvDone(0);
-        ADC_DRV_GetChanResult(0, 0, &g_adc_result);
-
-        // --- Calculate Temperature ---
-        // Formula: Temp (°C) = ( (ADC_Result / ADC_Max_Value) * V_Ref (mV) ) / 10 (mV/°C)
-        g_temperature_celsius = (((float)g_adc_result / ADC_MAX_VALUE) * ADC_VREF_MV) / 10.0f;
-
-        // --- Format and Display Temperature on LCD ---
-        // Convert the integer value to a formatted string (e.g., "27 C")
-        sprintf(temp_string, "%d C ", g_temperature_celsius);
-
-        // Move cursor to the beginning of the second line
-        LCD_SendCommand(0xC0);
-
-        // Send the formatted string to the LCD
-        LCD_SendString(temp_string);
-
-        // Wait for 1 second before the next measurement
-        OSIF_TimeDelay(1000);
-    }
+    // The LCD init steps run from their timer, conversion and telemetry per
+    // ADC block and the display refresh as the refresh policy paces it;
+    // the core sleeps whenever none has work pending, in VLPR once the LCD is up
+#if APP_DEADLINES
+    // Every handler from here on runs against its cycle budget, and the
+    // watchdog is only refreshed while all of them keep to it
+    Deadline_Watch(&s_adc_event, "convert", APP_BUDGET_CONVERT);
+    Deadline_Watch(&s_display_timer.event, "display", APP_BUDGET_DISPLAY);
+    Deadline_Watch(&s_anomaly_event, "anomaly", APP_BUDGET_DISPLAY);
+    Deadline_Watch(&s_lcd_init_timer.event, "lcd init", APP_BUDGET_LCD_INIT);
+    Deadline_Init(APP_BUDGET_DEFAULT);
+#endif
+    Sched_Run();
 
     return 0;
 }
@@ -130,97 +523,441 @@ int main(void)
 /*============================================================================*/
 
 /**
- * @brief Disables the Watchdog timer.
+ * @brief Hands the configuration in force to the modules it tunes.
+ * @details Field assignments only; runs before any of them is initialized.
+ * The anomaly limits follow the block period at the configured rate, a
+ * few 64-bit divisions once per boot.
+ */
+static void App_ApplyBootCfg(void)
+{
+    const boot_cfg_t *cfg = s_boot_cfg;
+    uint32_t rate_hz = cfg->sample_rate_hz;
+
+    s_adc_profile.hw_avg_enable = (cfg->hw_avg_enable != 0U);
+    s_adc_profile.hw_average = (adc_average_t)cfg->hw_average;
+    s_adc_profile.converter = s_boot_converters[cfg->converter];
+    s_lm35_config.rate_hz = rate_hz;
+    s_anomaly_config.max_step = (uint16_t)TEMP_TO_RAW_DELTA(APP_MAX_SLEW_C10_S * APP_BLOCK_SAMPLES, 10U * rate_hz,
+                                                            APP_OVERSAMPLE_BITS);
+    s_anomaly_config.trend_slope = (int32_t)TEMP_TO_RAW_DELTA(APP_TREND_C10_MIN * APP_BLOCK_SAMPLES,
+                                                              10U * 60U * rate_hz,
+                                                              APP_OVERSAMPLE_BITS + ANOMALY_SLOPE_FRAC_BITS);
+    Bandgap_SetReference(cfg->vref_mv);
+
+    s_i2c_devices[0] = cfg->lcd_address;
+    s_i2c_rates[0] = cfg->i2c_baud_hz;
+    s_i2c_rates[1] = cfg->i2c_max_hz;
+    s_i2c_rate_count = (cfg->i2c_max_hz > cfg->i2c_baud_hz) ? 2U : 1U;
+#if !APP_I2C_SLAVE
+    LCD_SetAddress(cfg->lcd_address);
+    I2C_Queue_SetHomeAddress(cfg->lcd_address);
+#endif
+}
+
+/**
+ * @brief Disables the Watchdog timer for the start-up.
+ * @details CS[UPDATE] stays set so that Deadline_Init() can enable it again.
  */
 void WDOG_disable(void)
 {
     WDOG->CNT = 0xD928C520;
     WDOG->TOVAL = 0x0000FFFF;
-    WDOG->CS = 0x00002100;
+    WDOG->CS = 0x00002120;
+}
+
+/**
+ * @brief Called from the sensor's interrupt for every queued batch.
+ * @param sensor Unused.
+ * @param param  Unused.
+ */
+PERF_HOT static void App_SensorReady(sensor_t *sensor, void *param)
+{
+    (void)sensor;
+    (void)param;
+
+    (void)Sched_Post(&s_adc_event);
+}
+
+#if !APP_WAKE_ON_THRESHOLD
+/**
+ * @brief Converts the readings the sensor queued to temperature.
+ * @details Runs from the scheduler each time App_SensorReady() posts. Posts
+ * coalesce, so every reading queued since the last run is converted in one
+ * block and the newest is used. Its age goes to PROF_HIST_SAMPLE_TO_VALUE,
+ * and a changed reading is stamped for PROF_HIST_VALUE_TO_LCD.
+ * @param param Unused.
+ */
+static void App_ConvertTemperature(void *param)
+{
+    sensor_sample_t samples[SENSOR_LM35_QUEUE_DEPTH];
+    const sensor_sample_t *newest;
+    uint32_t count;
+    uint32_t now;
+    int previous = g_temperature_celsius;
+
+    (void)param;
+
+    // Formula: Temp (°C) = ( (ADC_Result / ADC_Max_Value) * V_Ref (mV) ) / 10 (mV/°C),
+    // corrected by the board calibration and expanded into a table at boot
+    count = Sensor_Read(&s_sensor, samples, SENSOR_LM35_QUEUE_DEPTH);
+    if (count == 0U)
+    {
+        return;
+    }
+    newest = &samples[count - 1U];
+    g_adc_result = newest->raw;
+    g_temperature_celsius = newest->value;
+
+    Prof_Hist(PROF_HIST_SAMPLE_TO_VALUE, PROF_TIMESTAMP() - newest->timestamp);
+    if ((g_temperature_celsius != previous) && !s_change_pending)
+    {
+        s_change_ts = PROF_TIMESTAMP();
+        s_change_pending = true;
+    }
+
+    now = OSIF_GetMilliseconds();
+    (void)Telemetry_Push((int16_t)g_temperature_celsius, now);
+    Agg_Push(&s_stats_minute, (int16_t)g_temperature_celsius, now);
+    Agg_Push(&s_stats_hour, (int16_t)g_temperature_celsius, now);
+#if APP_CAN_NODE
+    CanNode_Sample((int16_t)g_temperature_celsius);
+#endif
+#if APP_I2C_SLAVE
+    I2C_Slave_Update(newest->unfiltered, (int16_t)g_temperature_celsius);
+#endif
+    App_LogSample(now);
+
+    // The policy decides whether this reading is worth a redraw
+    s_have_reading = true;
+    App_Refresh(NULL);
+}
+#else
+/**
+ * @brief Called from the ADC0 interrupt for every reading the wake monitor reports.
+ * @details WakeMon_Start() runs ADC0 at IRQ_PRIO_DMA, the level the ready
+ * queue is locked at, so posting from here is safe.
+ * @param raw      The 12-bit result.
+ * @param in_range Unused; the refresh policy decides on the value alone.
+ * @param param    Unused.
+ */
+static void App_WakeReading(uint16_t raw, bool in_range, void *param)
+{
+    (void)in_range;
+    (void)param;
+
+    s_wake_raw = raw;
+    (void)Sched_Post(&s_adc_event);
+}
+
+/**
+ * @brief Converts the wake monitor's reading and redraws it.
+ * @details The wake-on-threshold counterpart of App_ConvertTemperature(): one
+ * unfiltered result per wake-up, logged and shown through the same policy.
+ * Telemetry and the statistics windows are left out, as they assume a
+ * steady sample rate.
+ * @param param Unused.
+ */
+static void App_WakeConvert(void *param)
+{
+    int previous = g_temperature_celsius;
+
+    (void)param;
+
+    g_adc_result = s_wake_raw;
+    g_temperature_celsius = (int)TempCal_FromRaw(s_wake_raw, TEMP_RES_0C1);
+    if ((g_temperature_celsius != previous) && !s_change_pending)
+    {
+        s_change_ts = PROF_TIMESTAMP();
+        s_change_pending = true;
+    }
+    App_LogSample(OSIF_GetMilliseconds());
+
+    s_have_reading = true;
+    App_Refresh(NULL);
 }
 
 /**
- * @brief Sends a single byte to the LCD via I2C.
- * @details This function splits the byte into two 4-bit nibbles and sends them sequentially,
- * toggling the Enable (EN) pin for each nibble.
- * @param data The 8-bit data byte to send.
- * @param rs_bit Register Select bit (0 for command, 1 for data).
+ * @brief Scheduler idle hook: VLPS once nothing needs the tick or the bus.
+ * @details That is when the LCD is up with no frame queued or on the bus, every change
+ * is on screen and the monitor is watching the window rather than tracking
+ * an excursion. Until then the core only sleeps, so the refresh timers and
+ * the eDMA keep running; a change the policy holds back is drawn at its max
+ * age at the latest.
  */
-void LCD_SendByte(uint8_t data, uint8_t rs_bit)
+static void App_Idle(void)
 {
+    Power_Sleep(s_lcd_ready && !LCD_IsBusy() && !s_change_pending && !WakeMon_IsTracking());
+}
+#endif
+
+/**
+ * @brief Logs the current reading once per APP_LOG_INTERVAL_MS and writes
+ * each completed page to flash.
+ * @details Flash can only be programmed in RUN, so the profile is switched
+ * for the write and restored afterwards; that happens once per page, not
+ * per sample.
+ * @param now_ms Current time.
+ */
+static void App_LogSample(uint32_t now_ms)
+{
+    power_profile_t profile;
+
+    if ((now_ms - s_log_ms) < APP_LOG_INTERVAL_MS)
+    {
+        return;
+    }
+    s_log_ms = now_ms;
+
+    if (Datalog_Append((int16_t)g_temperature_celsius, now_ms))
+    {
+        profile = Power_GetProfile();
+        (void)Power_SetProfile(POWER_PROFILE_RUN);
+        (void)Datalog_Flush(false);
+        (void)Power_SetProfile(profile);
+    }
+}
+
+/**
+ * @brief Redraws the reading if the refresh policy says so, and re-arms the
+ * display timer for when it next could.
+ * @details Called for every converted block and from the display timer. A
+ * frame that cannot be queued is not recorded as shown and is retried after
+ * the rate cap.
+ * @param param Unused.
+ */
+static void App_Refresh(void *param)
+{
+    uint32_t now_ms, wait_ms;
+    int32_t value = g_temperature_celsius;
+
+    (void)param;
+
+    if (!s_lcd_ready || !s_have_reading)
+    {
+        return;
+    }
+
+    now_ms = OSIF_GetMilliseconds();
+    wait_ms = Refresh_Poll(&s_refresh, value, now_ms);
+    if (wait_ms == 0U)
+    {
+        if (App_UpdateDisplay() == STATUS_SUCCESS)
+        {
+            Refresh_Shown(&s_refresh, value, now_ms);
+            wait_ms = Refresh_Poll(&s_refresh, value, now_ms);
+        }
+        else
+        {
+            wait_ms = s_boot_cfg->refresh.min_interval_ms;
+        }
+    }
+    Sched_TimerStart(&s_display_timer, wait_ms, 0);
+}
+
+/**
+ * @brief Formats the current temperature and queues the changed cells.
+ * @details The reading is drawn two lines high on the left with a bar graph
+ * next to it. Every custom glyph on screen is requested again each refresh,
+ * so CGRAM is only rewritten when a digit or the bar's partial cell changes.
+ * Runs in the idle profile: a few characters are not worth a run-mode
+ * switch, whose way out of VLPR restarts the oscillators and PLL. If the
+ * LCD back buffer is still occupied the changes stay in the framebuffer and
+ * go out on the next refresh.
+ * @return Result of LCD_FB_FlushAsync(); STATUS_BUSY if nothing was queued.
+ */
+static status_t App_UpdateDisplay(void)
+{
+    // Buffer to hold the formatted temperature string
+    char temp_string[8];
     status_t status;
-    uint8_t high_nibble = data & 0xF0;
-    uint8_t low_nibble = (data << 4) & 0xF0;
-    uint8_t i2c_payload[4];
 
-    // Payload for the high nibble (EN pulse)
-    i2c_payload[0] = (high_nibble | rs_bit | 0x08 | 0x04); // Data | RS | Backlight | EN=1
-    i2c_payload[1] = (high_nibble | rs_bit | 0x08);        // Data | RS | Backlight | EN=0
+    // Convert the fixed-point value to a right-aligned string (e.g., " 27.4")
+    (void)Fmt_FixedQ(temp_string, 5, g_temperature_celsius, 1, NULL);
+
+    // Large digits in columns 0-4, the bar under the unit; only changed cells
+    // go out on the bus, streamed by the eDMA while the CPU moves on
+    LCD_Glyph_BeginFrame();
+    (void)LCD_Glyph_BigText(0, temp_string);
+    LCD_Glyph_BarGraph(1, 6, 10, g_temperature_celsius, APP_BAR_FULL_C10);
+    LCD_FB_PutChar(0, 15, s_trend_char);
+    s_frame_ts[s_frame_slot] = s_change_pending ? s_change_ts : 0U;
+    status = LCD_FB_FlushAsync(App_FrameDone, &s_frame_ts[s_frame_slot]);
+    if (status == STATUS_SUCCESS)
+    {
+        s_frame_slot ^= 1U;
+        s_change_pending = false;
+    }
+
+    return status;
+}
 
-    // Payload for the low nibble (EN pulse)
-    i2c_payload[2] = (low_nibble | rs_bit | 0x08 | 0x04);  // Data | RS | Backlight | EN=1
-    i2c_payload[3] = (low_nibble | rs_bit | 0x08);         // Data | RS | Backlight | EN=0
+/**
+ * @brief Completion of a display frame, from the LPI2C0/eDMA interrupt.
+ * @details A frame carrying a changed reading records the time since the
+ * change; the pixels update as the bytes arrive, so the end of the frame is
+ * when the new value is on screen. An empty frame completes from
+ * LCD_FB_FlushAsync() itself.
+ * @param status Result of the frame; a failed one records nothing.
+ * @param param  Timestamp slot of the frame, 0 if it carried no change.
+ */
+static void App_FrameDone(status_t status, void *param)
+{
+    uint32_t changed = *(const uint32_t *)param;
 
-    // Send the entire 4-byte sequence in a single blocking I2C transaction
-    status = LPI2C_DRV_MasterSendDataBlocking(INST_LPI2C0, i2c_payload, 4, true, 100);
-    (void)status; // Suppress unused variable warning
+    if ((status == STATUS_SUCCESS) && (changed != 0U))
+    {
+        Prof_Hist(PROF_HIST_VALUE_TO_LCD, PROF_TIMESTAMP() - changed);
+    }
 }
 
+#if APP_HIST_FRAME_MS
 /**
- * @brief Sends a command to the LCD.
- * @param command The command byte to send.
+ * @brief Sends the next latency histogram slice over telemetry.
+ * @details A slice the link has no room for is sent again next time.
+ * @param param Unused.
  */
-void LCD_SendCommand(uint8_t command)
+static void App_SendHistogram(void *param)
 {
-    LCD_SendByte(command, 0); // RS = 0 for commands
+    prof_hist_t hist;
+    uint8_t id = s_hist_slice / APP_HIST_SLICES;
+    uint8_t first = (uint8_t)((s_hist_slice % APP_HIST_SLICES) * TELEMETRY_HIST_BUCKETS);
+
+    (void)param;
+
+    Prof_GetHist((prof_hist_id_t)id, &hist);
+    if (Telemetry_PushHistogram(id, first, &hist.bucket[first], OSIF_GetMilliseconds()))
+    {
+        s_hist_slice = (uint8_t)((s_hist_slice + 1U) % (PROF_HIST_COUNT * APP_HIST_SLICES));
+    }
 }
+#endif
 
 /**
- * @brief Sends a data character to the LCD.
- * @param data The character byte to send.
+ * @brief Advances the LCD power-up sequence and re-arms itself for the next step.
+ * @details Once the LCD is ready the static text goes out, followed by the
+ * first reading if one is already converted; from then on the refresh
+ * policy paces the display and the core stays in VLPR (RUN for a CAN
+ * node), left only for the flash writes of the log.
+ * @param param Unused.
  */
-void LCD_SendData(uint8_t data)
+static void App_LcdInitStep(void *param)
 {
-    LCD_SendByte(data, 1); // RS = 1 for data
+    uint32_t delay_ms;
+
+    (void)param;
+
+    delay_ms = LCD_InitStep();
+    if (delay_ms != LCD_INIT_DONE)
+    {
+        Sched_TimerStart(&s_lcd_init_timer, delay_ms, 0);
+        return;
+    }
+
+    // This is done once to prevent screen flickering inside the main loop
+    LCD_FB_Init();
+    LCD_Glyph_Init();
+    LCD_FB_WriteString(0, 5, "\xDF" "C    Temp");
+    (void)LCD_FB_FlushAsync(NULL, NULL);
+    s_lcd_ready = true;
+
+    // Bring-up is over; nothing the handlers do from here needs a faster clock
+    (void)Power_SetProfile(APP_IDLE_PROFILE);
+
+    App_Refresh(NULL);
 }
 
 /**
- * @brief Sends a null-terminated string to the LCD.
- * @param str Pointer to the string.
+ * @brief Follows the anomaly stage: redraws when the trend marker changes.
+ * @details Runs from the scheduler for every rejected block, accepted step
+ * and trend edge the sensor's interrupt posts. Rejected blocks only count
+ * towards s_lm35.anomaly.spikes; the reading on screen is left as it was.
+ * @param param Unused.
  */
-void LCD_SendString(char *str)
+static void App_Anomaly(void *param)
 {
-    while (*str)
+    uint8_t flags = s_lm35.anomaly_flags;
+    char trend = ' ';
+
+    (void)param;
+
+    if ((flags & ANOMALY_RISING) != 0U)
+    {
+        trend = '+';
+    }
+    else if ((flags & ANOMALY_FALLING) != 0U)
+    {
+        trend = '-';
+    }
+
+    if ((trend != s_trend_char) && s_lcd_ready && s_have_reading)
     {
-        LCD_SendData(*str++);
+        s_trend_char = trend;
+        (void)App_UpdateDisplay();
+    }
+    else
+    {
+        s_trend_char = trend;
     }
 }
 
+#if !APP_I2C_SLAVE
 /**
- * @brief Initializes the LCD into 4-bit communication mode.
- * @details Sends the required sequence of commands to configure the LCD.
+ * @brief Restarts the LCD once a stuck I2C bus has been freed.
+ * @details Everything sent while the bus was down is lost, and the
+ * brownout that usually causes it may have reset the controller, so the
+ * power-up sequence runs again and the screen is redrawn from scratch.
+ * @param param Unused.
  */
-void LCD_Init(void)
+static void App_I2cRecovered(void *param)
 {
-    // Wait for LCD to power up
-    OSIF_TimeDelay(50);
+    (void)param;
+
+    s_lcd_ready = false;
+    Refresh_Init(&s_refresh, &s_boot_cfg->refresh);
+    LCD_InitBegin();
+    Sched_TimerStart(&s_lcd_init_timer, LCD_InitStep(), 0);
+}
+
+#if APP_I2C_METER_MS
+/**
+ * @brief Closes the current LPI2C0 utilization window.
+ * @details The rolling load, e.g. read from a debugger through
+ * I2C_Meter_Get(), shows what batching, the framebuffer diff and the bus
+ * rate save, and how much room is left for more devices.
+ * @param param Unused.
+ */
+static void App_I2cMeter(void *param)
+{
+    (void)param;
+
+    I2C_Meter_Update();
+}
+#endif
+#endif
 
-    // --- Special initialization sequence for 4-bit mode ---
-    LCD_SendByte(0x30, 0);
-    OSIF_TimeDelay(5);
-    LCD_SendByte(0x30, 0);
-    OSIF_TimeDelay(1);
-    LCD_SendByte(0x30, 0);
-    OSIF_TimeDelay(1);
-    LCD_SendByte(0x20, 0); // Set to 4-bit interface
-    OSIF_TimeDelay(1);
+/**
+ * @brief Re-derives the sampling period after a profile switch.
+ * @details PDB0 counts the bus clock, which differs in every run mode.
+ * @param profile Unused.
+ * @param param   Unused.
+ */
+static void App_PowerChanged(power_profile_t profile, void *param)
+{
+    (void)profile;
+    (void)param;
 
-    // --- Standard configuration ---
-    LCD_SendCommand(LCD_FUNCTION_SET | 0x08);    // 4-bit mode, 2 lines, 5x8 font
-    LCD_SendCommand(LCD_DISPLAY_CONTROL | 0x04); // Display on, cursor off, blink off
-    LCD_SendCommand(LCD_CLEAR_DISPLAY);          // Clear display
-    OSIF_TimeDelay(2);                           // This command takes longer to execute
-    LCD_SendCommand(LCD_ENTRY_MODE_SET | 0x02);  // Increment cursor, no display shift
-    LCD_SendCommand(LCD_RETURN_HOME);            // Return cursor to home position
+    (void)Sampler_UpdateClock();
 }
 
+#if APP_CAN_NODE
+/**
+ * @brief Sends the periodic CAN status frame from the latest reading.
+ * @param param Unused.
+ */
+static void App_CanPublish(void *param)
+{
+    (void)param;
+
+    (void)CanNode_Publish();
+}
+#endif
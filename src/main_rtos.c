@@ -0,0 +1,321 @@
+/**
+ ******************************************************************************
+ * @file      main_rtos.c
+ * @brief     FreeRTOS variant of the LM35/1602 LCD application: a sampling
+ * task converts each ADC block and a display task drives the LCD, with a
+ * queue between them. Built by the FreeRTOS_FLASH configuration instead of
+ * main.c and sched.c.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "S32K144.h"
+#include "peripherals_lpi2c_config_1.h"
+#include "clock_config.h"	// clockMan1_InitConfig0
+#include "board_fixed.h"    // Straight-line pin mux of the fixed board layout
+#include "lpi2c_driver.h"   // LPI2C low-level driver
+#include "interrupt_manager.h"
+#include "adc_sampler.h"    // PDB-paced ADC sampling
+#include "adc_stream.h"     // eDMA ring of ADC results
+#include "temp_conv.h"      // Fixed-point LM35 conversion
+#include "filter.h"         // Streaming sample filters
+#include "lcd_fb.h"         // HD44780 driver and shadow framebuffer
+#include "fmt.h"            // Allocation-free number formatting
+#include "prof.h"           // DWT cycle profiling
+#include "i2c_speed.h"      // Start-up I2C bus-speed negotiation
+#include "i2c_queue.h"      // Asynchronous LPI2C0 transactions
+#include "dma_alloc.h"      // Run-time eDMA channel allocation
+#include "mem_prof.h"       // Stack high-water mark
+#include "perf_cfg.h"       // Code cache and flash prefetch
+#include "FreeRTOS.h"
+#include "task.h"
+#include "queue.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Sampling preempts the display so that no ADC block is missed during a flush
+#define APP_SAMPLE_TASK_PRIORITY    (tskIDLE_PRIORITY + 2U)
+#define APP_DISPLAY_TASK_PRIORITY   (tskIDLE_PRIORITY + 1U)
+#define APP_SAMPLE_TASK_STACK       (configMINIMAL_STACK_SIZE + 64U)
+#define APP_DISPLAY_TASK_STACK      (configMINIMAL_STACK_SIZE + 128U)
+
+#define APP_TEMP_QUEUE_LENGTH       2U      // Readings waiting for the display
+#define APP_REFRESH_MS              1000U   // Display refresh period
+
+// ISRs that post to the kernel must not be above configMAX_SYSCALL_INTERRUPT_PRIORITY
+#define APP_KERNEL_ISR_PRIORITY     (configLIBRARY_MAX_SYSCALL_INTERRUPT_PRIORITY + 1U)
+
+#define APP_I2C_DMA_PRIO            8U      // eDMA priority of the LCD frames, below the ADC stream
+
+/*============================================================================*/
+/* Global Variables                                */
+/*============================================================================*/
+
+// State structure for the LPI2C0 master driver instance
+lpi2c_master_state_t g_lpi2c0MasterState;
+
+// Decimated ADC block, written from the eDMA interrupt
+volatile uint32_t g_adc_result;
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// 8x hardware averaging per conversion, then 64 results decimated to 15 bits
+static const sampler_profile_t s_adc_profile =
+{
+    .hw_avg_enable = true,
+    .hw_average = ADC_AVERAGE_8,
+    .oversample_bits = 3U,
+};
+
+// Smooths the decimated block results before they reach the display
+static filter_iir_t s_adc_iir;
+
+// Temperatures in 0.1 C steps, from the sampling task to the display task
+static QueueHandle_t s_temp_queue;
+
+// Notified by the eDMA interrupt for every decimated block
+static TaskHandle_t s_sample_task;
+
+// Devices on LPI2C0 (the LCD backpack) and the SCL rates tried for them, slowest first
+static const uint16_t s_i2c_devices[] = { 39U };
+static const uint32_t s_i2c_rates[] = { 400000U, 1000000U };
+
+/*============================================================================*/
+/* Private Function Prototypes                         */
+/*============================================================================*/
+
+void WDOG_disable(void);
+static void ADC_BlockReady(const uint16_t *block, uint32_t count, void *param);
+static void App_SampleTask(void *param);
+static void App_DisplayTask(void *param);
+
+void vApplicationIdleHook(void);
+void vApplicationTickHook(void);
+void vApplicationMallocFailedHook(void);
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName);
+
+/*============================================================================*/
+/* Main Function                                  */
+/*============================================================================*/
+
+int main(void)
+{
+    lpi2c_master_user_config_t i2c_config;
+    BaseType_t created;
+
+    /*--------------------------------------------------*/
+    /* 1. One-Time System Initialization       */
+    /*--------------------------------------------------*/
+    WDOG_disable();
+
+    // Paint the main stack; once the kernel runs it carries the interrupts only
+    MemProf_Init();
+    PerfCfg_Init();
+    CLOCK_DRV_Init(&clockMan1_InitConfig0);
+    BoardFixed_InitPins();
+    Prof_Init();
+
+    // Initialize the eDMA controller; every channel it hands out (LCD frames and
+    // the ADC stream) posts to the kernel from its handler, so none may be more urgent
+    (void)DMA_Alloc_Init(APP_KERNEL_ISR_PRIORITY);
+
+    // Initialize LPI2C0 in master mode; its idle semaphore is now a kernel semaphore
+    i2c_config = lpi2c0_MasterConfig0;
+    (void)DMA_Alloc_Channel(EDMA_REQ_DISABLED, APP_I2C_DMA_PRIO, APP_KERNEL_ISR_PRIORITY, &i2c_config.dmaChannel);
+    LPI2C_DRV_MasterInit(INST_LPI2C0, &i2c_config, &g_lpi2c0MasterState);
+
+    // The LPI2C0 master posts to the kernel from its handler too
+    INT_SYS_SetPriority(LPI2C0_Master_IRQn, APP_KERNEL_ISR_PRIORITY);
+
+    /*--------------------------------------------------*/
+    /* 2. Tasks and Queue                      */
+    /*--------------------------------------------------*/
+    // Kernel calls made before the scheduler starts keep kernel-aware interrupts masked
+    s_temp_queue = xQueueCreate(APP_TEMP_QUEUE_LENGTH, sizeof(int32_t));
+    configASSERT(s_temp_queue != NULL);
+    created = xTaskCreate(App_SampleTask, "sample", APP_SAMPLE_TASK_STACK, NULL,
+                          APP_SAMPLE_TASK_PRIORITY, &s_sample_task);
+    configASSERT(created == pdPASS);
+    created = xTaskCreate(App_DisplayTask, "display", APP_DISPLAY_TASK_STACK, NULL,
+                          APP_DISPLAY_TASK_PRIORITY, NULL);
+    configASSERT(created == pdPASS);
+
+    // --- ADC Initialization Block ---
+    // PDB0 triggers ADC0 at a fixed rate and the eDMA collects the results in blocks
+    (void)Sampler_Init(ADC_INPUTCHAN_EXT12, SAMPLER_RATE_HZ); // Corresponds to your configured ADC pin
+    (void)Sampler_ApplyProfile(&s_adc_profile);
+    Filter_IIR_Init(&s_adc_iir, FILTER_IIR_ALPHA(0.25));
+    (void)ADC_Stream_Start(ADC_BlockReady, NULL);
+    Sampler_Start();
+
+    /*--------------------------------------------------*/
+    /* 3. Start the Kernel                      */
+    /*--------------------------------------------------*/
+    vTaskStartScheduler();
+
+    // Only reached if the idle or timer task could not be allocated
+    for (;;)
+    {
+    }
+
+    return 0;
+}
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Disables the Watchdog timer.
+ */
+void WDOG_disable(void)
+{
+    WDOG->CNT = 0xD928C520;
+    WDOG->TOVAL = 0x0000FFFF;
+    WDOG->CS = 0x00002100;
+}
+
+/**
+ * @brief Called from the eDMA interrupt each time half of the ADC ring fills.
+ * @details Filters the block and wakes the sampling task.
+ * @param block Freshly filled samples.
+ * @param count Number of samples in the block.
+ * @param param Unused.
+ */
+static void ADC_BlockReady(const uint16_t *block, uint32_t count, void *param)
+{
+    BaseType_t task_woken = pdFALSE;
+
+    (void)param;
+
+    if (count >= (1UL << (2U * s_adc_profile.oversample_bits)))
+    {
+        g_adc_result = Filter_IIR_Process(&s_adc_iir,
+                                          (uint16_t)Sampler_Decimate(block, s_adc_profile.oversample_bits));
+        vTaskNotifyGiveFromISR(s_sample_task, &task_woken);
+        portYIELD_FROM_ISR(task_woken);
+    }
+}
+
+/**
+ * @brief Converts every filtered ADC block and hands one reading per refresh
+ * period to the display task.
+ * @param param Unused.
+ */
+static void App_SampleTask(void *param)
+{
+    TickType_t last_sent = xTaskGetTickCount();
+    int32_t temperature;
+
+    (void)param;
+
+    for (;;)
+    {
+        (void)ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+
+        // Formula: Temp (°C) = ( (ADC_Result / ADC_Max_Value) * V_Ref (mV) ) / 10 (mV/°C),
+        // folded into one precomputed Q16 multiply-shift
+        temperature = Temp_FromOversampled(g_adc_result, s_adc_profile.oversample_bits, TEMP_RES_0C1);
+
+        if ((xTaskGetTickCount() - last_sent) >= pdMS_TO_TICKS(APP_REFRESH_MS))
+        {
+            last_sent = xTaskGetTickCount();
+            (void)xQueueSend(s_temp_queue, &temperature, 0);
+        }
+    }
+}
+
+/**
+ * @brief Owns the LCD: initializes it, then shows each reading from the queue.
+ * @details LCD_Init() waits with OSIF_TimeDelay() and the bus-speed probe on
+ * the LPI2C0 semaphore, both of which need a running kernel, so they are done
+ * here rather than in main(). The blocking flush waits
+ * for LPI2C0 on its idle semaphore, so the CPU is free for the sampling task
+ * while the frame is on the bus.
+ * @param param Unused.
+ */
+static void App_DisplayTask(void *param)
+{
+    // Buffer to hold the formatted temperature string
+    char temp_string[16];
+    int32_t temperature;
+    uint32_t i2c_rate_hz = 400000U;
+
+    (void)param;
+
+    (void)I2C_Speed_Negotiate(INST_LPI2C0, s_i2c_devices, sizeof(s_i2c_devices) / sizeof(s_i2c_devices[0]),
+                              s_i2c_rates, sizeof(s_i2c_rates) / sizeof(s_i2c_rates[0]), &i2c_rate_hz);
+    LPI2C_DRV_MasterSetSlaveAddr(INST_LPI2C0, lpi2c0_MasterConfig0.slaveAddress, false);
+    LCD_SetBusRate(i2c_rate_hz);
+    I2C_Queue_SetBusRate(i2c_rate_hz);
+
+    LCD_Init();
+    LCD_FB_Init();
+    LCD_FB_WriteString(0, 0, "Temperature:");
+    (void)LCD_FB_Flush();
+
+    for (;;)
+    {
+        if (xQueueReceive(s_temp_queue, &temperature, portMAX_DELAY) == pdPASS)
+        {
+            // Convert the fixed-point value to a right-aligned string (e.g., "  27.4 C")
+            (void)Fmt_FixedQ(temp_string, 8, temperature, 1, " C");
+
+            // Place the string on the second line; only changed cells go out on the bus
+            LCD_FB_WriteString(1, 0, temp_string);
+            (void)LCD_FB_Flush();
+        }
+    }
+}
+
+/*============================================================================*/
+/* FreeRTOS Hooks                                 */
+/*============================================================================*/
+
+/**
+ * @brief Sleeps in WFI whenever no task is ready.
+ */
+void vApplicationIdleHook(void)
+{
+    STANDBY();
+}
+
+/**
+ * @brief Required by configUSE_TICK_HOOK; nothing to do on each tick.
+ */
+void vApplicationTickHook(void)
+{
+}
+
+/**
+ * @brief Traps a failed kernel heap allocation (configTOTAL_HEAP_SIZE too small).
+ */
+void vApplicationMallocFailedHook(void)
+{
+    taskDISABLE_INTERRUPTS();
+    for (;;)
+    {
+    }
+}
+
+/**
+ * @brief Traps a task stack overflow detected by configCHECK_FOR_STACK_OVERFLOW.
+ */
+void vApplicationStackOverflowHook(TaskHandle_t xTask, char *pcTaskName)
+{
+    (void)xTask;
+    (void)pcTaskName;
+
+    taskDISABLE_INTERRUPTS();
+    for (;;)
+    {
+    }
+}
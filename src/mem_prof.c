@@ -0,0 +1,259 @@
+/**
+ ******************************************************************************
+ * @file      mem_prof.c
+ * @brief     RAM high-water-mark profiling: the main stack and any other
+ * registered region are painted with a pattern, and the untouched part is
+ * measured later, alongside the static RAM layout from the linker script.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "mem_prof.h"
+#include <stddef.h>
+#include "irq_prio.h"
+#include "fmt.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define MEM_PROF_SECTIONS       7U   // Linker sections listed by MemProf_Dump()
+
+/*============================================================================*/
+/* Private Types                                   */
+/*============================================================================*/
+
+// One painted region, scanned upwards from base for the first overwritten word
+typedef struct
+{
+    const char *name;
+    const uint32_t *base;
+    uint32_t words;
+} mem_prof_region_t;
+
+// Bounds of one linker section, as symbols of S32K144_64_flash.ld
+typedef struct
+{
+    const char *name;
+    const uint8_t *start;
+    const uint8_t *end;
+} mem_prof_section_t;
+
+/*============================================================================*/
+/* External Symbols                                */
+/*============================================================================*/
+
+// Defined by the linker script; only their addresses are meaningful
+extern uint32_t __StackLimit[];
+extern uint32_t __StackTop[];
+extern uint8_t __interrupts_ram_start__[];
+extern uint8_t __interrupts_ram_end__[];
+extern uint8_t __data_start__[];
+extern uint8_t __data_end__[];
+extern uint8_t __code_ram_start__[];
+extern uint8_t __code_ram_end__[];
+extern uint8_t __noinit_start__[];
+extern uint8_t __noinit_end__[];
+extern uint8_t __bss_start__[];
+extern uint8_t __bss_end__[];
+extern uint8_t __HeapBase[];
+extern uint8_t __HeapLimit[];
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static mem_prof_region_t s_regions[MEM_PROF_MAX_REGIONS];
+static uint8_t s_count;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Fills words with MEM_PROF_PATTERN.
+ */
+static void MemProf_Paint(uint32_t *dst, uint32_t words)
+{
+    while (words-- != 0U)
+    {
+        *dst++ = MEM_PROF_PATTERN;
+    }
+}
+
+/**
+ * @brief Counts the pattern words at the bottom of a descending stack.
+ * @details A frame that happens to store the pattern itself reads as unused,
+ * so the result is the usage to within that one word.
+ */
+static uint32_t MemProf_Untouched(const mem_prof_region_t *region)
+{
+    uint32_t i = 0;
+
+    while ((i < region->words) && (region->base[i] == MEM_PROF_PATTERN))
+    {
+        i++;
+    }
+
+    return i;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Paints the unused part of the main stack and registers it as "msp".
+ * @details Call first thing in main(). Everything from __StackLimit up to
+ * MEM_PROF_SP_MARGIN below the current stack pointer is painted with
+ * interrupts masked, so no handler frame is overwritten on the way. On bare
+ * metal the main loop and every interrupt share this stack; under FreeRTOS
+ * it holds the interrupts only once the scheduler runs, the tasks having
+ * their own stacks, which uxTaskGetStackHighWaterMark() measures.
+ */
+void MemProf_Init(void)
+{
+    uint32_t *sp;
+    uint32_t *end;
+    uint32_t prev;
+
+    s_count = 0;
+
+    prev = IRQ_Lock(IRQ_PRIO_SAMPLING);
+#if defined(__GNUC__) && defined(__ARM_ARCH)
+    __asm volatile ("mov %0, sp" : "=r" (sp));
+#else
+    sp = __StackTop;
+#endif
+    end = sp - (MEM_PROF_SP_MARGIN / sizeof(uint32_t));
+    if ((end > __StackLimit) && (end <= __StackTop))
+    {
+        MemProf_Paint(__StackLimit, (uint32_t)(end - __StackLimit));
+    }
+    IRQ_Unlock(prev);
+
+    s_regions[0].name = "msp";
+    s_regions[0].base = __StackLimit;
+    s_regions[0].words = (uint32_t)(__StackTop - __StackLimit);
+    s_count = 1U;
+}
+
+/**
+ * @brief Paints a further stack and tracks its peak from now on.
+ * @details The region is treated as a descending stack, so it must not be
+ * in use yet: a task or coroutine stack before it is started, or a buffer
+ * filled from its top end.
+ * @param name Label for MemProf_Dump(), kept by reference.
+ * @param base Lowest address, word-aligned.
+ * @param size Length in bytes; a partial last word is ignored.
+ * @return STATUS_ERROR if the table is full, MemProf_Init() has not run or
+ *         the region is empty or misaligned.
+ */
+status_t MemProf_Register(const char *name, uint32_t *base, uint32_t size)
+{
+    mem_prof_region_t *region;
+
+    if ((s_count == 0U) || (s_count >= MEM_PROF_MAX_REGIONS) || (base == NULL) ||
+        ((((uintptr_t)base) & 3U) != 0U) || (size < sizeof(uint32_t)))
+    {
+        return STATUS_ERROR;
+    }
+
+    region = &s_regions[s_count];
+    region->name = name;
+    region->base = base;
+    region->words = size / sizeof(uint32_t);
+    MemProf_Paint(base, region->words);
+    s_count++;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Returns the number of tracked regions, 0 before MemProf_Init().
+ */
+uint8_t MemProf_Count(void)
+{
+    return s_count;
+}
+
+/**
+ * @brief Measures the peak usage of one region.
+ * @details Scans upwards from the bottom of the region, so it takes in the
+ * order of a cycle per unused byte; call it from the main context when the
+ * report is wanted, not periodically from an interrupt.
+ * @param index 0 for the main stack, then in order of registration.
+ * @param usage Destination.
+ * @return STATUS_ERROR for an unknown index.
+ */
+status_t MemProf_Get(uint8_t index, mem_prof_usage_t *usage)
+{
+    const mem_prof_region_t *region;
+
+    if ((index >= s_count) || (usage == NULL))
+    {
+        return STATUS_ERROR;
+    }
+
+    region = &s_regions[index];
+    usage->name = region->name;
+    usage->size = region->words * sizeof(uint32_t);
+    usage->used = (region->words - MemProf_Untouched(region)) * sizeof(uint32_t);
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Prints one line per tracked region: size, peak use and the margin
+ * left, then the size of every RAM section placed by the linker script.
+ * @param print Line sink, as for Prof_Dump().
+ */
+void MemProf_Dump(prof_print_t print)
+{
+    const mem_prof_section_t sections[MEM_PROF_SECTIONS] =
+    {
+        { "vector_ram", __interrupts_ram_start__, __interrupts_ram_end__ },
+        { "data", __data_start__, __data_end__ },
+        { "code_ram", __code_ram_start__, __code_ram_end__ },
+        { "noinit", __noinit_start__, __noinit_end__ },
+        { "bss", __bss_start__, __bss_end__ },
+        { "heap", __HeapBase, __HeapLimit },
+        { "stack", (const uint8_t *)__StackLimit, (const uint8_t *)__StackTop },
+    };
+    char line[PROF_NAME_WIDTH + (3U * PROF_VALUE_WIDTH) + 1U];
+    char *dst;
+    mem_prof_usage_t usage;
+    uint8_t i;
+
+    if (print == NULL)
+    {
+        return;
+    }
+
+    print("stack              size       used       free");
+
+    for (i = 0; i < s_count; i++)
+    {
+        (void)MemProf_Get(i, &usage);
+        dst = Prof_PutText(line, usage.name, PROF_NAME_WIDTH);
+        dst = Prof_PutValue(dst, usage.size, 0U);
+        dst = Prof_PutValue(dst, usage.used, 0U);
+        dst = Prof_PutValue(dst, usage.size - usage.used, 0U);
+        *dst = '\0';
+        print(line);
+    }
+
+    print("section            size");
+
+    for (i = 0; i < MEM_PROF_SECTIONS; i++)
+    {
+        dst = Prof_PutText(line, sections[i].name, PROF_NAME_WIDTH);
+        dst = Prof_PutValue(dst, (uint32_t)(sections[i].end - sections[i].start), 0U);
+        *dst = '\0';
+        print(line);
+    }
+}
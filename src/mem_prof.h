@@ -0,0 +1,61 @@
+/**
+ ******************************************************************************
+ * @file      mem_prof.h
+ * @brief     RAM high-water-mark profiling: the main stack and any other
+ * registered region are painted with a pattern, and the untouched part is
+ * measured later, alongside the static RAM layout from the linker script.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef MEM_PROF_H_
+#define MEM_PROF_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "status.h"
+#include "prof.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Fill word of unused memory; the byte FreeRTOS fills its task stacks with
+#define MEM_PROF_PATTERN        0xA5A5A5A5U
+
+// Regions tracked at once, the main stack included
+#ifndef MEM_PROF_MAX_REGIONS
+#define MEM_PROF_MAX_REGIONS    4U
+#endif
+
+// Bytes below the stack pointer left unpainted by MemProf_Init(), for its own frame
+#define MEM_PROF_SP_MARGIN      64U
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Peak usage of one region, in bytes.
+ */
+typedef struct
+{
+    const char *name;
+    uint32_t size;      // Whole region
+    uint32_t used;      // Deepest point ever written, counted down from the top
+} mem_prof_usage_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void MemProf_Init(void);
+status_t MemProf_Register(const char *name, uint32_t *base, uint32_t size);
+uint8_t MemProf_Count(void);
+status_t MemProf_Get(uint8_t index, mem_prof_usage_t *usage);
+void MemProf_Dump(prof_print_t print);
+
+#endif /* MEM_PROF_H_ */
@@ -0,0 +1,116 @@
+/**
+ ******************************************************************************
+ * @file      perf_cfg.c
+ * @brief     Explicit code cache and flash prefetch configuration, and the
+ * PERF_HOT marker that groups hot functions in flash for cache locality.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "perf_cfg.h"
+#include "S32K144.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Cache region modes, two bits per 256 MB region, region 0 in the top bits
+#define PERF_REGION_NON_CACHEABLE   0x0U
+#define PERF_REGION_WRITE_THROUGH   0x2U
+#define PERF_REGION_SHIFT(n)        (30U - (2U * (n)))
+
+// Only program flash (region 0) is cached. Region 1 holds SRAM_L, which the
+// eDMA writes behind the cache's back, and the FlexNVM the data log programs
+#define PERF_CACHE_REGIONS          (PERF_REGION_WRITE_THROUGH << PERF_REGION_SHIFT(0U))
+
+// MSCM OCMDR0 (program flash) OCM1 field: each set bit disables one kind of speculation
+#define PERF_OCM1_NO_INSTR_PREFETCH 0x1U
+#define PERF_OCM1_NO_DATA_PREFETCH  0x2U
+#define PERF_OCMDR_PFLASH           0U
+
+// Completes the cache switch before the next instruction fetch
+#if defined(__GNUC__) && defined(__ARM_ARCH)
+#define PERF_ISB()                  __asm volatile ("isb" ::: "memory")
+#else
+#define PERF_ISB()                  __asm volatile ("" ::: "memory")
+#endif
+
+/*============================================================================*/
+/* External Symbols                                */
+/*============================================================================*/
+
+// Bounds of the PERF_HOT block, from the linker script
+extern const uint8_t __text_hot_start__[];
+extern const uint8_t __text_hot_end__[];
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Applies the PERF_ settings to the flash controller and the cache.
+ * @details Call once early in main(), whatever SystemInit() left behind:
+ * the SDK's start-up code only touches the cache when its I_CACHE option
+ * is defined, and then caches every region. A read-only OCMDR0, locked by
+ * the boot configuration, keeps its reset speculation settings.
+ */
+void PerfCfg_Init(void)
+{
+    uint32_t ocm1 = 0;
+
+#if !PERF_FLASH_INSTR_PREFETCH
+    ocm1 |= PERF_OCM1_NO_INSTR_PREFETCH;
+#endif
+#if !PERF_FLASH_DATA_PREFETCH
+    ocm1 |= PERF_OCM1_NO_DATA_PREFETCH;
+#endif
+
+    if ((MSCM->OCMDR[PERF_OCMDR_PFLASH] & MSCM_OCMDR_RO_MASK) == 0U)
+    {
+        MSCM->OCMDR[PERF_OCMDR_PFLASH] = (MSCM->OCMDR[PERF_OCMDR_PFLASH] & ~MSCM_OCMDR_OCM1_MASK) |
+                                         MSCM_OCMDR_OCM1(ocm1);
+    }
+
+    PerfCfg_SetCodeCache(PERF_CODE_CACHE != 0);
+}
+
+/**
+ * @brief Switches the code cache on or off, e.g. to measure its gain.
+ * @details The cache is write-through, so it can be turned off at any time.
+ * Turning it on sets the region modes, which may only change while it is
+ * off, and invalidates both ways first, so nothing cached before a flash
+ * update is hit afterwards. Takes a few hundred cycles.
+ * @param enable true to cache program flash fetches.
+ */
+void PerfCfg_SetCodeCache(bool enable)
+{
+    LMEM->PCCCR &= ~LMEM_PCCCR_ENCACHE_MASK;
+    PERF_ISB();
+
+    if (!enable)
+    {
+        return;
+    }
+
+    LMEM->PCCRMR = PERF_CACHE_REGIONS;
+    LMEM->PCCCR = LMEM_PCCCR_INVW0_MASK | LMEM_PCCCR_INVW1_MASK | LMEM_PCCCR_GO_MASK;
+    while ((LMEM->PCCCR & LMEM_PCCCR_GO_MASK) != 0U)
+    {
+    }
+    LMEM->PCCCR = LMEM_PCCCR_ENCACHE_MASK;
+    PERF_ISB();
+}
+
+/**
+ * @brief Returns the size of the PERF_HOT block in bytes.
+ * @details Once it outgrows the 4 KB cache the path evicts itself on every
+ * pass, and the gain of the grouping is gone.
+ */
+uint32_t PerfCfg_HotTextSize(void)
+{
+    return (uint32_t)(__text_hot_end__ - __text_hot_start__);
+}
@@ -0,0 +1,79 @@
+/**
+ ******************************************************************************
+ * @file      perf_cfg.h
+ * @brief     Explicit code cache and flash prefetch configuration, the
+ * PERF_HOT marker that groups hot functions in flash for cache locality,
+ * and PERF_NOINIT for buffers the start-up code need not clear.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef PERF_CFG_H_
+#define PERF_CFG_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Set to 0 to run without the 4 KB LMEM code cache
+#ifndef PERF_CODE_CACHE
+#define PERF_CODE_CACHE         1
+#endif
+
+// Program flash speculation: instructions pay off in any loop, data mainly
+// for tables read in order, such as the calibration and glyph tables
+#ifndef PERF_FLASH_INSTR_PREFETCH
+#define PERF_FLASH_INSTR_PREFETCH   1
+#endif
+#ifndef PERF_FLASH_DATA_PREFETCH
+#define PERF_FLASH_DATA_PREFETCH    1
+#endif
+
+// Set to 0 to leave PERF_HOT functions wherever the linker puts them
+#ifndef PERF_HOT_GROUPING
+#define PERF_HOT_GROUPING       1
+#endif
+
+/**
+ * @brief Marks a function definition as part of the per-sample or per-frame
+ * path. It is put in .text.hot, which the linker script places as one block
+ * at the start of .text, so the whole path shares as few cache lines and
+ * sets as possible; GCC also optimizes it for speed. The section is named
+ * explicitly because GCC only moves hot functions into .text.hot.* by
+ * itself with -freorder-functions, which -O1 (Debug_FLASH, Benchmark_FLASH)
+ * leaves off.
+ */
+#if PERF_HOT_GROUPING && defined(__GNUC__)
+#define PERF_HOT                __attribute__((hot, section(".text.hot")))
+#else
+#define PERF_HOT
+#endif
+
+/**
+ * @brief Places a buffer in .noinit, which the start-up code neither copies
+ * nor clears, so its size costs no boot time. Only for data that is always
+ * written in full before it is read: its content after a reset is whatever
+ * the RAM held.
+ */
+#if defined(__GNUC__)
+#define PERF_NOINIT             __attribute__((section(".noinit")))
+#else
+#define PERF_NOINIT
+#endif
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void PerfCfg_Init(void);
+void PerfCfg_SetCodeCache(bool enable);
+uint32_t PerfCfg_HotTextSize(void);
+
+#endif /* PERF_CFG_H_ */
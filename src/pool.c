@@ -0,0 +1,98 @@
+/**
+ ******************************************************************************
+ * @file      pool.c
+ * @brief     Lock-free fixed-block memory pool, so transfer buffers can be
+ * handed to a driver and returned from its completion interrupt without a
+ * heap.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "pool.h"
+#include <stddef.h>
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Attaches storage to a pool and marks every block free.
+ * @details Must be called before any context uses the pool.
+ * @param pool       Pool to initialize.
+ * @param storage    At least count * POOL_STRIDE(block_size) bytes, e.g.
+ *                   declared with POOL_STORAGE().
+ * @param block_size Usable bytes per block.
+ * @param count      Number of blocks (1..POOL_MAX_BLOCKS).
+ * @return false on a bad size or count.
+ */
+bool Pool_Init(pool_t *pool, uint32_t *storage, uint32_t block_size, uint8_t count)
+{
+    if ((storage == NULL) || (block_size == 0U) || (count == 0U) || (count > POOL_MAX_BLOCKS))
+    {
+        return false;
+    }
+
+    pool->base = (uint8_t *)storage;
+    pool->stride = POOL_STRIDE(block_size);
+    pool->count = count;
+    pool->free_mask = (count == POOL_MAX_BLOCKS) ? 0xFFFFFFFFU : ((1UL << count) - 1U);
+
+    return true;
+}
+
+/**
+ * @brief Takes a free block.
+ * @details Wait-free against Pool_Free() and lock-free against other
+ * allocations: the compare-and-swap only retries when another context
+ * changed the mask in between. The lowest free block is taken.
+ * @return The block, or NULL when all are in use.
+ */
+void *Pool_Alloc(pool_t *pool)
+{
+    uint32_t mask = __atomic_load_n(&pool->free_mask, __ATOMIC_ACQUIRE);
+    uint32_t index;
+
+    do
+    {
+        if (mask == 0U)
+        {
+            return NULL;
+        }
+        index = (uint32_t)__builtin_ctz(mask);
+    } while (!__atomic_compare_exchange_n(&pool->free_mask, &mask, mask & ~(1UL << index),
+                                          true, __ATOMIC_ACQ_REL, __ATOMIC_ACQUIRE));
+
+    return pool->base + (index * pool->stride);
+}
+
+/**
+ * @brief Returns a block to its pool; callable from interrupt context, e.g.
+ * from the completion callback of the transfer that owned it.
+ * @return false if the pointer is not a block of this pool or is already free.
+ */
+bool Pool_Free(pool_t *pool, void *block)
+{
+    uint32_t offset = (uint32_t)((uint8_t *)block - pool->base);
+    uint32_t index = offset / pool->stride;
+    uint32_t bit;
+
+    if (((uint8_t *)block < pool->base) || (index >= pool->count) || ((offset % pool->stride) != 0U))
+    {
+        return false;
+    }
+
+    bit = 1UL << index;
+    return (__atomic_fetch_or(&pool->free_mask, bit, __ATOMIC_RELEASE) & bit) == 0U;
+}
+
+/**
+ * @brief Returns the number of free blocks; a snapshot while other contexts run.
+ */
+uint8_t Pool_Available(const pool_t *pool)
+{
+    return (uint8_t)__builtin_popcount(pool->free_mask);
+}
@@ -0,0 +1,62 @@
+/**
+ ******************************************************************************
+ * @file      pool.h
+ * @brief     Lock-free fixed-block memory pool, so transfer buffers can be
+ * handed to a driver and returned from its completion interrupt without a
+ * heap.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef POOL_H_
+#define POOL_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define POOL_MAX_BLOCKS     32U  // One bit of the free mask per block
+
+// Blocks are laid out on word boundaries
+#define POOL_STRIDE(block_size)     ((((uint32_t)(block_size)) + 3U) & ~3UL)
+
+/**
+ * @brief Declares word-aligned storage for count blocks of block_size bytes.
+ */
+#define POOL_STORAGE(name, block_size, count) \
+    uint32_t name[(POOL_STRIDE(block_size) / 4U) * (count)]
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Pool state. A set bit in free_mask is a free block; allocation and
+ * release each update the mask with one exclusive load/store pair, so any
+ * context may allocate or free without masking interrupts.
+ */
+typedef struct
+{
+    uint8_t *base;               // Caller-provided storage
+    uint32_t stride;             // Block size rounded up to a word
+    uint8_t count;               // Number of blocks
+    volatile uint32_t free_mask; // Bit n set while block n is free
+} pool_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+bool Pool_Init(pool_t *pool, uint32_t *storage, uint32_t block_size, uint8_t count);
+void *Pool_Alloc(pool_t *pool);
+bool Pool_Free(pool_t *pool, void *block);
+uint8_t Pool_Available(const pool_t *pool);
+
+#endif /* POOL_H_ */
@@ -0,0 +1,371 @@
+/**
+ ******************************************************************************
+ * @file      power.c
+ * @brief     Run-mode power profiles: HSRUN at 112 MHz for bursts of work,
+ * RUN at 48 MHz and VLPR at 4 MHz for idle, switched at run time, and VLPS
+ * for idle time that needs no clock but SIRC.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "power.h"
+#include <stddef.h>
+#include <stdbool.h>
+#include "device_registers.h"
+#include "osif.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// SMC_PMCTRL[RUNM] requests
+#define POWER_RUNM_RUN          0U
+#define POWER_RUNM_VLPR         2U
+#define POWER_RUNM_HSRUN        3U
+
+// SMC_PMCTRL[STOPM] request for the stop mode WFI enters with SLEEPDEEP
+#define POWER_STOPM_VLPS        2U
+
+// SMC_PMSTAT values once a mode is reached
+#define POWER_PMSTAT_RUN        0x01U
+#define POWER_PMSTAT_VLPR       0x04U
+#define POWER_PMSTAT_HSRUN      0x80U
+
+// SCG_CSR[SCS] system clock sources
+#define POWER_SCS_SIRC          2U
+#define POWER_SCS_FIRC          3U
+#define POWER_SCS_SPLL          6U
+
+// RUN clocked from SIRC at 8 MHz core and bus, 4 MHz slow, on the way to VLPR
+#define POWER_RCCR_SIRC         (SCG_RCCR_SCS(POWER_SCS_SIRC) | SCG_RCCR_DIVCORE(0U) | \
+                                 SCG_RCCR_DIVBUS(0U) | SCG_RCCR_DIVSLOW(1U))
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static power_profile_t s_profile;
+
+// Modules told about every switch, most recently registered first
+static power_client_t *s_clients;
+
+// RUN clock and the fast sources that were running before VLPR was entered
+static uint32_t s_rccr;
+static bool s_firc_on;
+static bool s_sosc_on;
+static bool s_spll_on;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Polls a register until the masked bits equal a value.
+ * @return STATUS_TIMEOUT after POWER_SWITCH_TIMEOUT reads.
+ */
+static status_t Power_Wait(const volatile uint32_t *reg, uint32_t mask, uint32_t value)
+{
+    uint32_t n;
+
+    for (n = 0; n < POWER_SWITCH_TIMEOUT; n++)
+    {
+        if ((*reg & mask) == value)
+        {
+            return STATUS_SUCCESS;
+        }
+    }
+
+    return STATUS_TIMEOUT;
+}
+
+/**
+ * @brief Requests a run mode and waits until SMC reports it.
+ */
+static status_t Power_RequestMode(uint32_t runm, uint32_t pmstat)
+{
+    SMC->PMCTRL = (SMC->PMCTRL & ~SMC_PMCTRL_RUNM_MASK) | SMC_PMCTRL_RUNM(runm);
+
+    return Power_Wait(&SMC->PMSTAT, SMC_PMSTAT_PMSTAT_MASK, pmstat);
+}
+
+/**
+ * @brief Waits until the SCG runs the system clock from the given source.
+ */
+static status_t Power_WaitSource(uint32_t scs)
+{
+    return Power_Wait(&SCG->CSR, SCG_CSR_SCS_MASK, scs << SCG_CSR_SCS_SHIFT);
+}
+
+/**
+ * @brief RUN to HSRUN; the SCG switches to the SPLL settings in HCCR.
+ */
+static status_t Power_EnterHsrun(void)
+{
+    status_t status;
+
+    if ((SCG->SPLLCSR & SCG_SPLLCSR_SPLLVLD_MASK) == 0U)
+    {
+        return STATUS_ERROR;
+    }
+
+    status = Power_RequestMode(POWER_RUNM_HSRUN, POWER_PMSTAT_HSRUN);
+    if (status == STATUS_SUCCESS)
+    {
+        status = Power_WaitSource(POWER_SCS_SPLL);
+    }
+
+    return status;
+}
+
+/**
+ * @brief HSRUN to RUN; the SCG switches back to the settings in RCCR.
+ */
+static status_t Power_ExitHsrun(void)
+{
+    status_t status;
+
+    status = Power_RequestMode(POWER_RUNM_RUN, POWER_PMSTAT_RUN);
+    if (status == STATUS_SUCCESS)
+    {
+        status = Power_WaitSource((SCG->RCCR & SCG_RCCR_SCS_MASK) >> SCG_RCCR_SCS_SHIFT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief RUN to VLPR.
+ * @details VLPR only allows SIRC, so RUN first moves onto it and the fast
+ * sources are stopped, the PLL before the oscillator it runs from. Their
+ * configuration registers keep their values for Power_ExitVlpr().
+ */
+static status_t Power_EnterVlpr(void)
+{
+    status_t status;
+
+    s_rccr = SCG->RCCR;
+    SCG->RCCR = POWER_RCCR_SIRC;
+    status = Power_WaitSource(POWER_SCS_SIRC);
+    if (status != STATUS_SUCCESS)
+    {
+        return status;
+    }
+
+    s_spll_on = (SCG->SPLLCSR & SCG_SPLLCSR_SPLLEN_MASK) != 0U;
+    s_sosc_on = (SCG->SOSCCSR & SCG_SOSCCSR_SOSCEN_MASK) != 0U;
+    s_firc_on = (SCG->FIRCCSR & SCG_FIRCCSR_FIRCEN_MASK) != 0U;
+    SCG->SPLLCSR &= ~SCG_SPLLCSR_SPLLEN_MASK;
+    SCG->SOSCCSR &= ~SCG_SOSCCSR_SOSCEN_MASK;
+    SCG->FIRCCSR &= ~SCG_FIRCCSR_FIRCEN_MASK;
+
+    return Power_RequestMode(POWER_RUNM_VLPR, POWER_PMSTAT_VLPR);
+}
+
+/**
+ * @brief VLPR to RUN.
+ * @details Restarts the sources Power_EnterVlpr() stopped, waiting for each
+ * to become valid, then restores the RUN clock. The crystal start-up makes
+ * this the slowest transition, typically a few milliseconds.
+ */
+static status_t Power_ExitVlpr(void)
+{
+    status_t status;
+
+    status = Power_RequestMode(POWER_RUNM_RUN, POWER_PMSTAT_RUN);
+    if ((status == STATUS_SUCCESS) && s_firc_on)
+    {
+        SCG->FIRCCSR |= SCG_FIRCCSR_FIRCEN_MASK;
+        status = Power_Wait(&SCG->FIRCCSR, SCG_FIRCCSR_FIRCVLD_MASK, SCG_FIRCCSR_FIRCVLD_MASK);
+    }
+    if ((status == STATUS_SUCCESS) && s_sosc_on)
+    {
+        SCG->SOSCCSR |= SCG_SOSCCSR_SOSCEN_MASK;
+        status = Power_Wait(&SCG->SOSCCSR, SCG_SOSCCSR_SOSCVLD_MASK, SCG_SOSCCSR_SOSCVLD_MASK);
+    }
+    if ((status == STATUS_SUCCESS) && s_spll_on)
+    {
+        SCG->SPLLCSR |= SCG_SPLLCSR_SPLLEN_MASK;
+        status = Power_Wait(&SCG->SPLLCSR, SCG_SPLLCSR_SPLLVLD_MASK, SCG_SPLLCSR_SPLLVLD_MASK);
+    }
+    if (status == STATUS_SUCCESS)
+    {
+        SCG->RCCR = s_rccr;
+        status = Power_WaitSource((s_rccr & SCG_RCCR_SCS_MASK) >> SCG_RCCR_SCS_SHIFT);
+    }
+
+    return status;
+}
+
+/**
+ * @brief Moves one step towards a profile; HSRUN and VLPR are only reachable from RUN.
+ */
+static status_t Power_Step(power_profile_t target)
+{
+    status_t status;
+    power_profile_t next;
+
+    if (s_profile == POWER_PROFILE_HSRUN)
+    {
+        status = Power_ExitHsrun();
+        next = POWER_PROFILE_RUN;
+    }
+    else if (s_profile == POWER_PROFILE_VLPR)
+    {
+        status = Power_ExitVlpr();
+        next = POWER_PROFILE_RUN;
+    }
+    else if (target == POWER_PROFILE_HSRUN)
+    {
+        status = Power_EnterHsrun();
+        next = POWER_PROFILE_HSRUN;
+    }
+    else
+    {
+        status = Power_EnterVlpr();
+        next = POWER_PROFILE_VLPR;
+    }
+
+    if (status == STATUS_SUCCESS)
+    {
+        s_profile = next;
+    }
+
+    return status;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Allows HSRUN and VLPR and picks up the current run mode.
+ * @details Call once after CLOCK_DRV_Init(). SMC_PMPROT is write-once after
+ * reset, so nothing else may write it. The bias enable is needed for VLPR.
+ */
+void Power_Init(void)
+{
+    uint32_t pmstat;
+
+    SMC->PMPROT = SMC_PMPROT_AHSRUN_MASK | SMC_PMPROT_AVLP_MASK;
+    PMC->REGSC |= PMC_REGSC_BIASEN_MASK;
+
+    pmstat = SMC->PMSTAT & SMC_PMSTAT_PMSTAT_MASK;
+    if (pmstat == POWER_PMSTAT_HSRUN)
+    {
+        s_profile = POWER_PROFILE_HSRUN;
+    }
+    else if (pmstat == POWER_PMSTAT_VLPR)
+    {
+        s_profile = POWER_PROFILE_VLPR;
+    }
+    else
+    {
+        s_profile = POWER_PROFILE_RUN;
+    }
+    s_clients = NULL;
+}
+
+/**
+ * @brief Adds a module to be notified after every profile switch.
+ * @param client Caller-owned registration, must stay valid.
+ * @param notify Re-derives the module's timing from the new clocks.
+ * @param param  Passed to notify.
+ */
+void Power_Register(power_client_t *client, power_notify_t notify, void *param)
+{
+    client->notify = notify;
+    client->param = param;
+    client->next = s_clients;
+    s_clients = client;
+}
+
+/**
+ * @brief Switches the run mode and re-derives everything clocked from it.
+ * @details Main context only. The OSIF tick is reloaded for the new core
+ * clock at each step, then every registered client is notified once. LPI2C0, ADC0 and LPIT0
+ * run from SIRCDIV2, which is the same in all three modes, so their baud
+ * rate and clock dividers stay valid without a client. Interrupts keep
+ * running during the switch, at whichever clock is active at the time.
+ * @param profile Profile to run in.
+ * @return STATUS_TIMEOUT or STATUS_ERROR if a transition did not complete;
+ * the profile reached so far is kept and reported by Power_GetProfile().
+ */
+status_t Power_SetProfile(power_profile_t profile)
+{
+    status_t status = STATUS_SUCCESS;
+    power_profile_t from = s_profile;
+    power_profile_t previous;
+    power_client_t *client;
+
+    if ((uint32_t)profile >= (uint32_t)POWER_PROFILE_COUNT)
+    {
+        return STATUS_ERROR;
+    }
+
+    while ((status == STATUS_SUCCESS) && (s_profile != profile))
+    {
+        previous = s_profile;
+        status = Power_Step(profile);
+
+        // Reload the tick at every step, even a failed one that may have moved
+        // the clock, so the crystal start-up on the way out of VLPR is timed
+        // right; a count left over from a faster clock would stretch the tick
+        if (s_profile < previous)
+        {
+            S32_SysTick->CVR = 0U;
+        }
+        OSIF_TimeDelay(0U);
+    }
+
+    if ((s_profile != from) || (status != STATUS_SUCCESS))
+    {
+        for (client = s_clients; client != NULL; client = client->next)
+        {
+            client->notify(s_profile, client->param);
+        }
+    }
+
+    return status;
+}
+
+/**
+ * @brief Returns the active profile.
+ */
+power_profile_t Power_GetProfile(void)
+{
+    return s_profile;
+}
+
+/**
+ * @brief Sleeps until the next interrupt, in VLPS or in the current run mode.
+ * @details Meant for the idle hook of the scheduler, called with interrupts
+ * masked. In VLPS the core, bus and flash clocks stop along with SysTick, so
+ * OSIF time and every scheduler timer stand still until the wake-up; SIRC is
+ * kept running in stop, so ADC0 and LPI2C0 on SIRCDIV2 and LPTMR0 on the LPO
+ * keep working and their interrupts end the stop. The core resumes in the
+ * run mode it stopped from. HSRUN cannot enter a stop mode, so there the
+ * core only sleeps.
+ * @param stop true to enter VLPS, false for plain WFI.
+ */
+void Power_Sleep(bool stop)
+{
+    if (stop && (s_profile != POWER_PROFILE_HSRUN))
+    {
+        SCG->SIRCCSR |= SCG_SIRCCSR_SIRCSTEN_MASK | SCG_SIRCCSR_SIRCLPEN_MASK;
+        SMC->PMCTRL = (SMC->PMCTRL & ~SMC_PMCTRL_STOPM_MASK) | SMC_PMCTRL_STOPM(POWER_STOPM_VLPS);
+        // Read back so the request has reached SMC before WFI
+        (void)SMC->PMCTRL;
+        S32_SCB->SCR |= S32_SCB_SCR_SLEEPDEEP_MASK;
+        STANDBY();
+        S32_SCB->SCR &= ~S32_SCB_SCR_SLEEPDEEP_MASK;
+    }
+    else
+    {
+        S32_SCB->SCR &= ~S32_SCB_SCR_SLEEPDEEP_MASK;
+        STANDBY();
+    }
+}
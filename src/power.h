@@ -0,0 +1,72 @@
+/**
+ ******************************************************************************
+ * @file      power.h
+ * @brief     Run-mode power profiles: HSRUN at 112 MHz for bursts of work,
+ * RUN at 48 MHz and VLPR at 4 MHz for idle, switched at run time, and VLPS
+ * for idle time that needs no clock but SIRC.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef POWER_H_
+#define POWER_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define POWER_SWITCH_TIMEOUT    100000U  // Poll iterations allowed for each mode or clock transition
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Run modes, in order of increasing clock. The system clocks of each
+ * come from the RCCR/VCCR/HCCR settings CLOCK_DRV_Init() programmed.
+ */
+typedef enum
+{
+    POWER_PROFILE_VLPR = 0,     // SIRC/2: 4 MHz core and bus
+    POWER_PROFILE_RUN,          // FIRC: 48 MHz core and bus
+    POWER_PROFILE_HSRUN,        // SPLL: 112 MHz core, 56 MHz bus
+    POWER_PROFILE_COUNT
+} power_profile_t;
+
+/**
+ * @brief Called after every completed switch, with the new clocks running.
+ * @param profile Profile now active.
+ * @param param   User parameter given to Power_Register().
+ */
+typedef void (*power_notify_t)(power_profile_t profile, void *param);
+
+/**
+ * @brief Registration of a module whose timing depends on the core or bus
+ * clock. Owned by the caller.
+ */
+typedef struct power_client
+{
+    power_notify_t notify;
+    void *param;
+    struct power_client *next;
+} power_client_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void Power_Init(void);
+void Power_Register(power_client_t *client, power_notify_t notify, void *param);
+status_t Power_SetProfile(power_profile_t profile);
+power_profile_t Power_GetProfile(void);
+void Power_Sleep(bool stop);
+
+#endif /* POWER_H_ */
@@ -0,0 +1,432 @@
+/**
+ ******************************************************************************
+ * @file      prof.c
+ * @brief     Cycle-accurate code profiling on the DWT cycle counter, with
+ * min/max/average accumulators per probe, plain event counters and log2
+ * latency histograms.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "prof.h"
+#include <stddef.h>
+#include "S32K144.h"
+#include "clock_manager.h"
+#include "fmt.h"
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define PROF_DWT_CTRL           (*(volatile uint32_t *)0xE0001000U)
+#define PROF_DWT_CTRL_CYCCNTENA 0x00000001U
+#define PROF_DEMCR              (*(volatile uint32_t *)0xE000EDFCU)
+#define PROF_DEMCR_TRCENA       0x01000000U
+
+// LPIT0 needs four functional clocks after M_CEN before its timers can be set up
+#define PROF_TS_ENABLE_CLOCKS   4U
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static prof_stat_t s_stats[PROF_ID_COUNT];
+
+// Cycles an empty PROF_BEGIN/PROF_END pair measures
+static uint32_t s_overhead;
+
+static const char * const s_names[PROF_ID_COUNT] =
+{
+    "lcd_string",
+    "i2c_block",
+    "lcd_flush",
+    "adc_block",
+    "temp_conv",
+};
+
+// Incremented from any context, see Prof_Count()
+static uint32_t s_counts[PROF_CNT_COUNT];
+
+static const char * const s_count_names[PROF_CNT_COUNT] =
+{
+    "i2c_nack",
+    "i2c_arb_lost",
+    "i2c_timeout",
+    "i2c_bus_busy",
+    "i2c_other",
+    "i2c_recover",
+    "i2c_rec_fail",
+};
+
+// Bucket counts, incremented from any context, see Prof_Hist()
+static prof_hist_t s_hists[PROF_HIST_COUNT];
+
+static const char * const s_hist_names[PROF_HIST_COUNT] =
+{
+    "isr_adc",
+    "isr_dma",
+    "isr_i2c",
+    "sample_value",
+    "value_lcd",
+};
+
+// Rate of PROF_TIMESTAMP(), 0 if LPIT0 is not clocked
+static uint32_t s_ts_hz;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Upper bound of the bucket holding a given share of a histogram.
+ * @param hist     Histogram to scan.
+ * @param total    Sum of its buckets, non-zero.
+ * @param permille Share of the values at or below the result, 1..1000.
+ * @return Largest value the bucket can hold, in ticks.
+ */
+static uint32_t Prof_HistBound(const prof_hist_t *hist, uint32_t total, uint32_t permille)
+{
+    uint64_t wanted = (((uint64_t)total * permille) + 999U) / 1000U;
+    uint64_t seen = 0;
+    uint8_t b;
+
+    for (b = 0; b < (PROF_HIST_BUCKETS - 1U); b++)
+    {
+        seen += hist->bucket[b];
+        if (seen >= wanted)
+        {
+            break;
+        }
+    }
+
+    return (b == 0U) ? 0U : ((b >= 31U) ? 0xFFFFFFFFU : ((1UL << b) - 1U));
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Starts the DWT cycle counter and measures the probe overhead.
+ * @details The counter runs whether or not a debugger is attached once
+ * TRCENA is set. Also starts the LPIT0 timestamp channel, which must not
+ * be used by anything else.
+ */
+void Prof_Init(void)
+{
+    uint32_t start, cycles;
+    uint32_t core_hz = 0;
+    uint8_t i;
+
+    PROF_DEMCR |= PROF_DEMCR_TRCENA;
+    PROF_DWT_CYCCNT = 0;
+    PROF_DWT_CTRL |= PROF_DWT_CTRL_CYCCNTENA;
+
+    // Timestamp channel: 32-bit periodic mode from the largest reload, so it
+    // simply wraps; it keeps counting under the debugger and in sleep
+    s_ts_hz = 0;
+    (void)CLOCK_SYS_GetFreq(LPIT0_CLK, &s_ts_hz);
+    (void)CLOCK_SYS_GetFreq(CORE_CLK, &core_hz);
+    if (s_ts_hz != 0U)
+    {
+        LPIT0->MCR = LPIT_MCR_M_CEN_MASK | LPIT_MCR_DBG_EN_MASK | LPIT_MCR_DOZE_EN_MASK;
+        start = PROF_DWT_CYCCNT;
+        while ((PROF_DWT_CYCCNT - start) <= ((core_hz / s_ts_hz) * PROF_TS_ENABLE_CLOCKS))
+        {
+        }
+        LPIT0->TMR[PROF_TS_CHANNEL].TCTRL = 0;
+        LPIT0->TMR[PROF_TS_CHANNEL].TVAL = 0xFFFFFFFFU;
+        LPIT0->TMR[PROF_TS_CHANNEL].TCTRL = LPIT_TMR_TCTRL_T_EN_MASK;
+    }
+
+    // Smallest of a few runs, so an interrupt during calibration does not count
+    s_overhead = 0xFFFFFFFFU;
+    for (i = 0; i < 4U; i++)
+    {
+        start = PROF_DWT_CYCCNT;
+        cycles = PROF_DWT_CYCCNT - start;
+        if (cycles < s_overhead)
+        {
+            s_overhead = cycles;
+        }
+    }
+
+    Prof_Reset();
+}
+
+/**
+ * @brief Clears every accumulator, counter and histogram.
+ */
+void Prof_Reset(void)
+{
+    uint8_t i, b;
+
+    for (i = 0; i < (uint8_t)PROF_ID_COUNT; i++)
+    {
+        s_stats[i].count = 0;
+        s_stats[i].min = 0xFFFFFFFFU;
+        s_stats[i].max = 0;
+        s_stats[i].total = 0;
+    }
+    for (i = 0; i < (uint8_t)PROF_CNT_COUNT; i++)
+    {
+        __atomic_store_n(&s_counts[i], 0U, __ATOMIC_RELAXED);
+    }
+    for (i = 0; i < (uint8_t)PROF_HIST_COUNT; i++)
+    {
+        for (b = 0; b < PROF_HIST_BUCKETS; b++)
+        {
+            __atomic_store_n(&s_hists[i].bucket[b], 0U, __ATOMIC_RELAXED);
+        }
+    }
+}
+
+/**
+ * @brief Adds one measurement to a probe; normally called through PROF_END().
+ * @details Not reentrant per probe: a given id must only be measured from
+ * one context (main or one interrupt).
+ * @param id     Probe to update.
+ * @param cycles Raw cycles between PROF_BEGIN() and PROF_END().
+ */
+void Prof_Record(prof_id_t id, uint32_t cycles)
+{
+    prof_stat_t *stat;
+
+    if ((uint32_t)id >= (uint32_t)PROF_ID_COUNT)
+    {
+        return;
+    }
+
+    stat = &s_stats[id];
+    cycles = (cycles > s_overhead) ? (cycles - s_overhead) : 0U;
+    stat->count++;
+    stat->total += cycles;
+    if (cycles < stat->min)
+    {
+        stat->min = cycles;
+    }
+    if (cycles > stat->max)
+    {
+        stat->max = cycles;
+    }
+}
+
+/**
+ * @brief Copies the accumulators of one probe.
+ * @param id   Probe to read.
+ * @param stat Destination; min is 0xFFFFFFFF while count is 0.
+ */
+void Prof_Get(prof_id_t id, prof_stat_t *stat)
+{
+    if ((uint32_t)id < (uint32_t)PROF_ID_COUNT)
+    {
+        *stat = s_stats[id];
+    }
+}
+
+/**
+ * @brief Adds one to an event counter.
+ * @details Unlike the probes, safe from any number of contexts at once: the
+ * increment is a single exclusive load/store pair.
+ * @param id Counter to increment.
+ */
+void Prof_Count(prof_counter_t id)
+{
+    if ((uint32_t)id < (uint32_t)PROF_CNT_COUNT)
+    {
+        (void)__atomic_fetch_add(&s_counts[id], 1U, __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * @brief Reads an event counter.
+ * @return Events since Prof_Init() or Prof_Reset(), 0 for an unknown id.
+ */
+uint32_t Prof_GetCount(prof_counter_t id)
+{
+    if ((uint32_t)id >= (uint32_t)PROF_CNT_COUNT)
+    {
+        return 0;
+    }
+
+    return __atomic_load_n(&s_counts[id], __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Returns the rate of PROF_TIMESTAMP() in Hz.
+ * @return 0 before Prof_Init(), or if LPIT0 has no functional clock.
+ */
+uint32_t Prof_TimestampHz(void)
+{
+    return s_ts_hz;
+}
+
+/**
+ * @brief Adds one value to a histogram.
+ * @details Constant time, a count-leading-zeros and one exclusive
+ * increment, so it is safe from any context and cheap enough for an
+ * interrupt's first instructions.
+ * @param id    Histogram to update.
+ * @param ticks Latency, normally the difference of two PROF_TIMESTAMP()s.
+ */
+PERF_HOT void Prof_Hist(prof_hist_id_t id, uint32_t ticks)
+{
+    uint32_t b;
+
+    if ((uint32_t)id >= (uint32_t)PROF_HIST_COUNT)
+    {
+        return;
+    }
+
+    b = (ticks == 0U) ? 0U : (32U - (uint32_t)__builtin_clz(ticks));
+    if (b >= PROF_HIST_BUCKETS)
+    {
+        b = PROF_HIST_BUCKETS - 1U;
+    }
+    (void)__atomic_fetch_add(&s_hists[id].bucket[b], 1U, __ATOMIC_RELAXED);
+}
+
+/**
+ * @brief Copies the buckets of one histogram.
+ * @details Values recorded during the copy may or may not be included.
+ */
+void Prof_GetHist(prof_hist_id_t id, prof_hist_t *hist)
+{
+    uint8_t b;
+
+    if ((uint32_t)id >= (uint32_t)PROF_HIST_COUNT)
+    {
+        return;
+    }
+
+    for (b = 0; b < PROF_HIST_BUCKETS; b++)
+    {
+        hist->bucket[b] = __atomic_load_n(&s_hists[id].bucket[b], __ATOMIC_RELAXED);
+    }
+}
+
+/**
+ * @brief Prints one line per probe that has been hit: count, min, max and
+ * average cycles, then one line per counter that is not zero, then one
+ * line per histogram with values: count and the bucket bounds, in
+ * timestamp ticks, of the median, the 99th percentile and the maximum.
+ * @param print Line sink, e.g. a UART or semihosting writer.
+ */
+void Prof_Dump(prof_print_t print)
+{
+    char line[PROF_NAME_WIDTH + (4U * PROF_VALUE_WIDTH) + 1U];
+    char *dst;
+    const prof_stat_t *stat;
+    prof_hist_t hist;
+    uint32_t count;
+    uint8_t i, b;
+
+    if (print == NULL)
+    {
+        return;
+    }
+
+    print("probe             count        min        max        avg");
+
+    for (i = 0; i < (uint8_t)PROF_ID_COUNT; i++)
+    {
+        stat = &s_stats[i];
+        if (stat->count == 0U)
+        {
+            continue;
+        }
+
+        dst = Prof_PutText(line, s_names[i], PROF_NAME_WIDTH);
+        dst = Prof_PutValue(dst, stat->count, 0U);
+        dst = Prof_PutValue(dst, stat->min, 0U);
+        dst = Prof_PutValue(dst, stat->max, 0U);
+        dst = Prof_PutValue(dst, stat->total / stat->count, 0U);
+        *dst = '\0';
+        print(line);
+    }
+
+    print("counter           count");
+
+    for (i = 0; i < (uint8_t)PROF_CNT_COUNT; i++)
+    {
+        count = Prof_GetCount((prof_counter_t)i);
+        if (count == 0U)
+        {
+            continue;
+        }
+
+        dst = Prof_PutText(line, s_count_names[i], PROF_NAME_WIDTH);
+        dst = Prof_PutValue(dst, count, 0U);
+        *dst = '\0';
+        print(line);
+    }
+
+    print("histogram         count        p50        p99        max");
+
+    for (i = 0; i < (uint8_t)PROF_HIST_COUNT; i++)
+    {
+        Prof_GetHist((prof_hist_id_t)i, &hist);
+        count = 0;
+        for (b = 0; b < PROF_HIST_BUCKETS; b++)
+        {
+            count += hist.bucket[b];
+        }
+        if (count == 0U)
+        {
+            continue;
+        }
+
+        dst = Prof_PutText(line, s_hist_names[i], PROF_NAME_WIDTH);
+        dst = Prof_PutValue(dst, count, 0U);
+        dst = Prof_PutValue(dst, Prof_HistBound(&hist, count, 500U), 0U);
+        dst = Prof_PutValue(dst, Prof_HistBound(&hist, count, 990U), 0U);
+        dst = Prof_PutValue(dst, Prof_HistBound(&hist, count, 1000U), 0U);
+        *dst = '\0';
+        print(line);
+    }
+}
+
+/**
+ * @brief Appends a left-aligned text column to a report line.
+ * @details Shared by every report dump, so their columns line up.
+ * @param dst   Next free character of the line.
+ * @param text  Text to write, cut to @p width; NULL for an empty column.
+ * @param width Column width, PROF_NAME_WIDTH for the first column.
+ * @return The character after the column.
+ */
+char *Prof_PutText(char *dst, const char *text, uint8_t width)
+{
+    while ((text != NULL) && (*text != '\0') && (width != 0U))
+    {
+        *dst++ = *text++;
+        width--;
+    }
+    while (width-- != 0U)
+    {
+        *dst++ = ' ';
+    }
+
+    return dst;
+}
+
+/**
+ * @brief Appends a right-aligned number column of PROF_VALUE_WIDTH.
+ * @param dst      Next free character of the line.
+ * @param value    Number to write, clamped to INT32_MAX.
+ * @param decimals Fixed-point decimals of @p value, 0 for an integer.
+ * @return The character after the column.
+ */
+char *Prof_PutValue(char *dst, uint64_t value, uint8_t decimals)
+{
+    if (value > 0x7FFFFFFFU)
+    {
+        value = 0x7FFFFFFFU;
+    }
+
+    return dst + Fmt_FixedQ(dst, PROF_VALUE_WIDTH, (int32_t)value, decimals, NULL);
+}
@@ -0,0 +1,156 @@
+/**
+ ******************************************************************************
+ * @file      prof.h
+ * @brief     Cycle-accurate code profiling on the DWT cycle counter, with
+ * min/max/average accumulators per probe, plain event counters and log2
+ * latency histograms.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef PROF_H_
+#define PROF_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Set to 0 to compile every probe out of the build
+#ifndef PROF_ENABLE
+#define PROF_ENABLE         1
+#endif
+
+// DWT cycle counter, clocked by the core (ARMv7-M debug architecture)
+#define PROF_DWT_CYCCNT     (*(volatile uint32_t *)0xE0001004U)
+
+// Timestamps come from LPIT0 channel 3 counting down from SIRCDIV2, which
+// runs at the same rate in every run mode, unlike the core clock
+#define PROF_TS_CHANNEL     3U
+#define PROF_TS_CVAL        (*(volatile uint32_t *)(0x40037024U + (PROF_TS_CHANNEL * 0x10U)))
+
+/**
+ * @brief Free-running up-counting timestamp, Prof_TimestampHz() ticks per
+ * second; differences are right across one wrap (about 9 min at 8 MHz).
+ * The host simulation in sim/ defines its own clock.
+ */
+#ifndef PROF_TIMESTAMP
+#define PROF_TIMESTAMP()    (~PROF_TS_CVAL)
+#endif
+
+// Histogram bucket b > 0 counts values in [2^(b-1), 2^b); bucket 0 counts
+// zeros and the last bucket everything from 2^30 up
+#define PROF_HIST_BUCKETS   32U
+
+// Columns of Prof_Dump() and of every other report dump, so they line up
+#define PROF_NAME_WIDTH     12U  // Name or label
+#define PROF_VALUE_WIDTH    11U  // Each number, room for 10 digits and a space
+
+#if PROF_ENABLE
+/**
+ * @brief Opens a measured scope; pair with PROF_END(id) in the same block.
+ * @param id A prof_id_t enumerator.
+ */
+#define PROF_BEGIN(id)      uint32_t prof_start_##id = PROF_DWT_CYCCNT
+#define PROF_END(id)        Prof_Record((id), PROF_DWT_CYCCNT - prof_start_##id)
+#else
+#define PROF_BEGIN(id)
+#define PROF_END(id)
+#endif
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Probe identifiers; add new probes before PROF_ID_COUNT and give
+ * them a name in prof.c.
+ */
+typedef enum
+{
+    PROF_LCD_SEND_STRING = 0,   // LCD_SendString(), whole string
+    PROF_I2C_BLOCKING,          // LPI2C_DRV_MasterSendDataBlocking() from the LCD driver
+    PROF_LCD_FLUSH,             // LCD_FB_Flush(), diff plus blocking transfers
+    PROF_ADC_BLOCK,             // eDMA block callback: decimation and filter
+    PROF_TEMP_CONVERT,          // Temp_FromOversampled()
+    PROF_ID_COUNT
+} prof_id_t;
+
+/**
+ * @brief Event counters; add new counters before PROF_CNT_COUNT and give
+ * them a name in prof.c.
+ */
+typedef enum
+{
+    PROF_CNT_I2C_NACK = 0,      // Address or data byte not acknowledged
+    PROF_CNT_I2C_ARB_LOST,      // SDA read back low while the master drove it high
+    PROF_CNT_I2C_TIMEOUT,       // Transfer that did not finish in time
+    PROF_CNT_I2C_BUS_BUSY,      // Bus held by another party, or refused while faulted
+    PROF_CNT_I2C_OTHER,         // FIFO errors and any other failure
+    PROF_CNT_I2C_RECOVERED,     // Bus released by I2C_Recover
+    PROF_CNT_I2C_RECOVER_FAIL,  // SDA still low after the recovery clocks
+    PROF_CNT_COUNT
+} prof_counter_t;
+
+/**
+ * @brief Latency histograms, in timestamp ticks; add new ones before
+ * PROF_HIST_COUNT and give them a name in prof.c.
+ */
+typedef enum
+{
+    PROF_HIST_ISR_ADC = 0,      // PDB trigger to the ADC0 conversion-complete handler
+    PROF_HIST_ISR_DMA,          // PDB trigger of a block's last sample to the eDMA block handler
+    PROF_HIST_ISR_I2C,          // LPI2C0 end-of-transfer handler, beyond the nominal wire time
+    PROF_HIST_SAMPLE_TO_VALUE,  // Block's last trigger to the converted, filtered temperature
+    PROF_HIST_VALUE_TO_LCD,     // Changed temperature to its frame completing on the bus
+    PROF_HIST_COUNT
+} prof_hist_id_t;
+
+/**
+ * @brief Bucket counts of one histogram, see PROF_HIST_BUCKETS.
+ */
+typedef struct
+{
+    uint32_t bucket[PROF_HIST_BUCKETS];
+} prof_hist_t;
+
+/**
+ * @brief Accumulated cycles of one probe. The probe overhead is already
+ * subtracted.
+ */
+typedef struct
+{
+    uint32_t count;
+    uint32_t min;
+    uint32_t max;
+    uint64_t total;
+} prof_stat_t;
+
+/**
+ * @brief Output sink for Prof_Dump(), called once per line without newline.
+ */
+typedef void (*prof_print_t)(const char *line);
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void Prof_Init(void);
+void Prof_Reset(void);
+void Prof_Record(prof_id_t id, uint32_t cycles);
+void Prof_Get(prof_id_t id, prof_stat_t *stat);
+void Prof_Count(prof_counter_t id);
+uint32_t Prof_GetCount(prof_counter_t id);
+uint32_t Prof_TimestampHz(void);
+void Prof_Hist(prof_hist_id_t id, uint32_t ticks);
+void Prof_GetHist(prof_hist_id_t id, prof_hist_t *hist);
+void Prof_Dump(prof_print_t print);
+char *Prof_PutText(char *dst, const char *text, uint8_t width);
+char *Prof_PutValue(char *dst, uint64_t value, uint8_t decimals);
+
+#endif /* PROF_H_ */
@@ -0,0 +1,78 @@
+/**
+ ******************************************************************************
+ * @file      refresh.c
+ * @brief     Display refresh policy: redraw on a change beyond a hysteresis
+ * band or when the shown value gets too old, never faster than a rate cap.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "refresh.h"
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Sets up a policy with nothing shown yet, so the first poll is due.
+ * @param p   Policy to initialize.
+ * @param cfg Tuning; a max age below the rate cap is raised to it.
+ */
+void Refresh_Init(refresh_policy_t *p, const refresh_config_t *cfg)
+{
+    p->cfg = *cfg;
+    if (p->cfg.max_age_ms < p->cfg.min_interval_ms)
+    {
+        p->cfg.max_age_ms = p->cfg.min_interval_ms;
+    }
+    p->shown = 0;
+    p->shown_ms = 0;
+    p->valid = false;
+}
+
+/**
+ * @brief Decides whether a new value should be drawn now.
+ * @details A value at least hysteresis away from the shown one is due once
+ * min_interval_ms has passed since the last refresh; anything else only
+ * once max_age_ms has. Small wobbles around the shown value therefore never
+ * redraw the screen, however fast samples arrive.
+ * @param p      Policy.
+ * @param value  Latest value.
+ * @param now_ms Current time; wraps freely.
+ * @return 0 when a refresh is due, otherwise the milliseconds after which
+ * it becomes due if the value stays as it is.
+ */
+uint32_t Refresh_Poll(const refresh_policy_t *p, int32_t value, uint32_t now_ms)
+{
+    uint32_t age = now_ms - p->shown_ms;
+    uint32_t target;
+    int32_t delta = value - p->shown;
+
+    if (!p->valid)
+    {
+        return 0U;
+    }
+
+    if (delta < 0)
+    {
+        delta = -delta;
+    }
+    target = (delta >= p->cfg.hysteresis) ? p->cfg.min_interval_ms : p->cfg.max_age_ms;
+
+    return (age >= target) ? 0U : (target - age);
+}
+
+/**
+ * @brief Records a value as drawn; call once the refresh has been queued.
+ */
+void Refresh_Shown(refresh_policy_t *p, int32_t value, uint32_t now_ms)
+{
+    p->shown = value;
+    p->shown_ms = now_ms;
+    p->valid = true;
+}
+
@@ -0,0 +1,53 @@
+/**
+ ******************************************************************************
+ * @file      refresh.h
+ * @brief     Display refresh policy: redraw on a change beyond a hysteresis
+ * band or when the shown value gets too old, never faster than a rate cap.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef REFRESH_H_
+#define REFRESH_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Tuning of one policy; values are in the caller's units.
+ */
+typedef struct
+{
+    int32_t hysteresis;          // Distance from the shown value that counts as a change
+    uint32_t min_interval_ms;    // Rate cap: shortest time between two refreshes
+    uint32_t max_age_ms;         // Refresh at least this often, changed or not
+} refresh_config_t;
+
+/**
+ * @brief Policy state: what is on screen and since when.
+ */
+typedef struct
+{
+    refresh_config_t cfg;
+    int32_t shown;
+    uint32_t shown_ms;
+    bool valid;                  // Clear until the first Refresh_Shown()
+} refresh_policy_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void Refresh_Init(refresh_policy_t *p, const refresh_config_t *cfg);
+uint32_t Refresh_Poll(const refresh_policy_t *p, int32_t value, uint32_t now_ms);
+void Refresh_Shown(refresh_policy_t *p, int32_t value, uint32_t now_ms);
+
+#endif /* REFRESH_H_ */
@@ -0,0 +1,366 @@
+/**
+ ******************************************************************************
+ * @file      sched.c
+ * @brief     Cooperative run-to-completion scheduler: a ready queue of events
+ * fed by interrupts and a timer wheel driven by the OSIF millisecond tick.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "sched.h"
+#include <stddef.h>
+#include "osif.h"
+#include "interrupt_manager.h"
+#include "irq_prio.h"
+#include "device_registers.h"
+#include "prof.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define SCHED_WHEEL_MASK    (SCHED_WHEEL_SLOTS - 1U)
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// FIFO of posted events, shared with the interrupts that post them
+static sched_event_t * volatile s_ready_head;
+static sched_event_t *s_ready_tail;
+
+// Each slot holds the timers whose expiry tick maps onto it
+static sched_timer_t *s_wheel[SCHED_WHEEL_SLOTS];
+
+// Last tick the wheel has been advanced to
+static uint32_t s_wheel_now;
+
+// Times every handler when set
+static sched_monitor_t s_monitor;
+
+// Sleeps instead of the plain WFI when set
+static sched_idle_t s_idle;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Links a timer into the wheel slot of its expiry tick.
+ */
+static void Sched_WheelInsert(sched_timer_t *timer)
+{
+    sched_timer_t **slot = &s_wheel[timer->expiry & SCHED_WHEEL_MASK];
+
+    timer->next = *slot;
+    *slot = timer;
+}
+
+/**
+ * @brief Unlinks a timer from its wheel slot, if it is there.
+ */
+static void Sched_WheelRemove(sched_timer_t *timer)
+{
+    sched_timer_t **link = &s_wheel[timer->expiry & SCHED_WHEEL_MASK];
+
+    while (*link != NULL)
+    {
+        if (*link == timer)
+        {
+            *link = timer->next;
+            break;
+        }
+        link = &(*link)->next;
+    }
+}
+
+/**
+ * @brief Advances the wheel one tick and posts every timer that is due.
+ * @details A slot may also hold timers for later laps of the wheel, which are
+ * left in place. Periodic timers are re-armed after the walk so that a period
+ * that is a multiple of the wheel size does not revisit the same slot.
+ */
+static void Sched_WheelStep(void)
+{
+    sched_timer_t **link;
+    sched_timer_t *timer;
+    sched_timer_t *rearm = NULL;
+
+    s_wheel_now++;
+    link = &s_wheel[s_wheel_now & SCHED_WHEEL_MASK];
+    while ((timer = *link) != NULL)
+    {
+        if ((int32_t)(timer->expiry - s_wheel_now) > 0)
+        {
+            link = &timer->next;
+            continue;
+        }
+
+        *link = timer->next;
+        (void)Sched_Post(&timer->event);
+        if (timer->period != 0U)
+        {
+            timer->expiry += timer->period;
+            timer->next = rearm;
+            rearm = timer;
+        }
+        else
+        {
+            timer->active = false;
+        }
+    }
+
+    while (rearm != NULL)
+    {
+        timer = rearm;
+        rearm = timer->next;
+        Sched_WheelInsert(timer);
+    }
+}
+
+/**
+ * @brief Takes the oldest event off the ready queue.
+ * @return The event, or NULL when nothing is ready.
+ */
+static sched_event_t *Sched_Pop(void)
+{
+    sched_event_t *event;
+    uint32_t lock;
+
+    lock = IRQ_Lock(IRQ_PRIO_DMA);
+    event = s_ready_head;
+    if (event != NULL)
+    {
+        s_ready_head = event->next;
+        event->queued = false;
+    }
+    IRQ_Unlock(lock);
+
+    return event;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Starts the OSIF tick and empties the ready queue and the wheel.
+ */
+void Sched_Init(void)
+{
+    uint8_t i;
+
+    // OSIF_TimeDelay(0) starts SysTick without waiting
+    OSIF_TimeDelay(0);
+
+    s_ready_head = NULL;
+    s_ready_tail = NULL;
+    for (i = 0; i < SCHED_WHEEL_SLOTS; i++)
+    {
+        s_wheel[i] = NULL;
+    }
+    s_wheel_now = OSIF_GetMilliseconds();
+}
+
+/**
+ * @brief Prepares an event for posting.
+ * @param event   Event storage, owned by the caller.
+ * @param handler Function to run from the main context.
+ * @param param   User parameter for the handler.
+ */
+void Sched_EventInit(sched_event_t *event, sched_handler_t handler, void *param)
+{
+    event->handler = handler;
+    event->param = param;
+    event->next = NULL;
+    event->queued = false;
+    event->budget = 0;
+    event->worst = 0;
+}
+
+/**
+ * @brief Appends an event to the ready queue.
+ * @details Safe to call from interrupts at IRQ_PRIO_DMA or below; the queue
+ * is locked at that level, so sampling interrupts are never held off by it.
+ * Posting an event that is already waiting does nothing, so bursts of
+ * interrupts coalesce into one run.
+ * @return false if the event was already queued.
+ */
+bool Sched_Post(sched_event_t *event)
+{
+    bool posted = false;
+    uint32_t lock;
+
+    lock = IRQ_Lock(IRQ_PRIO_DMA);
+    if (!event->queued)
+    {
+        event->queued = true;
+        event->next = NULL;
+        if (s_ready_head == NULL)
+        {
+            s_ready_head = event;
+        }
+        else
+        {
+            s_ready_tail->next = event;
+        }
+        s_ready_tail = event;
+        posted = true;
+    }
+    IRQ_Unlock(lock);
+
+    return posted;
+}
+
+/**
+ * @brief Prepares a timer; it stays idle until Sched_TimerStart().
+ * @param timer   Timer storage, owned by the caller.
+ * @param handler Function to run when the timer expires.
+ * @param param   User parameter for the handler.
+ */
+void Sched_TimerInit(sched_timer_t *timer, sched_handler_t handler, void *param)
+{
+    Sched_EventInit(&timer->event, handler, param);
+    timer->expiry = 0;
+    timer->period = 0;
+    timer->next = NULL;
+    timer->active = false;
+}
+
+/**
+ * @brief Arms a timer, restarting it if it was already running.
+ * @details Timers belong to the main context and must not be touched from
+ * interrupts; post an event instead.
+ * @param delay_ms  Ticks until the first expiry; 0 posts the event right away.
+ * @param period_ms Reload after each expiry, or 0 for a one-shot timer.
+ */
+void Sched_TimerStart(sched_timer_t *timer, uint32_t delay_ms, uint32_t period_ms)
+{
+    Sched_TimerStop(timer);
+
+    timer->period = period_ms;
+    if (delay_ms == 0U)
+    {
+        (void)Sched_Post(&timer->event);
+        if (period_ms == 0U)
+        {
+            return;
+        }
+        delay_ms = period_ms;
+    }
+
+    // Relative to the wheel, not to the clock, so a late wheel never skips the slot
+    timer->expiry = s_wheel_now + delay_ms;
+    timer->active = true;
+    Sched_WheelInsert(timer);
+}
+
+/**
+ * @brief Disarms a timer. An expiry already posted still runs.
+ */
+void Sched_TimerStop(sched_timer_t *timer)
+{
+    if (timer->active)
+    {
+        Sched_WheelRemove(timer);
+        timer->active = false;
+    }
+}
+
+/**
+ * @brief Installs a monitor that is handed the run time of every handler.
+ * @details Costs two DWT reads per handler run; the DWT must be running,
+ * see Prof_Init(). While set, the worst run of each event is kept in it.
+ * @param monitor Hook, or NULL to stop timing handlers.
+ */
+void Sched_SetMonitor(sched_monitor_t monitor)
+{
+    s_monitor = monitor;
+}
+
+/**
+ * @brief Installs the hook Sched_Run() sleeps through when nothing is ready.
+ * @details Lets the application pick a deeper sleep, e.g. VLPS, while none of
+ * its work depends on the tick. Main context only.
+ * @param idle Hook, or NULL for WFI in the current run mode.
+ */
+void Sched_SetIdle(sched_idle_t idle)
+{
+    s_idle = idle;
+}
+
+/**
+ * @brief Catches the wheel up with the OSIF tick and runs every ready event.
+ * @details Events posted by a handler are run in the same call, after the
+ * ones already waiting.
+ * @return true if at least one handler ran.
+ */
+bool Sched_RunOnce(void)
+{
+    uint32_t now = OSIF_GetMilliseconds();
+    sched_event_t *event;
+    uint32_t start, cycles;
+    bool ran = false;
+
+    while (s_wheel_now != now)
+    {
+        Sched_WheelStep();
+    }
+
+    while ((event = Sched_Pop()) != NULL)
+    {
+        if (s_monitor == NULL)
+        {
+            event->handler(event->param);
+        }
+        else
+        {
+            start = PROF_DWT_CYCCNT;
+            event->handler(event->param);
+            cycles = PROF_DWT_CYCCNT - start;
+            if (cycles > event->worst)
+            {
+                event->worst = cycles;
+            }
+            s_monitor(event, cycles);
+        }
+        ran = true;
+    }
+
+    return ran;
+}
+
+/**
+ * @brief Runs the scheduler forever, sleeping in WFI whenever nothing is ready.
+ * @details The queue is checked with interrupts masked so that a post landing
+ * just before WFI still wakes the core: a pending interrupt ends WFI even
+ * while masked by PRIMASK, and is taken as soon as the mask is lifted. This
+ * is the one place that masks globally; BASEPRI would not do, as an
+ * interrupt held off by it does not end WFI. A hook from Sched_SetIdle()
+ * sleeps in its place, under the same mask.
+ */
+void Sched_Run(void)
+{
+    for (;;)
+    {
+        (void)Sched_RunOnce();
+
+        INT_SYS_DisableIRQGlobal();
+        if (s_ready_head == NULL)
+        {
+            if (s_idle != NULL)
+            {
+                s_idle();
+            }
+            else
+            {
+                STANDBY();
+            }
+        }
+        INT_SYS_EnableIRQGlobal();
+    }
+}
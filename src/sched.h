@@ -0,0 +1,94 @@
+/**
+ ******************************************************************************
+ * @file      sched.h
+ * @brief     Cooperative run-to-completion scheduler: a ready queue of events
+ * fed by interrupts and a timer wheel driven by the OSIF millisecond tick.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef SCHED_H_
+#define SCHED_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define SCHED_WHEEL_SLOTS   16U  // Timer wheel size, must be a power of two
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Event handler, always called from the main context.
+ * @param param User parameter given to Sched_EventInit() or Sched_TimerInit().
+ */
+typedef void (*sched_handler_t)(void *param);
+
+/**
+ * @brief Unit of work placed on the ready queue.
+ * @details Owned by the caller; an event is queued at most once at a time.
+ */
+typedef struct sched_event
+{
+    sched_handler_t handler;
+    void *param;
+    struct sched_event *next;
+    volatile bool queued;
+    uint32_t budget;             // DWT cycles the handler may take per run, 0 for the monitor's default
+    uint32_t worst;              // Longest run seen by the monitor, in DWT cycles
+} sched_event_t;
+
+/**
+ * @brief Run-time monitor, called after every handler, see Sched_SetMonitor().
+ * @param event  The event whose handler just returned.
+ * @param cycles DWT cycles the handler took, interrupts included.
+ */
+typedef void (*sched_monitor_t)(sched_event_t *event, uint32_t cycles);
+
+/**
+ * @brief Replaces the plain WFI of Sched_Run(), see Sched_SetIdle().
+ * @details Called with interrupts masked by PRIMASK and nothing ready; must
+ * end in WFI or return at once.
+ */
+typedef void (*sched_idle_t)(void);
+
+/**
+ * @brief One-shot or periodic timer that posts its event when it expires.
+ */
+typedef struct sched_timer
+{
+    sched_event_t event;
+    uint32_t expiry;             // Tick at which the timer fires
+    uint32_t period;             // Reload in ticks, 0 for one-shot
+    struct sched_timer *next;    // Link in its wheel slot
+    bool active;
+} sched_timer_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void Sched_Init(void);
+void Sched_EventInit(sched_event_t *event, sched_handler_t handler, void *param);
+bool Sched_Post(sched_event_t *event);
+
+void Sched_TimerInit(sched_timer_t *timer, sched_handler_t handler, void *param);
+void Sched_TimerStart(sched_timer_t *timer, uint32_t delay_ms, uint32_t period_ms);
+void Sched_TimerStop(sched_timer_t *timer);
+
+void Sched_SetMonitor(sched_monitor_t monitor);
+void Sched_SetIdle(sched_idle_t idle);
+
+bool Sched_RunOnce(void);
+void Sched_Run(void);
+
+#endif /* SCHED_H_ */
@@ -0,0 +1,76 @@
+/**
+ ******************************************************************************
+ * @file      sensor.c
+ * @brief     Temperature sensor plugin interface: each driver acquires in
+ * batches along its fastest path and converts whole blocks of readings.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "sensor.h"
+#include <stddef.h>
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Binds a driver to its state and brings the sensor up.
+ * @param sensor  Caller-owned instance.
+ * @param driver  Sensor type, e.g. &g_sensor_lm35.
+ * @param context Driver state, set up as the driver's header describes.
+ * @param ready   Optional batch notification, called from interrupt context.
+ * @param param   User parameter for the notification.
+ * @return Result of the driver's init.
+ */
+status_t Sensor_Init(sensor_t *sensor, const sensor_driver_t *driver, void *context,
+                     sensor_ready_t ready, void *param)
+{
+    sensor->driver = driver;
+    sensor->context = context;
+    sensor->ready = ready;
+    sensor->param = param;
+
+    return driver->init(sensor);
+}
+
+/**
+ * @brief Starts the next batch, or the stream for a streaming driver.
+ */
+status_t Sensor_StartBatch(sensor_t *sensor)
+{
+    return sensor->driver->start_batch(sensor);
+}
+
+/**
+ * @brief Hands a finished transfer to the driver and notifies the owner if
+ * it queued readings.
+ * @details Called by drivers from their DMA or I2C completion interrupt.
+ * @param sensor The sensor.
+ * @param data   Transfer buffer, in the driver's own format.
+ * @param count  Elements in it; 0 for a failed transfer.
+ */
+PERF_HOT void Sensor_BatchReady(sensor_t *sensor, const void *data, uint32_t count)
+{
+    if (sensor->driver->on_batch_ready(sensor, data, count) && (sensor->ready != NULL))
+    {
+        sensor->ready(sensor, sensor->param);
+    }
+}
+
+/**
+ * @brief Converts the readings queued since the last call, oldest first.
+ * @param sensor The sensor.
+ * @param out    Destination for up to max readings.
+ * @param max    Capacity of out.
+ * @return Number of readings converted; 0 if none was queued.
+ */
+uint32_t Sensor_Read(sensor_t *sensor, sensor_sample_t *out, uint32_t max)
+{
+    return sensor->driver->convert_block(sensor, out, max);
+}
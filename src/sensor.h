@@ -0,0 +1,87 @@
+/**
+ ******************************************************************************
+ * @file      sensor.h
+ * @brief     Temperature sensor plugin interface: each driver acquires in
+ * batches along its fastest path and converts whole blocks of readings.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef SENSOR_H_
+#define SENSOR_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief One converted reading.
+ */
+typedef struct
+{
+    int16_t value;               // Filtered temperature, 0.1 C steps
+    int16_t unfiltered;          // The same before the driver's filter
+    uint32_t raw;                // Driver's raw result: ADC counts, or the I2C register
+    uint32_t timestamp;          // PROF_TIMESTAMP() of the acquisition
+} sensor_sample_t;
+
+typedef struct sensor sensor_t;
+
+/**
+ * @brief Batch notification, called from the driver's interrupt context once
+ * readings are queued and Sensor_Read() has something to convert.
+ * @param sensor The sensor.
+ * @param param  User parameter given to Sensor_Init().
+ */
+typedef void (*sensor_ready_t)(sensor_t *sensor, void *param);
+
+/**
+ * @brief Operations of one sensor type.
+ */
+typedef struct
+{
+    // Brings the hardware up without starting acquisition
+    status_t (*init)(sensor_t *sensor);
+
+    // Starts acquiring: a streaming driver keeps delivering batches from
+    // here on, a polled one delivers the one batch it started
+    status_t (*start_batch)(sensor_t *sensor);
+
+    // Takes a finished transfer from the driver's interrupt; count 0 for a
+    // failed one. Returns true when readings were queued
+    bool (*on_batch_ready)(sensor_t *sensor, const void *data, uint32_t count);
+
+    // Converts up to max queued readings, oldest first; main context
+    uint32_t (*convert_block)(sensor_t *sensor, sensor_sample_t *out, uint32_t max);
+} sensor_driver_t;
+
+/**
+ * @brief A sensor instance: a driver and its state, both owned by the caller.
+ */
+struct sensor
+{
+    const sensor_driver_t *driver;
+    void *context;               // Driver state, e.g. a sensor_lm35_t
+    sensor_ready_t ready;
+    void *param;
+};
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t Sensor_Init(sensor_t *sensor, const sensor_driver_t *driver, void *context,
+                     sensor_ready_t ready, void *param);
+status_t Sensor_StartBatch(sensor_t *sensor);
+void Sensor_BatchReady(sensor_t *sensor, const void *data, uint32_t count);
+uint32_t Sensor_Read(sensor_t *sensor, sensor_sample_t *out, uint32_t max);
+
+#endif /* SENSOR_H_ */
@@ -0,0 +1,132 @@
+/**
+ ******************************************************************************
+ * @file      sensor_i2c.c
+ * @brief     Digital I2C temperature sensor driver (LM75, TMP117) for the
+ * sensor interface, sharing LPI2C0 with the LCD through the I2C queue.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "sensor_i2c.h"
+#include "prof.h"
+
+/*============================================================================*/
+/* Private Function Prototypes                         */
+/*============================================================================*/
+
+static status_t SensorI2C_Init(sensor_t *sensor);
+static status_t SensorI2C_StartBatch(sensor_t *sensor);
+static bool SensorI2C_OnBatchReady(sensor_t *sensor, const void *data, uint32_t count);
+static uint32_t SensorI2C_ConvertBlock(sensor_t *sensor, sensor_sample_t *out, uint32_t max);
+
+/*============================================================================*/
+/* Global Variables                                */
+/*============================================================================*/
+
+const sensor_driver_t g_sensor_i2c =
+{
+    .init = SensorI2C_Init,
+    .start_batch = SensorI2C_StartBatch,
+    .on_batch_ready = SensorI2C_OnBatchReady,
+    .convert_block = SensorI2C_ConvertBlock,
+};
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Completion hook of the register read, from the LPI2C interrupt.
+ */
+static void SensorI2C_Done(status_t status, void *param)
+{
+    sensor_t *sensor = (sensor_t *)param;
+    sensor_i2c_t *dev = (sensor_i2c_t *)sensor->context;
+
+    Sensor_BatchReady(sensor, dev->rx, (status == STATUS_SUCCESS) ? sizeof(dev->rx) : 0U);
+}
+
+/**
+ * @brief Prepares the register read; both parts power up converting
+ * continuously, so nothing is written to them.
+ */
+static status_t SensorI2C_Init(sensor_t *sensor)
+{
+    sensor_i2c_t *dev = (sensor_i2c_t *)sensor->context;
+
+    dev->xfer.address = dev->cfg->address;
+    dev->xfer.tx_buf = &dev->cfg->reg;
+    dev->xfer.tx_size = 1U;
+    dev->xfer.rx_buf = dev->rx;
+    dev->xfer.rx_size = sizeof(dev->rx);
+    dev->xfer.send_stop = true;
+    dev->fresh = false;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Queues one burst read of the temperature register: the pointer
+ * write and the two-byte read joined by a repeated START.
+ * @details Meant to be called at the conversion rate of the part, e.g. from
+ * a scheduler timer; the read waits behind any LCD frame on the bus.
+ * @return STATUS_BUSY while the previous read is still queued.
+ */
+static status_t SensorI2C_StartBatch(sensor_t *sensor)
+{
+    sensor_i2c_t *dev = (sensor_i2c_t *)sensor->context;
+
+    if (dev->job.pending)
+    {
+        return STATUS_BUSY;
+    }
+    dev->timestamp = PROF_TIMESTAMP();
+
+    return I2C_Queue_Submit(&dev->job, &dev->xfer, 1U, SensorI2C_Done, sensor);
+}
+
+/**
+ * @brief Latches the register read, big-endian on the wire.
+ */
+static bool SensorI2C_OnBatchReady(sensor_t *sensor, const void *data, uint32_t count)
+{
+    sensor_i2c_t *dev = (sensor_i2c_t *)sensor->context;
+    const uint8_t *rx = (const uint8_t *)data;
+
+    if (count < 2U)
+    {
+        return false;
+    }
+    dev->result = (uint16_t)(((uint16_t)rx[0] << 8) | rx[1]);
+    dev->fresh = true;
+
+    return true;
+}
+
+/**
+ * @brief Converts the latched register; the parts filter internally, so
+ * both values are the same.
+ */
+static uint32_t SensorI2C_ConvertBlock(sensor_t *sensor, sensor_sample_t *out, uint32_t max)
+{
+    sensor_i2c_t *dev = (sensor_i2c_t *)sensor->context;
+    int32_t value;
+
+    if ((max == 0U) || !dev->fresh)
+    {
+        return 0;
+    }
+    dev->fresh = false;
+
+    value = ((int32_t)(int16_t)dev->result * 10) / (int32_t)(1L << dev->cfg->frac_bits);
+    out->value = (int16_t)value;
+    out->unfiltered = (int16_t)value;
+    out->raw = dev->result;
+    out->timestamp = dev->timestamp;
+
+    return 1U;
+}
@@ -0,0 +1,67 @@
+/**
+ ******************************************************************************
+ * @file      sensor_i2c.h
+ * @brief     Digital I2C temperature sensor driver (LM75, TMP117) for the
+ * sensor interface, sharing LPI2C0 with the LCD through the I2C queue.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef SENSOR_I2C_H_
+#define SENSOR_I2C_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "sensor.h"
+#include "i2c_queue.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Fraction bits of the left-aligned, two's complement temperature register
+#define SENSOR_LM75_FRAC_BITS       8U  // 1/256 C; the LM75B fills the top 11 bits
+#define SENSOR_TMP117_FRAC_BITS     7U  // 7.8125 mC per LSB
+
+#define SENSOR_I2C_TEMP_REG         0x00U  // Temperature register of both parts
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Which part, and where on the bus.
+ */
+typedef struct
+{
+    uint16_t address;            // 7-bit address, 0x48..0x4F
+    uint8_t reg;                 // SENSOR_I2C_TEMP_REG
+    uint8_t frac_bits;           // SENSOR_LM75_FRAC_BITS or SENSOR_TMP117_FRAC_BITS
+} sensor_i2c_config_t;
+
+/**
+ * @brief Driver state; only cfg is set by the caller. The job and its
+ * buffers belong to the I2C queue while a batch is in flight.
+ */
+typedef struct
+{
+    const sensor_i2c_config_t *cfg;
+    i2c_xfer_t xfer;
+    i2c_job_t job;
+    uint8_t rx[2];
+    uint16_t result;
+    uint32_t timestamp;          // PROF_TIMESTAMP() when the read was queued
+    volatile bool fresh;         // result not yet converted
+} sensor_i2c_t;
+
+/*============================================================================*/
+/* Global Variables                                */
+/*============================================================================*/
+
+extern const sensor_driver_t g_sensor_i2c;
+
+#endif /* SENSOR_I2C_H_ */
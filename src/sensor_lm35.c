@@ -0,0 +1,177 @@
+/**
+ ******************************************************************************
+ * @file      sensor_lm35.c
+ * @brief     LM35 analog sensor driver for the sensor interface: PDB0-paced
+ * ADC0 into the eDMA ring, decimated and filtered per block.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "sensor_lm35.h"
+#include <stddef.h>
+#include "adc_stream.h"
+#include "bandgap.h"
+#include "temp_conv.h"
+#include "temp_cal.h"
+#include "prof.h"
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Private Function Prototypes                         */
+/*============================================================================*/
+
+static status_t SensorLM35_Init(sensor_t *sensor);
+static status_t SensorLM35_StartBatch(sensor_t *sensor);
+static bool SensorLM35_OnBatchReady(sensor_t *sensor, const void *data, uint32_t count);
+static uint32_t SensorLM35_ConvertBlock(sensor_t *sensor, sensor_sample_t *out, uint32_t max);
+
+/*============================================================================*/
+/* Global Variables                                */
+/*============================================================================*/
+
+const sensor_driver_t g_sensor_lm35 =
+{
+    .init = SensorLM35_Init,
+    .start_batch = SensorLM35_StartBatch,
+    .on_batch_ready = SensorLM35_OnBatchReady,
+    .convert_block = SensorLM35_ConvertBlock,
+};
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief eDMA half-ring hook of the ADC0 stream.
+ */
+PERF_HOT static void SensorLM35_StreamBlock(const uint16_t *block, uint32_t count, void *param)
+{
+    Sensor_BatchReady((sensor_t *)param, block, count);
+}
+
+/**
+ * @brief Sets up PDB0, ADC0, the bandgap compensation and the filter.
+ * @details Calibration and the first conversions can overlap other start-up
+ * work; nothing is acquired until the batch is started.
+ * @return STATUS_ERROR if the rate is out of reach of the bus clock or of
+ * the converter profile with its averaging.
+ */
+static status_t SensorLM35_Init(sensor_t *sensor)
+{
+    sensor_lm35_t *lm35 = (sensor_lm35_t *)sensor->context;
+    const sensor_lm35_config_t *cfg = lm35->cfg;
+
+    if (!Sampler_Init(cfg->channel, cfg->rate_hz))
+    {
+        return STATUS_ERROR;
+    }
+    Bandgap_Init(cfg->channel, cfg->vref_comp_blocks);
+    if (!Sampler_ApplyProfile(cfg->profile) || (cfg->rate_hz > Sampler_MaxRateHz(NULL)))
+    {
+        return STATUS_ERROR;
+    }
+    Filter_IIR_Init(&lm35->iir, cfg->alpha_q15);
+    if (cfg->anomaly != NULL)
+    {
+        Anomaly_Init(&lm35->anomaly, cfg->anomaly);
+    }
+    lm35->anomaly_flags = 0;
+    (void)SPSC_Init(&lm35->queue, lm35->storage, sizeof(lm35->storage) / sizeof(lm35->storage[0]));
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Starts the eDMA stream and the trigger; blocks follow on their own
+ * until the sampler is stopped.
+ */
+static status_t SensorLM35_StartBatch(sensor_t *sensor)
+{
+    sensor_lm35_t *lm35 = (sensor_lm35_t *)sensor->context;
+    status_t status;
+
+    status = ADC_Stream_StartBatched(SensorLM35_StreamBlock, sensor, lm35->cfg->batch);
+    if (status == STATUS_SUCCESS)
+    {
+        Sampler_Start();
+    }
+
+    return status;
+}
+
+/**
+ * @brief Decimates, supply-corrects, screens and filters one ADC block.
+ * @details Called from the eDMA interrupt each time half of the ring fills.
+ * A bandgap block only updates the supply correction and queues nothing.
+ * The anomaly stage sits between the decimation and the IIR, so a rejected
+ * glitch never enters the filter state, the log or the telemetry.
+ * @return true if a result was queued for SensorLM35_ConvertBlock().
+ */
+PERF_HOT static bool SensorLM35_OnBatchReady(sensor_t *sensor, const void *data, uint32_t count)
+{
+    sensor_lm35_t *lm35 = (sensor_lm35_t *)sensor->context;
+    const uint16_t *block = (const uint16_t *)data;
+    uint8_t bits = lm35->cfg->profile->oversample_bits;
+    uint32_t full_scale = ((TEMP_ADC_MAX_VALUE + 1UL) << bits) - 1U;
+    uint32_t triggered = PROF_TIMESTAMP() - Sampler_TriggerAge(Prof_TimestampHz());
+    uint32_t corrected;
+    uint16_t decimated;
+    uint8_t flags;
+    bool queued = false;
+
+    PROF_BEGIN(PROF_ADC_BLOCK);
+    if (!Bandgap_OnBlock(block, count) && (count >= (1UL << (2U * bits))))
+    {
+        corrected = Bandgap_Correct(Sampler_Decimate(block, bits));
+        decimated = (uint16_t)((corrected > full_scale) ? full_scale : corrected);
+        if (lm35->cfg->anomaly != NULL)
+        {
+            decimated = Anomaly_Process(&lm35->anomaly, decimated, &flags);
+            lm35->anomaly_flags = flags;
+            if (((flags & ANOMALY_EVENT_MASK) != 0U) && (lm35->cfg->anomaly_event != NULL))
+            {
+                (void)Sched_Post(lm35->cfg->anomaly_event);
+            }
+        }
+        // Both words or neither; a full queue means the main context is far
+        // behind, and the oldest results win. The owner is only woken for a
+        // result that is actually there
+        if (SPSC_Count(&lm35->queue) <= ((sizeof(lm35->storage) / sizeof(lm35->storage[0])) - 2U))
+        {
+            queued = SPSC_Push(&lm35->queue, ((uint32_t)decimated << 16) | Filter_IIR_Process(&lm35->iir, decimated)) &&
+                     SPSC_Push(&lm35->queue, triggered);
+        }
+    }
+    PROF_END(PROF_ADC_BLOCK);
+
+    return queued;
+}
+
+/**
+ * @brief Converts the queued block results through the board calibration.
+ */
+static uint32_t SensorLM35_ConvertBlock(sensor_t *sensor, sensor_sample_t *out, uint32_t max)
+{
+    sensor_lm35_t *lm35 = (sensor_lm35_t *)sensor->context;
+    uint8_t bits = lm35->cfg->profile->oversample_bits;
+    uint32_t raw, triggered;
+    uint32_t n = 0;
+
+    // The interrupt pushes both words before this context can run again
+    PROF_BEGIN(PROF_TEMP_CONVERT);
+    while ((n < max) && SPSC_Pop(&lm35->queue, &raw) && SPSC_Pop(&lm35->queue, &triggered))
+    {
+        out[n].raw = raw & 0xFFFFU;
+        out[n].value = (int16_t)TempCal_FromOversampled(raw & 0xFFFFU, bits, TEMP_RES_0C1);
+        out[n].unfiltered = (int16_t)TempCal_FromOversampled(raw >> 16, bits, TEMP_RES_0C1);
+        out[n].timestamp = triggered;
+        n++;
+    }
+    PROF_END(PROF_TEMP_CONVERT);
+
+    return n;
+}
@@ -0,0 +1,75 @@
+/**
+ ******************************************************************************
+ * @file      sensor_lm35.h
+ * @brief     LM35 analog sensor driver for the sensor interface: PDB0-paced
+ * ADC0 into the eDMA ring, decimated and filtered per block.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef SENSOR_LM35_H_
+#define SENSOR_LM35_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "sensor.h"
+#include "adc_sampler.h"
+#include "filter.h"
+#include "anomaly.h"
+#include "sched.h"
+#include "spsc.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Block results held between two Sensor_Read() calls
+#define SENSOR_LM35_QUEUE_DEPTH 8U
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Acquisition setup of the LM35 input.
+ */
+typedef struct
+{
+    adc_inputchannel_t channel;
+    uint32_t rate_hz;
+    uint8_t batch;                     // ADC blocks per wake-up, see ADC_Stream_StartBatched()
+    uint16_t vref_comp_blocks;         // One bandgap block in this many, see Bandgap_Init(); 0 for none
+    const sampler_profile_t *profile;  // Hardware averaging and oversampling
+    int16_t alpha_q15;                 // IIR smoothing of the block results, FILTER_IIR_ALPHA()
+    const anomaly_config_t *anomaly;   // Spike and trend limits in decimated counts per block; NULL for none
+    sched_event_t *anomaly_event;      // Posted for every ANOMALY_EVENT_MASK flag; NULL for none
+} sensor_lm35_config_t;
+
+/**
+ * @brief Driver state; only cfg is set by the caller. There is one ADC0
+ * stream, so one LM35 sensor at a time.
+ */
+typedef struct
+{
+    const sensor_lm35_config_t *cfg;
+    filter_iir_t iir;
+    anomaly_t anomaly;
+    volatile uint8_t anomaly_flags;    // ANOMALY_* flags of the latest block
+
+    // Two words per block: the decimated result, after the anomaly stage, in
+    // the upper half and its filtered value in the lower, then the
+    // PROF_TIMESTAMP() of its last trigger
+    uint32_t storage[2U * SENSOR_LM35_QUEUE_DEPTH];
+    spsc_queue_t queue;
+} sensor_lm35_t;
+
+/*============================================================================*/
+/* Global Variables                                */
+/*============================================================================*/
+
+extern const sensor_driver_t g_sensor_lm35;
+
+#endif /* SENSOR_LM35_H_ */
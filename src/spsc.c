@@ -0,0 +1,99 @@
+/**
+ ******************************************************************************
+ * @file      spsc.c
+ * @brief     Wait-free single-producer/single-consumer ring of 32-bit words,
+ * for handing data from one interrupt to the main context without masking
+ * interrupts.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "spsc.h"
+#include <stddef.h>
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Attaches storage to an empty queue.
+ * @details Must be called before either side uses the queue.
+ * @param q        Queue to initialize.
+ * @param storage  Array of capacity words.
+ * @param capacity Number of slots; must be a non-zero power of two.
+ * @return false if the capacity is not a power of two.
+ */
+bool SPSC_Init(spsc_queue_t *q, uint32_t *storage, uint32_t capacity)
+{
+    if ((storage == NULL) || (capacity == 0U) || ((capacity & (capacity - 1U)) != 0U))
+    {
+        return false;
+    }
+
+    q->buf = storage;
+    q->mask = capacity - 1U;
+    q->head = 0;
+    q->tail = 0;
+
+    return true;
+}
+
+/**
+ * @brief Appends a word; producer side only.
+ * @details The slot is written before head is published, with a barrier in
+ * between, so the consumer never sees an index ahead of its data.
+ * @return false if the queue is full; the value is dropped.
+ */
+PERF_HOT bool SPSC_Push(spsc_queue_t *q, uint32_t value)
+{
+    uint32_t head = q->head;
+
+    if ((head - q->tail) > q->mask)
+    {
+        return false;
+    }
+
+    q->buf[head & q->mask] = value;
+    SPSC_DMB();
+    q->head = head + 1U;
+
+    return true;
+}
+
+/**
+ * @brief Removes the oldest word; consumer side only.
+ * @details The slot is read before tail is published, with a barrier in
+ * between, so the producer never overwrites data that is still being read.
+ * @return false if the queue is empty.
+ */
+PERF_HOT bool SPSC_Pop(spsc_queue_t *q, uint32_t *value)
+{
+    uint32_t tail = q->tail;
+
+    if (q->head == tail)
+    {
+        return false;
+    }
+
+    SPSC_DMB();
+    *value = q->buf[tail & q->mask];
+    SPSC_DMB();
+    q->tail = tail + 1U;
+
+    return true;
+}
+
+/**
+ * @brief Returns the number of words waiting.
+ * @details While the other side runs this is a snapshot: at least this many
+ * for the consumer, at most this many for the producer.
+ */
+uint32_t SPSC_Count(const spsc_queue_t *q)
+{
+    return q->head - q->tail;
+}
@@ -0,0 +1,57 @@
+/**
+ ******************************************************************************
+ * @file      spsc.h
+ * @brief     Wait-free single-producer/single-consumer ring of 32-bit words,
+ * for handing data from one interrupt to the main context without masking
+ * interrupts.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef SPSC_H_
+#define SPSC_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Orders the slot access against the index update as seen by the other side
+#if defined(__GNUC__) && defined(__ARM_ARCH)
+#define SPSC_DMB()  __asm volatile ("dmb" ::: "memory")
+#else
+#define SPSC_DMB()  __asm volatile ("" ::: "memory")
+#endif
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Ring state. The indices run freely and are masked on access, so all
+ * slots are usable and the fill level is simply head - tail.
+ */
+typedef struct
+{
+    uint32_t *buf;               // Caller-provided storage, capacity words
+    uint32_t mask;               // capacity - 1
+    volatile uint32_t head;      // Written by the producer only
+    volatile uint32_t tail;      // Written by the consumer only
+} spsc_queue_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+bool SPSC_Init(spsc_queue_t *q, uint32_t *storage, uint32_t capacity);
+bool SPSC_Push(spsc_queue_t *q, uint32_t value);
+bool SPSC_Pop(spsc_queue_t *q, uint32_t *value);
+uint32_t SPSC_Count(const spsc_queue_t *q);
+
+#endif /* SPSC_H_ */
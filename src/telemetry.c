@@ -0,0 +1,417 @@
+/**
+ ******************************************************************************
+ * @file      telemetry.c
+ * @brief     Binary sample stream over LPUART1: fixed-size frames with a
+ * CRC-16, COBS framed and sent by the eDMA without blocking the caller.
+ * Latency histograms share the link in frames of the same size.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "telemetry.h"
+#include "S32K144.h"
+#include "clock_manager.h"
+#include "dma_alloc.h"
+#include "irq_prio.h"
+#include "clock_gate.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define TELEMETRY_UART          LPUART1
+#define TELEMETRY_UART_CLK      LPUART1_CLK
+// Least urgent of the clients; the UART FIFO absorbs a late byte
+#define TELEMETRY_DMA_PRIO      4U
+
+#define TELEMETRY_OSR_MIN       4U
+#define TELEMETRY_OSR_MAX       32U
+#define TELEMETRY_SBR_MAX       0x1FFFU
+
+#define TELEMETRY_NO_BUFFER     0xFFU
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Samples of the frame being filled
+static int16_t s_values[TELEMETRY_FRAME_SAMPLES];
+static uint16_t s_deltas[TELEMETRY_FRAME_SAMPLES];
+static uint32_t s_first_ms;
+static uint32_t s_last_ms;
+static uint8_t s_count;
+static uint8_t s_seq;
+
+// Encoded frames: one on the wire, the other waiting behind it or free
+static uint8_t s_wire[2][TELEMETRY_WIRE_SIZE];
+static uint8_t s_wire_len[2];
+static volatile uint8_t s_tx_active = TELEMETRY_NO_BUFFER;
+static volatile uint8_t s_tx_queued = TELEMETRY_NO_BUFFER;
+
+static uint32_t s_dropped;
+static bool s_ready;
+
+static uint8_t s_channel;
+static bool s_have_channel;
+
+// CRC-16/CCITT-FALSE remainders for one nibble
+static const uint16_t s_crc_nibble[16] =
+{
+    0x0000U, 0x1021U, 0x2042U, 0x3063U, 0x4084U, 0x50A5U, 0x60C6U, 0x70E7U,
+    0x8108U, 0x9129U, 0xA14AU, 0xB16BU, 0xC18CU, 0xD1ADU, 0xE1CEU, 0xF1EFU,
+};
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Hands one encoded frame to the eDMA.
+ * @details One byte per LPUART transmit request; the request is dropped by
+ * the channel itself after the last byte. Called with the channel idle,
+ * from the main context under IRQ_Lock() or from its completion interrupt.
+ */
+static void Telemetry_Start(uint8_t buf)
+{
+    s_tx_active = buf;
+    ClockGate_Acquire(CLOCK_GATE_DMA);
+    (void)EDMA_DRV_ConfigMultiBlockTransfer(s_channel, EDMA_TRANSFER_MEM2PERIPH,
+                                            (uint32_t)s_wire[buf], (uint32_t)&TELEMETRY_UART->DATA,
+                                            EDMA_TRANSFER_SIZE_1B, 1U, s_wire_len[buf], true);
+    (void)EDMA_DRV_StartChannel(s_channel);
+}
+
+/**
+ * @brief eDMA completion of a frame: starts the one queued behind it.
+ * @details An error status is treated like completion; the frame is lost
+ * and the stream resynchronizes on the next delimiter.
+ */
+static void Telemetry_DmaDone(void *parameter, edma_chn_status_t status)
+{
+    uint8_t next = s_tx_queued;
+
+    (void)parameter;
+    (void)status;
+
+    ClockGate_Release(CLOCK_GATE_DMA);
+    s_tx_active = TELEMETRY_NO_BUFFER;
+    if (next != TELEMETRY_NO_BUFFER)
+    {
+        s_tx_queued = TELEMETRY_NO_BUFFER;
+        Telemetry_Start(next);
+    }
+}
+
+/**
+ * @brief COBS-encodes a payload of at most 254 bytes and appends the delimiter.
+ * @return Encoded length including the delimiter.
+ */
+static uint8_t Telemetry_Cobs(uint8_t *dst, const uint8_t *src, uint8_t len)
+{
+    uint8_t code_pos = 0;
+    uint8_t out = 1;
+    uint8_t code = 1;
+    uint8_t i;
+
+    for (i = 0; i < len; i++)
+    {
+        if (src[i] == 0U)
+        {
+            dst[code_pos] = code;
+            code_pos = out++;
+            code = 1;
+        }
+        else
+        {
+            dst[out++] = src[i];
+            code++;
+        }
+    }
+    dst[code_pos] = code;
+    dst[out++] = 0U;
+
+    return out;
+}
+
+/**
+ * @brief Appends the CRC to a payload, encodes it into a free wire buffer
+ * and queues it for the eDMA. Main context only.
+ * @param payload Frame without its CRC, with room for two more bytes.
+ * @param len     Bytes before the CRC.
+ * @return false if both wire buffers are still in use; the frame is dropped.
+ */
+static bool Telemetry_Queue(uint8_t *payload, uint8_t len)
+{
+    uint16_t crc;
+    uint32_t lock;
+    uint8_t buf;
+    bool busy;
+
+    // A buffer is free when it is neither on the wire nor waiting for it;
+    // only this function makes a buffer busy, so it stays free once found
+    lock = IRQ_Lock(IRQ_PRIO_I2C);
+    buf = (s_tx_active == 0U) ? 1U : 0U;
+    busy = (s_tx_queued == buf) || (s_tx_active == buf);
+    IRQ_Unlock(lock);
+    if (busy)
+    {
+        return false;
+    }
+
+    crc = Telemetry_Crc16(payload, len);
+    payload[len] = (uint8_t)crc;
+    payload[len + 1U] = (uint8_t)(crc >> 8);
+    s_wire_len[buf] = Telemetry_Cobs(s_wire[buf], payload, (uint8_t)(len + 2U));
+
+    // The completion interrupt must not see a half-updated queue
+    lock = IRQ_Lock(IRQ_PRIO_I2C);
+    if (s_tx_active == TELEMETRY_NO_BUFFER)
+    {
+        Telemetry_Start(buf);
+    }
+    else
+    {
+        s_tx_queued = buf;
+    }
+    IRQ_Unlock(lock);
+
+    return true;
+}
+
+/**
+ * @brief Builds the frame payload from the collected samples and queues it.
+ * @return false if both wire buffers are still in use; the frame is dropped.
+ */
+static bool Telemetry_Send(void)
+{
+    uint8_t payload[TELEMETRY_PAYLOAD_SIZE];
+    uint8_t *dst = payload;
+    uint8_t i;
+    bool sent;
+
+    *dst++ = TELEMETRY_FRAME_TYPE;
+    *dst++ = s_seq++;
+    *dst++ = s_count;
+    *dst++ = 0U;
+    *dst++ = (uint8_t)s_first_ms;
+    *dst++ = (uint8_t)(s_first_ms >> 8);
+    *dst++ = (uint8_t)(s_first_ms >> 16);
+    *dst++ = (uint8_t)(s_first_ms >> 24);
+    for (i = 0; i < TELEMETRY_FRAME_SAMPLES; i++)
+    {
+        uint16_t delta = (i < s_count) ? s_deltas[i] : 0U;
+        uint16_t value = (i < s_count) ? (uint16_t)s_values[i] : 0U;
+
+        *dst++ = (uint8_t)delta;
+        *dst++ = (uint8_t)(delta >> 8);
+        *dst++ = (uint8_t)value;
+        *dst++ = (uint8_t)(value >> 8);
+    }
+
+    sent = Telemetry_Queue(payload, (uint8_t)(dst - payload));
+    if (!sent)
+    {
+        s_dropped += s_count;
+    }
+    s_count = 0;
+
+    return sent;
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Sets LPUART1 up for 8N1 transmit with eDMA requests.
+ * @details The oversampling ratio and divider closest to baud_hz are
+ * searched as in the SDK LPUART driver. LPUART1 runs from SIRCDIV2, which
+ * does not change with the run mode, so the rate holds in VLPR and HSRUN.
+ * Must be called after DMA_Alloc_Init().
+ * @param baud_hz Line rate, e.g. TELEMETRY_BAUD_HZ.
+ * @return STATUS_ERROR if the functional clock is off or too slow for the
+ *         rate, STATUS_BUSY if no eDMA channel is left.
+ */
+status_t Telemetry_Init(uint32_t baud_hz)
+{
+    uint32_t clk_hz = 0;
+    uint32_t osr, sbr, rate, err;
+    uint32_t best_osr = 0, best_sbr = 0, best_err = 0xFFFFFFFFU;
+    uint32_t baud;
+    status_t status;
+
+    (void)CLOCK_SYS_GetFreq(TELEMETRY_UART_CLK, &clk_hz);
+    if ((clk_hz == 0U) || (baud_hz == 0U))
+    {
+        return STATUS_ERROR;
+    }
+
+    for (osr = TELEMETRY_OSR_MIN; osr <= TELEMETRY_OSR_MAX; osr++)
+    {
+        sbr = (clk_hz + ((baud_hz * osr) / 2U)) / (baud_hz * osr);
+        if ((sbr == 0U) || (sbr > TELEMETRY_SBR_MAX))
+        {
+            continue;
+        }
+        rate = clk_hz / (osr * sbr);
+        err = (rate > baud_hz) ? (rate - baud_hz) : (baud_hz - rate);
+        if (err < best_err)
+        {
+            best_err = err;
+            best_osr = osr;
+            best_sbr = sbr;
+        }
+    }
+    if (best_osr == 0U)
+    {
+        return STATUS_ERROR;
+    }
+
+    if (!s_have_channel)
+    {
+        status = DMA_Alloc_Channel(EDMA_REQ_LPUART1_TX, TELEMETRY_DMA_PRIO, IRQ_PRIO_I2C, &s_channel);
+        if (status != STATUS_SUCCESS)
+        {
+            return status;
+        }
+        s_have_channel = true;
+    }
+
+    // Baud settings only take while the transmitter and receiver are off
+    TELEMETRY_UART->CTRL = 0U;
+    baud = LPUART_BAUD_OSR(best_osr - 1U) | LPUART_BAUD_SBR(best_sbr) | LPUART_BAUD_TDMAE_MASK;
+    if (best_osr < 8U)
+    {
+        baud |= LPUART_BAUD_BOTHEDGE_MASK;
+    }
+    TELEMETRY_UART->BAUD = baud;
+    TELEMETRY_UART->CTRL = LPUART_CTRL_TE_MASK;
+
+    (void)EDMA_DRV_InstallCallback(s_channel, Telemetry_DmaDone, NULL);
+    s_count = 0;
+    s_ready = true;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Adds one sample, sending the frame once it is full.
+ * @details Only packs and encodes a few dozen bytes; the bytes leave through
+ * the eDMA while the caller moves on. A gap too long for the 16-bit delta
+ * sends the partial frame first. Main context only.
+ * @param value  Sample, e.g. temperature in 0.1 C steps.
+ * @param now_ms Time of the sample.
+ * @return false if a frame had to be dropped because the link is behind.
+ */
+bool Telemetry_Push(int16_t value, uint32_t now_ms)
+{
+    bool sent = true;
+
+    if (!s_ready)
+    {
+        return false;
+    }
+
+    if ((s_count != 0U) && ((now_ms - s_last_ms) > 0xFFFFU))
+    {
+        sent = Telemetry_Send();
+    }
+    if (s_count == 0U)
+    {
+        s_first_ms = now_ms;
+        s_last_ms = now_ms;
+    }
+    s_deltas[s_count] = (uint16_t)(now_ms - s_last_ms);
+    s_values[s_count] = value;
+    s_last_ms = now_ms;
+    s_count++;
+
+    if (s_count == TELEMETRY_FRAME_SAMPLES)
+    {
+        sent = Telemetry_Send() && sent;
+    }
+
+    return sent;
+}
+
+/**
+ * @brief Sends a partly filled frame right away.
+ * @return false if it had to be dropped.
+ */
+bool Telemetry_Flush(void)
+{
+    return (!s_ready || (s_count == 0U)) ? true : Telemetry_Send();
+}
+
+/**
+ * @brief Sends one slice of a histogram as its own frame.
+ * @details Independent of the sample frame being filled, which keeps its
+ * samples. A whole histogram takes one frame per TELEMETRY_HIST_BUCKETS
+ * buckets. Main context only.
+ * @param id           Histogram number, e.g. a prof_hist_id_t.
+ * @param first_bucket Index of counts[0] within the histogram.
+ * @param counts       TELEMETRY_HIST_BUCKETS bucket counts.
+ * @param now_ms       Time stamped into the frame.
+ * @return false if the link is behind; the frame is dropped and can be
+ *         sent again later.
+ */
+bool Telemetry_PushHistogram(uint8_t id, uint8_t first_bucket, const uint32_t *counts, uint32_t now_ms)
+{
+    uint8_t payload[TELEMETRY_PAYLOAD_SIZE];
+    uint8_t *dst = payload;
+    uint8_t i;
+
+    if (!s_ready)
+    {
+        return false;
+    }
+
+    *dst++ = TELEMETRY_HIST_TYPE;
+    *dst++ = s_seq++;
+    *dst++ = id;
+    *dst++ = first_bucket;
+    *dst++ = (uint8_t)now_ms;
+    *dst++ = (uint8_t)(now_ms >> 8);
+    *dst++ = (uint8_t)(now_ms >> 16);
+    *dst++ = (uint8_t)(now_ms >> 24);
+    for (i = 0; i < TELEMETRY_HIST_BUCKETS; i++)
+    {
+        *dst++ = (uint8_t)counts[i];
+        *dst++ = (uint8_t)(counts[i] >> 8);
+        *dst++ = (uint8_t)(counts[i] >> 16);
+        *dst++ = (uint8_t)(counts[i] >> 24);
+    }
+
+    return Telemetry_Queue(payload, (uint8_t)(dst - payload));
+}
+
+/**
+ * @brief Returns the number of samples lost to a busy link.
+ */
+uint32_t Telemetry_Dropped(void)
+{
+    return s_dropped;
+}
+
+/**
+ * @brief CRC-16/CCITT-FALSE (poly 0x1021, init 0xFFFF), one nibble per step.
+ * @details The 16-entry table keeps it at 32 bytes of flash; "123456789"
+ * gives 0x29B1.
+ */
+uint16_t Telemetry_Crc16(const uint8_t *data, uint32_t len)
+{
+    uint16_t crc = 0xFFFFU;
+
+    while (len-- != 0U)
+    {
+        crc = (uint16_t)((crc << 4) ^ s_crc_nibble[(crc >> 12) ^ (*data >> 4)]);
+        crc = (uint16_t)((crc << 4) ^ s_crc_nibble[(crc >> 12) ^ (*data & 0x0FU)]);
+        data++;
+    }
+
+    return crc;
+}
@@ -0,0 +1,66 @@
+/**
+ ******************************************************************************
+ * @file      telemetry.h
+ * @brief     Binary sample stream over LPUART1: fixed-size frames with a
+ * CRC-16, COBS framed and sent by the eDMA without blocking the caller.
+ * Latency histograms share the link in frames of the same size.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef TELEMETRY_H_
+#define TELEMETRY_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#ifndef TELEMETRY_BAUD_HZ
+#define TELEMETRY_BAUD_HZ       115200U  // OpenSDA virtual COM port on the EVB
+#endif
+
+#define TELEMETRY_FRAME_SAMPLES 8U       // Samples per frame; unused slots are sent as zero
+#define TELEMETRY_FRAME_TYPE    0x01U    // First payload byte: frame layout version
+
+/*
+ * Frame payload, little-endian, before COBS encoding:
+ *   u8  type, u8 seq, u8 count, u8 reserved
+ *   u32 time_ms of the first sample
+ *   TELEMETRY_FRAME_SAMPLES x { u16 delta_ms from the previous sample, i16 value }
+ *   u16 CRC-16/CCITT-FALSE over everything before it
+ * On the wire each frame is COBS encoded and ends with a 0x00 delimiter.
+ */
+#define TELEMETRY_PAYLOAD_SIZE  (8U + (TELEMETRY_FRAME_SAMPLES * 4U) + 2U)
+
+/*
+ * Histogram frame payload, the same size as a sample frame:
+ *   u8  type (TELEMETRY_HIST_TYPE), u8 seq, u8 histogram id, u8 first bucket
+ *   u32 time_ms when it was sent
+ *   TELEMETRY_HIST_BUCKETS x u32 bucket count
+ *   u16 CRC-16/CCITT-FALSE over everything before it
+ * Sequence numbers are shared with the sample frames.
+ */
+#define TELEMETRY_HIST_TYPE     0x02U
+#define TELEMETRY_HIST_BUCKETS  TELEMETRY_FRAME_SAMPLES
+#define TELEMETRY_WIRE_SIZE     (TELEMETRY_PAYLOAD_SIZE + 2U)   // COBS code byte and delimiter
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t Telemetry_Init(uint32_t baud_hz);
+bool Telemetry_Push(int16_t value, uint32_t now_ms);
+bool Telemetry_Flush(void);
+bool Telemetry_PushHistogram(uint8_t id, uint8_t first_bucket, const uint32_t *counts, uint32_t now_ms);
+uint32_t Telemetry_Dropped(void);
+uint16_t Telemetry_Crc16(const uint8_t *data, uint32_t len);
+
+#endif /* TELEMETRY_H_ */
@@ -0,0 +1,247 @@
+/**
+ ******************************************************************************
+ * @file      temp_cal.c
+ * @brief     Per-board temperature calibration: a multi-point correction
+ * table kept in D-Flash, expanded at boot into a lookup table from ADC code
+ * to centi-degrees so a conversion is a table load.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "temp_cal.h"
+#include <stddef.h>
+#include "S32K144.h"
+#include "S32K144_features.h"
+#include "datalog.h"
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Last D-Flash sector, past the temperature log
+#define TEMP_CAL_ADDR           (FEATURE_FLS_DF_START_ADDRESS + FEATURE_FLS_DF_BLOCK_SIZE - \
+                                 FEATURE_FLS_DF_BLOCK_SECTOR_SIZE)
+#define TEMP_CAL_RAW_FRAC_BITS  4U
+
+#if (DATALOG_SECTORS + 1U) * FEATURE_FLS_DF_BLOCK_SECTOR_SIZE > FEATURE_FLS_DF_BLOCK_SIZE
+#error "The calibration sector overlaps the temperature log"
+#endif
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+// Centi-degrees per 12-bit code, saturating at +-327.67 C, well past the
+// LM35's range; the extra entry lets the top code interpolate. Every entry
+// is rebuilt by TempCal_Init(), so start-up does not clear the 8 KB
+static PERF_NOINIT int16_t s_lut[TEMP_CAL_LUT_SIZE + 1U];
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Checks a record read from flash: magic, point count, checksum and
+ * strictly increasing raw codes.
+ */
+static bool TempCal_Valid(const temp_cal_record_t *rec)
+{
+    uint16_t sum;
+    uint8_t i;
+
+    if ((rec->magic != TEMP_CAL_MAGIC) || (rec->count == 0U) || (rec->count > TEMP_CAL_MAX_POINTS))
+    {
+        return false;
+    }
+
+    sum = (uint16_t)(rec->count + rec->checksum);
+    for (i = 0; i < rec->count; i++)
+    {
+        sum = (uint16_t)(sum + rec->points[i].raw_q4 + (uint16_t)rec->points[i].centi_c);
+    }
+
+    return sum == 0xFFFFU;
+}
+
+/**
+ * @brief Saturates to the table's value range.
+ */
+static int16_t TempCal_Clamp(int64_t value)
+{
+    if (value > INT16_MAX)
+    {
+        return INT16_MAX;
+    }
+    if (value < INT16_MIN)
+    {
+        return INT16_MIN;
+    }
+
+    return (int16_t)value;
+}
+
+/**
+ * @brief Divides rounding half away from zero.
+ */
+static int64_t TempCal_Div(int64_t num, int64_t den)
+{
+    if (den < 0)
+    {
+        num = -num;
+        den = -den;
+    }
+
+    return (num >= 0) ? ((num + (den / 2)) / den) : ((num - (den / 2)) / den);
+}
+
+/**
+ * @brief Converts centi-degrees to the requested resolution.
+ */
+static int32_t TempCal_Scale(int32_t centi_c, temp_resolution_t res)
+{
+    switch (res)
+    {
+        case TEMP_RES_0C01:
+            return centi_c;
+        case TEMP_RES_0C1:
+            return (centi_c >= 0) ? ((centi_c + 5) / 10) : ((centi_c - 5) / 10);
+        case TEMP_RES_1C:
+        default:
+            return (centi_c >= 0) ? ((centi_c + 50) / 100) : ((centi_c - 50) / 100);
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Loads this board's calibration from D-Flash and builds the table.
+ * @details Without a valid record, or with a FlexNVM partition that leaves
+ * no D-Flash, the table follows the nominal conversion of temp_conv.c, so
+ * the readings are the same as before calibration.
+ * @return true if a calibration record was applied.
+ */
+bool TempCal_Init(void)
+{
+    const temp_cal_record_t *rec = (const temp_cal_record_t *)TEMP_CAL_ADDR;
+    uint32_t depart = (SIM->FCFG1 & SIM_FCFG1_DEPART_MASK) >> SIM_FCFG1_DEPART_SHIFT;
+
+    if (((depart == 0x0U) || (depart == 0xFU)) && TempCal_Valid(rec) &&
+        TempCal_Build(rec->points, rec->count))
+    {
+        return true;
+    }
+
+    (void)TempCal_Build(NULL, 0);
+
+    return false;
+}
+
+/**
+ * @brief Fills the lookup table from reference points.
+ * @details Between two points the curve is linear; beyond the outer points
+ * the outer segments are extended. A single point keeps the nominal slope
+ * and only corrects the offset; no points gives the nominal conversion.
+ * Runs once at boot, so the 64-bit math here costs nothing per sample.
+ * @param points Reference points in strictly increasing raw order.
+ * @param count  Number of points, 0..TEMP_CAL_MAX_POINTS.
+ * @return false if the points are not usable; the table is then nominal.
+ */
+bool TempCal_Build(const temp_cal_point_t *points, uint8_t count)
+{
+    int64_t offset = 0;
+    int64_t x;
+    uint32_t code;
+    uint8_t seg = 0;
+    uint8_t i;
+    bool valid = (count == 0U) || ((points != NULL) && (count <= TEMP_CAL_MAX_POINTS));
+
+    for (i = 1; valid && (i < count); i++)
+    {
+        valid = points[i].raw_q4 > points[i - 1U].raw_q4;
+    }
+    if (!valid)
+    {
+        count = 0;
+    }
+
+    if (count == 1U)
+    {
+        offset = points[0].centi_c -
+                 Temp_FromOversampled(points[0].raw_q4, TEMP_CAL_RAW_FRAC_BITS, TEMP_RES_0C01);
+    }
+
+    for (code = 0; code <= TEMP_CAL_LUT_SIZE; code++)
+    {
+        if (count < 2U)
+        {
+            s_lut[code] = TempCal_Clamp(Temp_FromOversampled(code, 0U, TEMP_RES_0C01) + offset);
+            continue;
+        }
+
+        x = (int64_t)code << TEMP_CAL_RAW_FRAC_BITS;
+        while (((uint32_t)seg + 2U < count) && (x > points[seg + 1U].raw_q4))
+        {
+            seg++;
+        }
+        s_lut[code] = TempCal_Clamp(points[seg].centi_c +
+                                    TempCal_Div((int64_t)(points[seg + 1U].centi_c - points[seg].centi_c) *
+                                                (x - points[seg].raw_q4),
+                                                (int64_t)(points[seg + 1U].raw_q4 - points[seg].raw_q4)));
+    }
+
+    return valid;
+}
+
+/**
+ * @brief Converts one 12-bit ADC sample to calibrated temperature.
+ * @details One table load; other resolutions than 0.01 C add a division
+ * by a constant.
+ * @param raw 12-bit ADC result.
+ * @param res Output resolution.
+ */
+int32_t TempCal_FromRaw(uint16_t raw, temp_resolution_t res)
+{
+    if (raw > TEMP_ADC_MAX_VALUE)
+    {
+        raw = TEMP_ADC_MAX_VALUE;
+    }
+
+    return TempCal_Scale(s_lut[raw], res);
+}
+
+/**
+ * @brief Converts an oversampled ADC result to calibrated temperature.
+ * @details The upper 12 bits index the table and the extra bits
+ * interpolate to the next entry, so the resolution gained by oversampling
+ * is kept: two loads, a multiply and a shift.
+ * @param raw        Result with 12 + extra_bits bits of resolution.
+ * @param extra_bits Bits gained by oversampling, 0..16.
+ * @param res        Output resolution.
+ */
+int32_t TempCal_FromOversampled(uint32_t raw, uint8_t extra_bits, temp_resolution_t res)
+{
+    uint32_t code = raw >> extra_bits;
+    int32_t frac = (int32_t)(raw & ((1UL << extra_bits) - 1U));
+    int32_t lo;
+
+    if (code > TEMP_ADC_MAX_VALUE)
+    {
+        code = TEMP_ADC_MAX_VALUE;
+        frac = 0;
+    }
+
+    lo = s_lut[code];
+    if (frac != 0)
+    {
+        lo += ((((int32_t)s_lut[code + 1U] - lo) * frac) + (1L << (extra_bits - 1U))) >> extra_bits;
+    }
+
+    return TempCal_Scale(lo, res);
+}
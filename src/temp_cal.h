@@ -0,0 +1,67 @@
+/**
+ ******************************************************************************
+ * @file      temp_cal.h
+ * @brief     Per-board temperature calibration: a multi-point correction
+ * table kept in D-Flash, expanded at boot into a lookup table from ADC code
+ * to centi-degrees so a conversion is a table load.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef TEMP_CAL_H_
+#define TEMP_CAL_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "temp_conv.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define TEMP_CAL_MAX_POINTS     8U
+#define TEMP_CAL_MAGIC          0x4C414354UL  // "TCAL"
+#define TEMP_CAL_LUT_SIZE       (TEMP_ADC_MAX_VALUE + 1U)
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief One reference measurement: the ADC reading at a known temperature.
+ */
+typedef struct
+{
+    uint16_t raw_q4;        // ADC code with 4 fraction bits, e.g. an oversampled reading
+    int16_t centi_c;        // Reference temperature in 0.01 C steps
+} temp_cal_point_t;
+
+/**
+ * @brief Calibration record as programmed into the last D-Flash sector.
+ * @details Points are in increasing raw order. checksum is chosen so that
+ * count, every raw_q4 and every centi_c of the used points, summed as
+ * 16-bit words together with it, give 0xFFFF.
+ */
+typedef struct
+{
+    uint32_t magic;         // TEMP_CAL_MAGIC
+    uint8_t count;          // Points used, 1..TEMP_CAL_MAX_POINTS
+    uint8_t reserved;
+    uint16_t checksum;
+    temp_cal_point_t points[TEMP_CAL_MAX_POINTS];
+} temp_cal_record_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+bool TempCal_Init(void);
+bool TempCal_Build(const temp_cal_point_t *points, uint8_t count);
+int32_t TempCal_FromRaw(uint16_t raw, temp_resolution_t res);
+int32_t TempCal_FromOversampled(uint32_t raw, uint8_t extra_bits, temp_resolution_t res);
+
+#endif /* TEMP_CAL_H_ */
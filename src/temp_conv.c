@@ -0,0 +1,112 @@
+/**
+ ******************************************************************************
+ * @file      temp_conv.c
+ * @brief     Fixed-point LM35 temperature conversion (ADC counts to
+ * scaled degrees Celsius) using a precomputed Q16 multiply-shift.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "temp_conv.h"
+#include "perf_cfg.h"
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Returns the Q16 scale for a resolution.
+ * @details A 12-bit sample times the largest scale (~800k for 0.01 C) still
+ * fits in 32 bits together with the rounding term, so no 64-bit math is needed.
+ */
+static uint32_t Temp_Scale(temp_resolution_t res)
+{
+    switch (res)
+    {
+        case TEMP_RES_0C01:
+            return TEMP_SCALE_Q16(100U);
+        case TEMP_RES_0C1:
+            return TEMP_SCALE_Q16(10U);
+        case TEMP_RES_1C:
+        default:
+            return TEMP_SCALE_Q16(1U);
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Converts one ADC sample to temperature.
+ * @param raw 12-bit ADC result.
+ * @param res Output resolution.
+ * @return Temperature in steps of @p res (e.g. 2734 = 27.34 C for TEMP_RES_0C01).
+ */
+int32_t Temp_FromRaw(uint16_t raw, temp_resolution_t res)
+{
+    return (int32_t)((((uint32_t)raw * Temp_Scale(res)) + 0x8000U) >> 16);
+}
+
+/**
+ * @brief Converts an oversampled ADC result to temperature.
+ * @details Uses a 64-bit product (UMULL on the M4), since a 16-bit result
+ * times the 0.01 C scale no longer fits in 32 bits.
+ * @param raw        Result with 12 + extra_bits bits of resolution.
+ * @param extra_bits Bits gained by oversampling (see Sampler_Decimate()).
+ * @param res        Output resolution.
+ * @return Temperature in steps of @p res.
+ */
+PERF_HOT int32_t Temp_FromOversampled(uint32_t raw, uint8_t extra_bits, temp_resolution_t res)
+{
+    const uint32_t shift = 16U + extra_bits;
+
+    return (int32_t)((((uint64_t)raw * Temp_Scale(res)) + (1ULL << (shift - 1U))) >> shift);
+}
+
+/**
+ * @brief Converts a temperature back to the 12-bit ADC count that reads as it.
+ * @details Used to program hardware thresholds with the same scale as the
+ * display. Not on a hot path, so a plain 64-bit division is fine.
+ * @param temp Temperature in steps of @p res.
+ * @param res  Resolution of @p temp.
+ * @return ADC count, saturated to 0..TEMP_ADC_MAX_VALUE.
+ */
+uint16_t Temp_ToRaw(int32_t temp, temp_resolution_t res)
+{
+    const uint64_t den = (uint64_t)TEMP_ADC_VREF_MV * (uint32_t)res;
+    uint64_t raw;
+
+    if (temp <= 0)
+    {
+        return 0;
+    }
+
+    raw = (((uint64_t)temp * (TEMP_ADC_MAX_VALUE * TEMP_LM35_MV_PER_C)) + (den / 2U)) / den;
+
+    return (raw > TEMP_ADC_MAX_VALUE) ? (uint16_t)TEMP_ADC_MAX_VALUE : (uint16_t)raw;
+}
+
+/**
+ * @brief Converts a block of ADC samples to temperature.
+ * @details The scale is looked up once, leaving one multiply, add and shift
+ * per sample.
+ * @param raw   ADC samples.
+ * @param out   Destination for @p count temperatures (may not alias @p raw).
+ * @param count Number of samples.
+ * @param res   Output resolution.
+ */
+void Temp_FromRawBlock(const uint16_t *raw, int32_t *out, uint32_t count, temp_resolution_t res)
+{
+    const uint32_t scale = Temp_Scale(res);
+    uint32_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        out[i] = (int32_t)((((uint32_t)raw[i] * scale) + 0x8000U) >> 16);
+    }
+}
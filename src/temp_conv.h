@@ -0,0 +1,68 @@
+/**
+ ******************************************************************************
+ * @file      temp_conv.h
+ * @brief     Fixed-point LM35 temperature conversion (ADC counts to
+ * scaled degrees Celsius) using a precomputed Q16 multiply-shift.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef TEMP_CONV_H_
+#define TEMP_CONV_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// Analog front end
+#define TEMP_ADC_VREF_MV        5000U  // V-Reference for ADC in millivolts (5V)
+#define TEMP_ADC_MAX_VALUE      4095U  // Max value for a 12-bit ADC
+#define TEMP_LM35_MV_PER_C      10U    // LM35 output slope
+
+/**
+ * @brief Q16 factor turning ADC counts into degrees Celsius times @p div.
+ * @details Evaluated at compile time: (VREF * div / (MAX * slope)) << 16, rounded.
+ */
+#define TEMP_SCALE_Q16(div) \
+    ((uint32_t)((((uint64_t)TEMP_ADC_VREF_MV * (div) << 16) + \
+                 ((TEMP_ADC_MAX_VALUE * TEMP_LM35_MV_PER_C) / 2U)) / \
+                (TEMP_ADC_MAX_VALUE * TEMP_LM35_MV_PER_C)))
+
+/**
+ * @brief ADC counts a temperature change of @p delta / @p div degrees spans,
+ * with @p extra_bits of oversampling; truncated, evaluated at compile time.
+ */
+#define TEMP_TO_RAW_DELTA(delta, div, extra_bits) \
+    ((uint32_t)((((uint64_t)(delta) * TEMP_ADC_MAX_VALUE * TEMP_LM35_MV_PER_C) << (extra_bits)) / \
+                ((uint64_t)TEMP_ADC_VREF_MV * (div))))
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Output resolution; the value is the number of steps per degree.
+ */
+typedef enum
+{
+    TEMP_RES_1C    = 1U,    // Whole degrees
+    TEMP_RES_0C1   = 10U,   // Tenths of a degree
+    TEMP_RES_0C01  = 100U   // Hundredths of a degree
+} temp_resolution_t;
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+int32_t Temp_FromRaw(uint16_t raw, temp_resolution_t res);
+int32_t Temp_FromOversampled(uint32_t raw, uint8_t extra_bits, temp_resolution_t res);
+uint16_t Temp_ToRaw(int32_t temp, temp_resolution_t res);
+void Temp_FromRawBlock(const uint16_t *raw, int32_t *out, uint32_t count, temp_resolution_t res);
+
+#endif /* TEMP_CONV_H_ */
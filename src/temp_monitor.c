@@ -0,0 +1,123 @@
+/**
+ ******************************************************************************
+ * @file      temp_monitor.c
+ * @brief     Threshold monitor: the ADC0 hardware compare window only lets
+ * out-of-range readings raise a conversion complete interrupt.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "temp_monitor.h"
+#include <stddef.h>
+#include "adc_sampler.h"
+#include "clock_gate.h"
+#include "prof.h"
+#include "board_fixed.h"
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static temp_alarm_callback_t s_callback;
+static void *s_param;
+
+// Set while the monitor holds the ADC0 clock
+static bool s_armed;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Enables or disables the conversion complete interrupt on SC1[0].
+ */
+static void TempMon_SetChanInterrupt(bool enable)
+{
+    BoardFixed_AdcSetInterrupt(enable);
+}
+
+/**
+ * @brief ADC0 conversion complete callback: only reached by readings outside the window.
+ */
+static void TempMon_AdcCallback(const uint32_t instance, const uint8_t chanIndex,
+                                const uint16_t result, void *parameter)
+{
+    (void)instance;
+    (void)parameter;
+
+    // First thing, so the handlers ahead of this one are all that is measured
+    Prof_Hist(PROF_HIST_ISR_ADC, Sampler_TriggerAge(Prof_TimestampHz()));
+
+    if ((chanIndex == 0U) && (s_callback != NULL))
+    {
+        s_callback(result, s_param);
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Programs the compare window and arms the out-of-range interrupt.
+ * @details Limits are converted with Temp_ToRaw(), i.e. the same scale as the
+ * display. With ACFGT = 0, ACREN = 1 and CV1 <= CV2 the ADC only sets COCO for
+ * results below CV1 or above CV2, so conversions inside the window never
+ * interrupt the CPU. ADC0 must be set up by Sampler_Init() and must not be
+ * streaming (ADC_Stream_Stop()), since the eDMA would consume the results.
+ * @param low      Lower limit, in steps of @p res.
+ * @param high     Upper limit, in steps of @p res.
+ * @param res      Resolution of the limits.
+ * @param callback Alarm hook, called from interrupt context.
+ * @param param    User parameter for the hook.
+ */
+void TempMon_Start(int32_t low, int32_t high, temp_resolution_t res,
+                   temp_alarm_callback_t callback, void *param)
+{
+    adc_compare_config_t compare;
+
+    if (!s_armed)
+    {
+        ClockGate_Acquire(CLOCK_GATE_ADC0);
+        s_armed = true;
+    }
+    s_callback = callback;
+    s_param = param;
+
+    ADC_DRV_InitHwCompareStruct(&compare);
+    compare.compareEnable = true;
+    compare.compareGreaterThanEnable = false;
+    compare.compareRangeFuncEnable = true;
+    compare.compVal1 = (uint16_t)(Temp_ToRaw(low, res) >> Sampler_ResultShift());
+    compare.compVal2 = (uint16_t)(Temp_ToRaw(high, res) >> Sampler_ResultShift());
+    ADC_DRV_ConfigHwCompare(SAMPLER_ADC_INSTANCE, &compare);
+
+    ADC_DRV_InstallCallback(SAMPLER_ADC_INSTANCE, TempMon_AdcCallback, NULL);
+    TempMon_SetChanInterrupt(true);
+}
+
+/**
+ * @brief Disarms the interrupt and lets every conversion complete again.
+ */
+void TempMon_Stop(void)
+{
+    adc_compare_config_t compare;
+
+    if (!s_armed)
+    {
+        return;
+    }
+
+    TempMon_SetChanInterrupt(false);
+    ADC_DRV_InstallCallback(SAMPLER_ADC_INSTANCE, NULL, NULL);
+
+    ADC_DRV_InitHwCompareStruct(&compare);
+    ADC_DRV_ConfigHwCompare(SAMPLER_ADC_INSTANCE, &compare);
+
+    s_armed = false;
+    ClockGate_Release(CLOCK_GATE_ADC0);
+}
@@ -0,0 +1,39 @@
+/**
+ ******************************************************************************
+ * @file      temp_monitor.h
+ * @brief     Threshold monitor: the ADC0 hardware compare window only lets
+ * out-of-range readings raise a conversion complete interrupt.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef TEMP_MONITOR_H_
+#define TEMP_MONITOR_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include "temp_conv.h"
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Alarm hook, called from the ADC0 interrupt for each out-of-range reading.
+ * @param raw   The 12-bit result that left the window.
+ * @param param User parameter passed to TempMon_Start().
+ */
+typedef void (*temp_alarm_callback_t)(uint16_t raw, void *param);
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+void TempMon_Start(int32_t low, int32_t high, temp_resolution_t res,
+                   temp_alarm_callback_t callback, void *param);
+void TempMon_Stop(void);
+
+#endif /* TEMP_MONITOR_H_ */
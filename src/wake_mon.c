@@ -0,0 +1,195 @@
+/**
+ ******************************************************************************
+ * @file      wake_mon.c
+ * @brief     Wake-on-threshold monitor: LPTMR0 triggers ADC0 through TRGMUX
+ * while the core stays in VLPS, and the hardware compare window only wakes
+ * it for out-of-range temperatures.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include "wake_mon.h"
+#include <stddef.h>
+#include "device_registers.h"
+#include "interrupt_manager.h"
+#include "adc_sampler.h"
+#include "clock_gate.h"
+#include "board_fixed.h"
+#include "irq_prio.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+#define WAKE_MON_LPTMR_PCS_LPO1K    1U   // LPTMR0 PSR[PCS] selecting the 1 kHz LPO
+
+/*============================================================================*/
+/* Private Variables                               */
+/*============================================================================*/
+
+static wake_mon_callback_t s_callback;
+static void *s_param;
+
+// Window limits in result units of the current resolution, as written to CV1/CV2
+static uint16_t s_cv_low;
+static uint16_t s_cv_high;
+
+// Set while every conversion interrupts: from the start until the first
+// in-range reading, and from an out-of-range one until the next in-range one
+static volatile bool s_tracking;
+
+// Set while the monitor holds the ADC0 and LPTMR0 clocks
+static bool s_running;
+
+/*============================================================================*/
+/* Private Function Implementations                       */
+/*============================================================================*/
+
+/**
+ * @brief Arms the compare window, or lets every conversion complete.
+ * @details With ACFGT = 0, ACREN = 1 and CV1 <= CV2 the ADC only sets COCO
+ * for results below CV1 or above CV2, as in TempMon_Start(). Switched from
+ * the ADC0 interrupt, so written straight to the registers.
+ */
+static void WakeMon_SetWindow(bool armed)
+{
+    BoardFixed_AdcSetWindow(armed, s_cv_low, s_cv_high);
+}
+
+/**
+ * @brief ADC0 conversion complete callback.
+ * @details While the window is armed only a reading that left it gets here;
+ * the window is then dropped so the following readings are seen until one
+ * is back inside, which arms it again.
+ */
+static void WakeMon_AdcCallback(const uint32_t instance, const uint8_t chanIndex,
+                                const uint16_t result, void *parameter)
+{
+    bool in_range = (result >= s_cv_low) && (result <= s_cv_high);
+
+    (void)instance;
+    (void)parameter;
+
+    if (chanIndex != 0U)
+    {
+        return;
+    }
+
+    if (s_tracking && in_range)
+    {
+        WakeMon_SetWindow(true);
+        s_tracking = false;
+    }
+    else if (!s_tracking)
+    {
+        WakeMon_SetWindow(false);
+        s_tracking = true;
+    }
+
+    if (s_callback != NULL)
+    {
+        s_callback((uint16_t)(result << Sampler_ResultShift()), in_range, s_param);
+    }
+}
+
+/*============================================================================*/
+/* Public Function Implementations                        */
+/*============================================================================*/
+
+/**
+ * @brief Hands ADC0 to LPTMR0 and starts watching the window.
+ * @details LPTMR0 counts the LPO in VLPS; each compare match pulses its
+ * trigger, which TRGMUX routes to ADC0 as both trigger and pretrigger 0, so
+ * a conversion needs neither the core nor the bus clock. Limits are
+ * converted with Temp_ToRaw(), as for TempMon_Start(). The first reading
+ * is always reported, so the caller starts with a value. ADC0 must be set up
+ * by Sampler_Init() with the sampler and its stream stopped; the profile
+ * applied stays in effect, and with hardware averaging each trigger yields
+ * one averaged result. Pair with Power_Sleep() to stay in VLPS in between.
+ * While the monitor owns ADC0 its interrupt runs at IRQ_PRIO_DMA rather than
+ * IRQ_PRIO_SAMPLING: there is no conversion timing to protect, and the hook
+ * may then post to the scheduler.
+ * @param low       Lower limit, in steps of @p res.
+ * @param high      Upper limit, in steps of @p res.
+ * @param res       Resolution of the limits.
+ * @param period_ms Time between conversions, 1..WAKE_MON_PERIOD_MAX_MS.
+ * @param callback  Reading hook, called from the ADC0 interrupt at IRQ_PRIO_DMA.
+ * @param param     User parameter for the hook.
+ * @return STATUS_ERROR for a period out of range or a locked TRGMUX output.
+ */
+status_t WakeMon_Start(int32_t low, int32_t high, temp_resolution_t res, uint32_t period_ms,
+                       wake_mon_callback_t callback, void *param)
+{
+    if ((period_ms == 0U) || (period_ms > WAKE_MON_PERIOD_MAX_MS) ||
+        ((TRGMUX->TRGMUXn[TRGMUX_ADC0_INDEX] & TRGMUX_TRGMUXn_LK_MASK) != 0U))
+    {
+        return STATUS_ERROR;
+    }
+
+    WakeMon_Stop();
+    ClockGate_Acquire(CLOCK_GATE_ADC0);
+    ClockGate_Acquire(CLOCK_GATE_LPTMR0);
+    s_running = true;
+
+    s_callback = callback;
+    s_param = param;
+    s_cv_low = (uint16_t)(Temp_ToRaw(low, res) >> Sampler_ResultShift());
+    s_cv_high = (uint16_t)(Temp_ToRaw(high, res) >> Sampler_ResultShift());
+    s_tracking = true;
+
+    // The converter setup rewrites SC2, so the trigger goes first, then the window
+    Sampler_SelectTrigger(SAMPLER_TRIGGER_TRGMUX);
+    TRGMUX->TRGMUXn[TRGMUX_ADC0_INDEX] = (TRGMUX->TRGMUXn[TRGMUX_ADC0_INDEX] & ~TRGMUX_TRGMUXn_SEL0_MASK) |
+                                         TRGMUX_TRGMUXn_SEL0(TRGMUX_TRIG_SOURCE_LPTMR0);
+    WakeMon_SetWindow(false);
+    ADC_DRV_InstallCallback(SAMPLER_ADC_INSTANCE, WakeMon_AdcCallback, NULL);
+    INT_SYS_SetPriority(ADC0_IRQn, IRQ_PRIO_DMA);
+    BoardFixed_AdcSetInterrupt(true);
+
+    // Timer mode, counter reset on each match; only the trigger is used, no interrupt
+    LPTMR0->CSR = 0U;
+    LPTMR0->PSR = LPTMR_PSR_PCS(WAKE_MON_LPTMR_PCS_LPO1K) | LPTMR_PSR_PBYP_MASK;
+    LPTMR0->CMR = period_ms - 1U;
+    LPTMR0->CSR = LPTMR_CSR_TEN_MASK;
+
+    return STATUS_SUCCESS;
+}
+
+/**
+ * @brief Stops LPTMR0 and gives ADC0 back to the PDB0 trigger.
+ * @details A conversion in progress is dropped with the ADC0 clock, and the
+ * ADC0 interrupt goes back to IRQ_PRIO_SAMPLING.
+ */
+void WakeMon_Stop(void)
+{
+    if (!s_running)
+    {
+        return;
+    }
+
+    LPTMR0->CSR = 0U;
+    BoardFixed_AdcSetInterrupt(false);
+    ADC_DRV_InstallCallback(SAMPLER_ADC_INSTANCE, NULL, NULL);
+    INT_SYS_SetPriority(ADC0_IRQn, IRQ_PRIO_SAMPLING);
+    Sampler_SelectTrigger(SAMPLER_TRIGGER_PDB);
+    WakeMon_SetWindow(false);
+
+    s_running = false;
+    s_tracking = false;
+    ClockGate_Release(CLOCK_GATE_LPTMR0);
+    ClockGate_Release(CLOCK_GATE_ADC0);
+}
+
+/**
+ * @brief Reports whether every conversion wakes the core.
+ * @details True until the first in-range reading and while the temperature
+ * is out of range; VLPS only saves power once this is false.
+ */
+bool WakeMon_IsTracking(void)
+{
+    return s_tracking;
+}
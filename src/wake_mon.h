@@ -0,0 +1,55 @@
+/**
+ ******************************************************************************
+ * @file      wake_mon.h
+ * @brief     Wake-on-threshold monitor: LPTMR0 triggers ADC0 through TRGMUX
+ * while the core stays in VLPS, and the hardware compare window only wakes
+ * it for out-of-range temperatures.
+ * @author    [Vo Minh Luong]
+ * @date      Oct 17, 2025
+ ******************************************************************************
+ */
+
+#ifndef WAKE_MON_H_
+#define WAKE_MON_H_
+
+/*============================================================================*/
+/* Includes                                   */
+/*============================================================================*/
+#include <stdint.h>
+#include <stdbool.h>
+#include "status.h"
+#include "temp_conv.h"
+
+/*============================================================================*/
+/* Defines                                   */
+/*============================================================================*/
+
+// LPTMR0 counts the 1 kHz LPO with the prescaler bypassed; CMR is 16 bits
+#define WAKE_MON_PERIOD_MAX_MS  65536U
+
+/*============================================================================*/
+/* Types                                   */
+/*============================================================================*/
+
+/**
+ * @brief Reading hook, called from the ADC0 interrupt at IRQ_PRIO_DMA.
+ * @details Called for the reading that leaves the window, for every reading
+ * while it stays out, and for the first one back inside; in-range readings
+ * after that complete in hardware without waking the core. At that level
+ * the hook may call Sched_Post().
+ * @param raw      The result, scaled to 12 bits.
+ * @param in_range true if the reading is inside the window.
+ * @param param    User parameter passed to WakeMon_Start().
+ */
+typedef void (*wake_mon_callback_t)(uint16_t raw, bool in_range, void *param);
+
+/*============================================================================*/
+/* Public Function Prototypes                         */
+/*============================================================================*/
+
+status_t WakeMon_Start(int32_t low, int32_t high, temp_resolution_t res, uint32_t period_ms,
+                       wake_mon_callback_t callback, void *param);
+void WakeMon_Stop(void);
+bool WakeMon_IsTracking(void);
+
+#endif /* WAKE_MON_H_ */
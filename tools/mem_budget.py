@@ -0,0 +1,281 @@
+#!/usr/bin/env python3
+"""Per-module memory report and budget check from a GNU ld map file.
+
+Reads the "Memory Configuration" and "Linker script and memory map" parts
+of the map written by the link step (-Wl,-Map), sums every input section
+into .text (flash only), .data (flash and RAM) and .bss (RAM only) per
+object file, and prints one line per module plus one per memory region.
+Padding and the space an output section reserves itself, such as the
+heap, the stack and the RAM vector table, are listed under the section name
+in brackets.
+
+With --budget, the totals are checked against a budget file:
+
+    region <name> <bytes>                   use of one MEMORY region
+    module <name> <text> <data> <bss>       sizes of one object, '-' for no limit
+
+Sizes are decimal or 0x hex; '#' starts a comment. Modules are named after
+the object file without directory and extension, archive members after
+their archive. An LTO build keeps only the startup code and libraries
+apart and lists the rest as [lto], so there only the region budgets apply.
+The exit status is 1 if any budget is exceeded.
+
+    python3 ../tools/mem_budget.py LCD1602andLM35onS32K144.map --budget ../tools/mem_budget.txt
+"""
+
+import argparse
+import os
+import re
+import sys
+
+# Output sections that take no target memory
+NOLOAD_RE = re.compile(r"^\.(debug|comment|ARM\.attributes|stab|gnu\.attributes)")
+
+REGION_RE = re.compile(r"^(\S+)\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)")
+OUTPUT_RE = re.compile(r"^(\.\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?)?\s*$")
+INPUT_RE = re.compile(r"^ (\S+)(?:\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+(\S.*))?)?\s*$")
+CONT_RE = re.compile(r"^\s+0x([0-9a-fA-F]+)\s+0x([0-9a-fA-F]+)(?:\s+load address 0x([0-9a-fA-F]+))?(?:\s+(\S.*))?\s*$")
+
+KINDS = ("text", "data", "bss")
+
+
+class Region(object):
+    def __init__(self, name, origin, length):
+        self.name = name
+        self.origin = origin
+        self.length = length
+        self.attrs = ""
+        self.used = 0
+
+    def contains(self, addr):
+        return self.origin <= addr < self.origin + self.length
+
+
+class Output(object):
+    def __init__(self, name, addr, size, lma):
+        self.name = name
+        self.addr = addr
+        self.size = size
+        self.lma = lma
+        self.inputs = 0
+
+
+def module_name(path):
+    """Object file to module name: 'lcd' for ./src/lcd.o, 'libc_nano.a' for a member of it."""
+    path = path.strip()
+    member = path.find("(")
+    if member >= 0:
+        path = path[:member]
+    base = os.path.basename(path.replace("\\", "/"))
+    # Link-time optimization merges every LTO object into temporary partitions
+    if ".ltrans" in base:
+        return "[lto]"
+    if base.endswith(".o"):
+        base = base[:-2]
+    return base
+
+
+def parse_map(lines):
+    regions = []
+    outputs = []
+    modules = {}
+    state = None
+    current = None
+    pending_output = None
+    pending_input = None
+
+    def kind_of(section):
+        if section.lma is not None and section.lma != section.addr:
+            return "data"
+        for region in regions:
+            if region.contains(section.addr):
+                return "text" if "x" in region.attrs else "bss"
+        return None
+
+    def add_input(section, size, path):
+        section.inputs += size
+        kind = kind_of(section)
+        if kind is None or size == 0:
+            return
+        # Padding and reserved space, such as the heap and stack, go to the section
+        name = module_name(path) if path else "[%s]" % section.name
+        sizes = modules.setdefault(name, {"text": 0, "data": 0, "bss": 0})
+        sizes[kind] += size
+
+    for raw in lines:
+        line = raw.rstrip("\r\n")
+
+        if line.startswith("Memory Configuration"):
+            state = "regions"
+            continue
+        if line.startswith("Linker script and memory map"):
+            state = "map"
+            continue
+
+        if state == "regions":
+            match = REGION_RE.match(line)
+            if match and match.group(1) not in ("Name", "*default*"):
+                region = Region(match.group(1), int(match.group(2), 16), int(match.group(3), 16))
+                if len(line.split()) > 3:
+                    region.attrs = line.split()[3]
+                regions.append(region)
+            continue
+
+        if state != "map" or not line:
+            continue
+
+        # A long section name puts its address and size on the next line
+        if pending_output is not None or pending_input is not None:
+            match = CONT_RE.match(line)
+            if match:
+                addr, size = int(match.group(1), 16), int(match.group(2), 16)
+                if pending_output is not None:
+                    lma = int(match.group(3), 16) if match.group(3) else None
+                    current = Output(pending_output, addr, size, lma)
+                    outputs.append(current)
+                elif current is not None:
+                    add_input(current, size, match.group(4))
+            pending_output = None
+            pending_input = None
+            if match:
+                continue
+
+        if not line[0].isspace():
+            match = OUTPUT_RE.match(line)
+            if not match:
+                current = None
+                continue
+            if NOLOAD_RE.match(match.group(1)):
+                current = None
+                continue
+            if match.group(2) is None:
+                pending_output = match.group(1)
+                current = None
+                continue
+            lma = int(match.group(4), 16) if match.group(4) else None
+            current = Output(match.group(1), int(match.group(2), 16), int(match.group(3), 16), lma)
+            outputs.append(current)
+            continue
+
+        if current is None:
+            continue
+
+        match = INPUT_RE.match(line)
+        if not match or match.group(1).startswith("*("):
+            continue
+        if match.group(2) is None:
+            # Either a long input section name or a bare linker script statement
+            if match.group(1).startswith(".") or match.group(1) == "COMMON":
+                pending_input = match.group(1)
+            continue
+        add_input(current, int(match.group(3), 16), match.group(4))
+
+    # Space an output section reserves without a fill line in the map
+    for section in outputs:
+        kind = kind_of(section)
+        reserved = section.size - section.inputs
+        if kind is not None and reserved > 0:
+            sizes = modules.setdefault("[%s]" % section.name, {"text": 0, "data": 0, "bss": 0})
+            sizes[kind] += reserved
+
+    # Region use by address, with initialized data counted at its flash copy too
+    for section in outputs:
+        if kind_of(section) is None or section.size == 0:
+            continue
+        for region in regions:
+            if region.contains(section.addr):
+                region.used += section.size
+            if section.lma is not None and section.lma != section.addr and region.contains(section.lma):
+                region.used += section.size
+
+    return regions, modules
+
+
+def parse_size(text, where):
+    if text == "-":
+        return None
+    try:
+        return int(text, 0)
+    except ValueError:
+        raise SystemExit("%s: bad size '%s'" % (where, text))
+
+
+def parse_budget(path):
+    regions = {}
+    modules = {}
+    with open(path) as budget:
+        for number, raw in enumerate(budget, 1):
+            words = raw.split("#", 1)[0].split()
+            where = "%s:%d" % (path, number)
+            if not words:
+                continue
+            if words[0] == "region" and len(words) == 3:
+                regions[words[1]] = parse_size(words[2], where)
+            elif words[0] == "module" and len(words) == 5:
+                modules[words[1]] = dict(zip(KINDS, (parse_size(w, where) for w in words[2:])))
+            else:
+                raise SystemExit("%s: expected 'region <name> <bytes>' or 'module <name> <text> <data> <bss>'" % where)
+    return regions, modules
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.split("\n\n")[0])
+    parser.add_argument("map", help="linker map file")
+    parser.add_argument("--budget", help="budget file to check against")
+    parser.add_argument("--top", type=int, default=0, help="list only the N largest modules")
+    args = parser.parse_args()
+
+    with open(args.map) as map_file:
+        regions, modules = parse_map(map_file)
+    if not regions:
+        raise SystemExit("%s: no memory configuration, not a GNU ld map?" % args.map)
+
+    region_budget, module_budget = parse_budget(args.budget) if args.budget else ({}, {})
+    over = []
+
+    names = sorted(modules, key=lambda n: (-sum(modules[n].values()), n))
+    if args.top > 0:
+        names = names[:args.top]
+
+    print("%-24s %8s %8s %8s %8s" % ("module", "text", "data", "bss", "ram"))
+    for name in names:
+        sizes = modules[name]
+        marks = ""
+        for kind in KINDS:
+            limit = module_budget.get(name, {}).get(kind)
+            if limit is not None and sizes[kind] > limit:
+                over.append("module %s %s %d > %d" % (name, kind, sizes[kind], limit))
+                marks += " !" + kind
+        print("%-24s %8d %8d %8d %8d%s" % (name, sizes["text"], sizes["data"], sizes["bss"],
+                                          sizes["data"] + sizes["bss"], marks))
+
+    total = dict((kind, sum(m[kind] for m in modules.values())) for kind in KINDS)
+    print("%-24s %8d %8d %8d %8d" % ("total", total["text"], total["data"], total["bss"],
+                                     total["data"] + total["bss"]))
+    print("")
+
+    print("%-24s %8s %8s %8s %8s" % ("region", "used", "budget", "length", "free"))
+    for region in regions:
+        limit = region_budget.get(region.name)
+        mark = ""
+        if limit is not None and region.used > limit:
+            over.append("region %s %d > %d" % (region.name, region.used, limit))
+            mark = " !"
+        print("%-24s %8d %8s %8d %8d%s" % (region.name, region.used, "-" if limit is None else limit,
+                                          region.length, region.length - region.used, mark))
+
+    for name in module_budget:
+        if name not in modules:
+            print("note: budgeted module %s is not in the image" % name)
+
+    if over:
+        print("")
+        for entry in over:
+            print("over budget: " + entry)
+        return 1
+
+    return 0
+
+
+if __name__ == "__main__":
+    sys.exit(main())